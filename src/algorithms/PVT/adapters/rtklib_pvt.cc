@@ -834,6 +834,12 @@ Rtklib_Pvt::Rtklib_Pvt(const ConfigurationInterface* configuration,
     // Set maximum clock offset allowed if pvt_output_parameters.enable_rx_clock_correction = false
     pvt_output_parameters.max_obs_block_rx_clock_offset_ms = configuration->property(role + ".max_clock_offset_ms", pvt_output_parameters.max_obs_block_rx_clock_offset_ms);
 
+    // Solve several epochs in parallel when post-processing in Single mode (0 or 1: disabled)
+    pvt_output_parameters.batch_solver_threads = configuration->property(role + ".batch_solver_threads", pvt_output_parameters.batch_solver_threads);
+
+    // Write the RINEX, KML, GPX, GeoJSON and NMEA products from their own threads (0: written by the PVT block)
+    pvt_output_parameters.async_output_queue_size = configuration->property(role + ".async_output_queue_size", pvt_output_parameters.async_output_queue_size);
+
     // make PVT object
     pvt_ = rtklib_make_pvt_gs(in_streams_, pvt_output_parameters, rtk);
     DLOG(INFO) << "pvt(" << pvt_->unique_id() << ")";
@@ -53,8 +53,10 @@
 #include "monitor_pvt_udp_sink.h"
 #include "nmea_printer.h"
 #include "pvt_conf.h"
+#include "pvt_output_pipeline.h"
 #include "rinex_printer.h"
 #include "rtcm_printer.h"
+#include "rtklib_batch_solver.h"
 #include "rtklib_solver.h"
 #include <boost/any.hpp>                   // for any_cast, any
 #include <boost/archive/xml_iarchive.hpp>  // for xml_iarchive
@@ -71,6 +73,7 @@
 #include <cstring>                      // for strerror
 #include <exception>                    // for exception
 #include <fstream>                      // for ofstream
+#include <functional>                   // for function
 #include <iomanip>                      // for put_time, setprecision
 #include <iostream>                     // for operator<<
 #include <locale>                       // for locale
@@ -116,21 +119,6 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
     // Send PVT status to gnss_flowgraph
     this->message_port_register_out(pmt::mp("status"));
 
-    d_mapStringValues["1C"] = evGPS_1C;
-    d_mapStringValues["2S"] = evGPS_2S;
-    d_mapStringValues["L5"] = evGPS_L5;
-    d_mapStringValues["1B"] = evGAL_1B;
-    d_mapStringValues["5X"] = evGAL_5X;
-    d_mapStringValues["E6"] = evGAL_E6;
-    d_mapStringValues["7X"] = evGAL_7X;
-    d_mapStringValues["1G"] = evGLO_1G;
-    d_mapStringValues["2G"] = evGLO_2G;
-    d_mapStringValues["B1"] = evBDS_B1;
-    d_mapStringValues["B2"] = evBDS_B2;
-    d_mapStringValues["B3"] = evBDS_B3;
-    d_mapStringValues["1I"] = evIRN_1I;
-
-
     d_initial_carrier_phase_offset_estimation_rads = std::vector<double>(nchannels, 0.0);
     d_channel_initialized = std::vector<bool>(nchannels, false);
 
@@ -510,6 +498,52 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
             d_user_pvt_solver = d_internal_pvt_solver;
         }
 
+    if (conf_.batch_solver_threads > 1)
+        {
+            // Single point positioning solutions do not depend on the previous epochs,
+            // so a replay can solve several epochs at once
+            if (rtk.opt.mode == PMODE_SINGLE && d_enable_rx_clock_correction == false)
+                {
+                    d_batch_solver = std::make_unique<Rtklib_Batch_Solver>(rtk, static_cast<int32_t>(nchannels), conf_.batch_solver_threads, conf_.pre_2009_file);
+                    d_batch_epochs.reserve(d_batch_solver->max_epochs());
+                }
+            else
+                {
+                    LOG(WARNING) << "PVT.batch_solver_threads requires PVT.positioning_mode=Single and PVT.enable_rx_clock_correction=false. Epochs will be solved one at a time.";
+                }
+        }
+
+    if (conf_.async_output_queue_size > 0)
+        {
+            // Write the products from their own threads, so that a slow disk or port does not stall the receiver
+            d_output_pipeline = std::make_unique<Pvt_Output_Pipeline>(rtk, static_cast<int32_t>(nchannels), conf_.async_output_queue_size);
+            auto add_sink = [this](uint32_t id, const std::string& name) {
+                d_output_pipeline->add_sink(id, name, [this, id](const Pvt_Output& out) {
+                    print_outputs(&out.solution, out.observables, out.rx_time, out.flag_write_RINEX_obs_output, id);
+                });
+            };
+            if (d_kml_output_enabled)
+                {
+                    add_sink(KML_OUTPUT, "KML");
+                }
+            if (d_gpx_output_enabled)
+                {
+                    add_sink(GPX_OUTPUT, "GPX");
+                }
+            if (d_geojson_output_enabled)
+                {
+                    add_sink(GEOJSON_OUTPUT, "GeoJSON");
+                }
+            if (d_nmea_output_file_enabled)
+                {
+                    add_sink(NMEA_OUTPUT, "NMEA");
+                }
+            if (d_rinex_output_enabled)
+                {
+                    add_sink(RINEX_OUTPUT, "RINEX");
+                }
+        }
+
     d_gps_ephemeris_sptr_type_hash_code = typeid(std::shared_ptr<Gps_Ephemeris>).hash_code();
     d_gps_iono_sptr_type_hash_code = typeid(std::shared_ptr<Gps_Iono>).hash_code();
     d_gps_utc_model_sptr_type_hash_code = typeid(std::shared_ptr<Gps_Utc_Model>).hash_code();
@@ -544,6 +578,8 @@ rtklib_pvt_gs::rtklib_pvt_gs(uint32_t nchannels,
 rtklib_pvt_gs::~rtklib_pvt_gs()
 {
     DLOG(INFO) << "PVT block destructor called.";
+    // Write the products still queued before closing the printers
+    d_output_pipeline.reset();
     if (d_sysv_msqid != -1)
         {
             msgctl(d_sysv_msqid, IPC_RMID, nullptr);
@@ -561,7 +597,7 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
                                 {
                                     ofs.open(file_name.c_str(), std::ofstream::trunc | std::ofstream::out);
                                     boost::archive::xml_oarchive xml(ofs);
-                                    xml << boost::serialization::make_nvp("GNSS-SDR_cnav_ephemeris_map", d_internal_pvt_solver->gps_cnav_ephemeris_map);
+                                    xml << boost::serialization::make_nvp("GNSS-SDR_cnav_ephemeris_map", d_internal_pvt_solver->gps_cnav_ephemeris_map.map());
                                     LOG(INFO) << "Saved GPS L2CM or L5 Ephemeris map data";
                                 }
                             catch (const boost::archive::archive_exception& e)
@@ -587,7 +623,7 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
                                 {
                                     ofs.open(file_name.c_str(), std::ofstream::trunc | std::ofstream::out);
                                     boost::archive::xml_oarchive xml(ofs);
-                                    xml << boost::serialization::make_nvp("GNSS-SDR_ephemeris_map", d_internal_pvt_solver->gps_ephemeris_map);
+                                    xml << boost::serialization::make_nvp("GNSS-SDR_ephemeris_map", d_internal_pvt_solver->gps_ephemeris_map.map());
                                     LOG(INFO) << "Saved GPS L1 CA Ephemeris map data";
                                 }
                             catch (const boost::archive::archive_exception& e)
@@ -612,7 +648,7 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
                                 {
                                     ofs.open(file_name.c_str(), std::ofstream::trunc | std::ofstream::out);
                                     boost::archive::xml_oarchive xml(ofs);
-                                    xml << boost::serialization::make_nvp("GNSS-SDR_ephemeris_map", d_internal_pvt_solver->irnss_ephemeris_map);
+                                    xml << boost::serialization::make_nvp("GNSS-SDR_ephemeris_map", d_internal_pvt_solver->irnss_ephemeris_map.map());
                                     LOG(INFO) << "Saved IRNSS L5 CA Ephemeris map data";
                                 }
                             catch (const boost::archive::archive_exception& e)
@@ -638,7 +674,7 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
                                 {
                                     ofs.open(file_name.c_str(), std::ofstream::trunc | std::ofstream::out);
                                     boost::archive::xml_oarchive xml(ofs);
-                                    xml << boost::serialization::make_nvp("GNSS-SDR_gal_ephemeris_map", d_internal_pvt_solver->galileo_ephemeris_map);
+                                    xml << boost::serialization::make_nvp("GNSS-SDR_gal_ephemeris_map", d_internal_pvt_solver->galileo_ephemeris_map.map());
                                     LOG(INFO) << "Saved Galileo E1 Ephemeris map data";
                                 }
                             catch (const boost::archive::archive_exception& e)
@@ -668,7 +704,7 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
                                 {
                                     ofs.open(file_name.c_str(), std::ofstream::trunc | std::ofstream::out);
                                     boost::archive::xml_oarchive xml(ofs);
-                                    xml << boost::serialization::make_nvp("GNSS-SDR_gnav_ephemeris_map", d_internal_pvt_solver->glonass_gnav_ephemeris_map);
+                                    xml << boost::serialization::make_nvp("GNSS-SDR_gnav_ephemeris_map", d_internal_pvt_solver->glonass_gnav_ephemeris_map.map());
                                     LOG(INFO) << "Saved GLONASS GNAV Ephemeris map data";
                                 }
                             catch (const boost::archive::archive_exception& e)
@@ -996,7 +1032,7 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
                                 {
                                     ofs.open(file_name.c_str(), std::ofstream::trunc | std::ofstream::out);
                                     boost::archive::xml_oarchive xml(ofs);
-                                    xml << boost::serialization::make_nvp("GNSS-SDR_gnav_ephemeris_map", d_internal_pvt_solver->glonass_gnav_ephemeris_map);
+                                    xml << boost::serialization::make_nvp("GNSS-SDR_gnav_ephemeris_map", d_internal_pvt_solver->glonass_gnav_ephemeris_map.map());
                                     LOG(INFO) << "Saved GLONASS GNAV ephemeris map data";
                                 }
                             catch (const boost::archive::archive_exception& e)
@@ -1056,7 +1092,7 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
                                 {
                                     ofs.open(file_name.c_str(), std::ofstream::trunc | std::ofstream::out);
                                     boost::archive::xml_oarchive xml(ofs);
-                                    xml << boost::serialization::make_nvp("GNSS-SDR_bds_dnav_ephemeris_map", d_internal_pvt_solver->beidou_dnav_ephemeris_map);
+                                    xml << boost::serialization::make_nvp("GNSS-SDR_bds_dnav_ephemeris_map", d_internal_pvt_solver->beidou_dnav_ephemeris_map.map());
                                     LOG(INFO) << "Saved BeiDou DNAV Ephemeris map data";
                                 }
                             catch (const boost::archive::archive_exception& e)
@@ -1177,6 +1213,7 @@ rtklib_pvt_gs::~rtklib_pvt_gs()
 
 void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
 {
+    clear_ephemeris_if_requested();
     try
         {
             const size_t msg_type_hash_code = pmt::any_ref(msg).type().hash_code();
@@ -1198,16 +1235,16 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                             // d_eph_udp_sink_ptr->write_gps_ephemeris(gps_eph);
                         }
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
-                            if (d_internal_pvt_solver->gps_ephemeris_map.find(gps_eph->PRN) == d_internal_pvt_solver->gps_ephemeris_map.cend())
+                            if (d_internal_pvt_solver->gps_ephemeris_map.find(gps_eph->PRN) == nullptr)
                                 {
                                     new_annotation = true;
                                 }
                             else
                                 {
-                                    if (d_internal_pvt_solver->gps_ephemeris_map[gps_eph->PRN].toe != gps_eph->toe)
+                                    if (d_internal_pvt_solver->gps_ephemeris_map.find(gps_eph->PRN)->toe != gps_eph->toe)
                                         {
                                             new_annotation = true;
                                         }
@@ -1217,13 +1254,13 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Gps_Ephemeris> new_eph;
                                     new_eph[gps_eph->PRN] = *gps_eph;
-                                    d_rp->log_rinex_nav_gps_nav(d_type_of_rx, new_eph);
+                                    log_rinex_nav([this, new_eph]() { d_rp->log_rinex_nav_gps_nav(d_type_of_rx, new_eph); });
                                 }
                         }
-                    d_internal_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
+                    d_internal_pvt_solver->gps_ephemeris_map.set(gps_eph->PRN, *gps_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
-                            d_user_pvt_solver->gps_ephemeris_map[gps_eph->PRN] = *gps_eph;
+                            d_user_pvt_solver->gps_ephemeris_map.set(gps_eph->PRN, *gps_eph);
                         }
                     if (gps_eph->SV_health != 0)
                         {
@@ -1258,16 +1295,16 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                     // ### GPS CNAV message ###
                     const auto gps_cnav_ephemeris = boost::any_cast<std::shared_ptr<Gps_CNAV_Ephemeris>>(pmt::any_ref(msg));
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
-                            if (d_internal_pvt_solver->gps_cnav_ephemeris_map.find(gps_cnav_ephemeris->PRN) == d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
+                            if (d_internal_pvt_solver->gps_cnav_ephemeris_map.find(gps_cnav_ephemeris->PRN) == nullptr)
                                 {
                                     new_annotation = true;
                                 }
                             else
                                 {
-                                    if (d_internal_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->PRN].toe1 != gps_cnav_ephemeris->toe1)
+                                    if (d_internal_pvt_solver->gps_cnav_ephemeris_map.find(gps_cnav_ephemeris->PRN)->toe1 != gps_cnav_ephemeris->toe1)
                                         {
                                             new_annotation = true;
                                         }
@@ -1277,13 +1314,13 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Gps_CNAV_Ephemeris> new_cnav_eph;
                                     new_cnav_eph[gps_cnav_ephemeris->PRN] = *gps_cnav_ephemeris;
-                                    d_rp->log_rinex_nav_gps_cnav(d_type_of_rx, new_cnav_eph);
+                                    log_rinex_nav([this, new_cnav_eph]() { d_rp->log_rinex_nav_gps_cnav(d_type_of_rx, new_cnav_eph); });
                                 }
                         }
-                    d_internal_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->PRN] = *gps_cnav_ephemeris;
+                    d_internal_pvt_solver->gps_cnav_ephemeris_map.set(gps_cnav_ephemeris->PRN, *gps_cnav_ephemeris);
                     if (d_enable_rx_clock_correction == true)
                         {
-                            d_user_pvt_solver->gps_cnav_ephemeris_map[gps_cnav_ephemeris->PRN] = *gps_cnav_ephemeris;
+                            d_user_pvt_solver->gps_cnav_ephemeris_map.set(gps_cnav_ephemeris->PRN, *gps_cnav_ephemeris);
                         }
                     if (gps_cnav_ephemeris->signal_health != 0)
                         {
@@ -1342,16 +1379,16 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                             d_eph_udp_sink_ptr->write_galileo_ephemeris(galileo_eph);
                         }
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
-                            if (d_internal_pvt_solver->galileo_ephemeris_map.find(galileo_eph->PRN) == d_internal_pvt_solver->galileo_ephemeris_map.cend())
+                            if (d_internal_pvt_solver->galileo_ephemeris_map.find(galileo_eph->PRN) == nullptr)
                                 {
                                     new_annotation = true;
                                 }
                             else
                                 {
-                                    if (d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN].toe != galileo_eph->toe)
+                                    if (d_internal_pvt_solver->galileo_ephemeris_map.find(galileo_eph->PRN)->toe != galileo_eph->toe)
                                         {
                                             new_annotation = true;
                                         }
@@ -1361,13 +1398,13 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Galileo_Ephemeris> new_gal_eph;
                                     new_gal_eph[galileo_eph->PRN] = *galileo_eph;
-                                    d_rp->log_rinex_nav_gal_nav(d_type_of_rx, new_gal_eph);
+                                    log_rinex_nav([this, new_gal_eph]() { d_rp->log_rinex_nav_gal_nav(d_type_of_rx, new_gal_eph); });
                                 }
                         }
-                    d_internal_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
+                    d_internal_pvt_solver->galileo_ephemeris_map.set(galileo_eph->PRN, *galileo_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
-                            d_user_pvt_solver->galileo_ephemeris_map[galileo_eph->PRN] = *galileo_eph;
+                            d_user_pvt_solver->galileo_ephemeris_map.set(galileo_eph->PRN, *galileo_eph);
                         }
                     if (((galileo_eph->E1B_HS != 0) || (galileo_eph->E1B_DVS == true)) ||
                         ((galileo_eph->E5a_HS != 0) || (galileo_eph->E5a_DVS == true)) ||
@@ -1461,16 +1498,16 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                << " and Ephemeris IOD in UTC = " << glonass_gnav_eph->compute_GLONASS_time(glonass_gnav_eph->d_t_b)
                                << " from SV = " << glonass_gnav_eph->i_satellite_slot_number;
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
-                            if (d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(glonass_gnav_eph->PRN) == d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
+                            if (d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(glonass_gnav_eph->PRN) == nullptr)
                                 {
                                     new_annotation = true;
                                 }
                             else
                                 {
-                                    if (d_internal_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->PRN].d_t_b != glonass_gnav_eph->d_t_b)
+                                    if (d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(glonass_gnav_eph->PRN)->d_t_b != glonass_gnav_eph->d_t_b)
                                         {
                                             new_annotation = true;
                                         }
@@ -1480,13 +1517,13 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Glonass_Gnav_Ephemeris> new_glo_eph;
                                     new_glo_eph[glonass_gnav_eph->PRN] = *glonass_gnav_eph;
-                                    d_rp->log_rinex_nav_glo_gnav(d_type_of_rx, new_glo_eph);
+                                    log_rinex_nav([this, new_glo_eph]() { d_rp->log_rinex_nav_glo_gnav(d_type_of_rx, new_glo_eph); });
                                 }
                         }
-                    d_internal_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->PRN] = *glonass_gnav_eph;
+                    d_internal_pvt_solver->glonass_gnav_ephemeris_map.set(glonass_gnav_eph->PRN, *glonass_gnav_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
-                            d_user_pvt_solver->glonass_gnav_ephemeris_map[glonass_gnav_eph->PRN] = *glonass_gnav_eph;
+                            d_user_pvt_solver->glonass_gnav_ephemeris_map.set(glonass_gnav_eph->PRN, *glonass_gnav_eph);
                         }
                 }
             else if (msg_type_hash_code == d_glonass_gnav_utc_model_sptr_type_hash_code)
@@ -1524,16 +1561,16 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                << "inserted with Toe=" << bds_dnav_eph->toe << " and BDS Week="
                                << bds_dnav_eph->WN;
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
-                            if (d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(bds_dnav_eph->PRN) == d_internal_pvt_solver->beidou_dnav_ephemeris_map.cend())
+                            if (d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(bds_dnav_eph->PRN) == nullptr)
                                 {
                                     new_annotation = true;
                                 }
                             else
                                 {
-                                    if (d_internal_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->PRN].toc != bds_dnav_eph->toc)
+                                    if (d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(bds_dnav_eph->PRN)->toc != bds_dnav_eph->toc)
                                         {
                                             new_annotation = true;
                                         }
@@ -1543,13 +1580,13 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Beidou_Dnav_Ephemeris> new_bds_eph;
                                     new_bds_eph[bds_dnav_eph->PRN] = *bds_dnav_eph;
-                                    d_rp->log_rinex_nav_bds_dnav(d_type_of_rx, new_bds_eph);
+                                    log_rinex_nav([this, new_bds_eph]() { d_rp->log_rinex_nav_bds_dnav(d_type_of_rx, new_bds_eph); });
                                 }
                         }
-                    d_internal_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->PRN] = *bds_dnav_eph;
+                    d_internal_pvt_solver->beidou_dnav_ephemeris_map.set(bds_dnav_eph->PRN, *bds_dnav_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
-                            d_user_pvt_solver->beidou_dnav_ephemeris_map[bds_dnav_eph->PRN] = *bds_dnav_eph;
+                            d_user_pvt_solver->beidou_dnav_ephemeris_map.set(bds_dnav_eph->PRN, *bds_dnav_eph);
                         }
                     if (bds_dnav_eph->SV_health != 0)
                         {
@@ -1609,16 +1646,16 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                             // d_eph_udp_sink_ptr->write_irnss_ephemeris(irnss_eph);
                         }
                     // update/insert new ephemeris record to the global ephemeris map
-                    if (d_rinex_output_enabled && d_rp->is_rinex_header_written())  // The header is already written, we can now log the navigation message data
+                    if (d_rinex_output_enabled)
                         {
                             bool new_annotation = false;
-                            if (d_internal_pvt_solver->irnss_ephemeris_map.find(irnss_eph->i_satellite_PRN) == d_internal_pvt_solver->irnss_ephemeris_map.cend())
+                            if (d_internal_pvt_solver->irnss_ephemeris_map.find(irnss_eph->i_satellite_PRN) == nullptr)
                                 {
                                     new_annotation = true;
                                 }
                             else
                                 {
-                                    if (d_internal_pvt_solver->irnss_ephemeris_map[irnss_eph->i_satellite_PRN].d_Toe != irnss_eph->d_Toe)
+                                    if (d_internal_pvt_solver->irnss_ephemeris_map.find(irnss_eph->i_satellite_PRN)->d_Toe != irnss_eph->d_Toe)
                                         {
                                             new_annotation = true;
                                         }
@@ -1628,13 +1665,13 @@ void rtklib_pvt_gs::msg_handler_telemetry(const pmt::pmt_t& msg)
                                     // New record!
                                     std::map<int32_t, Irnss_Ephemeris> new_eph;
                                     new_eph[irnss_eph->i_satellite_PRN] = *irnss_eph;
-                                    d_rp->log_rinex_nav_irnss_nav(d_type_of_rx, new_eph);
+                                    log_rinex_nav([this, new_eph]() { d_rp->log_rinex_nav_irnss_nav(d_type_of_rx, new_eph); });
                                 }
                         }
-                    d_internal_pvt_solver->irnss_ephemeris_map[irnss_eph->i_satellite_PRN] = *irnss_eph;
+                    d_internal_pvt_solver->irnss_ephemeris_map.set(irnss_eph->i_satellite_PRN, *irnss_eph);
                     if (d_enable_rx_clock_correction == true)
                         {
-                            d_user_pvt_solver->irnss_ephemeris_map[irnss_eph->i_satellite_PRN] = *irnss_eph;
+                            d_user_pvt_solver->irnss_ephemeris_map.set(irnss_eph->i_satellite_PRN, *irnss_eph);
                         }
                     // if (gps_eph->SV_health != 0)
                     //     {
@@ -1698,12 +1735,12 @@ void rtklib_pvt_gs::msg_handler_has_data(const pmt::pmt_t& msg) const
 
 std::map<int, Gps_Ephemeris> rtklib_pvt_gs::get_gps_ephemeris_map() const
 {
-    return d_internal_pvt_solver->gps_ephemeris_map;
+    return *d_internal_pvt_solver->gps_ephemeris_map.snapshot();
 }
 
 std::map<int, Irnss_Ephemeris> rtklib_pvt_gs::get_irnss_ephemeris_map() const
 {
-    return d_internal_pvt_solver->irnss_ephemeris_map;
+    return *d_internal_pvt_solver->irnss_ephemeris_map.snapshot();
 }
 
 std::map<int, Gps_Almanac> rtklib_pvt_gs::get_gps_almanac_map() const
@@ -1714,7 +1751,7 @@ std::map<int, Gps_Almanac> rtklib_pvt_gs::get_gps_almanac_map() const
 
 std::map<int, Galileo_Ephemeris> rtklib_pvt_gs::get_galileo_ephemeris_map() const
 {
-    return d_internal_pvt_solver->galileo_ephemeris_map;
+    return *d_internal_pvt_solver->galileo_ephemeris_map.snapshot();
 }
 
 
@@ -1726,7 +1763,7 @@ std::map<int, Galileo_Almanac> rtklib_pvt_gs::get_galileo_almanac_map() const
 
 std::map<int, Beidou_Dnav_Ephemeris> rtklib_pvt_gs::get_beidou_dnav_ephemeris_map() const
 {
-    return d_internal_pvt_solver->beidou_dnav_ephemeris_map;
+    return *d_internal_pvt_solver->beidou_dnav_ephemeris_map.snapshot();
 }
 
 
@@ -1738,6 +1775,16 @@ std::map<int, Beidou_Dnav_Almanac> rtklib_pvt_gs::get_beidou_dnav_almanac_map()
 
 void rtklib_pvt_gs::clear_ephemeris()
 {
+    d_clear_ephemeris_requested = true;
+}
+
+
+void rtklib_pvt_gs::clear_ephemeris_if_requested()
+{
+    if (!d_clear_ephemeris_requested.exchange(false))
+        {
+            return;
+        }
     d_internal_pvt_solver->gps_ephemeris_map.clear();
     d_internal_pvt_solver->irnss_ephemeris_map.clear();
 
@@ -1893,40 +1940,40 @@ void rtklib_pvt_gs::apply_rx_clock_offset(std::map<int, Gnss_Synchro>& observabl
             observables_iter->second.RX_time -= rx_clock_offset_s;
             observables_iter->second.Pseudorange_m -= rx_clock_offset_s * SPEED_OF_LIGHT_M_S;
 
-            switch (d_mapStringValues[observables_iter->second.Signal])
+            switch (observables_iter->second.signal_id())
                 {
-                case evGPS_1C:
-                case evSBAS_1C:
-                case evGAL_1B:
+                case Gnss_Signal_Id::GPS_1C:
+                case Gnss_Signal_Id::SBAS_1C:
+                case Gnss_Signal_Id::GAL_1B:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ1 * TWO_PI;
                     break;
-                case evGPS_L5:
-                case evIRN_1I:
-                case evGAL_5X:
+                case Gnss_Signal_Id::GPS_L5:
+                case Gnss_Signal_Id::IRN_1I:
+                case Gnss_Signal_Id::GAL_5X:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ5 * TWO_PI;
                     break;
-                case evGAL_E6:
+                case Gnss_Signal_Id::GAL_E6:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ6 * TWO_PI;
                     break;
-                case evGAL_7X:
+                case Gnss_Signal_Id::GAL_7X:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ7 * TWO_PI;
                     break;
-                case evGPS_2S:
+                case Gnss_Signal_Id::GPS_2S:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ2 * TWO_PI;
                     break;
-                case evBDS_B3:
+                case Gnss_Signal_Id::BDS_B3:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ3_BDS * TWO_PI;
                     break;
-                case evGLO_1G:
+                case Gnss_Signal_Id::GLO_1G:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ1_GLO * TWO_PI;
                     break;
-                case evGLO_2G:
+                case Gnss_Signal_Id::GLO_2G:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ2_GLO * TWO_PI;
                     break;
-                case evBDS_B1:
+                case Gnss_Signal_Id::BDS_B1:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ1_BDS * TWO_PI;
                     break;
-                case evBDS_B2:
+                case Gnss_Signal_Id::BDS_B2:
                     observables_iter->second.Carrier_phase_rads -= rx_clock_offset_s * FREQ2_BDS * TWO_PI;
                     break;
                 default:
@@ -1996,40 +2043,40 @@ void rtklib_pvt_gs::initialize_and_apply_carrier_phase_offset()
             if (d_channel_initialized.at(observables_iter->second.Channel_ID) == false)
                 {
                     double wavelength_m = 0;
-                    switch (d_mapStringValues[observables_iter->second.Signal])
+                    switch (observables_iter->second.signal_id())
                         {
-                        case evGPS_1C:
-                        case evSBAS_1C:
-                        case evGAL_1B:
+                        case Gnss_Signal_Id::GPS_1C:
+                        case Gnss_Signal_Id::SBAS_1C:
+                        case Gnss_Signal_Id::GAL_1B:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ1;
                             break;
-                        case evGPS_L5:
-                        case evIRN_1I:
-                        case evGAL_5X:
+                        case Gnss_Signal_Id::GPS_L5:
+                        case Gnss_Signal_Id::IRN_1I:
+                        case Gnss_Signal_Id::GAL_5X:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ5;
                             break;
-                        case evGAL_E6:
+                        case Gnss_Signal_Id::GAL_E6:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ6;
                             break;
-                        case evGAL_7X:
+                        case Gnss_Signal_Id::GAL_7X:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ7;
                             break;
-                        case evGPS_2S:
+                        case Gnss_Signal_Id::GPS_2S:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ2;
                             break;
-                        case evBDS_B3:
+                        case Gnss_Signal_Id::BDS_B3:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ3_BDS;
                             break;
-                        case evGLO_1G:
+                        case Gnss_Signal_Id::GLO_1G:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ1_GLO;
                             break;
-                        case evGLO_2G:
+                        case Gnss_Signal_Id::GLO_2G:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ2_GLO;
                             break;
-                        case evBDS_B1:
+                        case Gnss_Signal_Id::BDS_B1:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ1_BDS;
                             break;
-                        case evBDS_B2:
+                        case Gnss_Signal_Id::BDS_B2:
                             wavelength_m = SPEED_OF_LIGHT_M_S / FREQ2_BDS;
                             break;
                         default:
@@ -2049,15 +2096,10 @@ void rtklib_pvt_gs::initialize_and_apply_carrier_phase_offset()
 int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_items,
     gr_vector_void_star& output_items __attribute__((unused)))
 {
+    clear_ephemeris_if_requested();
     for (int32_t epoch = 0; epoch < noutput_items; epoch++)
         {
-            bool flag_display_pvt = false;
             bool flag_compute_pvt_output = false;
-            bool flag_write_RTCM_1019_output = false;
-            bool flag_write_RTCM_1020_output = false;
-            bool flag_write_RTCM_1045_output = false;
-            bool flag_write_RTCM_MSM_output = false;
-            bool flag_write_RINEX_obs_output = false;
 
             d_gnss_observables_map.clear();
             const auto** in = reinterpret_cast<const Gnss_Synchro**>(&input_items[0]);  // Get the input buffer pointer
@@ -2066,66 +2108,88 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                 {
                     if (in[i][epoch].Flag_valid_pseudorange)
                         {
-                            const auto tmp_eph_iter_gps = d_internal_pvt_solver->gps_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_irnss = d_internal_pvt_solver->irnss_ephemeris_map.find(in[i][epoch].PRN);
-
-                            const auto tmp_eph_iter_gal = d_internal_pvt_solver->galileo_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_cnav = d_internal_pvt_solver->gps_cnav_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_glo_gnav = d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(in[i][epoch].PRN);
-                            const auto tmp_eph_iter_bds_dnav = d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(in[i][epoch].PRN);
-
+                            // Only the ephemeris of the system of the observable are looked up
+                            const Gps_Ephemeris* gps_eph = nullptr;
+                            const Gps_CNAV_Ephemeris* gps_cnav_eph = nullptr;
+                            const Galileo_Ephemeris* gal_eph = nullptr;
+                            const Glonass_Gnav_Ephemeris* glo_gnav_eph = nullptr;
                             bool store_valid_observable = false;
-
-                            if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_gps->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (std::string(in[i][epoch].Signal) == std::string("1C")) && (tmp_eph_iter_gps->second.SV_health == 0))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_irnss != d_internal_pvt_solver->irnss_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_irnss->second.i_satellite_PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (std::string(in[i][epoch].Signal) == std::string("1I")) && (tmp_eph_iter_gps->second.SV_health == 0))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_gal->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) &&
-                                        (((std::string(in[i][epoch].Signal) == std::string("1B")) && (tmp_eph_iter_gal->second.E1B_DVS == false) && (tmp_eph_iter_gal->second.E1B_HS == 0)) ||
-                                            ((std::string(in[i][epoch].Signal) == std::string("5X")) && (tmp_eph_iter_gal->second.E5a_DVS == false) && (tmp_eph_iter_gal->second.E5a_HS == 0)) ||
-                                            ((std::string(in[i][epoch].Signal) == std::string("7X")) && (tmp_eph_iter_gal->second.E5b_DVS == false) && (tmp_eph_iter_gal->second.E5b_HS == 0))))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_cnav->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (((std::string(in[i][epoch].Signal) == std::string("2S")) || (std::string(in[i][epoch].Signal) == std::string("L5"))) && (tmp_eph_iter_cnav->second.signal_health == 0)))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_glo_gnav->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && ((std::string(in[i][epoch].Signal) == std::string("1G")) || (std::string(in[i][epoch].Signal) == std::string("2G"))))
-                                        {
-                                            store_valid_observable = true;
-                                        }
-                                }
-                            if (tmp_eph_iter_bds_dnav != d_internal_pvt_solver->beidou_dnav_ephemeris_map.cend())
-                                {
-                                    const uint32_t prn_aux = tmp_eph_iter_bds_dnav->second.PRN;
-                                    if ((prn_aux == in[i][epoch].PRN) && (((std::string(in[i][epoch].Signal) == std::string("B1")) || (std::string(in[i][epoch].Signal) == std::string("B3"))) && (tmp_eph_iter_bds_dnav->second.SV_health == 0)))
-                                        {
-                                            store_valid_observable = true;
-                                        }
+                            const Gnss_Signal_Id signal_id = in[i][epoch].signal_id();
+                            switch (in[i][epoch].System)
+                                {
+                                case 'G':
+                                    {
+                                        gps_eph = d_internal_pvt_solver->gps_ephemeris_map.find(in[i][epoch].PRN);
+                                        if (gps_eph != nullptr)
+                                            {
+                                                if ((gps_eph->PRN == in[i][epoch].PRN) && (signal_id == Gnss_Signal_Id::GPS_1C) && (gps_eph->SV_health == 0))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                            }
+                                        gps_cnav_eph = d_internal_pvt_solver->gps_cnav_ephemeris_map.find(in[i][epoch].PRN);
+                                        if (gps_cnav_eph != nullptr)
+                                            {
+                                                if ((gps_cnav_eph->PRN == in[i][epoch].PRN) && ((signal_id == Gnss_Signal_Id::GPS_2S) || (signal_id == Gnss_Signal_Id::GPS_L5)) && (gps_cnav_eph->signal_health == 0))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                            }
+                                        break;
+                                    }
+                                case 'E':
+                                    {
+                                        gal_eph = d_internal_pvt_solver->galileo_ephemeris_map.find(in[i][epoch].PRN);
+                                        if (gal_eph != nullptr)
+                                            {
+                                                if ((gal_eph->PRN == in[i][epoch].PRN) &&
+                                                    (((signal_id == Gnss_Signal_Id::GAL_1B) && (gal_eph->E1B_DVS == false) && (gal_eph->E1B_HS == 0)) ||
+                                                        ((signal_id == Gnss_Signal_Id::GAL_5X) && (gal_eph->E5a_DVS == false) && (gal_eph->E5a_HS == 0)) ||
+                                                        ((signal_id == Gnss_Signal_Id::GAL_7X) && (gal_eph->E5b_DVS == false) && (gal_eph->E5b_HS == 0))))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                            }
+                                        break;
+                                    }
+                                case 'R':
+                                    {
+                                        glo_gnav_eph = d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(in[i][epoch].PRN);
+                                        if (glo_gnav_eph != nullptr)
+                                            {
+                                                if ((glo_gnav_eph->PRN == in[i][epoch].PRN) && ((signal_id == Gnss_Signal_Id::GLO_1G) || (signal_id == Gnss_Signal_Id::GLO_2G)))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                            }
+                                        break;
+                                    }
+                                case 'C':
+                                    {
+                                        const Beidou_Dnav_Ephemeris* bds_dnav_eph = d_internal_pvt_solver->beidou_dnav_ephemeris_map.find(in[i][epoch].PRN);
+                                        if (bds_dnav_eph != nullptr)
+                                            {
+                                                if ((bds_dnav_eph->PRN == in[i][epoch].PRN) && ((signal_id == Gnss_Signal_Id::BDS_B1) || (signal_id == Gnss_Signal_Id::BDS_B3)) && (bds_dnav_eph->SV_health == 0))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                            }
+                                        break;
+                                    }
+                                case 'I':
+                                    {
+                                        const Irnss_Ephemeris* irnss_eph = d_internal_pvt_solver->irnss_ephemeris_map.find(in[i][epoch].PRN);
+                                        if (irnss_eph != nullptr)
+                                            {
+                                                if ((irnss_eph->i_satellite_PRN == in[i][epoch].PRN) && (signal_id == Gnss_Signal_Id::IRN_1I) && (irnss_eph->i_SV_health == 0))
+                                                    {
+                                                        store_valid_observable = true;
+                                                    }
+                                            }
+                                        break;
+                                    }
+                                default:
+                                    break;
                                 }
 
                             if (store_valid_observable)
@@ -2138,42 +2202,22 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                                 {
                                     try
                                         {
-                                            if (d_internal_pvt_solver->gps_ephemeris_map.empty() == false)
+                                            // keep track of locking time
+                                            if (gps_eph != nullptr)
                                                 {
-                                                    if (tmp_eph_iter_gps != d_internal_pvt_solver->gps_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->gps_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(*gps_eph, in[i][epoch].RX_time, in[i][epoch]);
                                                 }
-
-                                            if (d_internal_pvt_solver->irnss_ephemeris_map.empty() == false)
-                                                {
-                                                    if (tmp_eph_iter_irnss != d_internal_pvt_solver->irnss_ephemeris_map.cend())
-                                                        {
-                                                            // d_rtcm_printer->lock_time(d_internal_pvt_solver->irnss_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
-                                                }
-
-                                            if (d_internal_pvt_solver->galileo_ephemeris_map.empty() == false)
+                                            if (gal_eph != nullptr)
                                                 {
-                                                    if (tmp_eph_iter_gal != d_internal_pvt_solver->galileo_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->galileo_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(*gal_eph, in[i][epoch].RX_time, in[i][epoch]);
                                                 }
-                                            if (d_internal_pvt_solver->gps_cnav_ephemeris_map.empty() == false)
+                                            if (gps_cnav_eph != nullptr)
                                                 {
-                                                    if (tmp_eph_iter_cnav != d_internal_pvt_solver->gps_cnav_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->gps_cnav_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(*gps_cnav_eph, in[i][epoch].RX_time, in[i][epoch]);
                                                 }
-                                            if (d_internal_pvt_solver->glonass_gnav_ephemeris_map.empty() == false)
+                                            if (glo_gnav_eph != nullptr)
                                                 {
-                                                    if (tmp_eph_iter_glo_gnav != d_internal_pvt_solver->glonass_gnav_ephemeris_map.cend())
-                                                        {
-                                                            d_rtcm_printer->lock_time(d_internal_pvt_solver->glonass_gnav_ephemeris_map.find(in[i][epoch].PRN)->second, in[i][epoch].RX_time, in[i][epoch]);  // keep track of locking time
-                                                        }
+                                                    d_rtcm_printer->lock_time(*glo_gnav_eph, in[i][epoch].RX_time, in[i][epoch]);
                                                 }
                                         }
                                     catch (const boost::exception& ex)
@@ -2195,6 +2239,19 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                 }
 
             // ############ 2 COMPUTE THE PVT ################################
+            if (d_batch_solver != nullptr)
+                {
+                    if (d_gnss_observables_map.empty() == false)
+                        {
+                            d_batch_epochs.push_back(std::move(d_gnss_observables_map));
+                            if (d_batch_epochs.size() == d_batch_solver->max_epochs())
+                                {
+                                    solve_batch();
+                                }
+                        }
+                    continue;
+                }
+
             bool flag_pvt_valid = false;
             if (d_gnss_observables_map.empty() == false)
                 {
@@ -2272,230 +2329,350 @@ int rtklib_pvt_gs::work(int noutput_items, gr_vector_const_void_star& input_item
                             flag_pvt_valid = d_user_pvt_solver->get_PVT(d_gnss_observables_map, false);
                         }
 
-                    if (flag_pvt_valid == true)
+                    output_solution(d_user_pvt_solver.get(), flag_pvt_valid, current_RX_time_ms);
+                }
+        }
+
+    if (d_batch_solver != nullptr)
+        {
+            // Do not keep epochs waiting for navigation data received after them
+            solve_batch();
+        }
+
+    return noutput_items;
+}
+
+
+void rtklib_pvt_gs::solve_batch()
+{
+    if (d_batch_epochs.empty())
+        {
+            return;
+        }
+    d_batch_solver->update_navigation_data(*d_user_pvt_solver);
+    d_batch_solver->solve(d_batch_epochs);
+    for (size_t i = 0; i < d_batch_epochs.size(); i++)
+        {
+            Rtklib_Solver* solver = d_batch_solver->solver(i);
+            bool flag_pvt_valid = d_batch_solver->is_valid(i);
+            d_gnss_observables_map = std::move(d_batch_epochs[i]);
+            d_rx_time = d_gnss_observables_map.cbegin()->second.RX_time;
+            const auto current_RX_time_ms = static_cast<uint32_t>(d_rx_time * 1000.0);
+            if (flag_pvt_valid)
+                {
+                    d_user_pvt_solver->dump_solution(*solver);
+                    const double Rx_clock_offset_s = solver->get_time_offset_s();
+                    if (fabs(Rx_clock_offset_s) * 1000.0 > d_max_obs_block_rx_clock_offset_ms)
                         {
-                            // initialize (if needed) the accumulated phase offset and apply it to the active channels
-                            // required to report accumulated phase cycles comparable to pseudoranges
-                            initialize_and_apply_carrier_phase_offset();
+                            if (!d_waiting_obs_block_rx_clock_offset_correction_msg)
+                                {
+                                    this->message_port_pub(pmt::mp("pvt_to_observables"), pmt::make_any(Rx_clock_offset_s));
+                                    d_waiting_obs_block_rx_clock_offset_correction_msg = true;
+                                    LOG(INFO) << "Sent clock offset correction to observables: " << Rx_clock_offset_s << "[s]";
+                                }
+                            flag_pvt_valid = false;
+                        }
+                }
+            output_solution(solver, flag_pvt_valid, current_RX_time_ms);
+        }
+    // Leave the last solution in the main solver, as solving one epoch at a
+    // time does, so that get_latest_PVT() reports it
+    d_user_pvt_solver->copy_solution(*d_batch_solver->solver(d_batch_epochs.size() - 1));
+    d_batch_epochs.clear();
+}
+
+
+void rtklib_pvt_gs::output_solution(Rtklib_Solver* solver, bool flag_pvt_valid, uint32_t current_RX_time_ms)
+{
+    bool flag_display_pvt = false;
+    bool flag_write_RTCM_1019_output = false;
+    bool flag_write_RTCM_1020_output = false;
+    bool flag_write_RTCM_1045_output = false;
+    bool flag_write_RTCM_MSM_output = false;
+    bool flag_write_RINEX_obs_output = false;
+
+    if (flag_pvt_valid == true)
+        {
+            // initialize (if needed) the accumulated phase offset and apply it to the active channels
+            // required to report accumulated phase cycles comparable to pseudoranges
+            initialize_and_apply_carrier_phase_offset();
 
-                            const double Rx_clock_offset_s = d_user_pvt_solver->get_time_offset_s();
-                            if (d_enable_rx_clock_correction == true && fabs(Rx_clock_offset_s) > 0.000001)  // 1us !!
+            const double Rx_clock_offset_s = solver->get_time_offset_s();
+            if (d_enable_rx_clock_correction == true && fabs(Rx_clock_offset_s) > 0.000001)  // 1us !!
+                {
+                    LOG(INFO) << "Warning: Rx clock offset at interpolated RX time: " << Rx_clock_offset_s * 1000.0 << "[ms]"
+                              << " at RX time: " << static_cast<uint32_t>(d_rx_time * 1000.0) << " [ms]";
+                }
+            else
+                {
+                    DLOG(INFO) << "Rx clock offset at interpolated RX time: " << Rx_clock_offset_s * 1000.0 << "[s]"
+                               << " at RX time: " << static_cast<uint32_t>(d_rx_time * 1000.0) << " [ms]";
+                    // Optional debug code: export observables snapshot for rtklib unit testing
+                    // std::cout << "step 1: save gnss_synchro map\n";
+                    // save_gnss_synchro_map_xml("./gnss_synchro_map.xml");
+                    // getchar(); // stop the execution
+                    // end debug
+                    if (d_display_rate_ms != 0)
+                        {
+                            if (current_RX_time_ms % d_display_rate_ms == 0)
                                 {
-                                    LOG(INFO) << "Warning: Rx clock offset at interpolated RX time: " << Rx_clock_offset_s * 1000.0 << "[ms]"
-                                              << " at RX time: " << static_cast<uint32_t>(d_rx_time * 1000.0) << " [ms]";
+                                    flag_display_pvt = true;
                                 }
-                            else
+                        }
+                    if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                        {
+                            if (current_RX_time_ms % d_rtcm_MT1019_rate_ms == 0)
                                 {
-                                    DLOG(INFO) << "Rx clock offset at interpolated RX time: " << Rx_clock_offset_s * 1000.0 << "[s]"
-                                               << " at RX time: " << static_cast<uint32_t>(d_rx_time * 1000.0) << " [ms]";
-                                    // Optional debug code: export observables snapshot for rtklib unit testing
-                                    // std::cout << "step 1: save gnss_synchro map\n";
-                                    // save_gnss_synchro_map_xml("./gnss_synchro_map.xml");
-                                    // getchar(); // stop the execution
-                                    // end debug
-                                    if (d_display_rate_ms != 0)
-                                        {
-                                            if (current_RX_time_ms % d_display_rate_ms == 0)
-                                                {
-                                                    flag_display_pvt = true;
-                                                }
-                                        }
-                                    if (d_rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                        {
-                                            if (current_RX_time_ms % d_rtcm_MT1019_rate_ms == 0)
-                                                {
-                                                    flag_write_RTCM_1019_output = true;
-                                                }
-                                        }
-                                    if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
-                                        {
-                                            if (current_RX_time_ms % d_rtcm_MT1020_rate_ms == 0)
-                                                {
-                                                    flag_write_RTCM_1020_output = true;
-                                                }
-                                        }
-                                    if (d_rtcm_MT1045_rate_ms != 0)
-                                        {
-                                            if (current_RX_time_ms % d_rtcm_MT1045_rate_ms == 0)
-                                                {
-                                                    flag_write_RTCM_1045_output = true;
-                                                }
-                                        }
-                                    // TODO: RTCM 1077, 1087 and 1097 are not used, so, disable the output rates
-                                    // if (current_RX_time_ms % d_rtcm_MT1077_rate_ms==0 && d_rtcm_MT1077_rate_ms != 0)
-                                    //     {
-                                    //         last_RTCM_1077_output_time = current_RX_time;
-                                    //     }
-                                    // if (current_RX_time_ms % d_rtcm_MT1087_rate_ms==0 && d_rtcm_MT1087_rate_ms != 0)
-                                    //     {
-                                    //         last_RTCM_1087_output_time = current_RX_time;
-                                    //     }
-                                    // if (current_RX_time_ms % d_rtcm_MT1097_rate_ms==0 && d_rtcm_MT1097_rate_ms != 0)
-                                    //     {
-                                    //         last_RTCM_1097_output_time = current_RX_time;
-                                    //     }
-                                    if (d_rtcm_MSM_rate_ms != 0)
-                                        {
-                                            if (current_RX_time_ms % d_rtcm_MSM_rate_ms == 0)
-                                                {
-                                                    flag_write_RTCM_MSM_output = true;
-                                                }
-                                        }
-                                    if (d_rinexobs_rate_ms != 0)
-                                        {
-                                            if (current_RX_time_ms % static_cast<uint32_t>(d_rinexobs_rate_ms) == 0)
-                                                {
-                                                    flag_write_RINEX_obs_output = true;
-                                                }
-                                        }
-
-                                    if (d_first_fix == true)
-                                        {
-                                            if (d_show_local_time_zone)
-                                                {
-                                                    const boost::posix_time::ptime time_first_solution = d_user_pvt_solver->get_position_UTC_time() + d_utc_diff_time;
-                                                    std::cout << "First position fix at " << time_first_solution << d_local_time_str;
-                                                }
-                                            else
-                                                {
-                                                    std::cout << "First position fix at " << d_user_pvt_solver->get_position_UTC_time() << " UTC";
-                                                }
-                                            std::cout << " is Lat = " << d_user_pvt_solver->get_latitude() << " [deg], Long = " << d_user_pvt_solver->get_longitude()
-                                                      << " [deg], Height= " << d_user_pvt_solver->get_height() << " [m]\n";
-                                            d_ttff_msgbuf ttff;
-                                            ttff.mtype = 1;
-                                            d_end = std::chrono::system_clock::now();
-                                            std::chrono::duration<double> elapsed_seconds = d_end - d_start;
-                                            ttff.ttff = elapsed_seconds.count();
-                                            send_sys_v_ttff_msg(ttff);
-                                            d_first_fix = false;
-                                        }
-                                    if (d_kml_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_kml_rate_ms == 0)
-                                                {
-                                                    d_kml_dump->print_position(d_user_pvt_solver.get(), false);
-                                                }
-                                        }
-                                    if (d_gpx_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_gpx_rate_ms == 0)
-                                                {
-                                                    d_gpx_dump->print_position(d_user_pvt_solver.get(), false);
-                                                }
-                                        }
-                                    if (d_geojson_output_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_geojson_rate_ms == 0)
-                                                {
-                                                    d_geojson_printer->print_position(d_user_pvt_solver.get(), false);
-                                                }
-                                        }
-                                    if (d_nmea_output_file_enabled)
-                                        {
-                                            if (current_RX_time_ms % d_nmea_rate_ms == 0)
-                                                {
-                                                    d_nmea_printer->Print_Nmea_Line(d_user_pvt_solver.get(), false);
-                                                }
-                                        }
-                                    if (d_rinex_output_enabled)
-                                        {
-                                            d_rp->print_rinex_annotation(d_user_pvt_solver.get(), d_gnss_observables_map, d_rx_time, d_type_of_rx, flag_write_RINEX_obs_output);
-                                        }
-                                    if (d_rtcm_enabled)
-                                        {
-                                            d_rtcm_printer->Print_Rtcm_Messages(d_user_pvt_solver.get(),
-                                                d_gnss_observables_map,
-                                                d_rx_time,
-                                                d_type_of_rx,
-                                                d_rtcm_MSM_rate_ms,
-                                                d_rtcm_MT1019_rate_ms,
-                                                d_rtcm_MT1020_rate_ms,
-                                                d_rtcm_MT1045_rate_ms,
-                                                d_rtcm_MT1077_rate_ms,
-                                                d_rtcm_MT1097_rate_ms,
-                                                flag_write_RTCM_MSM_output,
-                                                flag_write_RTCM_1019_output,
-                                                flag_write_RTCM_1020_output,
-                                                flag_write_RTCM_1045_output,
-                                                d_enable_rx_clock_correction);
-                                        }
+                                    flag_write_RTCM_1019_output = true;
+                                }
+                        }
+                    if (d_rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
+                        {
+                            if (current_RX_time_ms % d_rtcm_MT1020_rate_ms == 0)
+                                {
+                                    flag_write_RTCM_1020_output = true;
+                                }
+                        }
+                    if (d_rtcm_MT1045_rate_ms != 0)
+                        {
+                            if (current_RX_time_ms % d_rtcm_MT1045_rate_ms == 0)
+                                {
+                                    flag_write_RTCM_1045_output = true;
+                                }
+                        }
+                    // TODO: RTCM 1077, 1087 and 1097 are not used, so, disable the output rates
+                    // if (current_RX_time_ms % d_rtcm_MT1077_rate_ms==0 && d_rtcm_MT1077_rate_ms != 0)
+                    //     {
+                    //         last_RTCM_1077_output_time = current_RX_time;
+                    //     }
+                    // if (current_RX_time_ms % d_rtcm_MT1087_rate_ms==0 && d_rtcm_MT1087_rate_ms != 0)
+                    //     {
+                    //         last_RTCM_1087_output_time = current_RX_time;
+                    //     }
+                    // if (current_RX_time_ms % d_rtcm_MT1097_rate_ms==0 && d_rtcm_MT1097_rate_ms != 0)
+                    //     {
+                    //         last_RTCM_1097_output_time = current_RX_time;
+                    //     }
+                    if (d_rtcm_MSM_rate_ms != 0)
+                        {
+                            if (current_RX_time_ms % d_rtcm_MSM_rate_ms == 0)
+                                {
+                                    flag_write_RTCM_MSM_output = true;
+                                }
+                        }
+                    if (d_rinexobs_rate_ms != 0)
+                        {
+                            if (current_RX_time_ms % static_cast<uint32_t>(d_rinexobs_rate_ms) == 0)
+                                {
+                                    flag_write_RINEX_obs_output = true;
                                 }
                         }
 
-                    // DEBUG MESSAGE: Display position in console output
-                    if (d_user_pvt_solver->is_valid_position() && flag_display_pvt)
+                    if (d_first_fix == true)
                         {
-                            boost::posix_time::ptime time_solution;
-                            std::string UTC_solution_str;
                             if (d_show_local_time_zone)
                                 {
-                                    time_solution = d_user_pvt_solver->get_position_UTC_time() + d_utc_diff_time;
-                                    UTC_solution_str = d_local_time_str;
+                                    const boost::posix_time::ptime time_first_solution = solver->get_position_UTC_time() + d_utc_diff_time;
+                                    std::cout << "First position fix at " << time_first_solution << d_local_time_str;
                                 }
                             else
                                 {
-                                    time_solution = d_user_pvt_solver->get_position_UTC_time();
-                                    UTC_solution_str = " UTC";
+                                    std::cout << "First position fix at " << solver->get_position_UTC_time() << " UTC";
                                 }
-                            std::streamsize ss = std::cout.precision();  // save current precision
-                            std::cout.setf(std::ios::fixed, std::ios::floatfield);
-                            auto* facet = new boost::posix_time::time_facet("%Y-%b-%d %H:%M:%S.%f %z");
-                            std::cout.imbue(std::locale(std::cout.getloc(), facet));
-                            std::cout
-                                << TEXT_BOLD_GREEN
-                                << "Position at " << time_solution << UTC_solution_str
-                                << " using " << d_user_pvt_solver->get_num_valid_observations()
-                                << std::fixed << std::setprecision(9)
-                                << " observations is Lat = " << d_user_pvt_solver->get_latitude() << " [deg], Long = " << d_user_pvt_solver->get_longitude()
-                                << std::fixed << std::setprecision(3)
-                                << " [deg], Height = " << d_user_pvt_solver->get_height() << " [m]" << TEXT_RESET << '\n';
-
-                            std::cout << std::setprecision(ss);
-                            DLOG(INFO) << "RX clock offset: " << d_user_pvt_solver->get_time_offset_s() << "[s]";
-
-                            std::cout
-                                << TEXT_BOLD_GREEN
-                                << "Velocity: " << std::fixed << std::setprecision(3)
-                                << "East: " << d_user_pvt_solver->get_rx_vel()[0] << " [m/s], North: " << d_user_pvt_solver->get_rx_vel()[1]
-                                << " [m/s], Up = " << d_user_pvt_solver->get_rx_vel()[2] << " [m/s]" << TEXT_RESET << '\n';
-
-                            std::cout << std::setprecision(ss);
-                            DLOG(INFO) << "RX clock drift: " << d_user_pvt_solver->get_clock_drift_ppm() << " [ppm]";
-
-                            // boost::posix_time::ptime p_time;
-                            // gtime_t rtklib_utc_time = gpst2time(adjgpsweek(d_user_pvt_solver->gps_ephemeris_map.cbegin()->second.i_GPS_week), d_rx_time);
-                            // p_time = boost::posix_time::from_time_t(rtklib_utc_time.time);
-                            // p_time += boost::posix_time::microseconds(round(rtklib_utc_time.sec * 1e6));
-                            // std::cout << TEXT_MAGENTA << "Observable RX time (GPST) " << boost::posix_time::to_simple_string(p_time) << TEXT_RESET << '\n';
-
-                            DLOG(INFO) << "Position at " << boost::posix_time::to_simple_string(d_user_pvt_solver->get_position_UTC_time())
-                                       << " UTC using " << d_user_pvt_solver->get_num_valid_observations() << " observations is Lat = " << d_user_pvt_solver->get_latitude() << " [deg], Long = " << d_user_pvt_solver->get_longitude()
-                                       << " [deg], Height = " << d_user_pvt_solver->get_height() << " [m]";
-
-                            /* std::cout << "Dilution of Precision at " << boost::posix_time::to_simple_string(d_user_pvt_solver->get_position_UTC_time())
-                                         << " UTC using "<< d_user_pvt_solver->get_num_valid_observations() <<" observations is HDOP = " << d_user_pvt_solver->get_hdop() << " VDOP = "
-                                         << d_user_pvt_solver->get_vdop()
-                                         << " GDOP = " << d_user_pvt_solver->get_gdop() << '\n'; */
+                            std::cout << " is Lat = " << solver->get_latitude() << " [deg], Long = " << solver->get_longitude()
+                                      << " [deg], Height= " << solver->get_height() << " [m]\n";
+                            d_ttff_msgbuf ttff;
+                            ttff.mtype = 1;
+                            d_end = std::chrono::system_clock::now();
+                            std::chrono::duration<double> elapsed_seconds = d_end - d_start;
+                            ttff.ttff = elapsed_seconds.count();
+                            send_sys_v_ttff_msg(ttff);
+                            d_first_fix = false;
                         }
-
-                    // PVT MONITOR
-                    if (d_user_pvt_solver->is_valid_position())
+                    uint32_t outputs = 0;
+                    if (d_kml_output_enabled)
                         {
-                            const std::shared_ptr<Monitor_Pvt> monitor_pvt = std::make_shared<Monitor_Pvt>(d_user_pvt_solver->get_monitor_pvt());
-
-                            // publish new position to the gnss_flowgraph channel status monitor
-                            if (current_RX_time_ms % d_report_rate_ms == 0)
+                            if (current_RX_time_ms % d_kml_rate_ms == 0)
+                                {
+                                    outputs |= KML_OUTPUT;
+                                }
+                        }
+                    if (d_gpx_output_enabled)
+                        {
+                            if (current_RX_time_ms % d_gpx_rate_ms == 0)
+                                {
+                                    outputs |= GPX_OUTPUT;
+                                }
+                        }
+                    if (d_geojson_output_enabled)
+                        {
+                            if (current_RX_time_ms % d_geojson_rate_ms == 0)
                                 {
-                                    this->message_port_pub(pmt::mp("status"), pmt::make_any(monitor_pvt));
+                                    outputs |= GEOJSON_OUTPUT;
                                 }
-                            if (d_flag_monitor_pvt_enabled)
+                        }
+                    if (d_nmea_output_file_enabled)
+                        {
+                            if (current_RX_time_ms % d_nmea_rate_ms == 0)
                                 {
-                                    d_udp_sink_ptr->write_monitor_pvt(monitor_pvt.get());
+                                    outputs |= NMEA_OUTPUT;
                                 }
                         }
+                    if (d_rinex_output_enabled)
+                        {
+                            outputs |= RINEX_OUTPUT;
+                        }
+                    if (d_output_pipeline != nullptr)
+                        {
+                            if (outputs != 0)
+                                {
+                                    d_output_pipeline->push(*solver, d_gnss_observables_map, d_rx_time, flag_write_RINEX_obs_output, outputs);
+                                }
+                        }
+                    else
+                        {
+                            print_outputs(solver, d_gnss_observables_map, d_rx_time, flag_write_RINEX_obs_output, outputs);
+                        }
+                    if (d_rtcm_enabled)
+                        {
+                            d_rtcm_printer->Print_Rtcm_Messages(solver,
+                                d_gnss_observables_map,
+                                d_rx_time,
+                                d_type_of_rx,
+                                d_rtcm_MSM_rate_ms,
+                                d_rtcm_MT1019_rate_ms,
+                                d_rtcm_MT1020_rate_ms,
+                                d_rtcm_MT1045_rate_ms,
+                                d_rtcm_MT1077_rate_ms,
+                                d_rtcm_MT1097_rate_ms,
+                                flag_write_RTCM_MSM_output,
+                                flag_write_RTCM_1019_output,
+                                flag_write_RTCM_1020_output,
+                                flag_write_RTCM_1045_output,
+                                d_enable_rx_clock_correction);
+                        }
                 }
         }
 
-    return noutput_items;
+    // DEBUG MESSAGE: Display position in console output
+    if (solver->is_valid_position() && flag_display_pvt)
+        {
+            boost::posix_time::ptime time_solution;
+            std::string UTC_solution_str;
+            if (d_show_local_time_zone)
+                {
+                    time_solution = solver->get_position_UTC_time() + d_utc_diff_time;
+                    UTC_solution_str = d_local_time_str;
+                }
+            else
+                {
+                    time_solution = solver->get_position_UTC_time();
+                    UTC_solution_str = " UTC";
+                }
+            std::streamsize ss = std::cout.precision();  // save current precision
+            std::cout.setf(std::ios::fixed, std::ios::floatfield);
+            auto* facet = new boost::posix_time::time_facet("%Y-%b-%d %H:%M:%S.%f %z");
+            std::cout.imbue(std::locale(std::cout.getloc(), facet));
+            std::cout
+                << TEXT_BOLD_GREEN
+                << "Position at " << time_solution << UTC_solution_str
+                << " using " << solver->get_num_valid_observations()
+                << std::fixed << std::setprecision(9)
+                << " observations is Lat = " << solver->get_latitude() << " [deg], Long = " << solver->get_longitude()
+                << std::fixed << std::setprecision(3)
+                << " [deg], Height = " << solver->get_height() << " [m]" << TEXT_RESET << '\n';
+
+            std::cout << std::setprecision(ss);
+            DLOG(INFO) << "RX clock offset: " << solver->get_time_offset_s() << "[s]";
+
+            std::cout
+                << TEXT_BOLD_GREEN
+                << "Velocity: " << std::fixed << std::setprecision(3)
+                << "East: " << solver->get_rx_vel()[0] << " [m/s], North: " << solver->get_rx_vel()[1]
+                << " [m/s], Up = " << solver->get_rx_vel()[2] << " [m/s]" << TEXT_RESET << '\n';
+
+            std::cout << std::setprecision(ss);
+            DLOG(INFO) << "RX clock drift: " << solver->get_clock_drift_ppm() << " [ppm]";
+
+            // boost::posix_time::ptime p_time;
+            // gtime_t rtklib_utc_time = gpst2time(adjgpsweek(solver->gps_ephemeris_map.cbegin()->second.i_GPS_week), d_rx_time);
+            // p_time = boost::posix_time::from_time_t(rtklib_utc_time.time);
+            // p_time += boost::posix_time::microseconds(round(rtklib_utc_time.sec * 1e6));
+            // std::cout << TEXT_MAGENTA << "Observable RX time (GPST) " << boost::posix_time::to_simple_string(p_time) << TEXT_RESET << '\n';
+
+            DLOG(INFO) << "Position at " << boost::posix_time::to_simple_string(solver->get_position_UTC_time())
+                       << " UTC using " << solver->get_num_valid_observations() << " observations is Lat = " << solver->get_latitude() << " [deg], Long = " << solver->get_longitude()
+                       << " [deg], Height = " << solver->get_height() << " [m]";
+
+            /* std::cout << "Dilution of Precision at " << boost::posix_time::to_simple_string(solver->get_position_UTC_time())
+                         << " UTC using "<< solver->get_num_valid_observations() <<" observations is HDOP = " << solver->get_hdop() << " VDOP = "
+                         << solver->get_vdop()
+                         << " GDOP = " << solver->get_gdop() << '\n'; */
+        }
+
+    // PVT MONITOR
+    if (solver->is_valid_position())
+        {
+            const std::shared_ptr<Monitor_Pvt> monitor_pvt = std::make_shared<Monitor_Pvt>(solver->get_monitor_pvt());
+
+            // publish new position to the gnss_flowgraph channel status monitor
+            if (current_RX_time_ms % d_report_rate_ms == 0)
+                {
+                    this->message_port_pub(pmt::mp("status"), pmt::make_any(monitor_pvt));
+                }
+            if (d_flag_monitor_pvt_enabled)
+                {
+                    d_udp_sink_ptr->write_monitor_pvt(monitor_pvt.get());
+                }
+        }
 }
+
+
+void rtklib_pvt_gs::print_outputs(const Rtklib_Solver* solver,
+    const std::map<int, Gnss_Synchro>& observables,
+    double rx_time,
+    bool flag_write_RINEX_obs_output,
+    uint32_t outputs)
+{
+    if ((outputs & KML_OUTPUT) != 0)
+        {
+            d_kml_dump->print_position(solver, false);
+        }
+    if ((outputs & GPX_OUTPUT) != 0)
+        {
+            d_gpx_dump->print_position(solver, false);
+        }
+    if ((outputs & GEOJSON_OUTPUT) != 0)
+        {
+            d_geojson_printer->print_position(solver, false);
+        }
+    if ((outputs & NMEA_OUTPUT) != 0)
+        {
+            d_nmea_printer->Print_Nmea_Line(solver, false);
+        }
+    if ((outputs & RINEX_OUTPUT) != 0)
+        {
+            d_rp->print_rinex_annotation(solver, observables, rx_time, d_type_of_rx, flag_write_RINEX_obs_output);
+        }
+}
+
+
+void rtklib_pvt_gs::log_rinex_nav(const std::function<void()>& log)
+{
+    // The header is written with the first observables, so this must be
+    // checked by the thread that prints them
+    if (d_output_pipeline != nullptr)
+        {
+            d_output_pipeline->post(RINEX_OUTPUT, [this, log]() {
+                if (d_rp->is_rinex_header_written())
+                    {
+                        log();
+                    }
+            });
+        }
+    else if (d_rp->is_rinex_header_written())
+        {
+            log();
+        }
+}
+
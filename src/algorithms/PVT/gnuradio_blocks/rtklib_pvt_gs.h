@@ -25,10 +25,12 @@
 #include <gnuradio/sync_block.h>  // for sync_block
 #include <gnuradio/types.h>       // for gr_vector_const_void_star
 #include <pmt/pmt.h>              // for pmt_t
+#include <atomic>                 // for atomic
 #include <chrono>                 // for system_clock
 #include <cstddef>                // for size_t
 #include <cstdint>                // for int32_t
 #include <ctime>                  // for time_t
+#include <functional>             // for function
 #include <map>                    // for map
 #include <memory>                 // for shared_ptr, unique_ptr
 #include <string>                 // for string
@@ -56,8 +58,10 @@ class Monitor_Pvt_Udp_Sink;
 class Monitor_Ephemeris_Udp_Sink;
 class Nmea_Printer;
 class Pvt_Conf;
+class Pvt_Output_Pipeline;
 class Rinex_Printer;
 class Rtcm_Printer;
+class Rtklib_Batch_Solver;
 class Rtklib_Solver;
 class rtklib_pvt_gs;
 
@@ -108,7 +112,9 @@ public:
     std::map<int, Beidou_Dnav_Almanac> get_beidou_dnav_almanac_map() const;
 
     /*!
-     * \brief Clear all ephemeris information and the almanacs for GPS and Galileo
+     * \brief Clear all ephemeris information and the almanacs for GPS and Galileo.
+     * It can be called from any thread: the data are cleared by the block
+     * itself, before it processes the next message or observables.
      */
     void clear_ephemeris();
 
@@ -126,6 +132,16 @@ public:
         gr_vector_void_star& output_items);  //!< PVT Signal Processing
 
 private:
+    // Products written by print_outputs(), as bits of a mask
+    enum Pvt_Output_Type : uint32_t
+    {
+        KML_OUTPUT = 1U,
+        GPX_OUTPUT = 1U << 1,
+        GEOJSON_OUTPUT = 1U << 2,
+        NMEA_OUTPUT = 1U << 3,
+        RINEX_OUTPUT = 1U << 4
+    };
+
     friend rtklib_pvt_gs_sptr rtklib_make_pvt_gs(uint32_t nchannels,
         const Pvt_Conf& conf_,
         const rtk_t& rtk);
@@ -138,8 +154,22 @@ private:
 
     void msg_handler_has_data(const pmt::pmt_t& msg) const;
 
+    void clear_ephemeris_if_requested();
+
     void initialize_and_apply_carrier_phase_offset();
 
+    void solve_batch();
+
+    void output_solution(Rtklib_Solver* solver, bool flag_pvt_valid, uint32_t current_RX_time_ms);
+
+    void print_outputs(const Rtklib_Solver* solver,
+        const std::map<int, Gnss_Synchro>& observables,
+        double rx_time,
+        bool flag_write_RINEX_obs_output,
+        uint32_t outputs);
+
+    void log_rinex_nav(const std::function<void()>& log);
+
     void apply_rx_clock_offset(std::map<int, Gnss_Synchro>& observables_map,
         double rx_clock_offset_s);
 
@@ -166,6 +196,7 @@ private:
 
     std::shared_ptr<Rtklib_Solver> d_internal_pvt_solver;
     std::shared_ptr<Rtklib_Solver> d_user_pvt_solver;
+    std::unique_ptr<Rtklib_Batch_Solver> d_batch_solver;
 
     std::unique_ptr<Rinex_Printer> d_rp;
     std::unique_ptr<Kml_Printer> d_kml_dump;
@@ -175,6 +206,7 @@ private:
     std::unique_ptr<Rtcm_Printer> d_rtcm_printer;
     std::unique_ptr<Monitor_Pvt_Udp_Sink> d_udp_sink_ptr;
     std::unique_ptr<Monitor_Ephemeris_Udp_Sink> d_eph_udp_sink_ptr;
+    std::unique_ptr<Pvt_Output_Pipeline> d_output_pipeline;
 
     std::chrono::time_point<std::chrono::system_clock> d_start;
     std::chrono::time_point<std::chrono::system_clock> d_end;
@@ -186,27 +218,10 @@ private:
     std::vector<bool> d_channel_initialized;
     std::vector<double> d_initial_carrier_phase_offset_estimation_rads;
 
-    enum StringValue_
-    {
-        evGPS_1C,
-        evGPS_2S,
-        evGPS_L5,
-        evSBAS_1C,
-        evGAL_1B,
-        evGAL_5X,
-        evGAL_E6,
-        evGAL_7X,
-        evGLO_1G,
-        evGLO_2G,
-        evBDS_B1,
-        evBDS_B2,
-        evBDS_B3, 
-        evIRN_1I,
-    };
-    std::map<std::string, StringValue_> d_mapStringValues;
     std::map<int, Gnss_Synchro> d_gnss_observables_map;
     std::map<int, Gnss_Synchro> d_gnss_observables_map_t0;
     std::map<int, Gnss_Synchro> d_gnss_observables_map_t1;
+    std::vector<std::map<int, Gnss_Synchro>> d_batch_epochs;
 
     boost::posix_time::time_duration d_utc_diff_time;
 
@@ -278,6 +293,7 @@ private:
     bool d_show_local_time_zone;
     bool d_waiting_obs_block_rx_clock_offset_correction_msg;
     bool d_enable_rx_clock_correction;
+    std::atomic<bool> d_clear_ephemeris_requested{false};
 };
 
 
@@ -0,0 +1,208 @@
+/*!
+ * \file gnss_ephemeris_store.h
+ * \brief PRN-indexed store of the ephemerides of one constellation, with
+ * constant-time lookup and immutable snapshots for other readers
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_EPHEMERIS_STORE_H
+#define GNSS_SDR_GNSS_EPHEMERIS_STORE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>  // for std::move
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Ephemerides of the satellites of one constellation, indexed by PRN
+ * (from 1 to Max_Prn).
+ *
+ * The stored ephemerides live in an immutable ordered map that is replaced
+ * (copy-on-write) at every change, and a fixed table of pointers into that
+ * map provides the lookups of the solver without any tree traversal.
+ *
+ * The store has a single writer: set(), erase(), clear(), find() and map()
+ * must be called from the thread that computes the solutions (in the PVT
+ * block, its message handlers and work()). Any other thread must use
+ * snapshot(), which returns a consistent view that remains valid after
+ * further changes, and only waits for the swap of a pointer.
+ */
+template <typename Ephemeris, int Max_Prn>
+class Gnss_Ephemeris_Store
+{
+public:
+    using Map = std::map<int, Ephemeris>;
+
+    Gnss_Ephemeris_Store() : d_map(std::make_shared<const Map>())
+    {
+        d_index.fill(nullptr);
+        d_prn_versions.fill(0);
+    }
+
+    Gnss_Ephemeris_Store(const Gnss_Ephemeris_Store&) = delete;
+    Gnss_Ephemeris_Store& operator=(const Gnss_Ephemeris_Store&) = delete;
+
+    static constexpr int max_prn()
+    {
+        return Max_Prn;
+    }
+
+    /*!
+     * \brief Returns the ephemeris of satellite \a prn, or nullptr. The
+     * pointer is valid until the next change of the store.
+     */
+    const Ephemeris* find(int prn) const
+    {
+        return (prn >= 1 && prn <= Max_Prn) ? d_index[prn - 1] : nullptr;
+    }
+
+    /*!
+     * \brief Stores (or replaces) the ephemeris of satellite \a prn. Returns
+     * false, leaving the store unchanged, if \a prn is out of range.
+     */
+    bool set(int prn, const Ephemeris& eph)
+    {
+        if (prn < 1 || prn > Max_Prn)
+            {
+                return false;
+            }
+        auto map = std::make_shared<Map>(*d_map);
+        (*map)[prn] = eph;
+        publish(std::move(map));
+        d_prn_versions[prn - 1] = d_version;
+        return true;
+    }
+
+    /*!
+     * \brief Removes the ephemeris of satellite \a prn, if any
+     */
+    bool erase(int prn)
+    {
+        if (find(prn) == nullptr)
+            {
+                return false;
+            }
+        auto map = std::make_shared<Map>(*d_map);
+        map->erase(prn);
+        publish(std::move(map));
+        d_prn_versions[prn - 1] = d_version;
+        return true;
+    }
+
+    void clear()
+    {
+        if (!d_map->empty())
+            {
+                publish(std::make_shared<Map>());
+                d_prn_versions.fill(d_version);
+            }
+    }
+
+    /*!
+     * \brief Makes this store hold the same ephemerides and versions as
+     * \a other, sharing its map instead of copying the ephemerides
+     */
+    void assign(const Gnss_Ephemeris_Store& other)
+    {
+        if (other.d_map != d_map)
+            {
+                publish(other.d_map);
+            }
+        d_prn_versions = other.d_prn_versions;
+        d_version = other.d_version;
+    }
+
+    bool empty() const
+    {
+        return d_map->empty();
+    }
+
+    size_t size() const
+    {
+        return d_map->size();
+    }
+
+    /*!
+     * \brief Number of changes since construction. Useful to know whether
+     * anything derived from the stored ephemerides must be recomputed.
+     */
+    uint64_t version() const
+    {
+        return d_version;
+    }
+
+    /*!
+     * \brief Version of the ephemeris of satellite \a prn: 0 if it was never
+     * stored, and a new value every time it is stored or removed. Useful to
+     * cache data derived from a single ephemeris.
+     */
+    uint64_t version(int prn) const
+    {
+        return (prn >= 1 && prn <= Max_Prn) ? d_prn_versions[prn - 1] : 0;
+    }
+
+    /*!
+     * \brief Ordered view of the stored ephemerides, for the printers that
+     * run in the writer thread. Valid until the next change of the store.
+     */
+    const Map& map() const
+    {
+        return *d_map;
+    }
+
+    /*!
+     * \brief Consistent view of the stored ephemerides, safe to call from
+     * any thread and to keep for as long as needed
+     */
+    std::shared_ptr<const Map> snapshot() const
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        return d_map;
+    }
+
+private:
+    void publish(std::shared_ptr<const Map> map)
+    {
+        d_index.fill(nullptr);
+        for (const auto& eph : *map)
+            {
+                d_index[eph.first - 1] = &eph.second;
+            }
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_map.swap(map);
+        }
+        d_version++;
+        // The previous map is released here, out of the lock, unless a
+        // snapshot of it is still held by another thread.
+    }
+
+    std::array<const Ephemeris*, Max_Prn> d_index;
+    std::array<uint64_t, Max_Prn> d_prn_versions;
+    std::shared_ptr<const Map> d_map;
+    mutable std::mutex d_mutex;
+    uint64_t d_version{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_EPHEMERIS_STORE_H
@@ -17,18 +17,10 @@
 
 #include "monitor_ephemeris_udp_sink.h"
 #include <boost/archive/binary_oarchive.hpp>
-#include <iostream>
-#include <sstream>
 
 
-Monitor_Ephemeris_Udp_Sink::Monitor_Ephemeris_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled) : socket{io_context}
+Monitor_Ephemeris_Udp_Sink::Monitor_Ephemeris_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled) : sender(addresses, port)
 {
-    for (const auto& address : addresses)
-        {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
-        }
-
     use_protobuf = protobuf_enabled;
     if (use_protobuf)
         {
@@ -40,73 +32,33 @@ Monitor_Ephemeris_Udp_Sink::Monitor_Ephemeris_Udp_Sink(const std::vector<std::st
 
 bool Monitor_Ephemeris_Udp_Sink::write_galileo_ephemeris(const std::shared_ptr<Galileo_Ephemeris>& monitor_gal_eph)
 {
-    std::string outbound_data;
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
+            boost::archive::binary_oarchive oa{sender.new_datagram_streambuf()};
             oa << *monitor_gal_eph;
-            outbound_data = archive_stream.str();
         }
     else
         {
+            std::string& outbound_data = sender.new_datagram();
             outbound_data = "E";
-            outbound_data.append(serdes_gal.createProtobuffer(monitor_gal_eph));
+            serdes_gal.appendProtobuffer(monitor_gal_eph, outbound_data);
         }
-
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
-
-            try
-                {
-                    if (socket.send(boost::asio::buffer(outbound_data)) == 0)
-                        {
-                            return false;
-                        }
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    return false;
-                }
-        }
-    return true;
+    return sender.send();
 }
 
 
 bool Monitor_Ephemeris_Udp_Sink::write_gps_ephemeris(const std::shared_ptr<Gps_Ephemeris>& monitor_gps_eph)
 {
-    std::string outbound_data;
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
+            boost::archive::binary_oarchive oa{sender.new_datagram_streambuf()};
             oa << *monitor_gps_eph;
-            outbound_data = archive_stream.str();
         }
     else
         {
+            std::string& outbound_data = sender.new_datagram();
             outbound_data = "G";
-            outbound_data.append(serdes_gps.createProtobuffer(monitor_gps_eph));
-        }
-
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
-
-            try
-                {
-                    if (socket.send(boost::asio::buffer(outbound_data)) == 0)
-                        {
-                            return false;
-                        }
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    return false;
-                }
+            serdes_gps.appendProtobuffer(monitor_gps_eph, outbound_data);
         }
-    return true;
+    return sender.send();
 }
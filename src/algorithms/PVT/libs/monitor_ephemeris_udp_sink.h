@@ -22,7 +22,8 @@
 #include "gps_ephemeris.h"
 #include "serdes_galileo_eph.h"
 #include "serdes_gps_eph.h"
-#include <boost/asio.hpp>
+#include "udp_datagram_sender.h"
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -33,12 +34,6 @@
  * \{ */
 
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 class Monitor_Ephemeris_Udp_Sink
 {
 public:
@@ -49,10 +44,7 @@ public:
 private:
     Serdes_Galileo_Eph serdes_gal;
     Serdes_Gps_Eph serdes_gps;
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
-    boost::system::error_code error;
+    Udp_Datagram_Sender sender;
     bool use_protobuf;
 };
 
@@ -17,18 +17,10 @@
 
 #include "monitor_pvt_udp_sink.h"
 #include <boost/archive/binary_oarchive.hpp>
-#include <iostream>
-#include <sstream>
 
 
-Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled) : socket{io_context}
+Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool protobuf_enabled) : sender(addresses, port)
 {
-    for (const auto& address : addresses)
-        {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
-        }
-
     use_protobuf = protobuf_enabled;
     if (use_protobuf)
         {
@@ -39,35 +31,14 @@ Monitor_Pvt_Udp_Sink::Monitor_Pvt_Udp_Sink(const std::vector<std::string>& addre
 
 bool Monitor_Pvt_Udp_Sink::write_monitor_pvt(const Monitor_Pvt* const monitor_pvt)
 {
-    std::string outbound_data;
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
+            boost::archive::binary_oarchive oa{sender.new_datagram_streambuf()};
             oa << *monitor_pvt;
-            outbound_data = archive_stream.str();
         }
     else
         {
-            outbound_data = serdes.createProtobuffer(monitor_pvt);
-        }
-
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
-
-            try
-                {
-                    if (socket.send(boost::asio::buffer(outbound_data)) == 0)
-                        {
-                            return false;
-                        }
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    return false;
-                }
+            serdes.appendProtobuffer(monitor_pvt, sender.new_datagram());
         }
-    return true;
+    return sender.send();
 }
@@ -20,8 +20,8 @@
 
 #include "monitor_pvt.h"
 #include "serdes_monitor_pvt.h"
-#include <boost/asio.hpp>
-#include <memory>
+#include "udp_datagram_sender.h"
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -31,12 +31,6 @@
  * \{ */
 
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 class Monitor_Pvt_Udp_Sink
 {
 public:
@@ -45,10 +39,7 @@ public:
 
 private:
     Serdes_Monitor_Pvt serdes;
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
-    boost::system::error_code error;
+    Udp_Datagram_Sender sender;
     bool use_protobuf;
 };
 
@@ -28,6 +28,8 @@ Pvt_Conf::Pvt_Conf()
     nmea_rate_ms = 1000;
 
     max_obs_block_rx_clock_offset_ms = 40;
+    batch_solver_threads = 0;
+    async_output_queue_size = 0;
     rinex_version = 0;
     rinexobs_rate_ms = 0;
     rinex_name = std::string("-");
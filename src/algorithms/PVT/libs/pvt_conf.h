@@ -64,6 +64,8 @@ public:
     int32_t max_obs_block_rx_clock_offset_ms;
     int udp_port;
     int udp_eph_port;
+    int batch_solver_threads;
+    int async_output_queue_size;
 
     uint16_t rtcm_tcp_port;
     uint16_t rtcm_station_id;
@@ -0,0 +1,259 @@
+/*!
+ * \file pvt_output_pipeline.cc
+ * \brief Writes the PVT products (RINEX, KML, GPX, GeoJSON, NMEA) from
+ * dedicated threads, fed through a bounded queue of solution snapshots
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_output_pipeline.h"
+#include "gnss_sdr_make_unique.h"
+#include <glog/logging.h>
+#include <algorithm>  // for std::max
+#include <exception>
+#include <utility>  // for std::move
+
+
+Pvt_Output::Pvt_Output(const rtk_t& rtk, int nchannels)
+    : solution(rtk, nchannels, std::string(), false, false)
+{
+}
+
+
+Pvt_Output_Pipeline::Pvt_Output_Pipeline(const rtk_t& rtk, int nchannels, size_t capacity)
+    : d_rtk(rtk),
+      d_nchannels(nchannels),
+      d_capacity(capacity)
+{
+    // Enough for sinks that keep up. A sink that lags behind holds up to
+    // capacity slots, and more are allocated for the others when needed.
+    d_slots.reserve(capacity);
+    d_free_slots.reserve(capacity);
+    for (size_t i = 0; i < capacity; i++)
+        {
+            d_slots.push_back(std::make_unique<Slot>(rtk, nchannels));
+            d_free_slots.push_back(d_slots.back().get());
+        }
+}
+
+
+Pvt_Output_Pipeline::~Pvt_Output_Pipeline()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop = true;
+    }
+    for (auto& sink : d_sinks)
+        {
+            sink->cv.notify_one();
+        }
+    for (auto& sink : d_sinks)
+        {
+            sink->thread.join();
+            LOG(INFO) << "PVT output " << sink->name << ": " << sink->counters.written << " epochs written, "
+                      << sink->counters.dropped << " dropped, maximum lag of " << sink->counters.max_lag << " epochs";
+        }
+}
+
+
+void Pvt_Output_Pipeline::add_sink(uint32_t sink, const std::string& name, std::function<void(const Pvt_Output&)> print)
+{
+    auto new_sink = std::make_unique<Sink>();
+    new_sink->id = sink;
+    new_sink->name = name;
+    new_sink->print = std::move(print);
+    Sink* sink_ptr = new_sink.get();
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_sinks.push_back(std::move(new_sink));
+    }
+    sink_ptr->thread = std::thread(&Pvt_Output_Pipeline::run, this, sink_ptr);
+}
+
+
+bool Pvt_Output_Pipeline::push(const Rtklib_Solver& solution,
+    const std::map<int, Gnss_Synchro>& observables,
+    double rx_time,
+    bool flag_write_RINEX_obs_output,
+    uint32_t sinks)
+{
+    uint32_t accepted = 0;
+    bool dropped = false;
+    Slot* slot = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        for (auto& sink : d_sinks)
+            {
+                if ((sinks & sink->id) == 0)
+                    {
+                        continue;
+                    }
+                if (sink->pending_epochs >= d_capacity)
+                    {
+                        if (sink->counters.dropped == 0)
+                            {
+                                LOG(WARNING) << "PVT output " << sink->name << " is not keeping up, dropping epochs";
+                            }
+                        sink->counters.dropped++;
+                        dropped = true;
+                    }
+                else
+                    {
+                        accepted |= sink->id;
+                    }
+            }
+        if (accepted == 0)
+            {
+                return !dropped;
+            }
+        if (!d_free_slots.empty())
+            {
+                slot = d_free_slots.back();
+                d_free_slots.pop_back();
+            }
+    }
+
+    // Only this thread queues epochs, so the queues that accepted this one
+    // cannot get full in the meantime. Each queue holds at most d_capacity
+    // slots, which bounds the size of the pool.
+    std::unique_ptr<Slot> new_slot;
+    if (slot == nullptr)
+        {
+            new_slot = std::make_unique<Slot>(d_rtk, d_nchannels);
+            slot = new_slot.get();
+        }
+
+    // The slot belongs to this thread until it is queued
+    slot->output.solution.copy_solution(solution);
+    slot->output.observables = observables;
+    slot->output.rx_time = rx_time;
+    slot->output.flag_write_RINEX_obs_output = flag_write_RINEX_obs_output;
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    if (new_slot != nullptr)
+        {
+            d_slots.push_back(std::move(new_slot));
+        }
+    for (auto& sink : d_sinks)
+        {
+            if ((accepted & sink->id) != 0)
+                {
+                    slot->pending++;
+                    sink->pending_epochs++;
+                    sink->queue.push_back(Entry{slot, nullptr});
+                    sink->counters.max_lag = std::max(sink->counters.max_lag, sink->pending_epochs);
+                    sink->cv.notify_one();
+                }
+        }
+    return !dropped;
+}
+
+
+void Pvt_Output_Pipeline::post(uint32_t sink, std::function<void()> task)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    Sink* sink_ptr = find(sink);
+    if (sink_ptr != nullptr)
+        {
+            sink_ptr->queue.push_back(Entry{nullptr, std::move(task)});
+            sink_ptr->cv.notify_one();
+        }
+}
+
+
+Pvt_Output_Pipeline::Counters Pvt_Output_Pipeline::counters(uint32_t sink) const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    const Sink* sink_ptr = find(sink);
+    if (sink_ptr == nullptr)
+        {
+            return Counters{0, 0, 0, 0};
+        }
+    Counters counters = sink_ptr->counters;
+    counters.lag = sink_ptr->pending_epochs;
+    return counters;
+}
+
+
+std::vector<uint32_t> Pvt_Output_Pipeline::sinks() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    std::vector<uint32_t> ids;
+    ids.reserve(d_sinks.size());
+    for (const auto& sink : d_sinks)
+        {
+            ids.push_back(sink->id);
+        }
+    return ids;
+}
+
+
+std::string Pvt_Output_Pipeline::sink_name(uint32_t sink) const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    const Sink* sink_ptr = find(sink);
+    return sink_ptr != nullptr ? sink_ptr->name : std::string();
+}
+
+
+void Pvt_Output_Pipeline::run(Sink* sink)
+{
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (true)
+        {
+            sink->cv.wait(lock, [this, sink] { return d_stop || !sink->queue.empty(); });
+            if (sink->queue.empty())
+                {
+                    return;  // stopped, and everything has been written
+                }
+            Entry entry = std::move(sink->queue.front());
+            sink->queue.pop_front();
+            lock.unlock();
+            try
+                {
+                    if (entry.slot != nullptr)
+                        {
+                            sink->print(entry.slot->output);
+                        }
+                    else
+                        {
+                            entry.task();
+                        }
+                }
+            catch (const std::exception& e)
+                {
+                    LOG(ERROR) << "PVT output " << sink->name << " error: " << e.what();
+                }
+            lock.lock();
+            if (entry.slot != nullptr)
+                {
+                    sink->counters.written++;
+                    sink->pending_epochs--;
+                    if (--entry.slot->pending == 0)
+                        {
+                            d_free_slots.push_back(entry.slot);
+                        }
+                }
+        }
+}
+
+
+Pvt_Output_Pipeline::Sink* Pvt_Output_Pipeline::find(uint32_t sink) const
+{
+    for (const auto& sink_ptr : d_sinks)
+        {
+            if (sink_ptr->id == sink)
+                {
+                    return sink_ptr.get();
+                }
+        }
+    return nullptr;
+}
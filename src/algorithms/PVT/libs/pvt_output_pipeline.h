@@ -0,0 +1,162 @@
+/*!
+ * \file pvt_output_pipeline.h
+ * \brief Writes the PVT products (RINEX, KML, GPX, GeoJSON, NMEA) from
+ * dedicated threads, fed through a bounded queue of solution snapshots
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PVT_OUTPUT_PIPELINE_H
+#define GNSS_SDR_PVT_OUTPUT_PIPELINE_H
+
+#include "gnss_synchro.h"
+#include "rtklib.h"
+#include "rtklib_solver.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Immutable snapshot of one epoch, as read by the printers
+ */
+class Pvt_Output
+{
+public:
+    Pvt_Output(const rtk_t& rtk, int nchannels);
+
+    Rtklib_Solver solution;                   //!< Copy of the solution and of the navigation data
+    std::map<int, Gnss_Synchro> observables;  //!< Observables of the epoch
+    double rx_time{0.0};                      //!< Receiver time of the epoch [s]
+    bool flag_write_RINEX_obs_output{false};
+};
+
+
+/*!
+ * \brief Decouples the PVT block from the printers, so that a slow disk or
+ * serial port does not stall the receiver.
+ *
+ * Each sink (usually, one printer) has its own writer thread and FIFO queue,
+ * and receives the epochs in order. Each queue holds at most \a capacity
+ * epochs not yet written: when it is full, push() drops the epoch for that
+ * sink only, and counts the drop. The sinks share a single snapshot of each
+ * epoch, which goes back to a pool once all of them have written it.
+ */
+class Pvt_Output_Pipeline
+{
+public:
+    struct Counters
+    {
+        uint64_t written;  //!< Epochs written
+        uint64_t dropped;  //!< Epochs dropped because the queue was full
+        size_t lag;        //!< Epochs waiting to be written
+        size_t max_lag;    //!< Maximum number of epochs that were waiting
+    };
+
+    /*!
+     * \brief Creates a pipeline whose sinks queue up to \a capacity epochs
+     * each
+     */
+    Pvt_Output_Pipeline(const rtk_t& rtk, int nchannels, size_t capacity);
+
+    /*!
+     * \brief Writes all the queued epochs and stops the writer threads
+     */
+    ~Pvt_Output_Pipeline();
+
+    Pvt_Output_Pipeline(const Pvt_Output_Pipeline&) = delete;
+    Pvt_Output_Pipeline& operator=(const Pvt_Output_Pipeline&) = delete;
+
+    /*!
+     * \brief Adds a sink, identified by a single bit \a sink, and starts its
+     * writer thread. \a print is only called from that thread.
+     */
+    void add_sink(uint32_t sink, const std::string& name, std::function<void(const Pvt_Output&)> print);
+
+    /*!
+     * \brief Queues a snapshot of the epoch for the sinks selected by the
+     * bits of \a sinks. Returns false if the epoch was dropped for any of
+     * them.
+     */
+    bool push(const Rtklib_Solver& solution,
+        const std::map<int, Gnss_Synchro>& observables,
+        double rx_time,
+        bool flag_write_RINEX_obs_output,
+        uint32_t sinks);
+
+    /*!
+     * \brief Runs \a task in the writer thread of \a sink, after the epochs
+     * already queued for it. Tasks are never dropped.
+     */
+    void post(uint32_t sink, std::function<void()> task);
+
+    Counters counters(uint32_t sink) const;
+
+    std::vector<uint32_t> sinks() const;
+
+    std::string sink_name(uint32_t sink) const;
+
+private:
+    struct Slot
+    {
+        Slot(const rtk_t& rtk, int nchannels) : output(rtk, nchannels) {}
+        Pvt_Output output;
+        uint32_t pending{0};  // sinks that have not written it yet
+    };
+
+    struct Entry
+    {
+        Slot* slot;  // nullptr for tasks
+        std::function<void()> task;
+    };
+
+    struct Sink
+    {
+        uint32_t id{0};
+        std::string name;
+        std::function<void(const Pvt_Output&)> print;
+        std::deque<Entry> queue;
+        std::condition_variable cv;
+        std::thread thread;
+        Counters counters{0, 0, 0, 0};
+        size_t pending_epochs{0};  // queued or being written
+    };
+
+    void run(Sink* sink);
+    Sink* find(uint32_t sink) const;
+
+    const rtk_t d_rtk;
+    const int d_nchannels;
+    const size_t d_capacity;
+    std::vector<std::unique_ptr<Slot>> d_slots;
+    std::vector<Slot*> d_free_slots;
+    std::vector<std::unique_ptr<Sink>> d_sinks;
+    mutable std::mutex d_mutex;
+    bool d_stop{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PVT_OUTPUT_PIPELINE_H
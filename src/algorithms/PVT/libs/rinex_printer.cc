@@ -51,11 +51,12 @@
 #include <array>
 #include <cmath>  // for floor
 #include <exception>
+#include <fcntl.h>  // for open
 #include <iostream>  // for cout
 #include <iterator>
 #include <ostream>
 #include <set>
-#include <unistd.h>  // for getlogin_r()
+#include <unistd.h>  // for getlogin_r(), pwrite, close
 #include <utility>
 #include <vector>
 
@@ -338,220 +339,220 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
     std::map<int, Beidou_Dnav_Ephemeris>::const_iterator beidou_dnav_ephemeris_iter;
     if (!d_rinex_header_written)  // & we have utc data in nav message!
         {
-            galileo_ephemeris_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-            gps_ephemeris_iter = pvt_solver->gps_ephemeris_map.cbegin();
-            irnss_ephemeris_iter = pvt_solver->irnss_ephemeris_map.cbegin();
+            galileo_ephemeris_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+            gps_ephemeris_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+            irnss_ephemeris_iter = pvt_solver->irnss_ephemeris_map.map().cbegin();
 
-            gps_cnav_ephemeris_iter = pvt_solver->gps_cnav_ephemeris_map.cbegin();
-            glonass_gnav_ephemeris_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-            beidou_dnav_ephemeris_iter = pvt_solver->beidou_dnav_ephemeris_map.cbegin();
+            gps_cnav_ephemeris_iter = pvt_solver->gps_cnav_ephemeris_map.map().cbegin();
+            glonass_gnav_ephemeris_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
+            beidou_dnav_ephemeris_iter = pvt_solver->beidou_dnav_ephemeris_map.map().cbegin();
             switch (type_of_rx)
                 {
                 case 1:  // GPS L1 C/A only
-                    if (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend())
+                    if (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend())
                         {
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, rx_time);
                             rinex_nav_header(navFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map);
+                            log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 1002:  // Irnss L5 C/A only
-                    if (irnss_ephemeris_iter != pvt_solver->irnss_ephemeris_map.cend())
+                    if (irnss_ephemeris_iter != pvt_solver->irnss_ephemeris_map.map().cend())
                         {
                             rinex_obs_header(obsFile, irnss_ephemeris_iter->second, rx_time);
                             rinex_nav_header(navIrnFile, pvt_solver->irnss_iono, pvt_solver->irnss_utc_model, irnss_ephemeris_iter->second);
                             output_navfilename.push_back(navIrnfilename);
-                            log_rinex_nav(navIrnFile, pvt_solver->irnss_ephemeris_map);
+                            log_rinex_nav(navIrnFile, pvt_solver->irnss_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 2:  // GPS L2C only
-                    if (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend())
+                    if (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend())
                         {
                             const std::string signal("2S");
                             rinex_obs_header(obsFile, gps_cnav_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navFile, pvt_solver->gps_cnav_iono, pvt_solver->gps_cnav_utc_model);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navFile, pvt_solver->gps_cnav_ephemeris_map);
+                            log_rinex_nav(navFile, pvt_solver->gps_cnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 3:  // GPS L5 only
-                    if (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend())
+                    if (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend())
                         {
                             const std::string signal("L5");
                             rinex_obs_header(obsFile, gps_cnav_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navFile, pvt_solver->gps_cnav_iono, pvt_solver->gps_cnav_utc_model);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navFile, pvt_solver->gps_cnav_ephemeris_map);
+                            log_rinex_nav(navFile, pvt_solver->gps_cnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 4:  // Galileo E1B only
-                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                         {
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 5:  // Galileo E5a only
-                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                         {
                             const std::string signal("5X");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 6:  // Galileo E5b only
-                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                         {
                             const std::string signal("7X");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 7:  // GPS L1 C/A + GPS L2C
-                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                         {
                             const std::string signal("1C 2S");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navFile, pvt_solver->gps_cnav_ephemeris_map);
+                            log_rinex_nav(navFile, pvt_solver->gps_cnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 8:  // GPS L1 + GPS L5
-                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                         {
                             const std::string signal("1C L5");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map);
+                            log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 9:  // GPS L1 C/A + Galileo E1B
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("1B");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map.map(), pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 10:  // GPS L1 C/A + Galileo E5a
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("5X");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map.map(), pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 11:  // GPS L1 C/A + Galileo E5b
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("7X");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map.map(), pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 13:  // L5+E5a
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("5X");
                             const std::string gps_signal("L5");
                             rinex_obs_header(obsFile, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gps_signal, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_cnav_iono, pvt_solver->gps_cnav_utc_model, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_cnav_ephemeris_map, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_cnav_ephemeris_map.map(), pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 14:  // Galileo E1B + Galileo E5a
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("1B 5X");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time, gal_signal);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 15:  // Galileo E1B + Galileo E5b
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("1B 7X");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time, gal_signal);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 23:  // GLONASS L1 C/A only
-                    if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                    if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                         {
                             const std::string signal("1G");
                             rinex_obs_header(obsFile, glonass_gnav_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navGloFile, pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
                             output_navfilename.push_back(navGlofilename);
-                            log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map);
+                            log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 24:  // GLONASS L2 C/A only
-                    if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                    if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                         {
                             const std::string signal("2G");
                             rinex_obs_header(obsFile, glonass_gnav_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navGloFile, pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
                             output_navfilename.push_back(navGlofilename);
-                            log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map);
+                            log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 25:  // GLONASS L1 C/A + GLONASS L2 C/A
-                    if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                    if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                         {
                             const std::string signal("1G 2G");
                             rinex_obs_header(obsFile, glonass_gnav_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navGloFile, pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
                             output_navfilename.push_back(navGlofilename);
-                            log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map);
+                            log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 26:  // GPS L1 C/A + GLONASS L1 C/A
-                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                         {
                             const std::string glo_signal("1G");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, glo_signal);
                             if (d_version == 3)
                                 {
                                     rinex_nav_header(navMixFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second, pvt_solver->glonass_gnav_utc_model, pvt_solver->glonass_gnav_almanac);
-                                    log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map, pvt_solver->glonass_gnav_ephemeris_map);
+                                    log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map.map(), pvt_solver->glonass_gnav_ephemeris_map.map());
                                     output_navfilename.push_back(navMixfilename);
                                 }
                             if (d_version == 2)
@@ -560,37 +561,37 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                     rinex_nav_header(navGloFile, pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
                                     output_navfilename.push_back(navfilename);
                                     output_navfilename.push_back(navGlofilename);
-                                    log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map);
-                                    log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map);
+                                    log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map.map());
+                                    log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map.map());
                                 }
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 27:  // Galileo E1B + GLONASS L1 C/A
-                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                         {
                             const std::string glo_signal("1G");
                             const std::string gal_signal("1B");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, glo_signal, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model, pvt_solver->glonass_gnav_utc_model, pvt_solver->glonass_gnav_almanac);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->galileo_ephemeris_map, pvt_solver->glonass_gnav_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->galileo_ephemeris_map.map(), pvt_solver->glonass_gnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 28:  // GPS L2C + GLONASS L1 C/A
-                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                         {
                             const std::string glo_signal("1G");
                             rinex_obs_header(obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, glo_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_cnav_iono, pvt_solver->gps_cnav_utc_model, pvt_solver->glonass_gnav_utc_model, pvt_solver->glonass_gnav_almanac);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_cnav_ephemeris_map, pvt_solver->glonass_gnav_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_cnav_ephemeris_map.map(), pvt_solver->glonass_gnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 29:  // GPS L1 C/A + GLONASS L2 C/A
-                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                         {
                             const std::string glo_signal("2G");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, glo_signal);
@@ -598,7 +599,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 {
                                     rinex_nav_header(navMixFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second, pvt_solver->glonass_gnav_utc_model, pvt_solver->glonass_gnav_almanac);
                                     output_navfilename.push_back(navfilename);
-                                    log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map, pvt_solver->glonass_gnav_ephemeris_map);
+                                    log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map.map(), pvt_solver->glonass_gnav_ephemeris_map.map());
                                 }
                             if (d_version == 2)
                                 {
@@ -606,139 +607,139 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                     rinex_nav_header(navGloFile, pvt_solver->glonass_gnav_utc_model, glonass_gnav_ephemeris_iter->second);
                                     output_navfilename.push_back(navfilename);
                                     output_navfilename.push_back(navGlofilename);
-                                    log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map);
-                                    log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map);
+                                    log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map.map());
+                                    log_rinex_nav(navGloFile, pvt_solver->glonass_gnav_ephemeris_map.map());
                                 }
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 30:  // Galileo E1B + GLONASS L2 C/A
-                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                         {
                             const std::string glo_signal("2G");
                             const std::string gal_signal("1B");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, glo_signal, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model, pvt_solver->glonass_gnav_utc_model, pvt_solver->glonass_gnav_almanac);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->galileo_ephemeris_map, pvt_solver->glonass_gnav_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->galileo_ephemeris_map.map(), pvt_solver->glonass_gnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 31:  // GPS L2C + GLONASS L2 C/A
-                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                    if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                         {
                             const std::string glo_signal("2G");
                             rinex_obs_header(obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, glo_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_cnav_iono, pvt_solver->gps_cnav_utc_model, pvt_solver->glonass_gnav_utc_model, pvt_solver->glonass_gnav_almanac);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_cnav_ephemeris_map, pvt_solver->glonass_gnav_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_cnav_ephemeris_map.map(), pvt_solver->glonass_gnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 32:  // L1+E1+L5+E5a
-                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and
-                        (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()) and
-                        (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and
+                        (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()) and
+                        (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("1B 5X");
                             const std::string gps_signal("1C L5");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gps_signal, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map.map(), pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 33:  // L1+E1+E5a
-                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and
-                        (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and
+                        (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("1B 5X");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map.map(), pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 101:  // Galileo E1B + Galileo E6B
-                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                         {
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 102:  // Galileo E5a + Galileo E6B
-                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                         {
                             const std::string signal("5X");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 103:  // Galileo E5b + Galileo E6B
-                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                    if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                         {
                             const std::string signal("7X");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time, signal);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 104:  // Galileo E1B + Galileo E5a + Galileo E6B
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("1B 5X");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time, gal_signal);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 105:  // Galileo E1B + Galileo E5b + Galileo E6B
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("1B 7X");
                             rinex_obs_header(obsFile, galileo_ephemeris_iter->second, rx_time, gal_signal);
                             rinex_nav_header(navGalFile, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navGalfilename);
-                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navGalFile, pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 106:  // GPS L1 C/A + Galileo E1B + Galileo E6B
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("1B");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map.map(), pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 500:  // BDS B1I only
-                    if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.cend())
+                    if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.map().cend())
                         {
                             rinex_obs_header(obsFile, beidou_dnav_ephemeris_iter->second, rx_time, "B1");
                             rinex_nav_header(navFile, pvt_solver->beidou_dnav_iono, pvt_solver->beidou_dnav_utc_model);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navFile, pvt_solver->beidou_dnav_ephemeris_map);
+                            log_rinex_nav(navFile, pvt_solver->beidou_dnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
 
                     break;
                 case 501:  // BeiDou B1I + GPS L1 C/A
-                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.cend()))
+                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.map().cend()))
                         {
                             const std::string bds_signal("B1");
                             // rinex_obs_header(obsFile, gps_ephemeris_iter->second, beidou_dnav_ephemeris_iter->second, rx_time, bds_signal);
@@ -748,7 +749,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
 
                     break;
                 case 502:  // BeiDou B1I + Galileo E1B
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.map().cend()))
                         {
                             const std::string bds_signal("B1");
                             const std::string gal_signal("1B");
@@ -762,22 +763,22 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                 case 504:  // BeiDou B1I + GPS L1 C/A + Galileo E1B
                 case 505:  // BeiDou B1I + GPS L1 C/A + GLONASS L1 C/A + Galileo E1B
                 case 506:  // BeiDou B1I + Beidou B3I
-                    if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.cend())
+                    if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.map().cend())
                         {
                             // rinex_obs_header(obsFile, beidou_dnav_ephemeris_iter->second, rx_time, "B1");
                             // rinex_nav_header(navFile, pvt_solver->beidou_dnav_iono, pvt_solver->beidou_dnav_utc_model);
-                            // log_rinex_nav(navFile, pvt_solver->beidou_dnav_ephemeris_map);
+                            // log_rinex_nav(navFile, pvt_solver->beidou_dnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
 
                     break;
                 case 600:  // BDS B3I only
-                    if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.cend())
+                    if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.map().cend())
                         {
                             rinex_obs_header(obsFile, beidou_dnav_ephemeris_iter->second, rx_time, "B3");
                             rinex_nav_header(navFile, pvt_solver->beidou_dnav_iono, pvt_solver->beidou_dnav_utc_model);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navFile, pvt_solver->beidou_dnav_ephemeris_map);
+                            log_rinex_nav(navFile, pvt_solver->beidou_dnav_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
 
@@ -785,7 +786,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                 case 601:  // BeiDou B3I + GPS L2C
                 case 602:  // BeiDou B3I + GLONASS L2 C/A
                 case 603:  // BeiDou B3I + GPS L2C + GLONASS L2 C/A
-                    if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.cend())
+                    if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.map().cend())
                         {
                             rinex_obs_header(obsFile, beidou_dnav_ephemeris_iter->second, rx_time, "B3");
                             // rinex_nav_header(navFile, pvt_solver->beidou_dnav_iono, pvt_solver->beidou_dnav_utc_model);
@@ -794,28 +795,28 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
 
                     break;
                 case 1000:  // GPS L1 C/A + GPS L2C + GPS L5
-                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and
-                        (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                    if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and
+                        (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                         {
                             const std::string gps_signal("1C 2S L5");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, rx_time, gps_signal);
                             rinex_nav_header(navFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second);
                             output_navfilename.push_back(navfilename);
-                            log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map);
+                            log_rinex_nav(navFile, pvt_solver->gps_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
                 case 1001:  // GPS L1 C/A + Galileo E1B + GPS L2C + GPS L5 + Galileo E5a
-                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and
-                        (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and
-                        (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                    if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and
+                        (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and
+                        (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                         {
                             const std::string gal_signal("1B 5X");
                             const std::string gps_signal("1C 2S L5");
                             rinex_obs_header(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gps_signal, gal_signal);
                             rinex_nav_header(navMixFile, pvt_solver->gps_iono, pvt_solver->gps_utc_model, gps_ephemeris_iter->second, pvt_solver->galileo_iono, pvt_solver->galileo_utc_model);
                             output_navfilename.push_back(navMixfilename);
-                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map, pvt_solver->galileo_ephemeris_map);
+                            log_rinex_nav(navMixFile, pvt_solver->gps_ephemeris_map.map(), pvt_solver->galileo_ephemeris_map.map());
                             d_rinex_header_written = true;  // do not write header anymore
                         }
                     break;
@@ -825,13 +826,13 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
         }
     if (d_rinex_header_written)  // The header is already written, we can now log the navigation message data
         {
-            galileo_ephemeris_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-            gps_ephemeris_iter = pvt_solver->gps_ephemeris_map.cbegin();
-            irnss_ephemeris_iter = pvt_solver->irnss_ephemeris_map.cbegin();
+            galileo_ephemeris_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+            gps_ephemeris_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+            irnss_ephemeris_iter = pvt_solver->irnss_ephemeris_map.map().cbegin();
 
-            gps_cnav_ephemeris_iter = pvt_solver->gps_cnav_ephemeris_map.cbegin();
-            glonass_gnav_ephemeris_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-            beidou_dnav_ephemeris_iter = pvt_solver->beidou_dnav_ephemeris_map.cbegin();
+            gps_cnav_ephemeris_iter = pvt_solver->gps_cnav_ephemeris_map.map().cbegin();
+            glonass_gnav_ephemeris_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
+            beidou_dnav_ephemeris_iter = pvt_solver->beidou_dnav_ephemeris_map.map().cbegin();
 
             // Log observables into the RINEX file
             if (flag_write_RINEX_obs_output)
@@ -839,7 +840,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                     switch (type_of_rx)
                         {
                         case 1:  // GPS L1 C/A only
-                            if (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend())
+                            if (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and (pvt_solver->gps_utc_model.A0 != 0))
@@ -851,7 +852,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 1002:  // Irnss L5 C/A only
-                            if (irnss_ephemeris_iter != pvt_solver->irnss_ephemeris_map.cend())
+                            if (irnss_ephemeris_iter != pvt_solver->irnss_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, irnss_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and (pvt_solver->irnss_utc_model.d_A0 != 0))
@@ -864,7 +865,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                             break;
                         case 2:  // GPS L2C only
                         case 3:  // GPS L5
-                            if (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend())
+                            if (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, gps_cnav_ephemeris_iter->second, rx_time, gnss_observables_map);
                                 }
@@ -876,7 +877,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 4:  // Galileo E1B only
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "1B");
                                 }
@@ -888,7 +889,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 5:  // Galileo E5a only
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "5X");
                                 }
@@ -900,7 +901,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 6:  // Galileo E5b only
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "7X");
                                 }
@@ -912,7 +913,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 7:  // GPS L1 C/A + GPS L2C
-                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and (pvt_solver->gps_utc_model.A0 != 0))
@@ -924,7 +925,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 8:  // L1+L5
-                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and ((pvt_solver->gps_cnav_utc_model.A0 != 0) or (pvt_solver->gps_utc_model.A0 != 0)))
@@ -944,7 +945,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 9:  // GPS L1 C/A + Galileo E1B
-                            if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                            if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and (pvt_solver->gps_utc_model.A0 != 0))
@@ -956,7 +957,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 13:  // L5+E5a
-                            if ((gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                            if ((gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gnss_observables_map);
                                 }
@@ -968,7 +969,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 14:  // Galileo E1B + Galileo E5a
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "1B 5X");
                                 }
@@ -980,7 +981,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 15:  // Galileo E1B + Galileo E5b
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "1B 7X");
                                 }
@@ -992,7 +993,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 23:  // GLONASS L1 C/A only
-                            if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                            if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, glonass_gnav_ephemeris_iter->second, rx_time, gnss_observables_map, "1C");
                                 }
@@ -1004,7 +1005,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 24:  // GLONASS L2 C/A only
-                            if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                            if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, glonass_gnav_ephemeris_iter->second, rx_time, gnss_observables_map, "2C");
                                 }
@@ -1016,7 +1017,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 25:  // GLONASS L1 C/A + GLONASS L2 C/A
-                            if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                            if (glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, glonass_gnav_ephemeris_iter->second, rx_time, gnss_observables_map, "1C 2C");
                                 }
@@ -1028,7 +1029,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 26:  // GPS L1 C/A + GLONASS L1 C/A
-                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and (pvt_solver->gps_utc_model.A0 != 0))
@@ -1040,7 +1041,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 27:  // Galileo E1B + GLONASS L1 C/A
-                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, gnss_observables_map);
                                 }
@@ -1052,7 +1053,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 28:  // GPS L2C + GLONASS L1 C/A
-                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, gnss_observables_map);
                                 }
@@ -1064,7 +1065,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 29:  // GPS L1 C/A + GLONASS L2 C/A
-                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and (pvt_solver->gps_utc_model.A0 != 0))
@@ -1076,7 +1077,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 30:  // Galileo E1B + GLONASS L2 C/A
-                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, gnss_observables_map);
                                 }
@@ -1088,7 +1089,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 31:  // GPS L2C + GLONASS L2 C/A
-                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                            if ((glonass_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_cnav_ephemeris_iter->second, glonass_gnav_ephemeris_iter->second, rx_time, gnss_observables_map);
                                 }
@@ -1100,7 +1101,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 32:  // L1+E1+L5+E5a
-                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and ((pvt_solver->gps_cnav_utc_model.A0 != 0) or (pvt_solver->gps_utc_model.A0 != 0)) and (pvt_solver->galileo_utc_model.A0 != 0))
@@ -1120,7 +1121,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 33:  // L1+E1+E5a
-                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()))
+                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and (pvt_solver->gps_utc_model.A0 != 0) and (pvt_solver->galileo_utc_model.A0 != 0))
@@ -1132,7 +1133,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 101:  // Galileo E1B + Galileo E6B
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "1B");
                                 }
@@ -1144,7 +1145,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 102:  // Galileo E5a + Galileo E6B
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "5X");
                                 }
@@ -1156,7 +1157,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 103:  // Galileo E5b + Galileo E6B
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "5X");
                                 }
@@ -1168,7 +1169,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 104:  // Galileo E1B + Galileo E5a + Galileo E6B
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "1B 5X");
                                 }
@@ -1180,7 +1181,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 105:  // Galileo E1B + Galileo E5b + Galileo E6B
-                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend())
+                            if (galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, "1B 7X");
                                 }
@@ -1192,7 +1193,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 106:  // GPS L1 C/A + Galileo E1B + Galileo E6B
-                            if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()))
+                            if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gnss_observables_map);
                                     if (!d_rinex_header_updated and (pvt_solver->gps_utc_model.A0 != 0))
@@ -1204,7 +1205,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 500:  // BDS B1I only
-                            if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.cend())
+                            if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, beidou_dnav_ephemeris_iter->second, rx_time, gnss_observables_map, "B1");
                                 }
@@ -1216,7 +1217,7 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 600:  // BDS B3I only
-                            if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.cend())
+                            if (beidou_dnav_ephemeris_iter != pvt_solver->beidou_dnav_ephemeris_map.map().cend())
                                 {
                                     log_rinex_obs(obsFile, beidou_dnav_ephemeris_iter->second, rx_time, gnss_observables_map, "B3");
                                 }
@@ -1228,8 +1229,8 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 1000:  // GPS L1 C/A + GPS L2C + GPS L5
-                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and
-                                (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                            if ((gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and
+                                (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, rx_time, gnss_observables_map, true);
                                 }
@@ -1241,9 +1242,9 @@ void Rinex_Printer::print_rinex_annotation(const Rtklib_Solver* pvt_solver, cons
                                 }
                             break;
                         case 1001:  // GPS L1 C/A + Galileo E1B + GPS L2C + GPS L5 + Galileo E5a
-                            if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.cend()) and
-                                (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.cend()) and
-                                (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                            if ((galileo_ephemeris_iter != pvt_solver->galileo_ephemeris_map.map().cend()) and
+                                (gps_ephemeris_iter != pvt_solver->gps_ephemeris_map.map().cend()) and
+                                (gps_cnav_ephemeris_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                 {
                                     log_rinex_obs(obsFile, gps_ephemeris_iter->second, gps_cnav_ephemeris_iter->second, galileo_ephemeris_iter->second, rx_time, gnss_observables_map, true);
                                 }
@@ -1761,6 +1762,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Glonass_Gnav_Utc_M
             out << line << '\n';
         }
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -1921,6 +1929,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Gps_Iono& gps_iono
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -2045,6 +2060,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Gps_CNAV_Iono& gps
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -2159,6 +2181,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Galileo_Iono& gali
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -2265,6 +2294,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Galileo_Iono& iono
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -2381,6 +2417,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Gps_CNAV_Iono& ion
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -2513,6 +2556,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Gps_CNAV_Iono& ion
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -2760,6 +2810,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Gps_Iono& iono, co
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -3006,6 +3063,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Irnss_Iono& iono,
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -3171,6 +3235,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Gps_Iono& gps_iono
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -3282,6 +3353,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Beidou_Dnav_Iono&
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -3433,6 +3511,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Gps_Iono& gps_iono
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -3564,6 +3649,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Gps_CNAV_Iono& gps
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -3680,6 +3772,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Glonass_Gnav_Utc_M
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -3811,6 +3910,13 @@ void Rinex_Printer::rinex_nav_header(std::fstream& out, const Galileo_Iono& gali
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for a line added by update_nav_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- End of Header
     line.clear();
     line += std::string(60, ' ');
@@ -3948,52 +4054,42 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Glonass_Gnav_Utc_
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
+            line_aux.clear();
 
-            if (!no_more_finds)
+            if ((line_str.find("GLUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
                 {
-                    line_aux.clear();
-
-                    if ((line_str.find("GLUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GLUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_c, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GLGP", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GLGP");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_gps, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
-                        }
-                    else
-                        {
-                            data.push_back(line_str);
-                        }
+                    line_aux += std::string("GLUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_c, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GLGP", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GLGP");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_gps, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
@@ -4001,16 +4097,7 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Glonass_Gnav_Utc_
                 }
         }
 
-    out.close();
-    out.open(navGlofilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navGlofilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    overwrite_header(out, navGlofilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC info.\n";
 }
 
@@ -4020,60 +4107,214 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
+        {
+            line_aux.clear();
+
+            if ((line_str.find("GAL", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GAL ");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai2, 10, 2), 12);
+                    const double zero = 0.0;
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(zero, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GAUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GAUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WNot), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GPGA", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GPGA");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A_0G, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A_1G, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.t_0G), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_0G), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                {
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.Delta_tLS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.Delta_tLSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    data.push_back(line_str);
+                    no_more_finds = true;
+                }
+            else
+                {
+                    data.push_back(line_str);
+                }
+        }
+
+    overwrite_header(out, navGalfilename, data);
+    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
+}
+
+
+void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Utc_Model& utc_model, const Gps_Iono& iono, const Gps_Ephemeris& eph) const
+{
+    std::vector<std::string> data;
+    std::string line_aux;
+
+    out.seekp(0);
+    data.clear();
+
+    bool no_more_finds = false;
+    std::string line_str;
+
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
+            line_aux.clear();
 
-            if (!no_more_finds)
+            if (d_version == 2)
                 {
-                    line_aux.clear();
+                    if (line_str.find("ION ALPHA", 59) != std::string::npos)
+                        {
+                            line_aux += std::string(2, ' ');
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
+                            line_aux += std::string(10, ' ');
+                            line_aux += Rinex_Printer::leftJustify("ION ALPHA", 20);
+                            data.push_back(line_aux);
+                        }
+                    else if (line_str.find("ION BETA", 59) != std::string::npos)
+                        {
+                            line_aux += std::string(2, ' ');
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
+                            line_aux += std::string(10, ' ');
+                            line_aux += Rinex_Printer::leftJustify("ION BETA", 20);
+                            data.push_back(line_aux);
+                        }
+                    else if (line_str.find("DELTA-UTC", 59) != std::string::npos)
+                        {
+                            line_aux += std::string(3, ' ');
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 18, 2), 19);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 18, 2), 19);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 9);
+                            if (d_pre_2009_file == false)
+                                {
+                                    if (eph.WN < 512)
+                                        {
+                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 2048), 9);  // valid from 2019 to 2029
+                                        }
+                                    else
+                                        {
+                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 9);  // valid from 2009 to 2019
+                                        }
+                                }
+                            else
+                                {
+                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256), 9);
+                                }
+                            line_aux += std::string(1, ' ');
+                            line_aux += Rinex_Printer::leftJustify("DELTA-UTC: A0,A1,T,W", 20);
+                            data.push_back(line_aux);
+                        }
+                    else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                        {
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
+                            line_aux += std::string(54, ' ');
+                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                            data.push_back(line_aux);
+                        }
+                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                        {
+                            data.push_back(line_str);
+                            no_more_finds = true;
+                        }
+                    else
+                        {
+                            data.push_back(line_str);
+                        }
+                }
 
-                    if ((line_str.find("GAL", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
+            if (d_version == 3)
+                {
+                    if (line_str.find("GPSA", 0) != std::string::npos)
                         {
-                            line_aux += std::string("GAL ");
+                            line_aux += std::string("GPSA");
                             line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai2, 10, 2), 12);
-                            const double zero = 0.0;
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(zero, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
                             line_aux += std::string(7, ' ');
                             line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
                             data.push_back(line_aux);
                         }
-                    else if ((line_str.find("GAUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                    else if (line_str.find("GPSB", 0) != std::string::npos)
                         {
-                            line_aux += std::string("GAUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WNot), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                            line_aux += std::string("GPSB");
+                            line_aux += std::string(1, ' ');
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
+                            line_aux += std::string(7, ' ');
+                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
                             data.push_back(line_aux);
                         }
-                    else if ((line_str.find("GPGA", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                    else if (line_str.find("GPUT", 0) != std::string::npos)
                         {
-                            line_aux += std::string("GPGA");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A_0G, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A_1G, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.t_0G), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_0G), 5);
+                            line_aux += std::string("GPUT");
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 16, 2), 18);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 15, 2), 16);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
+                            if (d_pre_2009_file == false)
+                                {
+                                    if (eph.WN < 512)
+                                        {
+                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 2048), 5);  // valid from 2019 to 2029
+                                        }
+                                    else
+                                        {
+                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 2009 to 2019
+                                        }
+                                }
+                            else
+                                {
+                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 1999 to 2008
+                                }
                             line_aux += std::string(10, ' ');
                             line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
                             data.push_back(line_aux);
                         }
                     else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
                         {
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.Delta_tLS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.Delta_tLSF), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
                             line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
                             line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
                             line_aux += std::string(36, ' ');
@@ -4090,410 +4331,104 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
                             data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
         }
 
-    out.close();
-    out.open(navGalfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navGalfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    overwrite_header(out, navfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
-
-void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Utc_Model& utc_model, const Gps_Iono& iono, const Gps_Ephemeris& eph) const
+void Rinex_Printer::update_nav_header(std::fstream& out, const Irnss_Utc_Model& utc_model, const Irnss_Iono& iono, const Irnss_Ephemeris& eph) const
 {
     std::vector<std::string> data;
     std::string line_aux;
 
-    int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
+            line_aux.clear();
 
-            if (!no_more_finds)
+            if (d_version == 2)
                 {
-                    line_aux.clear();
-
-                    if (d_version == 2)
+                    if (line_str.find("ION ALPHA", 59) != std::string::npos)
                         {
-                            if (line_str.find("ION ALPHA", 59) != std::string::npos)
-                                {
-                                    line_aux += std::string(2, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
-                                    line_aux += std::string(10, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("ION ALPHA", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("ION BETA", 59) != std::string::npos)
-                                {
-                                    line_aux += std::string(2, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
-                                    line_aux += std::string(10, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("ION BETA", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("DELTA-UTC", 59) != std::string::npos)
-                                {
-                                    line_aux += std::string(3, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 18, 2), 19);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 18, 2), 19);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 9);
-                                    if (d_pre_2009_file == false)
-                                        {
-                                            if (eph.WN < 512)
-                                                {
-                                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 2048), 9);  // valid from 2019 to 2029
-                                                }
-                                            else
-                                                {
-                                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 9);  // valid from 2009 to 2019
-                                                }
-                                        }
-                                    else
-                                        {
-                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256), 9);
-                                        }
-                                    line_aux += std::string(1, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("DELTA-UTC: A0,A1,T,W", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                                {
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
-                                    line_aux += std::string(54, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    no_more_finds = true;
-                                }
-                            else
-                                {
-                                    data.push_back(line_str);
-                                }
+                            line_aux += std::string(2, ' ');
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha0, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha1, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha2, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha3, 10, 2), 12);
+                            line_aux += std::string(10, ' ');
+                            line_aux += Rinex_Printer::leftJustify("ION ALPHA", 20);
+                            data.push_back(line_aux);
                         }
-
-                    if (d_version == 3)
+                    else if (line_str.find("ION BETA", 59) != std::string::npos)
                         {
-                            if (line_str.find("GPSA", 0) != std::string::npos)
-                                {
-                                    line_aux += std::string("GPSA");
-                                    line_aux += std::string(1, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
-                                    line_aux += std::string(7, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("GPSB", 0) != std::string::npos)
-                                {
-                                    line_aux += std::string("GPSB");
-                                    line_aux += std::string(1, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
-                                    line_aux += std::string(7, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("GPUT", 0) != std::string::npos)
-                                {
-                                    line_aux += std::string("GPUT");
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 16, 2), 18);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 15, 2), 16);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
-                                    if (d_pre_2009_file == false)
-                                        {
-                                            if (eph.WN < 512)
-                                                {
-                                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 2048), 5);  // valid from 2019 to 2029
-                                                }
-                                            else
-                                                {
-                                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 2009 to 2019
-                                                }
-                                        }
-                                    else
-                                        {
-                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 1999 to 2008
-                                        }
-                                    line_aux += std::string(10, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                                {
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
-                                    line_aux += std::string(36, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    no_more_finds = true;
-                                }
-                            else
-                                {
-                                    data.push_back(line_str);
-                                }
+                            line_aux += std::string(2, ' ');
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta0, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta1, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta2, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta3, 10, 2), 12);
+                            line_aux += std::string(10, ' ');
+                            line_aux += Rinex_Printer::leftJustify("ION BETA", 20);
+                            data.push_back(line_aux);
                         }
-                }
-            else
-                {
-                    data.push_back(line_str);
-                }
-        }
-
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
-}
-
-void Rinex_Printer::update_nav_header(std::fstream& out, const Irnss_Utc_Model& utc_model, const Irnss_Iono& iono, const Irnss_Ephemeris& eph) const
-{
-    std::vector<std::string> data;
-    std::string line_aux;
-
-    int64_t pos = out.tellp();
-    out.seekp(0);
-    data.clear();
-
-    bool no_more_finds = false;
-    std::string line_str;
-
-    while (!out.eof())
-        {
-            std::getline(out, line_str);
-
-            if (!no_more_finds)
-                {
-                    line_aux.clear();
-
-                    if (d_version == 2)
+                    else if (line_str.find("DELTA-UTC", 59) != std::string::npos)
                         {
-                            if (line_str.find("ION ALPHA", 59) != std::string::npos)
-                                {
-                                    line_aux += std::string(2, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha0, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha1, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha2, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha3, 10, 2), 12);
-                                    line_aux += std::string(10, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("ION ALPHA", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("ION BETA", 59) != std::string::npos)
-                                {
-                                    line_aux += std::string(2, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta0, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta1, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta2, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta3, 10, 2), 12);
-                                    line_aux += std::string(10, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("ION BETA", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("DELTA-UTC", 59) != std::string::npos)
+                            line_aux += std::string(3, ' ');
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.d_A0, 18, 2), 19);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.d_A1, 18, 2), 19);
+                            // line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 9);
+                            if (d_pre_2009_file == false)
                                 {
-                                    line_aux += std::string(3, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.d_A0, 18, 2), 19);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.d_A1, 18, 2), 19);
-                                    // line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 9);
-                                    if (d_pre_2009_file == false)
+                                    if (eph.i_IRNSS_week < 512)
                                         {
-                                            if (eph.i_IRNSS_week < 512)
-                                                {
-                                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 2048), 9);  // valid from 2019 to 2029
-                                                }
-                                            else
-                                                {
-                                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 1024), 9);  // valid from 2009 to 2019
-                                                }
+                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 2048), 9);  // valid from 2019 to 2029
                                         }
                                     else
                                         {
-                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256), 9);
+                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 1024), 9);  // valid from 2009 to 2019
                                         }
-                                    line_aux += std::string(1, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("DELTA-UTC: A0,A1,T,W", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                                {
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
-                                    line_aux += std::string(54, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    no_more_finds = true;
                                 }
                             else
                                 {
-                                    data.push_back(line_str);
+                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256), 9);
                                 }
+                            line_aux += std::string(1, ' ');
+                            line_aux += Rinex_Printer::leftJustify("DELTA-UTC: A0,A1,T,W", 20);
+                            data.push_back(line_aux);
                         }
-
-                    if (d_version == 3)
+                    else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
                         {
-                            if (line_str.find("GPSA", 0) != std::string::npos)
-                                {
-                                    line_aux += std::string("GPSA");
-                                    line_aux += std::string(1, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha0, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha1, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha2, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha3, 10, 2), 12);
-                                    line_aux += std::string(7, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("GPSB", 0) != std::string::npos)
-                                {
-                                    line_aux += std::string("GPSB");
-                                    line_aux += std::string(1, ' ');
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta0, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta1, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta2, 10, 2), 12);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta3, 10, 2), 12);
-                                    line_aux += std::string(7, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("GPUT", 0) != std::string::npos)
-                                {
-                                    line_aux += std::string("GPUT");
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.d_A0, 16, 2), 18);
-                                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.d_A1, 15, 2), 16);
-                                    // line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
-                                    if (d_pre_2009_file == false)
-                                        {
-                                            if (eph.i_IRNSS_week < 512)
-                                                {
-                                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 2048), 5);  // valid from 2019 to 2029
-                                                }
-                                            else
-                                                {
-                                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 1024), 5);  // valid from 2009 to 2019
-                                                }
-                                        }
-                                    else
-                                        {
-                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 1024), 5);  // valid from 1999 to 2008
-                                        }
-                                    line_aux += std::string(10, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                                {
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_LSF), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_DN), 6);
-                                    line_aux += std::string(36, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    no_more_finds = true;
-                                }
-                            else
-                                {
-                                    data.push_back(line_str);
-                                }
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
+                            line_aux += std::string(54, ' ');
+                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                            data.push_back(line_aux);
+                        }
+                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                        {
+                            data.push_back(line_str);
+                            no_more_finds = true;
+                        }
+                    else
+                        {
+                            data.push_back(line_str);
                         }
                 }
-            else
-                {
-                    data.push_back(line_str);
-                }
-        }
-
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navIrnfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
-    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
-}
-
-void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Model& utc_model, const Gps_CNAV_Iono& iono) const
-{
-    std::vector<std::string> data;
-    std::string line_aux;
 
-    const int64_t pos = out.tellp();
-    out.seekp(0);
-    data.clear();
-
-    bool no_more_finds = false;
-    std::string line_str;
-
-    while (!out.eof())
-        {
-            std::getline(out, line_str);
-
-            if (!no_more_finds)
+            if (d_version == 3)
                 {
-                    line_aux.clear();
-
                     if (line_str.find("GPSA", 0) != std::string::npos)
                         {
                             line_aux += std::string("GPSA");
                             line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha0, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha1, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha2, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_alpha3, 10, 2), 12);
                             line_aux += std::string(7, ' ');
                             line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
                             data.push_back(line_aux);
@@ -4502,10 +4437,10 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                         {
                             line_aux += std::string("GPSB");
                             line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta0, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta1, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta2, 10, 2), 12);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.d_beta3, 10, 2), 12);
                             line_aux += std::string(7, ' ');
                             line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
                             data.push_back(line_aux);
@@ -4513,20 +4448,34 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                     else if (line_str.find("GPUT", 0) != std::string::npos)
                         {
                             line_aux += std::string("GPUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T), 5);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.d_A0, 16, 2), 18);
+                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.d_A1, 15, 2), 16);
+                            // line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
+                            if (d_pre_2009_file == false)
+                                {
+                                    if (eph.i_IRNSS_week < 512)
+                                        {
+                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 2048), 5);  // valid from 2019 to 2029
+                                        }
+                                    else
+                                        {
+                                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 1024), 5);  // valid from 2009 to 2019
+                                        }
+                                }
+                            else
+                                {
+                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_T + (eph.i_IRNSS_week / 256) * 256 + 1024), 5);  // valid from 1999 to 2008
+                                }
                             line_aux += std::string(10, ' ');
                             line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
                             data.push_back(line_aux);
                         }
                     else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
                         {
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_LSF), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_DN), 6);
                             line_aux += std::string(36, ' ');
                             line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
                             data.push_back(line_aux);
@@ -4541,22 +4490,84 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                             data.push_back(line_str);
                         }
                 }
+        }
+
+    overwrite_header(out, navIrnfilename, data);
+    std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
+}
+
+void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Model& utc_model, const Gps_CNAV_Iono& iono) const
+{
+    std::vector<std::string> data;
+    std::string line_aux;
+
+    out.seekp(0);
+    data.clear();
+
+    bool no_more_finds = false;
+    std::string line_str;
+
+    while (!no_more_finds && std::getline(out, line_str))
+        {
+            line_aux.clear();
+
+            if (line_str.find("GPSA", 0) != std::string::npos)
+                {
+                    line_aux += std::string("GPSA");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("GPSB", 0) != std::string::npos)
+                {
+                    line_aux += std::string("GPSB");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("GPUT", 0) != std::string::npos)
+                {
+                    line_aux += std::string("GPUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                {
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    data.push_back(line_str);
+                    no_more_finds = true;
+                }
             else
                 {
                     data.push_back(line_str);
                 }
         }
 
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    overwrite_header(out, navfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
@@ -4566,126 +4577,107 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Utc_Mode
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
-        {
-            std::getline(out, line_str);
-
-            if (!no_more_finds)
+    while (!no_more_finds && std::getline(out, line_str))
+        {
+            line_aux.clear();
+            if ((line_str.find("GAL", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GAL ");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai2, 10, 2), 12);
+                    const double zero = 0.0;
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(zero, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GPSA", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GPSA");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GPSB", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GPSB");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+
+            else if ((line_str.find("GAUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GAUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A0, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A1, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.tot), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WNot), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GPGA", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GPGA");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A_0G, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A_1G, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.t_0G), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WN_0G), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("GPUT", 0) != std::string::npos)
+                {
+                    line_aux += std::string("GPUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                {
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
                 {
-                    line_aux.clear();
-                    if ((line_str.find("GAL", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GAL ");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai2, 10, 2), 12);
-                            const double zero = 0.0;
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(zero, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GPSA", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GPSA");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GPSB", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GPSB");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-
-                    else if ((line_str.find("GAUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GAUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A0, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A1, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.tot), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WNot), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GPGA", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GPGA");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A_0G, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A_1G, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.t_0G), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WN_0G), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("GPUT", 0) != std::string::npos)
-                        {
-                            line_aux += std::string("GPUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.tot), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_T), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                        {
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
-                            line_aux += std::string(36, ' ');
-                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
-                        }
-                    else
-                        {
-                            data.push_back(line_str);
-                        }
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
                     data.push_back(line_str);
                 }
         }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    overwrite_header(out, navfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
@@ -4695,141 +4687,122 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
-        {
-            std::getline(out, line_str);
-
-            if (!no_more_finds)
-                {
-                    line_aux.clear();
-
-                    if (line_str.find("GPSA", 0) != std::string::npos)
-                        {
-                            line_aux += std::string("GPSA");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha3, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GAL", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GAL ");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai2, 10, 2), 12);
-                            const double zero = 0.0;
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(zero, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GPSB", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GPSB");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.beta0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.beta1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.beta2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.beta3, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GPUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GPUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A0, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A1, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.tot), 7);
-                            if (d_pre_2009_file == false)
+    while (!no_more_finds && std::getline(out, line_str))
+        {
+            line_aux.clear();
+
+            if (line_str.find("GPSA", 0) != std::string::npos)
+                {
+                    line_aux += std::string("GPSA");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GAL", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GAL ");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai2, 10, 2), 12);
+                    const double zero = 0.0;
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(zero, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GPSB", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GPSB");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.beta0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.beta1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.beta2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.beta3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GPUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GPUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A0, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A1, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.tot), 7);
+                    if (d_pre_2009_file == false)
+                        {
+                            if (eph.WN < 512)
                                 {
-                                    if (eph.WN < 512)
-                                        {
-                                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 2048), 5);  // valid from 2019 to 2029
-                                        }
-                                    else
-                                        {
-                                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 2009 to 2019
-                                        }
+                                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 2048), 5);  // valid from 2019 to 2029
                                 }
                             else
                                 {
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 1999 to 2008
+                                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 2009 to 2019
                                 }
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GAUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GAUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A0, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A1, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.tot), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WNot), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GPGA", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GPGA");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A_0G, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A_1G, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.t_0G), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WN_0G), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                        {
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DN), 6);
-                            line_aux += std::string(36, ' ');
-                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
                         }
                     else
                         {
-                            data.push_back(line_str);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 1999 to 2008
                         }
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GAUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GAUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A0, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A1, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.tot), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WNot), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GPGA", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GPGA");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A_0G, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A_1G, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.t_0G), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WN_0G), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                {
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
                     data.push_back(line_str);
                 }
         }
-
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+
+    overwrite_header(out, navMixfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
@@ -4842,99 +4815,89 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
+            line_aux.clear();
 
-            if (!no_more_finds)
+            if (line_str.find("GPSA", 0) != std::string::npos)
                 {
-                    line_aux.clear();
-
-                    if (line_str.find("GPSA", 0) != std::string::npos)
-                        {
-                            line_aux += std::string("GPSA");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha3, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GPUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                    line_aux += std::string("GPSA");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GPUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GPUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A0, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A1, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.tot), 7);
+                    if (d_pre_2009_file == false)
                         {
-                            line_aux += std::string("GPUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A0, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A1, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.tot), 7);
-                            if (d_pre_2009_file == false)
+                            if (eph.WN < 512)
                                 {
-                                    if (eph.WN < 512)
-                                        {
-                                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 2048), 5);  // valid from 2019 to 2029
-                                        }
-                                    else
-                                        {
-                                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 2009 to 2019
-                                        }
+                                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 2048), 5);  // valid from 2019 to 2029
                                 }
                             else
                                 {
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256), 5);
+                                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256 + 1024), 5);  // valid from 2009 to 2019
                                 }
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GLUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GLUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_c, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GLGP", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GLGP");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_gps, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                        {
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DN), 6);
-                            line_aux += std::string(36, ' ');
-                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
                         }
                     else
                         {
-                            data.push_back(line_str);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T + (eph.WN / 256) * 256), 5);
                         }
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GLUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GLUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_c, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GLGP", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GLGP");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_gps, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                {
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
@@ -4942,16 +4905,7 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_Iono& gps_ion
                 }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    overwrite_header(out, navMixfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
@@ -4964,85 +4918,75 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Iono& gp
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
-        {
-            std::getline(out, line_str);
-
-            if (!no_more_finds)
+    while (!no_more_finds && std::getline(out, line_str))
+        {
+            line_aux.clear();
+
+            if (line_str.find("GPSA", 0) != std::string::npos)
+                {
+                    line_aux += std::string("GPSA");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GPUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GPUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A0, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A1, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.tot), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GLUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GLUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_c, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GLGP", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GLGP");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_gps, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                {
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
                 {
-                    line_aux.clear();
-
-                    if (line_str.find("GPSA", 0) != std::string::npos)
-                        {
-                            line_aux += std::string("GPSA");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_iono.alpha3, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GPUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GPUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A0, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(gps_utc_model.A1, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.tot), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_T), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GLUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GLUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_c, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GLGP", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GLGP");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_gps, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                        {
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DeltaT_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(gps_utc_model.DN), 6);
-                            line_aux += std::string(36, ' ');
-                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
-                        }
-                    else
-                        {
-                            data.push_back(line_str);
-                        }
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
@@ -5050,16 +4994,7 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Gps_CNAV_Iono& gp
                 }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    overwrite_header(out, navMixfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
@@ -5076,75 +5011,65 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
-        {
-            std::getline(out, line_str);
-
-            if (!no_more_finds)
+    while (!no_more_finds && std::getline(out, line_str))
+        {
+            line_aux.clear();
+
+            if ((line_str.find("GAL", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GAL ");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai2, 10, 2), 12);
+                    const double zero = 0.0;
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(zero, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GAUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GAUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A0, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A1, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.tot), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WNot), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if ((line_str.find("GLUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
+                {
+                    line_aux += std::string("GLUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_c, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
+                    line_aux += std::string(10, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                {
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.Delta_tLS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.Delta_tLSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
                 {
-                    line_aux.clear();
-
-                    if ((line_str.find("GAL", 0) != std::string::npos) && (line_str.find("IONOSPHERIC CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GAL ");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_iono.ai2, 10, 2), 12);
-                            const double zero = 0.0;
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(zero, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GAUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GAUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A0, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(galileo_utc_model.A1, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.tot), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WNot), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if ((line_str.find("GLUT", 0) != std::string::npos) && (line_str.find("TIME SYSTEM CORR", 59) != std::string::npos))
-                        {
-                            line_aux += std::string("GLUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(glonass_gnav_utc_model.d_tau_c, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(0.0, 15, 2), 16);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 7);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(0.0), 5);
-                            line_aux += std::string(10, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                        {
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.Delta_tLS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.Delta_tLSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.DN), 6);
-                            line_aux += std::string(36, ' ');
-                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
-                        }
-                    else
-                        {
-                            data.push_back(line_str);
-                        }
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
@@ -5152,16 +5077,7 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Galileo_Iono& gal
                 }
         }
 
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navMixfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    overwrite_header(out, navMixfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
@@ -5171,73 +5087,63 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Beidou_Dnav_Utc_M
     std::vector<std::string> data;
     std::string line_aux;
 
-    const int64_t pos = out.tellp();
     out.seekp(0);
     data.clear();
 
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
+            line_aux.clear();
 
-            if (!no_more_finds)
+            if (line_str.find("BDSA", 0) != std::string::npos)
                 {
-                    line_aux.clear();
-
-                    if (line_str.find("BDSA", 0) != std::string::npos)
-                        {
-                            line_aux += std::string("BDSA");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("BDSB", 0) != std::string::npos)
-                        {
-                            line_aux += std::string("BDSB");
-                            line_aux += std::string(1, ' ');
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
-                            line_aux += std::string(7, ' ');
-                            line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("BDUT", 0) != std::string::npos)
-                        {
-                            line_aux += std::string("BDUT");
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0_UTC, 16, 2), 18);
-                            line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1_UTC, 15, 2), 16);
-                            line_aux += std::string(22, ' ');
-                            line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
-                        {
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
-                            line_aux += std::string(36, ' ');
-                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
-                        }
-                    else
-                        {
-                            data.push_back(line_str);
-                        }
+                    line_aux += std::string("BDSA");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.alpha3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("BDSB", 0) != std::string::npos)
+                {
+                    line_aux += std::string("BDSB");
+                    line_aux += std::string(1, ' ');
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta0, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta1, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta2, 10, 2), 12);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(iono.beta3, 10, 2), 12);
+                    line_aux += std::string(7, ' ');
+                    line_aux += Rinex_Printer::leftJustify("IONOSPHERIC CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("BDUT", 0) != std::string::npos)
+                {
+                    line_aux += std::string("BDUT");
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A0_UTC, 16, 2), 18);
+                    line_aux += Rinex_Printer::rightJustify(Rinex_Printer::doub2for(utc_model.A1_UTC, 15, 2), 16);
+                    line_aux += std::string(22, ' ');
+                    line_aux += Rinex_Printer::leftJustify("TIME SYSTEM CORR", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("LEAP SECONDS", 59) != std::string::npos)
+                {
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
@@ -5245,16 +5151,7 @@ void Rinex_Printer::update_nav_header(std::fstream& out, const Beidou_Dnav_Utc_M
                 }
         }
 
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(navfilename, std::ios::out | std::ios::app);
-    out.seekp(pos);
+    overwrite_header(out, navfilename, data);
     std::cout << "The RINEX Navigation file header has been updated with UTC and IONO info.\n";
 }
 
@@ -7102,6 +6999,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Glonass_Gnav_Ephem
             out << line << '\n';
         }
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- END OF HEADER
     line.clear();
     line += std::string(60, ' ');
@@ -7458,6 +7362,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& gps
             out << line << '\n';
         }
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -7778,6 +7689,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_CNAV_Ephemeris
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -8098,6 +8016,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Galileo_Ephemeris&
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -8362,6 +8287,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& eph
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -8625,6 +8557,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Irnss_Ephemeris& e
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -8873,6 +8812,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_CNAV_Ephemeris
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -9146,8 +9092,15 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& eph
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
-    // -------- SYS /PHASE SHIFTS
-
+    // -------- SYS /PHASE SHIFTS
+
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -9499,6 +9452,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& gps
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -9820,6 +9780,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_CNAV_Ephemeris
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -10084,6 +10051,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Galileo_Ephemeris&
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -10377,6 +10351,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Gps_Ephemeris& gps
     Rinex_Printer::lengthCheck(line);
     out << line << '\n';
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -10609,6 +10590,13 @@ void Rinex_Printer::rinex_obs_header(std::fstream& out, const Beidou_Dnav_Epheme
 
     // -------- SYS /PHASE SHIFTS
 
+    // -------- Line COMMENT (blank, reserved for the LEAP SECONDS line added by update_obs_header())
+    line.clear();
+    line += std::string(60, ' ');
+    line += Rinex_Printer::leftJustify("COMMENT", 20);
+    Rinex_Printer::lengthCheck(line);
+    out << line << '\n';
+
     // -------- end of header
     line.clear();
     line += std::string(60, ' ');
@@ -10638,75 +10626,57 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_Utc_Model& ut
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
+            line_aux.clear();
 
-            if (!no_more_finds)
+            if (d_version == 2)
                 {
-                    line_aux.clear();
-
-                    if (d_version == 2)
+                    if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)  // TIME OF FIRST OBS last header annotation might change in the future
                         {
-                            if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)  // TIME OF FIRST OBS last header annotation might change in the future
-                                {
-                                    data.push_back(line_str);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
-                                    line_aux += std::string(54, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    no_more_finds = true;
-                                }
-                            else
-                                {
-                                    data.push_back(line_str);
-                                }
+                            data.push_back(line_str);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
+                            line_aux += std::string(54, ' ');
+                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                            data.push_back(line_aux);
                         }
-
-                    if (d_version == 3)
+                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
                         {
-                            if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
-                                    line_aux += std::string(36, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    no_more_finds = true;
-                                }
-                            else
-                                {
-                                    data.push_back(line_str);
-                                }
+                            data.push_back(line_str);
+                            no_more_finds = true;
+                        }
+                    else
+                        {
+                            data.push_back(line_str);
                         }
                 }
-            else
+
+            if (d_version == 3)
                 {
-                    data.push_back(line_str);
+                    if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
+                        {
+                            data.push_back(line_str);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
+                            line_aux += std::string(36, ' ');
+                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                            data.push_back(line_aux);
+                        }
+                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                        {
+                            data.push_back(line_str);
+                            no_more_finds = true;
+                        }
+                    else
+                        {
+                            data.push_back(line_str);
+                        }
                 }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    overwrite_header(out, obsfilename, data);
 }
 
 void Rinex_Printer::update_obs_header(std::fstream& out, const Irnss_Utc_Model& utc_model) const
@@ -10720,75 +10690,57 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Irnss_Utc_Model&
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
+            line_aux.clear();
 
-            if (!no_more_finds)
+            if (d_version == 2)
                 {
-                    line_aux.clear();
-
-                    if (d_version == 2)
+                    if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)  // TIME OF FIRST OBS last header annotation might change in the future
                         {
-                            if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)  // TIME OF FIRST OBS last header annotation might change in the future
-                                {
-                                    data.push_back(line_str);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
-                                    line_aux += std::string(54, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    no_more_finds = true;
-                                }
-                            else
-                                {
-                                    data.push_back(line_str);
-                                }
+                            data.push_back(line_str);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
+                            line_aux += std::string(54, ' ');
+                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                            data.push_back(line_aux);
                         }
-
-                    if (d_version == 3)
+                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
                         {
-                            if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LSF), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_LSF), 6);
-                                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_DN), 6);
-                                    line_aux += std::string(36, ' ');
-                                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                                    data.push_back(line_aux);
-                                }
-                            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                                {
-                                    data.push_back(line_str);
-                                    no_more_finds = true;
-                                }
-                            else
-                                {
-                                    data.push_back(line_str);
-                                }
+                            data.push_back(line_str);
+                            no_more_finds = true;
+                        }
+                    else
+                        {
+                            data.push_back(line_str);
                         }
                 }
-            else
+
+            if (d_version == 3)
                 {
-                    data.push_back(line_str);
+                    if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
+                        {
+                            data.push_back(line_str);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LS), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.d_DeltaT_LSF), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_WN_LSF), 6);
+                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.i_DN), 6);
+                            line_aux += std::string(36, ' ');
+                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                            data.push_back(line_aux);
+                        }
+                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                        {
+                            data.push_back(line_str);
+                            no_more_finds = true;
+                        }
+                    else
+                        {
+                            data.push_back(line_str);
+                        }
                 }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    overwrite_header(out, obsfilename, data);
 }
 
 void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_CNAV_Utc_Model& utc_model) const
@@ -10802,33 +10754,24 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_CNAV_Utc_Mode
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
-
-            if (!no_more_finds)
+            line_aux.clear();
+            if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
                 {
-                    line_aux.clear();
-                    if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
-                            line_aux += std::string(36, ' ');
-                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
-                        }
-                    else
-                        {
-                            data.push_back(line_str);
-                        }
+                    data.push_back(line_str);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
@@ -10836,16 +10779,7 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Gps_CNAV_Utc_Mode
                 }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    overwrite_header(out, obsfilename, data);
 }
 
 
@@ -10860,34 +10794,25 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Galileo_Utc_Model
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
+            line_aux.clear();
 
-            if (!no_more_finds)
+            if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
                 {
-                    line_aux.clear();
-
-                    if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.Delta_tLS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.Delta_tLSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.DN), 6);
-                            line_aux += std::string(36, ' ');
-                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
-                        }
-                    else
-                        {
-                            data.push_back(line_str);
-                        }
+                    data.push_back(line_str);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.Delta_tLS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.Delta_tLSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(galileo_utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
@@ -10895,16 +10820,7 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Galileo_Utc_Model
                 }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
-        {
-            out << data[i] << '\n';
-        }
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
-    out.seekp(0, std::ios_base::end);
+    overwrite_header(out, obsfilename, data);
 }
 
 
@@ -10919,34 +10835,25 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Beidou_Dnav_Utc_M
     bool no_more_finds = false;
     std::string line_str;
 
-    while (!out.eof())
+    while (!no_more_finds && std::getline(out, line_str))
         {
-            std::getline(out, line_str);
+            line_aux.clear();
 
-            if (!no_more_finds)
+            if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
                 {
-                    line_aux.clear();
-
-                    if (line_str.find("TIME OF FIRST OBS", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
-                            line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
-                            line_aux += std::string(36, ' ');
-                            line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
-                            data.push_back(line_aux);
-                        }
-                    else if (line_str.find("END OF HEADER", 59) != std::string::npos)
-                        {
-                            data.push_back(line_str);
-                            no_more_finds = true;
-                        }
-                    else
-                        {
-                            data.push_back(line_str);
-                        }
+                    data.push_back(line_str);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LS), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DeltaT_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.WN_LSF), 6);
+                    line_aux += Rinex_Printer::rightJustify(std::to_string(utc_model.DN), 6);
+                    line_aux += std::string(36, ' ');
+                    line_aux += Rinex_Printer::leftJustify("LEAP SECONDS", 20);
+                    data.push_back(line_aux);
+                }
+            else if (line_str.find("END OF HEADER", 59) != std::string::npos)
+                {
+                    data.push_back(line_str);
+                    no_more_finds = true;
                 }
             else
                 {
@@ -10954,16 +10861,85 @@ void Rinex_Printer::update_obs_header(std::fstream& out, const Beidou_Dnav_Utc_M
                 }
         }
 
-    out.close();
-    out.open(obsfilename, std::ios::out | std::ios::trunc);
-    out.seekp(0);
-    for (int32_t i = 0; i < static_cast<int32_t>(data.size()) - 1; i++)
+    overwrite_header(out, obsfilename, data);
+}
+
+
+bool Rinex_Printer::overwrite_header(std::fstream& out, const std::string& filename, std::vector<std::string>& header) const
+{
+    // The stream is positioned just after the END OF HEADER line
+    std::streamoff header_size = out.tellg();
+    out.clear();
+    if (header_size < 0)
+        {
+            // No END OF HEADER line, the whole file was read as header
+            out.seekg(0, std::ios_base::end);
+            header_size = out.tellg();
+        }
+
+    // Blank COMMENT lines were reserved in the header to absorb new lines
+    const std::string reserved_line = std::string(60, ' ') + Rinex_Printer::leftJustify("COMMENT", 20);
+    int64_t new_size = 0;
+    for (const auto& line : header)
+        {
+            new_size += static_cast<int64_t>(line.size()) + 1;
+        }
+    for (auto it = header.begin(); it != header.end() && new_size > header_size;)
+        {
+            if (*it == reserved_line)
+                {
+                    new_size -= static_cast<int64_t>(reserved_line.size()) + 1;
+                    it = header.erase(it);
+                }
+            else
+                {
+                    ++it;
+                }
+        }
+
+    std::string new_header;
+    new_header.reserve(static_cast<size_t>(new_size));
+    for (const auto& line : header)
+        {
+            new_header += line;
+            new_header += '\n';
+        }
+
+    if (new_size == header_size)
         {
-            out << data[i] << '\n';
+            // Same size: patch the header in place, the records are not touched
+            out.flush();
+            const int fd = ::open(filename.c_str(), O_WRONLY);
+            bool written = fd >= 0;
+            size_t offset = 0;
+            while (written && offset < new_header.size())
+                {
+                    const ssize_t n = ::pwrite(fd, new_header.data() + offset, new_header.size() - offset, static_cast<off_t>(offset));
+                    written = n > 0;
+                    offset += written ? static_cast<size_t>(n) : 0;
+                }
+            if (fd >= 0)
+                {
+                    ::close(fd);
+                }
+            if (written)
+                {
+                    out.seekp(0, std::ios_base::end);
+                    return true;
+                }
+            LOG(WARNING) << "Could not update the header of " << filename << " in place, rewriting the file";
         }
+
+    // The header does not fit in its former space: rewrite the whole file
+    out.seekg(header_size);
+    const std::string records((std::istreambuf_iterator<char>(out)), std::istreambuf_iterator<char>());
+    out.close();
+    out.open(filename, std::ios::out | std::ios::trunc);
+    out << new_header << records;
     out.close();
-    out.open(obsfilename, std::ios::out | std::ios::in | std::ios::app);
+    out.open(filename, std::ios::out | std::ios::in | std::ios::app);
     out.seekp(0, std::ios_base::end);
+    return false;
 }
 
 
@@ -810,6 +810,17 @@ private:
     void update_obs_header(std::fstream& out,
         const Beidou_Dnav_Utc_Model& utc_model) const;
 
+    /*
+     * Replaces the header of the file with the lines in header, once out has
+     * been read up to the END OF HEADER line. If the new header takes the same
+     * space as the old one (new lines can be absorbed by the reserved blank
+     * COMMENT lines), it is patched in place and the records are not read.
+     * Otherwise, the whole file is rewritten. Returns true if patched in place.
+     */
+    bool overwrite_header(std::fstream& out,
+        const std::string& filename,
+        std::vector<std::string>& header) const;
+
     /*
      * Generation of RINEX signal strength indicators
      */
@@ -236,15 +236,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 1:  // GPS L1 C/A
                             if (flag_write_RTCM_1019_output == true)
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -255,15 +255,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 6:  // Galileo E5b
                             if (flag_write_RTCM_1045_output == true)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -272,16 +272,16 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 7:  // GPS L1 C/A + GPS L2C
                             if (flag_write_RTCM_1019_output == true)
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    const auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                    if ((gps_eph_iter != pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    const auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.map().cbegin();
+                                    if ((gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -290,16 +290,16 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 8:  // L1+L5
                             if (flag_write_RTCM_1019_output == true)
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    const auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                    if ((gps_eph_iter != pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    const auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.map().cbegin();
+                                    if ((gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -308,22 +308,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 9:  // GPS L1 C/A + Galileo E1B
                             if (flag_write_RTCM_1019_output == true)
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_1045_output == true)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
                                     int gps_channel = 0;
                                     int gal_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -334,8 +334,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -345,19 +345,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "E")
                                                         {
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -366,7 +366,7 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 13:  // L5+E5a
                             if (flag_write_RTCM_1045_output == true)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
@@ -374,8 +374,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
 
                             if (flag_write_RTCM_MSM_output and rtcm_MSM_rate_ms != 0)
                                 {
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.map().cbegin();
                                     int gal_channel = 0;
                                     int gps_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -386,8 +386,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.cend())
+                                                            gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -397,8 +397,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "E")
                                                         {
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
@@ -406,11 +406,11 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 }
                                         }
 
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend() and (rtcm_MT1097_rate_ms != 0))
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend() and (rtcm_MT1097_rate_ms != 0))
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.cend() and (rtcm_MT1077_rate_ms != 0))
+                                    if (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend() and (rtcm_MT1077_rate_ms != 0))
                                         {
                                             Print_Rtcm_MSM(7, {}, gps_cnav_eph_iter->second, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -420,15 +420,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 15:  // Galileo E1B + Galileo E5b
                             if (flag_write_RTCM_1045_output == true)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -439,15 +439,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 25:  // GLONASS L1 C/A + GLONASS L2 C/A
                             if (flag_write_RTCM_1020_output == true)
                                 {
-                                    for (const auto& glonass_gnav_ephemeris_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_ephemeris_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_ephemeris_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    const auto glo_gnav_ephemeris_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                    if (glo_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    const auto glo_gnav_ephemeris_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
+                                    if (glo_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glo_gnav_ephemeris_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -457,22 +457,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 26:  // GPS L1 C/A + GLONASS L1 C/A
                             if (flag_write_RTCM_1019_output == true)
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_1020_output == true)
                                 {
-                                    for (const auto& glonass_gnav_ephemeris_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_ephemeris_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_ephemeris_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
+                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
                                     int gps_channel = 0;
                                     int glo_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -483,8 +483,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -494,8 +494,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "R")
                                                         {
-                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                                                 {
                                                                     glo_channel = 1;
                                                                 }
@@ -503,11 +503,11 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 }
                                         }
 
-                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -516,22 +516,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 27:  // GLONASS L1 C/A + Galileo E1B
                             if (flag_write_RTCM_1020_output == true)
                                 {
-                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_eph_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (flag_write_RTCM_1045_output == true)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
                                     int gal_channel = 0;
                                     int glo_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -542,8 +542,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "E")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
@@ -553,19 +553,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "R")
                                                         {
-                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                                                 {
                                                                     glo_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -574,22 +574,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 29:  // GPS L1 C/A + GLONASS L2 C/A
                             if (flag_write_RTCM_1019_output == true)
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_1020_output == true)
                                 {
-                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_eph_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
                                     int gps_channel = 0;
                                     int glo_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -600,8 +600,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -611,19 +611,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "R")
                                                         {
-                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                                                 {
                                                                     glo_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -632,22 +632,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 30:  // GLONASS L2 C/A + Galileo E1B
                             if (flag_write_RTCM_1020_output == true)
                                 {
-                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_eph_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (flag_write_RTCM_1045_output == true)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
                                     int gal_channel = 0;
                                     int glo_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -658,8 +658,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "E")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
@@ -669,19 +669,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "R")
                                                         {
-                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                                                 {
                                                                     glo_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -690,22 +690,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 32:  // L1+E1+L5+E5a
                             if (flag_write_RTCM_1019_output == true)
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_1045_output == true)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
                                     int gal_channel = 0;
                                     int gps_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -716,8 +716,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "E")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
@@ -727,19 +727,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "G")
                                                         {
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -752,15 +752,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 105:  // Galileo E1B + Galileo E5b + Galileo E6B
                             if (flag_write_RTCM_1045_output == true)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -769,22 +769,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 106:  // GPS L1 C/A + Galileo E1B + Galileo E6B
                             if (flag_write_RTCM_1019_output == true)
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_1045_output == true)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (flag_write_RTCM_MSM_output == true)
                                 {
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
                                     int gps_channel = 0;
                                     int gal_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -795,8 +795,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -806,19 +806,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "E")
                                                         {
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -836,15 +836,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 1:                            // GPS L1 C/A
                             if (rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -856,15 +856,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 6:                            // Galileo E5b
                             if (rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -874,16 +874,16 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 7:                            // GPS L1 C/A + GPS L2C
                             if (rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    const auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                    if ((gps_eph_iter != pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    const auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.map().cbegin();
+                                    if ((gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -893,16 +893,16 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 8:                            // L1+L5
                             if (rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    const auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.cbegin();
-                                    if ((gps_eph_iter != pvt_solver->gps_ephemeris_map.cend()) and (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.cend()))
+                                    const auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    const auto gps_cnav_eph_iter = pvt_solver->gps_cnav_ephemeris_map.map().cbegin();
+                                    if ((gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend()) and (gps_cnav_eph_iter != pvt_solver->gps_cnav_ephemeris_map.map().cend()))
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, gps_cnav_eph_iter->second, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -912,22 +912,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 9:                            // GPS L1 C/A + Galileo E1B
                             if (rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MT1045_rate_ms != 0)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
                                     int gps_channel = 0;
                                     int gal_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -938,8 +938,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -949,19 +949,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "E")
                                                         {
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -972,14 +972,14 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 13:  // L5+E5a
                             if (rtcm_MT1045_rate_ms != 0)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
                                     int gal_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
                                         {
@@ -988,8 +988,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "E")
                                                         {
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
@@ -997,7 +997,7 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 }
                                         }
 
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend() and (rtcm_MT1097_rate_ms != 0))
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend() and (rtcm_MT1097_rate_ms != 0))
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1008,15 +1008,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 15:                           // Galileo E1B + Galileo E5b
                             if (rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1028,15 +1028,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 25:                           // GLONASS L1 C/A + GLONASS L2 C/A
                             if (rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_eph_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    const auto glo_gnav_ephemeris_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
-                                    if (glo_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    const auto glo_gnav_ephemeris_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
+                                    if (glo_gnav_ephemeris_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glo_gnav_ephemeris_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1046,22 +1046,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 26:                           // GPS L1 C/A + GLONASS L1 C/A
                             if (rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_eph_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
                                     int gps_channel = 0;
                                     int glo_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -1072,8 +1072,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -1083,19 +1083,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "R")
                                                         {
-                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                                                 {
                                                                     glo_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1105,14 +1105,14 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 27:                           // GLONASS L1 C/A + Galileo E1B
                             if (rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_eph_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
@@ -1121,8 +1121,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                 {
                                     int gal_channel = 0;
                                     int glo_channel = 0;
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
                                         {
                                             const std::string system(gnss_observables_iter.second.System, 1);
@@ -1131,8 +1131,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "E")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
@@ -1142,19 +1142,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "R")
                                                         {
-                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                                                 {
                                                                     glo_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1164,22 +1164,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 29:                           // GPS L1 C/A + GLONASS L2 C/A
                             if (rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_eph_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
-                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
+                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
                                     int gps_channel = 0;
                                     int glo_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -1190,8 +1190,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -1201,20 +1201,20 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "R")
                                                         {
-                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                                                 {
                                                                     glo_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
 
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1224,14 +1224,14 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 30:                           // GLONASS L2 C/A + Galileo E1B
                             if (rtcm_MT1020_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map)
+                                    for (const auto& glonass_gnav_eph_iter : pvt_solver->glonass_gnav_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1020(glonass_gnav_eph_iter.second, pvt_solver->glonass_gnav_utc_model);
                                         }
                                 }
                             if (rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
@@ -1240,8 +1240,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                 {
                                     int gal_channel = 0;
                                     int glo_channel = 0;
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    auto glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().cbegin();
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
                                         {
                                             const std::string system(gnss_observables_iter.second.System, 1);
@@ -1250,8 +1250,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "E")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
@@ -1261,19 +1261,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "R")
                                                         {
-                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                                            glonass_gnav_eph_iter = pvt_solver->glonass_gnav_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                                                 {
                                                                     glo_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.cend())
+                                    if (glonass_gnav_eph_iter != pvt_solver->glonass_gnav_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, {}, glonass_gnav_eph_iter->second, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1283,22 +1283,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 32:                           // L1+E1+L5+E5a
                             if (rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
                                     int gps_channel = 0;
                                     int gal_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -1309,8 +1309,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -1320,19 +1320,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "E")
                                                         {
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1344,15 +1344,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 103:                          // Galileo E5b + Galileo E6B
                             if (rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1363,15 +1363,15 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 105:                          // Galileo E1B + Galileo E5b + Galileo E6B
                             if (rtcm_MT1045_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    const auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -1381,22 +1381,22 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                         case 106:                          // GPS L1 C/A + Galileo E1B + Galileo E6B
                             if (rtcm_MT1019_rate_ms != 0)  // allows deactivating messages by setting rate = 0
                                 {
-                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map)
+                                    for (const auto& gps_eph_iter : pvt_solver->gps_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1019(gps_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MT1045_rate_ms != 0)
                                 {
-                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map)
+                                    for (const auto& gal_eph_iter : pvt_solver->galileo_ephemeris_map.map())
                                         {
                                             Print_Rtcm_MT1045(gal_eph_iter.second);
                                         }
                                 }
                             if (rtcm_MSM_rate_ms != 0)
                                 {
-                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.cbegin();
-                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.cbegin();
+                                    auto gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().cbegin();
+                                    auto gps_eph_iter = pvt_solver->gps_ephemeris_map.map().cbegin();
                                     int gps_channel = 0;
                                     int gal_channel = 0;
                                     for (const auto& gnss_observables_iter : gnss_observables_map)
@@ -1407,8 +1407,8 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                     if (system == "G")
                                                         {
                                                             // This is a channel with valid GPS signal
-                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                                            gps_eph_iter = pvt_solver->gps_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                                                 {
                                                                     gps_channel = 1;
                                                                 }
@@ -1418,19 +1418,19 @@ void Rtcm_Printer::Print_Rtcm_Messages(const Rtklib_Solver* pvt_solver,
                                                 {
                                                     if (system == "E")
                                                         {
-                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.find(gnss_observables_iter.second.PRN);
-                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                                            gal_eph_iter = pvt_solver->galileo_ephemeris_map.map().find(gnss_observables_iter.second.PRN);
+                                                            if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                                                 {
                                                                     gal_channel = 1;
                                                                 }
                                                         }
                                                 }
                                         }
-                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.cend())
+                                    if (gps_eph_iter != pvt_solver->gps_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, gps_eph_iter->second, {}, {}, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
-                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.cend())
+                                    if (gal_eph_iter != pvt_solver->galileo_ephemeris_map.map().cend())
                                         {
                                             Print_Rtcm_MSM(7, {}, {}, gal_eph_iter->second, {}, rx_time, gnss_observables_map, enable_rx_clock_correction, 0, 0, false, false);
                                         }
@@ -0,0 +1,116 @@
+/*!
+ * \file rtklib_batch_solver.cc
+ * \brief Solves several epochs of observables in parallel with independent
+ * single point positioning solvers
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "rtklib_batch_solver.h"
+#include "gnss_sdr_make_unique.h"
+#include <algorithm>  // for std::max
+#include <string>
+
+
+Rtklib_Batch_Solver::Rtklib_Batch_Solver(const rtk_t& rtk, int nchannels, int num_threads, bool pre_2009_file)
+{
+    const auto num_solvers = static_cast<size_t>(std::max(num_threads, 1));
+    d_solvers.reserve(num_solvers);
+    for (size_t i = 0; i < num_solvers; i++)
+        {
+            d_solvers.push_back(std::make_unique<Rtklib_Solver>(rtk, nchannels, std::string(), false, false));
+            d_solvers.back()->set_averaging_depth(1);
+            d_solvers.back()->set_pre_2009_file(pre_2009_file);
+        }
+    d_results.resize(num_solvers, 0);
+    // The calling thread solves the first epoch of each batch
+    d_threads.reserve(num_solvers - 1);
+    for (size_t i = 1; i < num_solvers; i++)
+        {
+            d_threads.emplace_back(&Rtklib_Batch_Solver::run, this, i);
+        }
+}
+
+
+Rtklib_Batch_Solver::~Rtklib_Batch_Solver()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop = true;
+    }
+    d_start_cv.notify_all();
+    for (auto& thread : d_threads)
+        {
+            thread.join();
+        }
+}
+
+
+void Rtklib_Batch_Solver::update_navigation_data(const Rtklib_Solver& reference)
+{
+    for (auto& solver : d_solvers)
+        {
+            solver->copy_navigation_data(reference);
+        }
+}
+
+
+void Rtklib_Batch_Solver::solve(const std::vector<std::map<int, Gnss_Synchro>>& epochs)
+{
+    if (epochs.empty())
+        {
+            return;
+        }
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_epochs = &epochs;
+        d_pending = d_threads.size();
+        d_batch++;
+    }
+    d_start_cv.notify_all();
+    solve_epoch(0);
+    std::unique_lock<std::mutex> lock(d_mutex);
+    d_done_cv.wait(lock, [this] { return d_pending == 0; });
+    d_epochs = nullptr;
+}
+
+
+void Rtklib_Batch_Solver::run(size_t index)
+{
+    uint64_t batch = 0;
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (true)
+        {
+            d_start_cv.wait(lock, [this, batch] { return d_stop || d_batch != batch; });
+            if (d_stop)
+                {
+                    return;
+                }
+            batch = d_batch;
+            lock.unlock();
+            solve_epoch(index);
+            lock.lock();
+            if (--d_pending == 0)
+                {
+                    d_done_cv.notify_one();
+                }
+        }
+}
+
+
+void Rtklib_Batch_Solver::solve_epoch(size_t index)
+{
+    // d_epochs does not change until all the threads are done with this batch
+    if (index < d_epochs->size())
+        {
+            d_results[index] = d_solvers[index]->get_PVT((*d_epochs)[index], false) ? 1 : 0;
+        }
+}
@@ -0,0 +1,107 @@
+/*!
+ * \file rtklib_batch_solver.h
+ * \brief Solves several epochs of observables in parallel with independent
+ * single point positioning solvers
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_RTKLIB_BATCH_SOLVER_H
+#define GNSS_SDR_RTKLIB_BATCH_SOLVER_H
+
+#include "gnss_synchro.h"
+#include "rtklib.h"
+#include "rtklib_solver.h"
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** \addtogroup PVT
+ * \{ */
+/** \addtogroup PVT_libs
+ * \{ */
+
+
+/*!
+ * \brief Pool of Rtklib_Solver objects that solve up to max_epochs() epochs
+ * at once, one per thread, for post-processing.
+ *
+ * Only valid for single point positioning, where the solution of an epoch
+ * does not depend on the filter state left by the previous one. Each epoch
+ * of a batch is solved by its own solver, which keeps the solution until the
+ * next batch so that the printers can read it in epoch order. The RTKLIB
+ * functions that cache results between calls (time_str(), eci2ecef() and
+ * sbstropcorr()) keep those caches per thread.
+ */
+class Rtklib_Batch_Solver
+{
+public:
+    Rtklib_Batch_Solver(const rtk_t& rtk, int nchannels, int num_threads, bool pre_2009_file);
+    ~Rtklib_Batch_Solver();
+
+    Rtklib_Batch_Solver(const Rtklib_Batch_Solver&) = delete;
+    Rtklib_Batch_Solver& operator=(const Rtklib_Batch_Solver&) = delete;
+
+    /*!
+     * \brief Copies the ephemerides (sharing the maps of the stores) and the
+     * ionospheric and time models of \a reference to all the solvers
+     */
+    void update_navigation_data(const Rtklib_Solver& reference);
+
+    /*!
+     * \brief Solves epochs[i] with solver(i), for i < epochs.size() <=
+     * max_epochs(), and returns when all of them are done
+     */
+    void solve(const std::vector<std::map<int, Gnss_Synchro>>& epochs);
+
+    /*!
+     * \brief Result of get_PVT() for epoch \a i of the last batch
+     */
+    bool is_valid(size_t i) const
+    {
+        return d_results[i] != 0;
+    }
+
+    Rtklib_Solver* solver(size_t i) const
+    {
+        return d_solvers[i].get();
+    }
+
+    size_t max_epochs() const
+    {
+        return d_solvers.size();
+    }
+
+private:
+    void run(size_t index);
+    void solve_epoch(size_t index);
+
+    std::vector<std::unique_ptr<Rtklib_Solver>> d_solvers;
+    std::vector<uint8_t> d_results;
+    std::vector<std::thread> d_threads;
+    std::mutex d_mutex;
+    std::condition_variable d_start_cv;
+    std::condition_variable d_done_cv;
+    const std::vector<std::map<int, Gnss_Synchro>>* d_epochs{nullptr};
+    uint64_t d_batch{0};
+    size_t d_pending{0};
+    bool d_stop{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_RTKLIB_BATCH_SOLVER_H
@@ -379,15 +379,126 @@ Monitor_Pvt Rtklib_Solver::get_monitor_pvt() const
 }
 
 
+void Rtklib_Solver::copy_navigation_data(const Rtklib_Solver &other)
+{
+    galileo_ephemeris_map.assign(other.galileo_ephemeris_map);
+    gps_ephemeris_map.assign(other.gps_ephemeris_map);
+    gps_cnav_ephemeris_map.assign(other.gps_cnav_ephemeris_map);
+    glonass_gnav_ephemeris_map.assign(other.glonass_gnav_ephemeris_map);
+    beidou_dnav_ephemeris_map.assign(other.beidou_dnav_ephemeris_map);
+    irnss_ephemeris_map.assign(other.irnss_ephemeris_map);
+
+    galileo_utc_model = other.galileo_utc_model;
+    galileo_iono = other.galileo_iono;
+    gps_utc_model = other.gps_utc_model;
+    gps_iono = other.gps_iono;
+    irnss_utc_model = other.irnss_utc_model;
+    irnss_iono = other.irnss_iono;
+    gps_cnav_iono = other.gps_cnav_iono;
+    gps_cnav_utc_model = other.gps_cnav_utc_model;
+    glonass_gnav_utc_model = other.glonass_gnav_utc_model;
+    glonass_gnav_almanac = other.glonass_gnav_almanac;
+    beidou_dnav_utc_model = other.beidou_dnav_utc_model;
+    beidou_dnav_iono = other.beidou_dnav_iono;
+}
+
+
+void Rtklib_Solver::copy_solution(const Rtklib_Solver &other)
+{
+    Pvt_Solution::operator=(other);
+    pvt_sol = other.pvt_sol;
+    pvt_ssat = other.pvt_ssat;
+    dop_ = other.dop_;
+    monitor_pvt = other.monitor_pvt;
+    copy_navigation_data(other);
+}
+
+
+void Rtklib_Solver::dump_solution(const Rtklib_Solver &solution)
+{
+    if (d_flag_dump_enabled == false)
+        {
+            return;
+        }
+    // MULTIPLEXED FILE RECORDING - Record results to file
+    try
+        {
+            double tmp_double;
+            uint32_t tmp_uint32;
+            float tmp_float;
+            // TOW
+            tmp_uint32 = solution.monitor_pvt.TOW_at_current_symbol_ms;
+            d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
+            // WEEK
+            tmp_uint32 = solution.monitor_pvt.week;
+            d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
+            // PVT GPS time
+            tmp_double = solution.monitor_pvt.RX_time;
+            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
+            // User clock offset [s]
+            tmp_double = solution.monitor_pvt.user_clk_offset;
+            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
+
+            // ECEF POS X,Y,X [m] + ECEF VEL X,Y,X [m/s] (6 x double)
+            for (int i = 0; i < 6; i++)
+                {
+                    tmp_double = solution.pvt_sol.rr[i];
+                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
+                }
+
+            // position variance/covariance (m^2) {c_xx,c_yy,c_zz,c_xy,c_yz,c_zx} (6 x double)
+            for (int i = 0; i < 6; i++)
+                {
+                    tmp_double = solution.pvt_sol.qr[i];
+                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
+                }
+
+            // GEO user position Latitude [deg]
+            tmp_double = solution.get_latitude();
+            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
+            // GEO user position Longitude [deg]
+            tmp_double = solution.get_longitude();
+            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
+            // GEO user position Height [m]
+            tmp_double = solution.get_height();
+            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
+
+            // NUMBER OF VALID SATS
+            d_dump_file.write(reinterpret_cast<const char *>(&solution.pvt_sol.ns), sizeof(uint8_t));
+            // RTKLIB solution status
+            d_dump_file.write(reinterpret_cast<const char *>(&solution.pvt_sol.stat), sizeof(uint8_t));
+            // RTKLIB solution type (0:xyz-ecef,1:enu-baseline)
+            d_dump_file.write(reinterpret_cast<const char *>(&solution.pvt_sol.type), sizeof(uint8_t));
+            // AR ratio factor for validation
+            tmp_float = solution.pvt_sol.ratio;
+            d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
+            // AR ratio threshold for validation
+            tmp_float = solution.pvt_sol.thres;
+            d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
+
+            // GDOP / PDOP/ HDOP/ VDOP
+            for (int i = 0; i < 4; i++)
+                {
+                    tmp_double = solution.dop_[i];
+                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
+                }
+        }
+    catch (const std::ifstream::failure &e)
+        {
+            LOG(WARNING) << "Exception writing RTKLIB dump file " << e.what();
+        }
+}
+
+
 bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_map, bool flag_averaging)
 {
     std::map<int, Gnss_Synchro>::const_iterator gnss_observables_iter;
-    std::map<int, Galileo_Ephemeris>::const_iterator galileo_ephemeris_iter;
-    std::map<int, Gps_Ephemeris>::const_iterator gps_ephemeris_iter;
-    std::map<int, Gps_CNAV_Ephemeris>::const_iterator gps_cnav_ephemeris_iter;
-    std::map<int, Glonass_Gnav_Ephemeris>::const_iterator glonass_gnav_ephemeris_iter;
-    std::map<int, Beidou_Dnav_Ephemeris>::const_iterator beidou_ephemeris_iter;
-    std::map<int, Irnss_Ephemeris>::const_iterator irnss_ephemeris_iter;
+    const Galileo_Ephemeris *galileo_eph = nullptr;
+    const Gps_Ephemeris *gps_eph = nullptr;
+    const Gps_CNAV_Ephemeris *gps_cnav_eph = nullptr;
+    const Glonass_Gnav_Ephemeris *glonass_gnav_eph = nullptr;
+    const Beidou_Dnav_Ephemeris *beidou_eph = nullptr;
+    const Irnss_Ephemeris *irnss_eph = nullptr;
 
 
     const Glonass_Gnav_Utc_Model gnav_utc = this->glonass_gnav_utc_model;
@@ -401,8 +512,14 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
     int glo_valid_obs = 0;  // GLONASS L1/L2 valid observations counter
 
     obs_data.fill({});
-    std::vector<eph_t> eph_data(MAXOBS);
-    std::vector<geph_t> geph_data(MAXOBS);
+
+    // The converted GLONASS ephemerides depend on the GLONASS time scale offsets
+    if ((gnav_utc.d_tau_c != d_glonass_gnav_eph_cache_tau_c) || (gnav_utc.d_tau_gps != d_glonass_gnav_eph_cache_tau_gps))
+        {
+            d_glonass_gnav_eph_cache.clear();
+            d_glonass_gnav_eph_cache_tau_c = gnav_utc.d_tau_c;
+            d_glonass_gnav_eph_cache_tau_gps = gnav_utc.d_tau_gps;
+        }
 
     // Workaround for NAV/CNAV clash problem
     bool gps_dual_band = false;
@@ -416,12 +533,12 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                 {
                 case 'G':
                     {
-                        const std::string sig_(gnss_observables_iter->second.Signal);
-                        if (sig_ == "1C")
+                        const Gnss_Signal_Id sig_ = gnss_observables_iter->second.signal_id();
+                        if (sig_ == Gnss_Signal_Id::GPS_1C)
                             {
                                 band1 = true;
                             }
-                        if (sig_ == "2S")
+                        if (sig_ == Gnss_Signal_Id::GPS_2S)
                             {
                                 band2 = true;
                             }
@@ -441,26 +558,25 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
          gnss_observables_iter != gnss_observables_map.cend();
          ++gnss_observables_iter)  // CHECK INCONSISTENCY when combining GLONASS + other system
         {
-            LOG(INFO)<<"gnss observable system is "<<gnss_observables_iter->second.Signal;
             switch (gnss_observables_iter->second.System)
                 {
                 case 'E':
                     {
-                        const std::string sig_(gnss_observables_iter->second.Signal);
+                        const Gnss_Signal_Id sig_ = gnss_observables_iter->second.signal_id();
                         // Galileo E1
-                        if (sig_ == "1B")
+                        if (sig_ == Gnss_Signal_Id::GAL_1B)
                             {
                                 // 1 Gal - find the ephemeris for the current GALILEO SV observation. The SV PRN ID is the map key
-                                galileo_ephemeris_iter = galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (galileo_ephemeris_iter != galileo_ephemeris_map.cend())
+                                galileo_eph = galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (galileo_eph != nullptr)
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second);
+                                        eph_data[valid_obs] = d_galileo_eph_cache.get(galileo_ephemeris_map, gnss_observables_iter->second.PRN);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                             gnss_observables_iter->second,
-                                            galileo_ephemeris_iter->second.WN,
+                                            galileo_eph->WN,
                                             0);
                                         valid_obs++;
                                     }
@@ -471,11 +587,11 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                             }
 
                         // Galileo E5
-                        if (sig_ == "5X")
+                        if (sig_ == Gnss_Signal_Id::GAL_5X)
                             {
                                 // 1 Gal - find the ephemeris for the current GALILEO SV observation. The SV PRN ID is the map key
-                                galileo_ephemeris_iter = galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (galileo_ephemeris_iter != galileo_ephemeris_map.cend())
+                                galileo_eph = galileo_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (galileo_eph != nullptr)
                                     {
                                         bool found_E1_obs = false;
                                         for (int i = 0; i < valid_obs; i++)
@@ -484,7 +600,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                     {
                                                         obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(obs_data[i + glo_valid_obs],
                                                             gnss_observables_iter->second,
-                                                            galileo_ephemeris_iter->second.WN,
+                                                            galileo_eph->WN,
                                                             2);  // Band 3 (L5/E5)
                                                         found_E1_obs = true;
                                                         break;
@@ -494,7 +610,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert Galileo E5 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(galileo_ephemeris_iter->second);
+                                                eph_data[valid_obs] = d_galileo_eph_cache.get(galileo_ephemeris_map, gnss_observables_iter->second.PRN);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -502,7 +618,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                     {}, {0.0, 0.0, 0.0}, {}};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                                     gnss_observables_iter->second,
-                                                    galileo_ephemeris_iter->second.WN,
+                                                    galileo_eph->WN,
                                                     2);  // Band 3 (L5/E5)
                                                 valid_obs++;
                                             }
@@ -518,19 +634,19 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     {
                         // GPS L1
                         // 1 GPS - find the ephemeris for the current GPS SV observation. The SV PRN ID is the map key
-                        const std::string sig_(gnss_observables_iter->second.Signal);
-                        if (sig_ == "1C")
+                        const Gnss_Signal_Id sig_ = gnss_observables_iter->second.signal_id();
+                        if (sig_ == Gnss_Signal_Id::GPS_1C)
                             {
-                                gps_ephemeris_iter = gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (gps_ephemeris_iter != gps_ephemeris_map.cend())
+                                gps_eph = gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (gps_eph != nullptr)
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(gps_ephemeris_iter->second, this->is_pre_2009());
+                                        eph_data[valid_obs] = d_gps_eph_cache.get(gps_ephemeris_map, gnss_observables_iter->second.PRN, this->is_pre_2009());
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                             gnss_observables_iter->second,
-                                            gps_ephemeris_iter->second.WN,
+                                            gps_eph->WN,
                                             0,
                                             this->is_pre_2009());
                                         valid_obs++;
@@ -541,14 +657,14 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                     }
                             }
                         // GPS L2 (todo: solve NAV/CNAV clash)
-                        if ((sig_ == "2S") and (gps_dual_band == false))
+                        if ((sig_ == Gnss_Signal_Id::GPS_2S) and (gps_dual_band == false))
                             {
-                                gps_cnav_ephemeris_iter = gps_cnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (gps_cnav_ephemeris_iter != gps_cnav_ephemeris_map.cend())
+                                gps_cnav_eph = gps_cnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (gps_cnav_eph != nullptr)
                                     {
                                         // 1. Find the same satellite in GPS L1 band
-                                        gps_ephemeris_iter = gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                        if (gps_ephemeris_iter != gps_ephemeris_map.cend())
+                                        gps_eph = gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                        if (gps_eph != nullptr)
                                             {
                                                 /* By the moment, GPS L2 observables are not used in pseudorange computations if GPS L1 is available
                                                 // 2. If found, replace the existing GPS L1 ephemeris with the GPS L2 ephemeris
@@ -557,7 +673,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                     {
                                                         if (eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
                                                             {
-                                                                eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                                eph_data[i] = d_gps_cnav_eph_cache.get(gps_cnav_ephemeris_map, gnss_observables_iter->second.PRN);
                                                                 obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(obs_data[i + glo_valid_obs],
                                                                     gnss_observables_iter->second,
                                                                     eph_data[i].week,
@@ -571,7 +687,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // 3. If not found, insert the GPS L2 ephemeris and the observation
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                eph_data[valid_obs] = d_gps_cnav_eph_cache.get(gps_cnav_ephemeris_map, gnss_observables_iter->second.PRN);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -579,7 +695,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                     {}, {0.0, 0.0, 0.0}, {}};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                                     gnss_observables_iter->second,
-                                                    gps_cnav_ephemeris_iter->second.WN,
+                                                    gps_cnav_eph->WN,
                                                     1);  // Band 2 (L2)
                                                 valid_obs++;
                                             }
@@ -590,14 +706,14 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                     }
                             }
                         // GPS L5
-                        if (sig_ == "L5")
+                        if (sig_ == Gnss_Signal_Id::GPS_L5)
                             {
-                                gps_cnav_ephemeris_iter = gps_cnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (gps_cnav_ephemeris_iter != gps_cnav_ephemeris_map.cend())
+                                gps_cnav_eph = gps_cnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (gps_cnav_eph != nullptr)
                                     {
                                         // 1. Find the same satellite in GPS L1 band
-                                        gps_ephemeris_iter = gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                        if (gps_ephemeris_iter != gps_ephemeris_map.cend())
+                                        gps_eph = gps_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                        if (gps_eph != nullptr)
                                             {
                                                 // 2. If found, replace the existing GPS L1 ephemeris with the GPS L5 ephemeris
                                                 // (more precise!), and attach the L5 observation to the L1 observation in RTKLIB structure
@@ -605,10 +721,10 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                     {
                                                         if (eph_data[i].sat == static_cast<int>(gnss_observables_iter->second.PRN))
                                                             {
-                                                                eph_data[i] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                                eph_data[i] = d_gps_cnav_eph_cache.get(gps_cnav_ephemeris_map, gnss_observables_iter->second.PRN);
                                                                 obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(obs_data[i],
                                                                     gnss_observables_iter->second,
-                                                                    gps_cnav_ephemeris_iter->second.WN,
+                                                                    gps_cnav_eph->WN,
                                                                     2);  // Band 3 (L5)
                                                                 break;
                                                             }
@@ -618,7 +734,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // 3. If not found, insert the GPS L5 ephemeris and the observation
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(gps_cnav_ephemeris_iter->second);
+                                                eph_data[valid_obs] = d_gps_cnav_eph_cache.get(gps_cnav_ephemeris_map, gnss_observables_iter->second.PRN);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -626,7 +742,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                     {}, {0.0, 0.0, 0.0}, {}};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                                     gnss_observables_iter->second,
-                                                    gps_cnav_ephemeris_iter->second.WN,
+                                                    gps_cnav_eph->WN,
                                                     2);  // Band 3 (L5)
                                                 valid_obs++;
                                             }
@@ -640,21 +756,21 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     }
                 case 'R':  // TODO This should be using rtk lib nomenclature
                     {
-                        const std::string sig_(gnss_observables_iter->second.Signal);
+                        const Gnss_Signal_Id sig_ = gnss_observables_iter->second.signal_id();
                         // GLONASS GNAV L1
-                        if (sig_ == "1G")
+                        if (sig_ == Gnss_Signal_Id::GLO_1G)
                             {
                                 // 1 Glo - find the ephemeris for the current GLONASS SV observation. The SV Slot Number (PRN ID) is the map key
-                                glonass_gnav_ephemeris_iter = glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (glonass_gnav_ephemeris_iter != glonass_gnav_ephemeris_map.cend())
+                                glonass_gnav_eph = glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (glonass_gnav_eph != nullptr)
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                        geph_data[glo_valid_obs] = d_glonass_gnav_eph_cache.get(glonass_gnav_ephemeris_map, gnss_observables_iter->second.PRN, gnav_utc);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                             gnss_observables_iter->second,
-                                            glonass_gnav_ephemeris_iter->second.d_WN,
+                                            glonass_gnav_eph->d_WN,
                                             0);  // Band 0 (L1)
                                         glo_valid_obs++;
                                     }
@@ -664,11 +780,11 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                     }
                             }
                         // GLONASS GNAV L2
-                        if (sig_ == "2G")
+                        if (sig_ == Gnss_Signal_Id::GLO_2G)
                             {
                                 // 1 GLONASS - find the ephemeris for the current GLONASS SV observation. The SV PRN ID is the map key
-                                glonass_gnav_ephemeris_iter = glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (glonass_gnav_ephemeris_iter != glonass_gnav_ephemeris_map.cend())
+                                glonass_gnav_eph = glonass_gnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (glonass_gnav_eph != nullptr)
                                     {
                                         bool found_L1_obs = false;
                                         for (int i = 0; i < glo_valid_obs; i++)
@@ -677,7 +793,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                     {
                                                         obs_data[i + valid_obs] = insert_obs_to_rtklib(obs_data[i + valid_obs],
                                                             gnss_observables_iter->second,
-                                                            glonass_gnav_ephemeris_iter->second.d_WN,
+                                                            glonass_gnav_eph->d_WN,
                                                             1);  // Band 1 (L2)
                                                         found_L1_obs = true;
                                                         break;
@@ -687,12 +803,12 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert GLONASS GNAV L2 obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                geph_data[glo_valid_obs] = eph_to_rtklib(glonass_gnav_ephemeris_iter->second, gnav_utc);
+                                                geph_data[glo_valid_obs] = d_glonass_gnav_eph_cache.get(glonass_gnav_ephemeris_map, gnss_observables_iter->second.PRN, gnav_utc);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 obsd_t newobs{};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                                     gnss_observables_iter->second,
-                                                    glonass_gnav_ephemeris_iter->second.d_WN,
+                                                    glonass_gnav_eph->d_WN,
                                                     1);  // Band 1 (L2)
                                                 glo_valid_obs++;
                                             }
@@ -708,19 +824,19 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     {
                         // BEIDOU B1I
                         //  - find the ephemeris for the current BEIDOU SV observation. The SV PRN ID is the map key
-                        const std::string sig_(gnss_observables_iter->second.Signal);
-                        if (sig_ == "B1")
+                        const Gnss_Signal_Id sig_ = gnss_observables_iter->second.signal_id();
+                        if (sig_ == Gnss_Signal_Id::BDS_B1)
                             {
-                                beidou_ephemeris_iter = beidou_dnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (beidou_ephemeris_iter != beidou_dnav_ephemeris_map.cend())
+                                beidou_eph = beidou_dnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (beidou_eph != nullptr)
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                        eph_data[valid_obs] = d_beidou_dnav_eph_cache.get(beidou_dnav_ephemeris_map, gnss_observables_iter->second.PRN);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                             gnss_observables_iter->second,
-                                            beidou_ephemeris_iter->second.WN + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
+                                            beidou_eph->WN + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
                                             0);
                                         valid_obs++;
                                     }
@@ -730,10 +846,10 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                     }
                             }
                         // BeiDou B3
-                        if (sig_ == "B3")
+                        if (sig_ == Gnss_Signal_Id::BDS_B3)
                             {
-                                beidou_ephemeris_iter = beidou_dnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (beidou_ephemeris_iter != beidou_dnav_ephemeris_map.cend())
+                                beidou_eph = beidou_dnav_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (beidou_eph != nullptr)
                                     {
                                         bool found_B1I_obs = false;
                                         for (int i = 0; i < valid_obs; i++)
@@ -742,7 +858,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                     {
                                                         obs_data[i + glo_valid_obs] = insert_obs_to_rtklib(obs_data[i + glo_valid_obs],
                                                             gnss_observables_iter->second,
-                                                            beidou_ephemeris_iter->second.WN + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
+                                                            beidou_eph->WN + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
                                                             2);  // Band 3 (L2/G2/B3)
                                                         found_B1I_obs = true;
                                                         break;
@@ -752,7 +868,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                             {
                                                 // insert BeiDou B3I obs as new obs and also insert its ephemeris
                                                 // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                                eph_data[valid_obs] = eph_to_rtklib(beidou_ephemeris_iter->second);
+                                                eph_data[valid_obs] = d_beidou_dnav_eph_cache.get(beidou_dnav_ephemeris_map, gnss_observables_iter->second.PRN);
                                                 // convert observation from GNSS-SDR class to RTKLIB structure
                                                 const auto default_code_ = static_cast<unsigned char>(CODE_NONE);
                                                 obsd_t newobs = {{0, 0}, '0', '0', {}, {},
@@ -760,7 +876,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                                                     {}, {0.0, 0.0, 0.0}, {}};
                                                 obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                                     gnss_observables_iter->second,
-                                                    beidou_ephemeris_iter->second.WN + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
+                                                    beidou_eph->WN + BEIDOU_DNAV_BDT2GPST_WEEK_NUM_OFFSET,
                                                     2);  // Band 2 (L2/G2)
                                                 valid_obs++;
                                             }
@@ -776,19 +892,19 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     {
                         // IRNSS
                         // 1 IRNSS - find the ephemeris for the current GPS SV observation. The SV PRN ID is the map key
-                        const std::string sig_(gnss_observables_iter->second.Signal);
-                        if (sig_ == "1I")
+                        const Gnss_Signal_Id sig_ = gnss_observables_iter->second.signal_id();
+                        if (sig_ == Gnss_Signal_Id::IRN_1I)
                             {
-                                irnss_ephemeris_iter = irnss_ephemeris_map.find(gnss_observables_iter->second.PRN);
-                                if (irnss_ephemeris_iter != irnss_ephemeris_map.cend())
+                                irnss_eph = irnss_ephemeris_map.find(gnss_observables_iter->second.PRN);
+                                if (irnss_eph != nullptr)
                                     {
                                         // convert ephemeris from GNSS-SDR class to RTKLIB structure
-                                        eph_data[valid_obs] = eph_to_rtklib(irnss_ephemeris_iter->second);
+                                        eph_data[valid_obs] = d_irnss_eph_cache.get(irnss_ephemeris_map, gnss_observables_iter->second.PRN);
                                         // convert observation from GNSS-SDR class to RTKLIB structure
                                         obsd_t newobs{};
                                         obs_data[valid_obs + glo_valid_obs] = insert_obs_to_rtklib(newobs,
                                             gnss_observables_iter->second,
-                                            irnss_ephemeris_iter->second.i_IRNSS_week,
+                                            irnss_eph->i_IRNSS_week,
                                             0,
                                             this->is_pre_2009());
                                         valid_obs++;
@@ -934,32 +1050,21 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     this->set_num_valid_observations(rtk_.sol.ns);  // record the number of valid satellites used by the PVT solver
                     pvt_sol = rtk_.sol;
                     // DOP computation
-                    unsigned int used_sats = 0;
+                    int index_aux = 0;
                     for (unsigned int i = 0; i < MAXSAT; i++)
                         {
                             pvt_ssat[i] = rtk_.ssat[i];
                             if (rtk_.ssat[i].vs == 1)
                                 {
-                                    used_sats++;
-                                }
-                        }
-
-                    std::vector<double> azel;
-                    azel.reserve(used_sats * 2);
-                    int index_aux = 0;
-                    for (auto &i : rtk_.ssat)
-                        {
-                            if (i.vs == 1)
-                                {
-                                    azel[2 * index_aux] = i.azel[0];
-                                    azel[2 * index_aux + 1] = i.azel[1];
+                                    d_azel[2 * index_aux] = rtk_.ssat[i].azel[0];
+                                    d_azel[2 * index_aux + 1] = rtk_.ssat[i].azel[1];
                                     index_aux++;
                                 }
                         }
 
                     if (index_aux > 0)
                         {
-                            dops(index_aux, azel.data(), 0.0, dop_.data());
+                            dops(index_aux, d_azel.data(), 0.0, dop_.data());
                         }
                     this->set_valid_position(true);
                     std::array<double, 4> rx_position_and_time{};
@@ -1077,86 +1182,7 @@ bool Rtklib_Solver::get_PVT(const std::map<int, Gnss_Synchro> &gnss_observables_
                     monitor_pvt.user_clk_drift_ppm = clock_drift_ppm;
 
                     // ######## LOG FILE #########
-                    if (d_flag_dump_enabled == true)
-                        {
-                            // MULTIPLEXED FILE RECORDING - Record results to file
-                            try
-                                {
-                                    double tmp_double;
-                                    uint32_t tmp_uint32;
-                                    // TOW
-                                    tmp_uint32 = gnss_observables_map.cbegin()->second.TOW_at_current_symbol_ms;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
-                                    // WEEK
-                                    tmp_uint32 = adjgpsweek(nav_data.eph[0].week, this->is_pre_2009());
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_uint32), sizeof(uint32_t));
-                                    // PVT GPS time
-                                    tmp_double = gnss_observables_map.cbegin()->second.RX_time;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    // User clock offset [s]
-                                    tmp_double = rx_position_and_time[3];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-
-                                    // ECEF POS X,Y,X [m] + ECEF VEL X,Y,X [m/s] (6 x double)
-                                    tmp_double = pvt_sol.rr[0];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[1];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[2];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[3];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[4];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.rr[5];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-
-                                    // position variance/covariance (m^2) {c_xx,c_yy,c_zz,c_xy,c_yz,c_zx} (6 x double)
-                                    tmp_double = pvt_sol.qr[0];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[1];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[2];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[3];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[4];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = pvt_sol.qr[5];
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-
-                                    // GEO user position Latitude [deg]
-                                    tmp_double = this->get_latitude();
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    // GEO user position Longitude [deg]
-                                    tmp_double = this->get_longitude();
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    // GEO user position Height [m]
-                                    tmp_double = this->get_height();
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-
-                                    // NUMBER OF VALID SATS
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.ns), sizeof(uint8_t));
-                                    // RTKLIB solution status
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.stat), sizeof(uint8_t));
-                                    // RTKLIB solution type (0:xyz-ecef,1:enu-baseline)
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.type), sizeof(uint8_t));
-                                    // AR ratio factor for validation
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.ratio), sizeof(float));
-                                    // AR ratio threshold for validation
-                                    d_dump_file.write(reinterpret_cast<char *>(&pvt_sol.thres), sizeof(float));
-
-                                    // GDOP / PDOP/ HDOP/ VDOP
-                                    d_dump_file.write(reinterpret_cast<char *>(&dop_[0]), sizeof(double));
-                                    d_dump_file.write(reinterpret_cast<char *>(&dop_[1]), sizeof(double));
-                                    d_dump_file.write(reinterpret_cast<char *>(&dop_[2]), sizeof(double));
-                                    d_dump_file.write(reinterpret_cast<char *>(&dop_[3]), sizeof(double));
-                                }
-                            catch (const std::ifstream::failure &e)
-                                {
-                                    LOG(WARNING) << "Exception writing RTKLIB dump file " << e.what();
-                                }
-                        }
+                    dump_solution(*this);
                 }
         }
     return this->is_valid_position();
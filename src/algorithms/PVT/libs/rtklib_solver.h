@@ -46,6 +46,7 @@
 #include "glonass_gnav_almanac.h"
 #include "glonass_gnav_ephemeris.h"
 #include "glonass_gnav_utc_model.h"
+#include "gnss_ephemeris_store.h"
 #include "gnss_synchro.h"
 #include "gps_almanac.h"
 #include "gps_cnav_ephemeris.h"
@@ -60,7 +61,9 @@
 #include "monitor_pvt.h"
 #include "pvt_solution.h"
 #include "rtklib.h"
+#include "rtklib_conversions.h"
 #include <array>
+#include <cstdint>
 #include <fstream>
 #include <map>
 #include <string>
@@ -89,16 +92,33 @@ public:
     double get_gdop() const override;
     Monitor_Pvt get_monitor_pvt() const;
 
+    /*!
+     * \brief Copies the ephemerides (sharing the maps of the stores) and the
+     * ionospheric and time models of \a other
+     */
+    void copy_navigation_data(const Rtklib_Solver& other);
+
+    /*!
+     * \brief Copies the last solution of \a other and its navigation data,
+     * so that the printers can read them while \a other keeps solving
+     */
+    void copy_solution(const Rtklib_Solver& other);
+
+    /*!
+     * \brief Writes the last valid solution of \a solution to the dump file
+     * of this solver, if dumping is enabled
+     */
+    void dump_solution(const Rtklib_Solver& solution);
+
     sol_t pvt_sol{};
     std::array<ssat_t, MAXSAT> pvt_ssat{};
 
-    std::map<int, Galileo_Ephemeris> galileo_ephemeris_map;            //!< Map storing new Galileo_Ephemeris
-    std::map<int, Gps_Ephemeris> gps_ephemeris_map;                    //!< Map storing new GPS_Ephemeris
-    std::map<int, Gps_CNAV_Ephemeris> gps_cnav_ephemeris_map;          //!< Map storing new GPS_CNAV_Ephemeris
-    std::map<int, Glonass_Gnav_Ephemeris> glonass_gnav_ephemeris_map;  //!< Map storing new GLONASS GNAV Ephemeris
-    std::map<int, Beidou_Dnav_Ephemeris> beidou_dnav_ephemeris_map;    //!< Map storing new BeiDou DNAV Ephmeris
-    std::map<int, Irnss_Ephemeris> irnss_ephemeris_map;                    //!< Map storing new GPS_Ephemeris
-
+    Gnss_Ephemeris_Store<Galileo_Ephemeris, 36> galileo_ephemeris_map;            //!< Galileo ephemerides, indexed by PRN
+    Gnss_Ephemeris_Store<Gps_Ephemeris, 32> gps_ephemeris_map;                    //!< GPS LNAV ephemerides, indexed by PRN
+    Gnss_Ephemeris_Store<Gps_CNAV_Ephemeris, 32> gps_cnav_ephemeris_map;          //!< GPS CNAV ephemerides, indexed by PRN
+    Gnss_Ephemeris_Store<Glonass_Gnav_Ephemeris, 32> glonass_gnav_ephemeris_map;  //!< GLONASS GNAV ephemerides, indexed by slot number
+    Gnss_Ephemeris_Store<Beidou_Dnav_Ephemeris, 63> beidou_dnav_ephemeris_map;    //!< BeiDou DNAV ephemerides, indexed by PRN
+    Gnss_Ephemeris_Store<Irnss_Ephemeris, 32> irnss_ephemeris_map;                //!< IRNSS ephemerides, indexed by PRN
 
     Galileo_Utc_Model galileo_utc_model;
     Galileo_Iono galileo_iono;
@@ -122,9 +142,62 @@ public:
     std::map<int, Beidou_Dnav_Almanac> beidou_dnav_almanac_map;
 
 private:
+    /*
+     * Ephemerides converted to the RTKLIB structures, indexed by PRN. Each
+     * one is converted again only when the ephemeris of that satellite
+     * changes in its store, not at every epoch.
+     */
+    template <typename Rtklib_Ephemeris, int Max_Prn>
+    class Converted_Ephemeris_Cache
+    {
+    public:
+        template <typename Store, typename... Args>
+        const Rtklib_Ephemeris& get(const Store& store, int prn, const Args&... args)
+        {
+            static_assert(Store::max_prn() <= Max_Prn, "The cache is smaller than the store");
+            Entry& entry = d_entries[prn - 1];  // prn is in range, since its ephemeris is stored
+            const uint64_t version = store.version(prn);
+            if (entry.version != version)
+                {
+                    entry.converted = eph_to_rtklib(*store.find(prn), args...);
+                    entry.version = version;
+                }
+            return entry.converted;
+        }
+
+        void clear()
+        {
+            for (auto& entry : d_entries)
+                {
+                    entry.version = 0;
+                }
+        }
+
+    private:
+        struct Entry
+        {
+            Rtklib_Ephemeris converted{};
+            uint64_t version{0};
+        };
+        std::array<Entry, Max_Prn> d_entries{};
+    };
+
     bool save_matfile() const;
 
+    Converted_Ephemeris_Cache<eph_t, 36> d_galileo_eph_cache;
+    Converted_Ephemeris_Cache<eph_t, 32> d_gps_eph_cache;
+    Converted_Ephemeris_Cache<eph_t, 32> d_gps_cnav_eph_cache;
+    Converted_Ephemeris_Cache<geph_t, 32> d_glonass_gnav_eph_cache;
+    Converted_Ephemeris_Cache<eph_t, 63> d_beidou_dnav_eph_cache;
+    Converted_Ephemeris_Cache<eph_t, 32> d_irnss_eph_cache;
+    double d_glonass_gnav_eph_cache_tau_c{0.0};
+    double d_glonass_gnav_eph_cache_tau_gps{0.0};
+
+    // Scratch buffers of get_PVT(), reused at every epoch
     std::array<obsd_t, MAXOBS> obs_data{};
+    std::array<eph_t, MAXOBS> eph_data{};
+    std::array<geph_t, MAXOBS> geph_data{};
+    std::array<double, 2 * MAXSAT> d_azel{};
     std::array<double, 4> dop_{};
     rtk_t rtk_{};
     Monitor_Pvt monitor_pvt{};
@@ -76,9 +76,14 @@ public:
 
     inline std::string createProtobuffer(const std::shared_ptr<Galileo_Ephemeris> monitor)  //!< Serialization into a string
     {
-        monitor_.Clear();
-
         std::string data;
+        appendProtobuffer(monitor, data);
+        return data;
+    }
+
+    inline void appendProtobuffer(const std::shared_ptr<Galileo_Ephemeris>& monitor, std::string& data)  //!< Serialization appended to a string, reusing its capacity
+    {
+        monitor_.Clear();
 
         monitor_.set_prn(monitor->PRN);
         monitor_.set_m_0(monitor->M_0);
@@ -119,8 +124,7 @@ public:
         monitor_.set_bgd_e1e5a(monitor->BGD_E1E5a);
         monitor_.set_bgd_e1e5b(monitor->BGD_E1E5b);
 
-        monitor_.SerializeToString(&data);
-        return data;
+        monitor_.AppendToString(&data);
     }
 
     inline Galileo_Ephemeris readProtobuffer(const gnss_sdr::GalileoEphemeris& mon) const  //!< Deserialization
@@ -75,9 +75,14 @@ public:
 
     inline std::string createProtobuffer(const std::shared_ptr<Gps_Ephemeris> monitor)  //!< Serialization into a string
     {
-        monitor_.Clear();
         std::string data;
+        appendProtobuffer(monitor, data);
+        return data;
+    }
 
+    inline void appendProtobuffer(const std::shared_ptr<Gps_Ephemeris>& monitor, std::string& data)  //!< Serialization appended to a string, reusing its capacity
+    {
+        monitor_.Clear();
         monitor_.set_prn(monitor->PRN);
         monitor_.set_m_0(monitor->M_0);
         monitor_.set_delta_n(monitor->delta_n);
@@ -121,8 +126,7 @@ public:
         monitor_.set_alert_flag(monitor->alert_flag);
         monitor_.set_antispoofing_flag(monitor->antispoofing_flag);
 
-        monitor_.SerializeToString(&data);
-        return data;
+        monitor_.AppendToString(&data);
     }
 
     inline Gps_Ephemeris readProtobuffer(const gnss_sdr::GpsEphemeris& mon) const  //!< Deserialization
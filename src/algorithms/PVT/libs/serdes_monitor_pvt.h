@@ -76,9 +76,14 @@ public:
 
     inline std::string createProtobuffer(const Monitor_Pvt* const monitor)  //!< Serialization into a string
     {
-        monitor_.Clear();
-
         std::string data;
+        appendProtobuffer(monitor, data);
+        return data;
+    }
+
+    inline void appendProtobuffer(const Monitor_Pvt* const monitor, std::string& data)  //!< Serialization appended to a string, reusing its capacity
+    {
+        monitor_.Clear();
 
         monitor_.set_tow_at_current_symbol_ms(monitor->TOW_at_current_symbol_ms);
         monitor_.set_week(monitor->week);
@@ -110,8 +115,7 @@ public:
         monitor_.set_vdop(monitor->vdop);
         monitor_.set_user_clk_drift_ppm(monitor->user_clk_drift_ppm);
 
-        monitor_.SerializeToString(&data);
-        return data;
+        monitor_.AppendToString(&data);
     }
 
     inline Monitor_Pvt readProtobuffer(const gnss_sdr::MonitorPvt& mon) const  //!< Deserialization
@@ -58,7 +58,6 @@ GpsL5iPcpsAcquisition::GpsL5iPcpsAcquisition(
 
     code_length_ = static_cast<unsigned int>(std::floor(static_cast<double>(acq_parameters_.resampled_fs) / (GPS_L5I_CODE_RATE_CPS / GPS_L5I_CODE_LENGTH_CHIPS)));
     vector_length_ = static_cast<unsigned int>(std::floor(acq_parameters_.sampled_ms * acq_parameters_.samples_per_ms) * (acq_parameters_.bit_transition_flag ? 2.0 : 1.0));
-    code_ = std::vector<std::complex<float>>(vector_length_);
     fs_in_ = acq_parameters_.fs_in;
 
     num_codes_ = acq_parameters_.sampled_ms;
@@ -150,24 +149,22 @@ void GpsL5iPcpsAcquisition::init()
 
 void GpsL5iPcpsAcquisition::set_local_code()
 {
-    std::vector<std::complex<float>> code(code_length_);
-
-    if (acq_parameters_.use_automatic_resampler)
-        {
-            gps_l5i_code_gen_complex_sampled(code, gnss_synchro_->PRN, acq_parameters_.resampled_fs);
-        }
-    else
-        {
-            gps_l5i_code_gen_complex_sampled(code, gnss_synchro_->PRN, fs_in_);
-        }
-
-    own::span<gr_complex> code_span(code_.data(), vector_length_);
-    for (unsigned int i = 0; i < num_codes_; i++)
-        {
-            std::copy_n(code.data(), code_length_, code_span.subspan(i * code_length_, code_length_).data());
-        }
-
-    acquisition_->set_local_code(code_.data());
+    acquisition_->set_local_code([this](own::span<gr_complex> code_span) {
+        std::vector<std::complex<float>> code(code_length_);
+
+        if (acq_parameters_.use_automatic_resampler)
+            {
+                gps_l5i_code_gen_complex_sampled(code, gnss_synchro_->PRN, acq_parameters_.resampled_fs);
+            }
+        else
+            {
+                gps_l5i_code_gen_complex_sampled(code, gnss_synchro_->PRN, fs_in_);
+            }
+        for (unsigned int i = 0; i < num_codes_; i++)
+            {
+                std::copy_n(code.data(), code_length_, code_span.subspan(i * code_length_, code_length_).data());
+            }
+    });
 }
 
 
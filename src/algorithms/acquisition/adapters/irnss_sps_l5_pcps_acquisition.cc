@@ -66,7 +66,6 @@ IrnssSpsL5PcpsAcquisition::IrnssSpsL5PcpsAcquisition(
 
     code_length_ = static_cast<unsigned int>(std::floor(static_cast<double>(acq_parameters_.resampled_fs) / (GPS_L1_CA_CODE_RATE_CPS / GPS_L1_CA_CODE_LENGTH_CHIPS)));
     vector_length_ = std::floor(acq_parameters_.sampled_ms * acq_parameters_.samples_per_ms) * (acq_parameters_.bit_transition_flag ? 2.0 : 1.0);
-    code_ = std::vector<std::complex<float>>(vector_length_);
 
     sampled_ms_ = acq_parameters_.sampled_ms;
 
@@ -155,44 +154,22 @@ void IrnssSpsL5PcpsAcquisition::init()
 
 void IrnssSpsL5PcpsAcquisition::set_local_code()
 {
-    std::vector<std::complex<float>> code(code_length_);
-    LOG(INFO)<<"CODE LENGTH IS "<<code_length_;
-    LOG(INFO)<<"CODE LENGTH IS "<<code_length_;
-    LOG(INFO)<<"CODE LENGTH IS "<<code_length_;
-    LOG(INFO)<<"CODE LENGTH IS "<<code_length_;
-    LOG(INFO)<<"CODE LENGTH IS "<<code_length_;
-
-
-    if (acq_parameters_.use_automatic_resampler)
-        {
-            irnss_l5_sps_code_gen_complex_sampled(code, gnss_synchro_->PRN, acq_parameters_.resampled_fs, 0);  //**from gps_sdr_signal_processing.h file**
-            LOG(INFO)<<"automatic resampler done";
-    LOG(INFO)<<"automatic resampler done";
-    LOG(INFO)<<"automatic resampler done";
-    LOG(INFO)<<"automatic resampler done";
-    LOG(INFO)<<"automatic resampler done";
-        }
-    else
-        {
-            irnss_l5_sps_code_gen_complex_sampled(code, gnss_synchro_->PRN, acq_parameters_.fs_in, 0);         //**from gps_sdr_signal_processing.h file**
-            LOG(INFO)<<"not automatic resampler done";
-    LOG(INFO)<<"not automatic resampler done";
-    LOG(INFO)<<"not automatic resampler done";
-    LOG(INFO)<<"not automatic resampler done";
-    LOG(INFO)<<"not automatic resampler done";
-        }
-    own::span<gr_complex> code_span(code_.data(), vector_length_);
-    for (unsigned int i = 0; i < sampled_ms_; i++)
-        {
-            std::copy_n(code.data(), code_length_, code_span.subspan(i * code_length_, code_length_).data());
-        }
-
-    acquisition_->set_local_code(code_.data());
-    LOG(INFO)<<" acquisition block done";
-    LOG(INFO)<<" acquisition block done";
-    LOG(INFO)<<" acquisition block done";
-    LOG(INFO)<<" acquisition block done";
-    LOG(INFO)<<" acquisition block done";
+    acquisition_->set_local_code([this](own::span<gr_complex> code_span) {
+        std::vector<std::complex<float>> code(code_length_);
+
+        if (acq_parameters_.use_automatic_resampler)
+            {
+                irnss_l5_sps_code_gen_complex_sampled(code, gnss_synchro_->PRN, acq_parameters_.resampled_fs, 0);
+            }
+        else
+            {
+                irnss_l5_sps_code_gen_complex_sampled(code, gnss_synchro_->PRN, acq_parameters_.fs_in, 0);
+            }
+        for (unsigned int i = 0; i < sampled_ms_; i++)
+            {
+                std::copy_n(code.data(), code_length_, code_span.subspan(i * code_length_, code_length_).data());
+            }
+    });
 }
 
 
@@ -174,7 +174,6 @@ private:
     int doppler_center_;
     unsigned int sampled_ms_;
     std::string dump_filename_;
-    std::vector<std::complex<float>> code_;
     Gnss_Synchro* gnss_synchro_;
     std::string role_;
     unsigned int in_streams_;
@@ -105,10 +105,12 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_) : gr::block("pcps_acqu
     // }
 
     d_tmp_buffer = volk_gnsssdr::vector<float>(d_fft_size);
-    d_fft_codes = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
     d_input_signal = volk_gnsssdr::vector<std::complex<float>>(d_fft_size);
     d_fft_if = gnss_fft_fwd_make_unique(d_fft_size);
-    d_ifft = gnss_fft_rev_make_unique(d_fft_size);
+    const uint32_t effective_fft_size = (d_acq_parameters.bit_transition_flag ? d_fft_size / 2 : d_fft_size);
+    const uint32_t grid_offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
+    d_acq_engine = std::make_unique<Acq_Batch_Engine>(d_fft_size, effective_fft_size, grid_offset, d_acq_parameters.threads);
+    d_acq_target = Acq_Batch_Target{nullptr, &d_magnitude_grid};
 
     d_gnss_synchro = nullptr;
     d_worker_active = false;
@@ -163,6 +165,12 @@ pcps_acquisition::pcps_acquisition(const Acq_Conf& conf_) : gr::block("pcps_acqu
 }
 
 
+pcps_acquisition::~pcps_acquisition()
+{
+    release_fft_codes();
+}
+
+
 void pcps_acquisition::set_resampler_latency(uint32_t latency_samples)
 {
     gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
@@ -202,7 +210,61 @@ void pcps_acquisition::set_local_code(std::complex<float>* code)
         }
 
     d_fft_if->execute();  // We need the FFT of local code
-    volk_32fc_conjugate_32fc(d_fft_codes.data(), d_fft_if->get_outbuf(), d_fft_size);
+    // The private spectrum is only borrowed by this block, so it is reused
+    // from one PRN to the next
+    if (!d_private_fft_codes)
+        {
+            d_private_fft_codes = std::make_shared<Code_Spectrum_Cache::Spectrum>(d_fft_size);
+        }
+    volk_32fc_conjugate_32fc(d_private_fft_codes->data(), d_fft_if->get_outbuf(), d_fft_size);
+    release_fft_codes();
+    d_fft_codes = d_private_fft_codes;
+    d_acq_target.fft_code = d_fft_codes->data();
+}
+
+
+void pcps_acquisition::set_local_code(const std::function<void(own::span<std::complex<float>>)>& code_generator, uint32_t variant)
+{
+    // This will check if it's fdma, if yes will update the intermediate frequency and the doppler grid
+    if (is_fdma())
+        {
+            update_grid_doppler_wipeoffs();
+        }
+    // The code replica is placed after code_offset zeros, as in set_local_code(std::complex<float>*)
+    const uint32_t code_offset = ((d_acq_parameters.bit_transition_flag or (d_acq_parameters.sampled_ms != d_acq_parameters.ms_per_code)) ? d_fft_size / 2 : 0);
+    const Code_Spectrum_Key key{d_gnss_synchro->System,
+        std::string(d_gnss_synchro->Signal, 2),
+        d_gnss_synchro->PRN,
+        (d_acq_parameters.use_automatic_resampler ? d_acq_parameters.resampled_fs : d_acq_parameters.fs_in),
+        d_fft_size,
+        code_offset,
+        variant};
+
+    gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
+    auto fft_codes = Code_Spectrum_Cache::instance().get(key, [&](Code_Spectrum_Cache::Spectrum& spectrum) {
+        std::fill_n(d_fft_if->get_inbuf(), d_fft_size, gr_complex(0.0, 0.0));
+        code_generator(own::span<std::complex<float>>(d_fft_if->get_inbuf() + code_offset, d_fft_size - code_offset));
+        d_fft_if->execute();  // We need the FFT of local code
+        volk_32fc_conjugate_32fc(spectrum.data(), d_fft_if->get_outbuf(), d_fft_size);
+    });
+    if (fft_codes != d_fft_codes)
+        {
+            release_fft_codes();
+            d_fft_codes = std::move(fft_codes);
+        }
+    d_acq_target.fft_code = d_fft_codes->data();
+}
+
+
+void pcps_acquisition::release_fft_codes()
+{
+    // Drop the spectrum of the previous PRN. The cache keeps it for the next
+    // channel that searches that PRN, unless it exceeds its memory budget.
+    if (d_fft_codes and d_fft_codes != d_private_fft_codes)
+        {
+            d_fft_codes.reset();
+            Code_Spectrum_Cache::instance().trim();
+        }
 }
 
 
@@ -259,7 +321,7 @@ void pcps_acquisition::init()
     d_num_doppler_bins = static_cast<uint32_t>(std::ceil(static_cast<double>(static_cast<int32_t>(d_acq_parameters.doppler_max) - static_cast<int32_t>(-d_acq_parameters.doppler_max)) / static_cast<double>(d_doppler_step)));
 
     // Create the carrier Doppler wipeoff signals
-    if (d_grid_doppler_wipeoffs.empty())
+    if (d_grid_doppler_wipeoffs.empty() and !d_acq_parameters.doppler_by_bin_rotation)
         {
             d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(d_num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
         }
@@ -292,6 +354,11 @@ void pcps_acquisition::init()
 
 void pcps_acquisition::update_grid_doppler_wipeoffs()
 {
+    if (d_acq_parameters.doppler_by_bin_rotation)
+        {
+            update_grid_doppler_rotations();
+            return;
+        }
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
         {
             const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
@@ -300,6 +367,45 @@ void pcps_acquisition::update_grid_doppler_wipeoffs()
 }
 
 
+void pcps_acquisition::update_grid_doppler_rotations()
+{
+    // Each Doppler bin is split into an integer number of FFT bins, applied as a
+    // circular shift of the input spectrum, plus a residual frequency in
+    // [0, bin_spacing), applied as a time-domain wipe-off shared by all the
+    // Doppler bins with the same residual.
+    const double fs = static_cast<double>(d_acq_parameters.use_automatic_resampler ? d_acq_parameters.resampled_fs : d_acq_parameters.fs_in);
+    const double bin_spacing = fs / static_cast<double>(d_fft_size);
+    std::vector<double> residuals;
+    d_doppler_rotations.resize(d_num_doppler_bins);
+    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+        {
+            const int32_t doppler = -static_cast<int32_t>(d_acq_parameters.doppler_max) + d_doppler_center + d_doppler_step * doppler_index;
+            const double freq = static_cast<double>(d_doppler_bias + doppler);
+            const auto bin_shift = static_cast<int32_t>(std::floor(freq / bin_spacing + 1e-9));
+            const double residual = freq - static_cast<double>(bin_shift) * bin_spacing;
+            uint32_t wipeoff_index = 0U;
+            while (wipeoff_index < residuals.size() and std::abs(residuals[wipeoff_index] - residual) > 1e-6)
+                {
+                    wipeoff_index++;
+                }
+            if (wipeoff_index == residuals.size())
+                {
+                    residuals.push_back(residual);
+                }
+            d_doppler_rotations[doppler_index] = {wipeoff_index, bin_shift};
+        }
+
+    if (d_grid_doppler_wipeoffs.size() != residuals.size())
+        {
+            d_grid_doppler_wipeoffs = volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>(residuals.size(), volk_gnsssdr::vector<std::complex<float>>(d_fft_size));
+        }
+    for (uint32_t wipeoff_index = 0; wipeoff_index < residuals.size(); wipeoff_index++)
+        {
+            update_local_carrier(d_grid_doppler_wipeoffs[wipeoff_index], static_cast<float>(residuals[wipeoff_index]));
+        }
+}
+
+
 void pcps_acquisition::update_grid_doppler_wipeoffs_step2()
 {
     for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
@@ -498,24 +604,14 @@ float pcps_acquisition::max_to_input_power_statistic(uint32_t& indext, int32_t&
     LOG(INFO)<<"noncoherent integration counter: "<<d_num_noncoherent_integrations_counter;
     // LOG(INFO)<<"Magniture grid: "<<d_magnitude_grid;
 
-    float grid_maximum = 0.0;
-    uint32_t index_doppler = 0U;
-    uint32_t tmp_intex_t = 0U;
-    uint32_t index_time = 0U;
     const int32_t effective_fft_size = (d_acq_parameters.bit_transition_flag ? d_fft_size / 2 : d_fft_size);
     LOG(INFO)<<"effective fft size: "<<effective_fft_size;
 
     // Find the correlation peak and the carrier frequency
-    for (uint32_t i = 0; i < num_doppler_bins; i++)
-        {
-            volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_magnitude_grid[i].data(), effective_fft_size);
-            if (d_magnitude_grid[i][tmp_intex_t] > grid_maximum)
-                {
-                    grid_maximum = d_magnitude_grid[i][tmp_intex_t];
-                    index_doppler = i;
-                    index_time = tmp_intex_t;
-                }
-        }
+    const Acq_Grid_Peak peak = d_acq_engine->find_peak(d_magnitude_grid, num_doppler_bins, effective_fft_size);
+    const float grid_maximum = peak.value;
+    const uint32_t index_doppler = peak.doppler_index;
+    const uint32_t index_time = peak.time_index;
     indext = index_time;
     if (!d_step_two)
         {
@@ -540,22 +636,11 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
     // Find the highest peak and compare it to the second highest peak
     // The second peak is chosen not closer than 1 chip to the highest peak
 
-    float firstPeak = 0.0;
-    uint32_t index_doppler = 0U;
-    uint32_t tmp_intex_t = 0U;
-    uint32_t index_time = 0U;
-
     // Find the correlation peak and the carrier frequency
-    for (uint32_t i = 0; i < num_doppler_bins; i++)
-        {
-            volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_magnitude_grid[i].data(), d_fft_size);
-            if (d_magnitude_grid[i][tmp_intex_t] > firstPeak)
-                {
-                    firstPeak = d_magnitude_grid[i][tmp_intex_t];
-                    index_doppler = i;
-                    index_time = tmp_intex_t;
-                }
-        }
+    const Acq_Grid_Peak peak = d_acq_engine->find_peak(d_magnitude_grid, num_doppler_bins, d_fft_size);
+    const float firstPeak = peak.value;
+    const uint32_t index_doppler = peak.doppler_index;
+    const uint32_t index_time = peak.time_index;
     indext = index_time;
 
     if (!d_step_two)
@@ -595,6 +680,7 @@ float pcps_acquisition::first_vs_second_peak_statistic(uint32_t& indext, int32_t
     while (idx != excludeRangeIndex2);
 
     // Find the second highest correlation peak in the same freq. bin ---
+    uint32_t tmp_intex_t = 0U;
     volk_gnsssdr_32f_index_max_32u(&tmp_intex_t, d_tmp_buffer.data(), d_fft_size);
     const float secondPeak = d_tmp_buffer[tmp_intex_t];
 
@@ -643,34 +729,20 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
     // Doppler frequency grid loop
     if (!d_step_two)
         {
-            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
+            // Perform the FFT-based convolution  (parallel time search)
+            if (d_acq_parameters.doppler_by_bin_rotation)
                 {
-                    // Remove Doppler
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs[doppler_index].data(), d_fft_size);
-
-                    // Perform the FFT-based convolution  (parallel time search)
-                    // Compute the FFT of the carrier wiped--off incoming signal
-                    d_fft_if->execute();
-
-                    // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
-
-                    // Compute the inverse FFT
-                    d_ifft->execute();
+                    d_acq_engine->search_by_rotation(in, d_grid_doppler_wipeoffs, d_doppler_rotations, d_acq_target, d_num_noncoherent_integrations_counter != 1);
+                }
+            else
+                {
+                    d_acq_engine->search(in, d_grid_doppler_wipeoffs, d_num_doppler_bins, d_acq_target, d_num_noncoherent_integrations_counter != 1);
+                }
 
-                    // Compute squared magnitude (and accumulate in case of non-coherent integration)
-                    const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
-                    if (d_num_noncoherent_integrations_counter == 1)
-                        {
-                            volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
-                        }
-                    else
-                        {
-                            volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), d_ifft->get_outbuf() + offset, effective_fft_size);
-                            volk_32f_x2_add_32f(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
-                        }
-                    // Record results to file if required
-                    if (d_dump and d_channel == d_dump_channel)
+            // Record results to file if required
+            if (d_dump and d_channel == d_dump_channel)
+                {
+                    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins; doppler_index++)
                         {
                             memcpy(d_grid.colptr(doppler_index), d_magnitude_grid[doppler_index].data(), sizeof(float) * effective_fft_size);
                         }
@@ -715,37 +787,18 @@ void pcps_acquisition::acquisition_core(uint64_t samp_count)
         }
     else
         {
-            for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
-                {
-                    volk_32fc_x2_multiply_32fc(d_fft_if->get_inbuf(), in, d_grid_doppler_wipeoffs_step_two[doppler_index].data(), d_fft_size);
-
-                    // Perform the FFT-based convolution  (parallel time search)
-                    // Compute the FFT of the carrier wiped--off incoming signal
-                    d_fft_if->execute();
-
-                    // Multiply carrier wiped--off, Fourier transformed incoming signal
-                    // with the local FFT'd code reference using SIMD operations with VOLK library
-                    volk_32fc_x2_multiply_32fc(d_ifft->get_inbuf(), d_fft_if->get_outbuf(), d_fft_codes.data(), d_fft_size);
+            // Perform the FFT-based convolution  (parallel time search)
+            d_acq_engine->search(in, d_grid_doppler_wipeoffs_step_two, d_num_doppler_bins_step2, d_acq_target, d_num_noncoherent_integrations_counter != 1);
 
-                    // compute the inverse FFT
-                    d_ifft->execute();
-
-                    const size_t offset = (d_acq_parameters.bit_transition_flag ? effective_fft_size : 0);
-                    if (d_num_noncoherent_integrations_counter == 1)
-                        {
-                            volk_32fc_magnitude_squared_32f(d_magnitude_grid[doppler_index].data(), d_ifft->get_outbuf() + offset, effective_fft_size);
-                        }
-                    else
-                        {
-                            volk_32fc_magnitude_squared_32f(d_tmp_buffer.data(), d_ifft->get_outbuf() + offset, effective_fft_size);
-                            volk_32f_x2_add_32f(d_magnitude_grid[doppler_index].data(), d_magnitude_grid[doppler_index].data(), d_tmp_buffer.data(), effective_fft_size);
-                        }
-                    // Record results to file if required
-                    if (d_dump and d_channel == d_dump_channel)
+            // Record results to file if required
+            if (d_dump and d_channel == d_dump_channel)
+                {
+                    for (uint32_t doppler_index = 0; doppler_index < d_num_doppler_bins_step2; doppler_index++)
                         {
                             memcpy(d_narrow_grid.colptr(doppler_index), d_magnitude_grid[doppler_index].data(), sizeof(float) * effective_fft_size);
                         }
                 }
+
             // Compute the test statistic
             if (d_use_CFAR_algorithm_flag)
                 {
@@ -42,8 +42,10 @@
 #define ARMA_NO_DEBUG 1
 #endif
 
+#include "acq_batch_engine.h"
 #include "acq_conf.h"
 #include "channel_fsm.h"
+#include "code_spectrum_cache.h"
 #include "gnss_sdr_fft.h"
 #include <armadillo>
 #include <glog/logging.h>
@@ -55,10 +57,12 @@
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <complex>
 #include <cstdint>
+#include <functional>
 #include <memory>
 #include <queue>
 #include <string>
 #include <utility>
+#include <vector>
 
 #if HAS_STD_SPAN
 #include <span>
@@ -92,7 +96,7 @@ pcps_acquisition_sptr pcps_make_acquisition(const Acq_Conf& conf_);
 class pcps_acquisition : public gr::block
 {
 public:
-    ~pcps_acquisition() = default;
+    ~pcps_acquisition();
 
     /*!
      * \brief Initializes acquisition algorithm and reserves memory.
@@ -116,6 +120,16 @@ public:
      */
     void set_local_code(std::complex<float>* code);
 
+    /*!
+     * \brief Sets local code for PCPS acquisition algorithm, borrowing its
+     * spectrum from the process-wide Code_Spectrum_Cache.
+     * \param code_generator - Writes the sampled code replica into the given
+     * span. It is only called if the spectrum is not cached yet.
+     * \param variant - Distinguishes replicas of the same signal and PRN
+     * (e.g., data and pilot components).
+     */
+    void set_local_code(const std::function<void(own::span<std::complex<float>>)>& code_generator, uint32_t variant = 0);
+
     /*!
      * \brief If set to 1, ensures that acquisition starts at the
      * first available sample.
@@ -221,6 +235,7 @@ private:
     void update_local_carrier(own::span<gr_complex> carrier_vector, float freq) const;
     void update_grid_doppler_wipeoffs();
     void update_grid_doppler_wipeoffs_step2();
+    void update_grid_doppler_rotations();
     void acquisition_core(uint64_t samp_count);
     void send_negative_acquisition();
     void send_positive_acquisition();
@@ -228,6 +243,7 @@ private:
     bool is_fdma();
     bool start();
     void calculate_threshold(void);
+    void release_fft_codes();
     float first_vs_second_peak_statistic(uint32_t& indext, int32_t& doppler, uint32_t num_doppler_bins, int32_t doppler_max, int32_t doppler_step);
     float max_to_input_power_statistic(uint32_t& indext, int32_t& doppler, uint32_t num_doppler_bins, int32_t doppler_max, int32_t doppler_step);
 
@@ -236,12 +252,15 @@ private:
     volk_gnsssdr::vector<std::complex<float>> d_input_signal;
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs;
     volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> d_grid_doppler_wipeoffs_step_two;
-    volk_gnsssdr::vector<std::complex<float>> d_fft_codes;
     volk_gnsssdr::vector<std::complex<float>> d_data_buffer;
     volk_gnsssdr::vector<lv_16sc_t> d_data_buffer_sc;
 
     std::unique_ptr<gnss_fft_complex_fwd> d_fft_if;
-    std::unique_ptr<gnss_fft_complex_rev> d_ifft;
+    std::unique_ptr<Acq_Batch_Engine> d_acq_engine;
+    Code_Spectrum_Cache::Spectrum_Sptr d_fft_codes;
+    std::shared_ptr<Code_Spectrum_Cache::Spectrum> d_private_fft_codes;
+    Acq_Batch_Target d_acq_target{};
+    std::vector<Acq_Doppler_Rotation> d_doppler_rotations;
     std::weak_ptr<ChannelFsm> d_channel_fsm;
 
     Acq_Conf d_acq_parameters;
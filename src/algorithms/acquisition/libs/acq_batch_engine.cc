@@ -0,0 +1,310 @@
+/*!
+ * \file acq_batch_engine.cc
+ * \brief Doppler search engine for PCPS acquisition that splits the Doppler
+ * bins among worker threads.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "acq_batch_engine.h"
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+
+
+Acq_Batch_Engine::Acq_Batch_Engine(uint32_t fft_size,
+    uint32_t effective_fft_size,
+    uint32_t offset,
+    uint32_t num_workers) : d_fft_size(fft_size),
+                            d_effective_fft_size(effective_fft_size),
+                            d_offset(offset)
+{
+    d_workers.resize(std::max(num_workers, 1U));
+    for (auto& worker : d_workers)
+        {
+            worker.fft_if = gnss_fft_fwd_make_unique(d_fft_size);
+            worker.ifft = gnss_fft_rev_make_unique(d_fft_size);
+            worker.tmp_buffer = volk_gnsssdr::vector<float>(d_fft_size);
+            worker.peak = Acq_Grid_Peak{0.0, 0U, 0U};
+            worker.forward_ffts = 0ULL;
+            worker.inverse_ffts = 0ULL;
+            worker.first_bin = 0U;
+            worker.last_bin = 0U;
+        }
+
+    // The first worker runs in the calling thread
+    d_threads.reserve(d_workers.size() - 1);
+    for (uint32_t w = 1; w < d_workers.size(); w++)
+        {
+            d_threads.emplace_back([this, w]() { worker_loop(w); });
+        }
+}
+
+
+Acq_Batch_Engine::~Acq_Batch_Engine()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop = true;
+    }
+    d_start_cond.notify_all();
+    for (auto& thread : d_threads)
+        {
+            if (thread.joinable())
+                {
+                    thread.join();
+                }
+        }
+}
+
+
+void Acq_Batch_Engine::worker_loop(uint32_t index)
+{
+    uint64_t generation = 0ULL;
+    while (true)
+        {
+            const Task* task;
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                d_start_cond.wait(lock, [&]() { return d_stop or (d_generation != generation and index < d_active_workers); });
+                if (d_stop)
+                    {
+                        return;
+                    }
+                generation = d_generation;
+                task = d_task;
+            }
+
+            Worker& worker = d_workers[index];
+            (*task)(worker, worker.first_bin, worker.last_bin);
+
+            bool last = false;
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                last = (--d_pending_workers == 0U);
+            }
+            if (last)
+                {
+                    d_done_cond.notify_one();
+                }
+        }
+}
+
+
+void Acq_Batch_Engine::run_workers(uint32_t num_doppler_bins, const Task& task)
+{
+    // Split the Doppler bins in contiguous ranges. The first range is
+    // processed by the calling thread.
+    const auto num_workers = std::min(static_cast<uint32_t>(d_workers.size()), std::max(num_doppler_bins, 1U));
+    const uint32_t bins_per_worker = num_doppler_bins / num_workers;
+    const uint32_t remainder = num_doppler_bins % num_workers;
+    uint32_t first_bin = 0;
+    for (uint32_t w = 0; w < num_workers; w++)
+        {
+            d_workers[w].first_bin = first_bin;
+            d_workers[w].last_bin = first_bin + bins_per_worker + (w < remainder ? 1 : 0);
+            first_bin = d_workers[w].last_bin;
+        }
+
+    if (num_workers > 1)
+        {
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                d_task = &task;
+                d_active_workers = num_workers;
+                d_pending_workers = num_workers - 1;
+                d_generation++;
+            }
+            d_start_cond.notify_all();
+        }
+
+    task(d_workers[0], d_workers[0].first_bin, d_workers[0].last_bin);
+
+    if (num_workers > 1)
+        {
+            std::unique_lock<std::mutex> lock(d_mutex);
+            d_done_cond.wait(lock, [this]() { return d_pending_workers == 0U; });
+            d_task = nullptr;
+        }
+}
+
+
+void Acq_Batch_Engine::search(const gr_complex* input,
+    const volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>& wipeoffs,
+    uint32_t num_doppler_bins,
+    const Acq_Batch_Target& target,
+    bool accumulate)
+{
+    run_workers(num_doppler_bins, [&](Worker& worker, uint32_t first_bin, uint32_t last_bin) {
+        search_range(worker, input, wipeoffs, first_bin, last_bin, target, accumulate);
+    });
+}
+
+
+void Acq_Batch_Engine::search_by_rotation(const gr_complex* input,
+    const volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>& residual_wipeoffs,
+    const std::vector<Acq_Doppler_Rotation>& rotations,
+    const Acq_Batch_Target& target,
+    bool accumulate)
+{
+    run_workers(static_cast<uint32_t>(rotations.size()), [&](Worker& worker, uint32_t first_bin, uint32_t last_bin) {
+        search_by_rotation_range(worker, input, residual_wipeoffs, rotations, first_bin, last_bin, target, accumulate);
+    });
+}
+
+
+Acq_Grid_Peak Acq_Batch_Engine::find_peak(const volk_gnsssdr::vector<volk_gnsssdr::vector<float>>& grid,
+    uint32_t num_doppler_bins,
+    uint32_t length)
+{
+    run_workers(num_doppler_bins, [&](Worker& worker, uint32_t first_bin, uint32_t last_bin) {
+        worker.peak = Acq_Grid_Peak{0.0, first_bin, 0U};
+        uint32_t tmp_index = 0U;
+        for (uint32_t i = first_bin; i < last_bin; i++)
+            {
+                volk_gnsssdr_32f_index_max_32u(&tmp_index, grid[i].data(), length);
+                if (grid[i][tmp_index] > worker.peak.value)
+                    {
+                        worker.peak = Acq_Grid_Peak{grid[i][tmp_index], i, tmp_index};
+                    }
+            }
+    });
+
+    // Reduce in Doppler order, keeping the first maximum as the serial search does
+    Acq_Grid_Peak peak{0.0, 0U, 0U};
+    const auto num_workers = std::min(static_cast<uint32_t>(d_workers.size()), std::max(num_doppler_bins, 1U));
+    for (uint32_t w = 0; w < num_workers; w++)
+        {
+            if (d_workers[w].peak.value > peak.value)
+                {
+                    peak = d_workers[w].peak;
+                }
+        }
+    return peak;
+}
+
+
+uint64_t Acq_Batch_Engine::forward_ffts() const
+{
+    uint64_t count = 0ULL;
+    for (const auto& worker : d_workers)
+        {
+            count += worker.forward_ffts;
+        }
+    return count;
+}
+
+
+uint64_t Acq_Batch_Engine::inverse_ffts() const
+{
+    uint64_t count = 0ULL;
+    for (const auto& worker : d_workers)
+        {
+            count += worker.inverse_ffts;
+        }
+    return count;
+}
+
+
+void Acq_Batch_Engine::search_range(Worker& worker, const gr_complex* input,
+    const volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>& wipeoffs,
+    uint32_t first_bin, uint32_t last_bin,
+    const Acq_Batch_Target& target,
+    bool accumulate) const
+{
+    for (uint32_t doppler_index = first_bin; doppler_index < last_bin; doppler_index++)
+        {
+            // Remove Doppler
+            volk_32fc_x2_multiply_32fc(worker.fft_if->get_inbuf(), input, wipeoffs[doppler_index].data(), d_fft_size);
+
+            // Compute the FFT of the carrier wiped--off incoming signal
+            worker.fft_if->execute();
+            worker.forward_ffts++;
+
+            correlate(worker, worker.fft_if->get_outbuf(), target, doppler_index, accumulate);
+        }
+}
+
+
+void Acq_Batch_Engine::search_by_rotation_range(Worker& worker, const gr_complex* input,
+    const volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>& residual_wipeoffs,
+    const std::vector<Acq_Doppler_Rotation>& rotations,
+    uint32_t first_bin, uint32_t last_bin,
+    const Acq_Batch_Target& target,
+    bool accumulate) const
+{
+    for (uint32_t wipeoff_index = 0; wipeoff_index < residual_wipeoffs.size(); wipeoff_index++)
+        {
+            bool transformed = false;
+            for (uint32_t doppler_index = first_bin; doppler_index < last_bin; doppler_index++)
+                {
+                    if (rotations[doppler_index].wipeoff_index != wipeoff_index)
+                        {
+                            continue;
+                        }
+                    if (!transformed)
+                        {
+                            // Remove the residual Doppler and compute the FFT, once for all the bins sharing it
+                            volk_32fc_x2_multiply_32fc(worker.fft_if->get_inbuf(), input, residual_wipeoffs[wipeoff_index].data(), d_fft_size);
+                            worker.fft_if->execute();
+                            worker.forward_ffts++;
+                            transformed = true;
+                        }
+                    correlate_shifted(worker, worker.fft_if->get_outbuf(), rotations[doppler_index].bin_shift, target, doppler_index, accumulate);
+                }
+        }
+}
+
+
+void Acq_Batch_Engine::correlate(Worker& worker, const gr_complex* spectrum, const Acq_Batch_Target& target, uint32_t doppler_index, bool accumulate) const
+{
+    // Multiply carrier wiped--off, Fourier transformed incoming signal with the local FFT'd code reference
+    volk_32fc_x2_multiply_32fc(worker.ifft->get_inbuf(), spectrum, target.fft_code, d_fft_size);
+
+    accumulate_magnitude(worker, target, doppler_index, accumulate);
+}
+
+
+void Acq_Batch_Engine::correlate_shifted(Worker& worker, const gr_complex* spectrum, int32_t bin_shift, const Acq_Batch_Target& target, uint32_t doppler_index, bool accumulate) const
+{
+    // Wiping off a carrier of bin_shift FFT bins is a circular shift of the
+    // spectrum: X'[m] = X[(m + bin_shift) mod N]
+    const auto n = static_cast<int32_t>(d_fft_size);
+    const auto shift = static_cast<uint32_t>(((bin_shift % n) + n) % n);
+    const uint32_t head = d_fft_size - shift;
+    volk_32fc_x2_multiply_32fc(worker.ifft->get_inbuf(), spectrum + shift, target.fft_code, head);
+    if (shift > 0)
+        {
+            volk_32fc_x2_multiply_32fc(worker.ifft->get_inbuf() + head, spectrum, target.fft_code + head, shift);
+        }
+
+    accumulate_magnitude(worker, target, doppler_index, accumulate);
+}
+
+
+void Acq_Batch_Engine::accumulate_magnitude(Worker& worker, const Acq_Batch_Target& target, uint32_t doppler_index, bool accumulate) const
+{
+    // Compute the inverse FFT
+    worker.ifft->execute();
+    worker.inverse_ffts++;
+
+    // Compute squared magnitude (and accumulate in case of non-coherent integration)
+    float* row = (*target.magnitude_grid)[doppler_index].data();
+    if (!accumulate)
+        {
+            volk_32fc_magnitude_squared_32f(row, worker.ifft->get_outbuf() + d_offset, d_effective_fft_size);
+        }
+    else
+        {
+            volk_32fc_magnitude_squared_32f(worker.tmp_buffer.data(), worker.ifft->get_outbuf() + d_offset, d_effective_fft_size);
+            volk_32f_x2_add_32f(row, row, worker.tmp_buffer.data(), d_effective_fft_size);
+        }
+}
@@ -0,0 +1,227 @@
+/*!
+ * \file acq_batch_engine.h
+ * \brief Doppler search engine for PCPS acquisition that splits the Doppler
+ * bins among worker threads.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_ACQ_BATCH_ENGINE_H
+#define GNSS_SDR_ACQ_BATCH_ENGINE_H
+
+#include "gnss_sdr_fft.h"
+#include <gnuradio/gr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <complex>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Code replica searched by the Acq_Batch_Engine.
+ *
+ * \a fft_code points to the conjugated FFT of the local code (fft_size
+ * elements), and \a magnitude_grid receives one row of squared correlation
+ * magnitudes per Doppler bin.
+ */
+struct Acq_Batch_Target
+{
+    const std::complex<float>* fft_code;
+    volk_gnsssdr::vector<volk_gnsssdr::vector<float>>* magnitude_grid;
+};
+
+
+/*!
+ * \brief Doppler bin obtained by circularly shifting the spectrum of the
+ * input block wiped-off with a residual carrier.
+ *
+ * The Doppler frequency of the bin is bin_shift * fs / fft_size plus the
+ * frequency of the residual wipe-off number \a wipeoff_index.
+ */
+struct Acq_Doppler_Rotation
+{
+    uint32_t wipeoff_index;
+    int32_t bin_shift;
+};
+
+
+/*!
+ * \brief Location and value of the maximum of a magnitude grid.
+ */
+struct Acq_Grid_Peak
+{
+    float value;
+    uint32_t doppler_index;
+    uint32_t time_index;
+};
+
+
+/*!
+ * \brief Runs the Doppler loop of the PCPS algorithm for a code replica.
+ *
+ * For each Doppler bin, the input block is carrier wiped-off,
+ * Fourier-transformed and correlated with the code spectrum of the target.
+ *
+ * The Doppler bins can be split in contiguous ranges among several workers,
+ * each one with its own FFT plans and scratch buffers. The first range is
+ * processed by the calling thread, and the others by threads started in the
+ * constructor, which wait for work between calls. Every bin is always
+ * computed with the same sequence of operations and written to its own grid
+ * row, so the results do not depend on the number of workers.
+ */
+class Acq_Batch_Engine
+{
+public:
+    /*!
+     * \brief Constructor.
+     * \param fft_size - Length of the FFTs (and of the Doppler wipe-offs).
+     * \param effective_fft_size - Number of correlation lags stored per Doppler bin.
+     * \param offset - First correlation lag stored (used with bit_transition_flag).
+     * \param num_workers - Number of threads sharing the Doppler bins.
+     */
+    Acq_Batch_Engine(uint32_t fft_size, uint32_t effective_fft_size, uint32_t offset, uint32_t num_workers = 1);
+
+    /*!
+     * \brief Destructor. Stops and joins the worker threads.
+     */
+    ~Acq_Batch_Engine();
+
+    Acq_Batch_Engine(const Acq_Batch_Engine&) = delete;
+    Acq_Batch_Engine& operator=(const Acq_Batch_Engine&) = delete;
+
+    /*!
+     * \brief Computes the squared correlation magnitudes of \a input against
+     * \a target for the first \a num_doppler_bins wipe-offs.
+     * \param input - fft_size input samples.
+     * \param wipeoffs - Carrier wipe-off vectors, one per Doppler bin.
+     * \param num_doppler_bins - Number of Doppler bins to search.
+     * \param target - Code replica and output grid.
+     * \param accumulate - If true, magnitudes are added to the grid contents
+     * (non-coherent integration). Otherwise, the grid rows are overwritten.
+     */
+    void search(const gr_complex* input,
+        const volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>& wipeoffs,
+        uint32_t num_doppler_bins,
+        const Acq_Batch_Target& target,
+        bool accumulate);
+
+    /*!
+     * \brief Same as search(), but each Doppler bin is obtained by circularly
+     * shifting the spectrum of the input block wiped-off with the residual
+     * carrier given by \a rotations. A single forward FFT is executed per
+     * distinct residual wipe-off (and worker), instead of one per Doppler bin.
+     * \param input - fft_size input samples.
+     * \param residual_wipeoffs - Residual carrier wipe-off vectors.
+     * \param rotations - Residual wipe-off and integer FFT bin shift of each
+     * Doppler bin.
+     * \param target - Code replica and output grid.
+     * \param accumulate - If true, magnitudes are added to the grid contents.
+     */
+    void search_by_rotation(const gr_complex* input,
+        const volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>& residual_wipeoffs,
+        const std::vector<Acq_Doppler_Rotation>& rotations,
+        const Acq_Batch_Target& target,
+        bool accumulate);
+
+    /*!
+     * \brief Returns the maximum of the first \a length elements of the first
+     * \a num_doppler_bins rows of \a grid. Ties are resolved in favor of the
+     * lowest Doppler index and then the lowest time index, regardless of the
+     * number of workers.
+     */
+    Acq_Grid_Peak find_peak(const volk_gnsssdr::vector<volk_gnsssdr::vector<float>>& grid,
+        uint32_t num_doppler_bins,
+        uint32_t length);
+
+    /*!
+     * \brief Returns the number of worker threads.
+     */
+    inline uint32_t num_workers() const
+    {
+        return static_cast<uint32_t>(d_workers.size());
+    }
+
+    /*!
+     * \brief Returns the number of forward FFTs executed since construction.
+     */
+    uint64_t forward_ffts() const;
+
+    /*!
+     * \brief Returns the number of inverse FFTs executed since construction.
+     */
+    uint64_t inverse_ffts() const;
+
+private:
+    struct Worker
+    {
+        std::unique_ptr<gnss_fft_complex_fwd> fft_if;
+        std::unique_ptr<gnss_fft_complex_rev> ifft;
+        volk_gnsssdr::vector<float> tmp_buffer;
+        Acq_Grid_Peak peak;
+        uint64_t forward_ffts;
+        uint64_t inverse_ffts;
+        uint32_t first_bin;
+        uint32_t last_bin;
+    };
+
+    using Task = std::function<void(Worker&, uint32_t, uint32_t)>;
+
+    void run_workers(uint32_t num_doppler_bins, const Task& task);
+    void worker_loop(uint32_t index);
+
+    void search_range(Worker& worker, const gr_complex* input,
+        const volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>& wipeoffs,
+        uint32_t first_bin, uint32_t last_bin,
+        const Acq_Batch_Target& target,
+        bool accumulate) const;
+
+    void search_by_rotation_range(Worker& worker, const gr_complex* input,
+        const volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>>& residual_wipeoffs,
+        const std::vector<Acq_Doppler_Rotation>& rotations,
+        uint32_t first_bin, uint32_t last_bin,
+        const Acq_Batch_Target& target,
+        bool accumulate) const;
+
+    void correlate(Worker& worker, const gr_complex* spectrum, const Acq_Batch_Target& target, uint32_t doppler_index, bool accumulate) const;
+    void correlate_shifted(Worker& worker, const gr_complex* spectrum, int32_t bin_shift, const Acq_Batch_Target& target, uint32_t doppler_index, bool accumulate) const;
+    void accumulate_magnitude(Worker& worker, const Acq_Batch_Target& target, uint32_t doppler_index, bool accumulate) const;
+
+    std::vector<Worker> d_workers;
+    std::vector<std::thread> d_threads;
+
+    std::mutex d_mutex;
+    std::condition_variable d_start_cond;
+    std::condition_variable d_done_cond;
+    const Task* d_task{nullptr};
+    uint64_t d_generation{0ULL};
+    uint32_t d_active_workers{0U};
+    uint32_t d_pending_workers{0U};
+    bool d_stop{false};
+
+    uint32_t d_fft_size;
+    uint32_t d_effective_fft_size;
+    uint32_t d_offset;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_ACQ_BATCH_ENGINE_H
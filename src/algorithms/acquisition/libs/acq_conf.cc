@@ -45,6 +45,7 @@ Acq_Conf::Acq_Conf()
     blocking = true;
     make_2_steps = false;
     dump_channel = 0U;
+    threads = 1U;
     it_size = sizeof(gr_complex);
     item_type = std::string("gr_complex");
     blocking_on_standby = false;
@@ -53,6 +54,7 @@ Acq_Conf::Acq_Conf()
     resampled_fs = 0LL;
     resampler_latency_samples = 0U;
     enable_monitor_output = false;
+    doppler_by_bin_rotation = false;
 }
 
 
@@ -111,6 +113,13 @@ void Acq_Conf::SetFromConfiguration(const ConfigurationInterface *configuration,
         }
     make_2_steps = configuration->property(role + ".make_two_steps", make_2_steps);
     blocking_on_standby = configuration->property(role + ".blocking_on_standby", blocking_on_standby);
+    doppler_by_bin_rotation = configuration->property(role + ".doppler_by_bin_rotation", doppler_by_bin_rotation);
+    threads = configuration->property(role + ".threads", threads);
+    if (threads == 0U)
+        {
+            LOG(WARNING) << "Parameter threads should be at least 1. Setting it to 1";
+            threads = 1U;
+        }
 
     if (pfa <= 0.0)
         {
@@ -61,6 +61,7 @@ public:
     uint32_t num_doppler_bins_step2;
     uint32_t resampler_latency_samples;
     uint32_t dump_channel;
+    uint32_t threads;
     int32_t doppler_max;
     int32_t doppler_min;
 
@@ -72,6 +73,7 @@ public:
     bool make_2_steps;
     bool use_automatic_resampler;
     bool enable_monitor_output;
+    bool doppler_by_bin_rotation;  // obtain Doppler bins by rotating the input spectrum instead of one FFT per bin
 
 private:
     void SetDerivedParams();
@@ -0,0 +1,142 @@
+/*!
+ * \file code_spectrum_cache.cc
+ * \brief Process-wide cache of conjugated FFTs of local code replicas,
+ * shared by all the PCPS acquisition blocks.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "code_spectrum_cache.h"
+#include <glog/logging.h>
+#include <algorithm>
+#include <utility>
+
+
+Code_Spectrum_Cache& Code_Spectrum_Cache::instance()
+{
+    static Code_Spectrum_Cache cache;
+    return cache;
+}
+
+
+Code_Spectrum_Cache::Spectrum_Sptr Code_Spectrum_Cache::get(const Code_Spectrum_Key& key, const std::function<void(Spectrum&)>& compute)
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        const auto it = d_spectra.find(key);
+        if (it != d_spectra.end())
+            {
+                d_hits++;
+                it->second.last_request = ++d_requests;
+                return it->second.spectrum;
+            }
+    }
+
+    // The replica generation and FFT are executed without holding the lock,
+    // so that other channels are not blocked meanwhile
+    auto spectrum = std::make_shared<Spectrum>(key.fft_size);
+    compute(*spectrum);
+
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_misses++;
+    const auto inserted = d_spectra.emplace(key, Entry{std::move(spectrum), 0ULL});
+    inserted.first->second.last_request = ++d_requests;
+    if (inserted.second)
+        {
+            DLOG(INFO) << "Code spectrum cache: new entry for " << key.system << " " << key.signal
+                       << " PRN " << key.prn << ", fs " << key.fs << " sps, FFT size " << key.fft_size
+                       << " (" << d_spectra.size() << " entries)";
+        }
+    // If another channel computed the same spectrum meanwhile, its entry is kept
+    return inserted.first->second.spectrum;
+}
+
+
+void Code_Spectrum_Cache::trim()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    trim_locked();
+}
+
+
+void Code_Spectrum_Cache::set_max_released_bytes(size_t max_bytes)
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_max_released_bytes = max_bytes;
+    trim_locked();
+}
+
+
+size_t Code_Spectrum_Cache::max_released_bytes() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_max_released_bytes;
+}
+
+
+void Code_Spectrum_Cache::trim_locked()
+{
+    // Spectra held only by the cache, from the least recently requested
+    using Released_Entry = std::pair<uint64_t, std::map<Code_Spectrum_Key, Entry>::iterator>;
+    std::vector<Released_Entry> released;
+    size_t released_bytes = 0;
+    for (auto it = d_spectra.begin(); it != d_spectra.end(); ++it)
+        {
+            if (it->second.spectrum.use_count() == 1)
+                {
+                    released.emplace_back(it->second.last_request, it);
+                    released_bytes += it->second.spectrum->size() * sizeof(Spectrum::value_type);
+                }
+        }
+    if (released_bytes <= d_max_released_bytes)
+        {
+            return;
+        }
+    std::sort(released.begin(), released.end(),
+        [](const Released_Entry& a, const Released_Entry& b) { return a.first < b.first; });
+    for (const auto& entry : released)
+        {
+            if (released_bytes <= d_max_released_bytes)
+                {
+                    break;
+                }
+            released_bytes -= entry.second->second.spectrum->size() * sizeof(Spectrum::value_type);
+            d_spectra.erase(entry.second);
+        }
+}
+
+
+void Code_Spectrum_Cache::clear()
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    d_spectra.clear();
+}
+
+
+size_t Code_Spectrum_Cache::size() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_spectra.size();
+}
+
+
+uint64_t Code_Spectrum_Cache::hits() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_hits;
+}
+
+
+uint64_t Code_Spectrum_Cache::misses() const
+{
+    std::lock_guard<std::mutex> lock(d_mutex);
+    return d_misses;
+}
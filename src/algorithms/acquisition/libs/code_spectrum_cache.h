@@ -0,0 +1,139 @@
+/*!
+ * \file code_spectrum_cache.h
+ * \brief Process-wide cache of conjugated FFTs of local code replicas,
+ * shared by all the PCPS acquisition blocks.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CODE_SPECTRUM_CACHE_H
+#define GNSS_SDR_CODE_SPECTRUM_CACHE_H
+
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <vector>
+
+/** \addtogroup Acquisition
+ * \{ */
+/** \addtogroup acquisition_libs
+ * \{ */
+
+
+/*!
+ * \brief Identifies a code spectrum: signal, PRN, sampling rate and the
+ * layout of the zero-padded FFT input.
+ *
+ * \a code_offset is the number of leading zeros before the code replica in
+ * the FFT input buffer, and \a variant distinguishes replicas that differ for
+ * the same signal and PRN (e.g., data or pilot components).
+ */
+struct Code_Spectrum_Key
+{
+    char system;
+    std::string signal;
+    uint32_t prn;
+    int64_t fs;
+    uint32_t fft_size;
+    uint32_t code_offset;
+    uint32_t variant;
+
+    bool operator<(const Code_Spectrum_Key& other) const
+    {
+        return std::tie(system, signal, prn, fs, fft_size, code_offset, variant) <
+               std::tie(other.system, other.signal, other.prn, other.fs, other.fft_size, other.code_offset, other.variant);
+    }
+};
+
+
+/*!
+ * \brief Immutable, reference-counted store of conjugated code spectra.
+ *
+ * Acquisition blocks borrow spectra through shared pointers instead of
+ * owning a copy each, and the replica generation plus FFT is only executed
+ * the first time a given key is requested. Spectra released by all their
+ * borrowers are kept, so that a channel that picks up a PRN dropped by
+ * another one finds it in the cache, up to a memory budget beyond which the
+ * least recently requested ones are removed.
+ */
+class Code_Spectrum_Cache
+{
+public:
+    using Spectrum = volk_gnsssdr::vector<std::complex<float>>;
+    using Spectrum_Sptr = std::shared_ptr<const Spectrum>;
+
+    /*!
+     * \brief Returns the process-wide instance.
+     */
+    static Code_Spectrum_Cache& instance();
+
+    /*!
+     * \brief Returns the spectrum identified by \a key. If it is not in the
+     * cache yet, \a compute is called to fill a new fft_size-long spectrum.
+     * \a compute runs without holding the cache lock.
+     */
+    Spectrum_Sptr get(const Code_Spectrum_Key& key, const std::function<void(Spectrum&)>& compute);
+
+    /*!
+     * \brief Removes the least recently requested spectra that are not
+     * borrowed by any acquisition block, until those take no more than
+     * max_released_bytes(). Called when a block releases a spectrum.
+     */
+    void trim();
+
+    /*!
+     * \brief Sets the memory budget of the spectra that are not borrowed,
+     * and trims the cache accordingly.
+     */
+    void set_max_released_bytes(size_t max_bytes);
+
+    size_t max_released_bytes() const;  //!< Memory budget of the spectra that are not borrowed
+
+    /*!
+     * \brief Removes all the spectra. Borrowed spectra remain valid for
+     * their current holders.
+     */
+    void clear();
+
+    size_t size() const;      //!< Number of cached spectra
+    uint64_t hits() const;    //!< Number of requests served from the cache
+    uint64_t misses() const;  //!< Number of requests that computed a new spectrum
+
+private:
+    Code_Spectrum_Cache() = default;
+
+    struct Entry
+    {
+        Spectrum_Sptr spectrum;
+        uint64_t last_request;
+    };
+
+    void trim_locked();
+
+    std::map<Code_Spectrum_Key, Entry> d_spectra;
+    mutable std::mutex d_mutex;
+    size_t d_max_released_bytes{64 * 1024 * 1024};  // a few hundred spectra of typical FFT sizes
+    uint64_t d_requests{0ULL};
+    uint64_t d_hits{0ULL};
+    uint64_t d_misses{0ULL};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CODE_SPECTRUM_CACHE_H
@@ -33,7 +33,7 @@ Channel::Channel(const ConfigurationInterface* configuration,
     std::shared_ptr<TelemetryDecoderInterface> nav,
     const std::string& role,
     const std::string& signal_str,
-    Concurrent_Queue<pmt::pmt_t>* queue) : acq_(std::move(acq)),
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue) : acq_(std::move(acq)),
                                            trk_(std::move(trk)),
                                            nav_(std::move(nav)),
                                            role_(role),
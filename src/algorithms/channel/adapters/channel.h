@@ -24,7 +24,7 @@
 #include "channel_fsm.h"
 #include "channel_interface.h"
 #include "channel_msg_receiver_cc.h"
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "gnss_signal.h"
 #include "gnss_synchro.h"
 #include <gnuradio/block.h>
@@ -68,7 +68,7 @@ public:
         std::shared_ptr<TelemetryDecoderInterface> nav,
         const std::string& role,
         const std::string& signal_str,
-        Concurrent_Queue<pmt::pmt_t>* queue);
+        Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~Channel() = default;  //!< Destructor
 
@@ -167,7 +167,7 @@ void ChannelFsm::set_telemetry(std::shared_ptr<TelemetryDecoderInterface> teleme
 }
 
 
-void ChannelFsm::set_queue(Concurrent_Queue<pmt::pmt_t>* queue)
+void ChannelFsm::set_queue(Concurrent_Ring_Queue<pmt::pmt_t>* queue)
 {
     std::lock_guard<std::mutex> lk(mx_);
     queue_ = queue;
@@ -20,7 +20,7 @@
 #define GNSS_SDR_CHANNEL_FSM_H
 
 #include "acquisition_interface.h"
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "telemetry_decoder_interface.h"
 #include "tracking_interface.h"
 #include <pmt/pmt.h>
@@ -48,7 +48,7 @@ public:
     void set_acquisition(std::shared_ptr<AcquisitionInterface> acquisition);
     void set_tracking(std::shared_ptr<TrackingInterface> tracking);
     void set_telemetry(std::shared_ptr<TelemetryDecoderInterface> telemetry);
-    void set_queue(Concurrent_Queue<pmt::pmt_t>* queue);
+    void set_queue(Concurrent_Ring_Queue<pmt::pmt_t>* queue);
     void set_channel(uint32_t channel);
     void start_acquisition();
 
@@ -74,7 +74,7 @@ private:
 
     std::mutex mx_;
 
-    Concurrent_Queue<pmt::pmt_t>* queue_;
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue_;
 
     uint32_t channel_;
     uint32_t state_;
@@ -0,0 +1,122 @@
+/*!
+ * \file fused_signal_conditioner.cc
+ * \brief Signal conditioner that does the data type adaptation, input
+ * filtering and decimation in a single GNU Radio block
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fused_signal_conditioner.h"
+#include "configuration_interface.h"
+#include <glog/logging.h>
+#include <gnuradio/filter/firdes.h>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+
+FusedSignalConditioner::FusedSignalConditioner(const ConfigurationInterface* configuration, std::string role,
+    unsigned int in_streams, unsigned int out_streams) : role_(std::move(role)), in_streams_(in_streams), out_streams_(out_streams)
+{
+    const std::string default_input_item_type("gr_complex");
+    const std::string default_dump_filename("../data/signal_conditioner.dat");
+    const double default_intermediate_freq = 0.0;
+    const double default_sampling_freq = 4000000.0;
+    const int default_decimation_factor = 1;
+    const float default_pfa = 0.04;
+    const int default_length = 32;
+    const int default_n_segments_est = 12500;
+    const int default_n_segments_reset = 1000;
+
+    DLOG(INFO) << "role " << role_;
+
+    input_item_type_ = configuration->property(role_ + ".input_item_type", default_input_item_type);
+    dump_ = configuration->property(role_ + ".dump", false);
+    dump_filename_ = configuration->property(role_ + ".dump_filename", default_dump_filename);
+    const double intermediate_freq = configuration->property(role_ + ".IF", default_intermediate_freq);
+    const double sampling_freq = configuration->property(role_ + ".sampling_frequency", default_sampling_freq);
+    const int decimation_factor = configuration->property(role_ + ".decimation_factor", default_decimation_factor);
+    const double default_bw = (sampling_freq / decimation_factor) / 2;
+    const double bw = configuration->property(role_ + ".bw", default_bw);
+    const double default_tw = bw / 10.0;
+    const double tw = configuration->property(role_ + ".tw", default_tw);
+    const bool remove_dc = configuration->property(role_ + ".remove_dc", false);
+    const bool pulse_blanking = configuration->property(role_ + ".pulse_blanking", false);
+    const float pfa = configuration->property(role_ + ".pfa", default_pfa);
+    const int length = configuration->property(role_ + ".length", default_length);
+    const int n_segments_est = configuration->property(role_ + ".segments_est", default_n_segments_est);
+    const int n_segments_reset = configuration->property(role_ + ".segments_reset", default_n_segments_reset);
+
+    const std::vector<float> taps = gr::filter::firdes::low_pass(1.0, sampling_freq, bw, tw);
+    try
+        {
+            fused_conditioner_ = make_fused_conditioner(input_item_type_, taps, intermediate_freq, sampling_freq,
+                decimation_factor, remove_dc, pulse_blanking, pfa, length, n_segments_est, n_segments_reset);
+            input_size_ = fused_conditioner_->input_signature()->sizeof_stream_item(0);
+            DLOG(INFO) << "fused_conditioner(" << fused_conditioner_->unique_id() << ")";
+            LOG(INFO) << "Created fused_conditioner with " << taps.size() << " taps";
+        }
+    catch (const std::invalid_argument& e)
+        {
+            LOG(ERROR) << e.what();
+            input_size_ = 0;  // notifies wrong configuration
+        }
+
+    if (dump_)
+        {
+            DLOG(INFO) << "Dumping output into file " << dump_filename_;
+            std::cout << "Dumping output into file " << dump_filename_ << '\n';
+            file_sink_ = gr::blocks::file_sink::make(sizeof(gr_complex), dump_filename_.c_str());
+        }
+    if (in_streams_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one input stream";
+        }
+    if (out_streams_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one output stream";
+        }
+}
+
+
+void FusedSignalConditioner::connect(gr::top_block_sptr top_block)
+{
+    if (fused_conditioner_ == nullptr)
+        {
+            throw std::invalid_argument("Invalid " + role_ + " configuration for the Fused_Conditioner implementation");
+        }
+    if (dump_)
+        {
+            top_block->connect(fused_conditioner_, 0, file_sink_, 0);
+        }
+}
+
+
+void FusedSignalConditioner::disconnect(gr::top_block_sptr top_block)
+{
+    if (dump_ and fused_conditioner_ != nullptr)
+        {
+            top_block->disconnect(fused_conditioner_, 0, file_sink_, 0);
+        }
+}
+
+
+gr::basic_block_sptr FusedSignalConditioner::get_left_block()
+{
+    return fused_conditioner_;
+}
+
+
+gr::basic_block_sptr FusedSignalConditioner::get_right_block()
+{
+    return fused_conditioner_;
+}
@@ -0,0 +1,92 @@
+/*!
+ * \file fused_signal_conditioner.h
+ * \brief Signal conditioner that does the data type adaptation, input
+ * filtering and decimation in a single GNU Radio block
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FUSED_SIGNAL_CONDITIONER_H
+#define GNSS_SDR_FUSED_SIGNAL_CONDITIONER_H
+
+#include "fused_conditioner.h"
+#include "gnss_block_interface.h"
+#include <gnuradio/blocks/file_sink.h>
+#include <cstddef>
+#include <string>
+
+/** \addtogroup Signal_Conditioner
+ * \{ */
+/** \addtogroup Signal_Conditioner_adapters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief Signal conditioner implementation "Fused_Conditioner".
+ *
+ * Replaces the DataTypeAdapter -> InputFilter -> Resampler chain of
+ * Signal_Conditioner with a single fused_conditioner block, so the samples
+ * are not written to a full-rate buffer between stages. It converts the
+ * input to gr_complex, optionally removes the DC offset and blanks pulses,
+ * shifts the IF down to zero Hz and decimates by an integer factor with a
+ * low-pass FIR filter. Its parameters are read from the SignalConditioner
+ * role. With \p pulse_blanking=true, the \p pfa, \p length,
+ * \p segments_est and \p segments_reset parameters have the same meaning
+ * and defaults as those of the Pulse_Blanking_Filter.
+ */
+class FusedSignalConditioner : public GNSSBlockInterface
+{
+public:
+    FusedSignalConditioner(const ConfigurationInterface* configuration,
+        std::string role, unsigned int in_streams,
+        unsigned int out_streams);
+
+    ~FusedSignalConditioner() = default;
+
+    inline std::string role() override
+    {
+        return role_;
+    }
+
+    //! Returns "Fused_Conditioner"
+    inline std::string implementation() override
+    {
+        return "Fused_Conditioner";
+    }
+
+    inline size_t item_size() override
+    {
+        return input_size_;
+    }
+
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    gr::basic_block_sptr get_left_block() override;
+    gr::basic_block_sptr get_right_block() override;
+
+private:
+    fused_conditioner_sptr fused_conditioner_;
+    gr::blocks::file_sink::sptr file_sink_;
+    std::string dump_filename_;
+    std::string input_item_type_;
+    std::string role_;
+    size_t input_size_;
+    unsigned int in_streams_;
+    unsigned int out_streams_;
+    bool dump_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FUSED_SIGNAL_CONDITIONER_H
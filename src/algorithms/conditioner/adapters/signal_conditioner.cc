@@ -62,6 +62,13 @@ void SignalConditioner::connect(gr::top_block_sptr top_block)
             throw std::invalid_argument("itemsize mismatch: Invalid input/ouput data type configuration for the InputFilter");
         }
 
+    // The sub-bands of a multi-band input filter are the outputs of the conditioner
+    const bool multiband = multiband_input_filter();
+    if (multiband and res_->implementation() != "Pass_Through")
+        {
+            throw std::invalid_argument("An InputFilter with several outputs requires a Pass_Through Resampler");
+        }
+
     const size_t data_type_adapter_output_size = data_type_adapt_->get_right_block()->output_signature()->sizeof_stream_item(0);
     const size_t input_filter_input_size = in_filt_->get_left_block()->input_signature()->sizeof_stream_item(0);
     const size_t input_filter_output_size = in_filt_->get_right_block()->output_signature()->sizeof_stream_item(0);
@@ -72,7 +79,7 @@ void SignalConditioner::connect(gr::top_block_sptr top_block)
             throw std::invalid_argument("itemsize mismatch: Invalid input/ouput data type configuration for the DataTypeAdapter/InputFilter connection");
         }
 
-    if (input_filter_output_size != resampler_input_size)
+    if (!multiband and input_filter_output_size != resampler_input_size)
         {
             throw std::invalid_argument("itemsize mismatch: Invalid input/ouput data type configuration for the Input Filter/Resampler connection");
         }
@@ -80,8 +87,11 @@ void SignalConditioner::connect(gr::top_block_sptr top_block)
     top_block->connect(data_type_adapt_->get_right_block(), 0, in_filt_->get_left_block(), 0);
     DLOG(INFO) << "data_type_adapter -> input_filter";
 
-    top_block->connect(in_filt_->get_right_block(), 0, res_->get_left_block(), 0);
-    DLOG(INFO) << "input_filter -> resampler";
+    if (!multiband)
+        {
+            top_block->connect(in_filt_->get_right_block(), 0, res_->get_left_block(), 0);
+            DLOG(INFO) << "input_filter -> resampler";
+        }
     connected_ = true;
 }
 
@@ -96,8 +106,11 @@ void SignalConditioner::disconnect(gr::top_block_sptr top_block)
 
     top_block->disconnect(data_type_adapt_->get_right_block(), 0,
         in_filt_->get_left_block(), 0);
-    top_block->disconnect(in_filt_->get_right_block(), 0,
-        res_->get_left_block(), 0);
+    if (!multiband_input_filter())
+        {
+            top_block->disconnect(in_filt_->get_right_block(), 0,
+                res_->get_left_block(), 0);
+        }
 
     data_type_adapt_->disconnect(top_block);
     in_filt_->disconnect(top_block);
@@ -115,5 +128,19 @@ gr::basic_block_sptr SignalConditioner::get_left_block()
 
 gr::basic_block_sptr SignalConditioner::get_right_block()
 {
+    if (multiband_input_filter())
+        {
+            return in_filt_->get_right_block();
+        }
     return res_->get_right_block();
 }
+
+
+bool SignalConditioner::multiband_input_filter() const
+{
+    if (in_filt_ == nullptr or in_filt_->get_right_block() == nullptr)
+        {
+            return false;
+        }
+    return in_filt_->get_right_block()->output_signature()->max_streams() > 1;
+}
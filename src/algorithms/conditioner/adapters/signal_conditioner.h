@@ -64,6 +64,9 @@ public:
     inline std::shared_ptr<GNSSBlockInterface> resampler() { return res_; }
 
 private:
+    // True if the input filter delivers several sub-bands, one per output port
+    bool multiband_input_filter() const;
+
     std::shared_ptr<GNSSBlockInterface> data_type_adapt_;
     std::shared_ptr<GNSSBlockInterface> in_filt_;
     std::shared_ptr<GNSSBlockInterface> res_;
@@ -0,0 +1,291 @@
+/*!
+ * \file fused_conditioner.cc
+ * \brief GNU Radio block that converts the sample type, removes the DC
+ * offset, blanks pulses, translates the frequency and decimates the input
+ * signal in a single pass
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "fused_conditioner.h"
+#include "MATH_CONSTANTS.h"
+#include "gnss_sdr_make_unique.h"
+#include <gnuradio/io_signature.h>
+#include <pmt/pmt.h>
+#include <volk/volk.h>
+#include <algorithm>  // for std::copy
+#include <cmath>
+#include <cstring>  // for memcpy
+#include <stdexcept>
+
+namespace
+{
+// Input samples processed per pass. The working buffer (8 bytes per
+// sample, plus the filter history) stays within the L1/L2 caches.
+constexpr int32_t TARGET_CHUNK_SAMPLES = 4096;
+
+// Weight of each chunk in the running estimation of the DC offset
+constexpr float DC_ESTIMATION_WEIGHT = 0.05;
+
+
+size_t input_item_size(const std::string &input_item_type)
+{
+    if (input_item_type == "gr_complex")
+        {
+            return sizeof(gr_complex);
+        }
+    if (input_item_type == "cshort")
+        {
+            return 2 * sizeof(int16_t);
+        }
+    if (input_item_type == "cbyte" or input_item_type == "ishort" or input_item_type == "short")
+        {
+            return sizeof(int16_t);
+        }
+    if (input_item_type == "ibyte" or input_item_type == "byte")
+        {
+            return sizeof(int8_t);
+        }
+    if (input_item_type == "float")
+        {
+            return sizeof(float);
+        }
+    throw std::invalid_argument("fused_conditioner: unknown input item type " + input_item_type);
+}
+
+
+int32_t input_items_per_sample(const std::string &input_item_type)
+{
+    if (input_item_type == "ishort" or input_item_type == "ibyte")
+        {
+            return 2;
+        }
+    return 1;
+}
+}  // namespace
+
+
+fused_conditioner_sptr make_fused_conditioner(const std::string &input_item_type,
+    const std::vector<float> &taps,
+    double intermediate_freq,
+    double sampling_freq,
+    int32_t decimation_factor,
+    bool remove_dc,
+    bool pulse_blanking,
+    float pfa,
+    int32_t length,
+    int32_t n_segments_est,
+    int32_t n_segments_reset)
+{
+    return fused_conditioner_sptr(new fused_conditioner(input_item_type, taps, intermediate_freq, sampling_freq,
+        decimation_factor, remove_dc, pulse_blanking, pfa, length, n_segments_est, n_segments_reset));
+}
+
+
+fused_conditioner::fused_conditioner(const std::string &input_item_type,
+    const std::vector<float> &taps,
+    double intermediate_freq,
+    double sampling_freq,
+    int32_t decimation_factor,
+    bool remove_dc,
+    bool pulse_blanking,
+    float pfa,
+    int32_t length,
+    int32_t n_segments_est,
+    int32_t n_segments_reset) : gr::sync_decimator("fused_conditioner",
+                                    gr::io_signature::make(1, 1, input_item_size(input_item_type)),
+                                    gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                                    std::max(decimation_factor, 1) * input_items_per_sample(input_item_type)),
+                                input_size_(input_item_size(input_item_type) * input_items_per_sample(input_item_type)),
+                                decimation_factor_(decimation_factor),
+                                remove_dc_(remove_dc),
+                                xlat_(intermediate_freq != 0.0)
+{
+    if (taps.empty() or decimation_factor < 1 or (pulse_blanking and length < 1))
+        {
+            throw std::invalid_argument("fused_conditioner: invalid filter or pulse blanking parameters");
+        }
+    if (input_item_type == "gr_complex")
+        {
+            input_format_ = Input_Format::complex_float;
+        }
+    else if (input_item_type == "cshort" or input_item_type == "ishort")
+        {
+            input_format_ = Input_Format::complex_short;
+        }
+    else if (input_item_type == "cbyte" or input_item_type == "ibyte")
+        {
+            input_format_ = Input_Format::complex_byte;
+        }
+    else if (input_item_type == "float")
+        {
+            input_format_ = Input_Format::real_float;
+        }
+    else if (input_item_type == "short")
+        {
+            input_format_ = Input_Format::real_short;
+        }
+    else
+        {
+            input_format_ = Input_Format::real_byte;
+        }
+
+    // Mixing the input with exp(-j w n) and then filtering is the same as
+    // filtering with the taps h[k] exp(j w k) and rotating the output by
+    // exp(-j w n). The taps are stored reversed for the dot products.
+    const auto ntaps = static_cast<int32_t>(taps.size());
+    const double w = TWO_PI * intermediate_freq / sampling_freq;
+    taps_ = volk_gnsssdr::vector<gr_complex>(ntaps);
+    for (int32_t k = 0; k < ntaps; k++)
+        {
+            taps_[ntaps - 1 - k] = taps[k] * gr_complex(std::cos(w * k), std::sin(w * k));
+        }
+    phase_step_ = gr_complex(std::cos(w * decimation_factor_), -std::sin(w * decimation_factor_));
+
+    // Chunks hold a whole number of outputs
+    chunk_samples_ = std::max(decimation_factor_, (TARGET_CHUNK_SAMPLES / decimation_factor_) * decimation_factor_);
+    set_output_multiple(chunk_samples_ / decimation_factor_);
+
+    if (pulse_blanking)
+        {
+            blanker_ = std::make_unique<Pulse_Blanking_Detector>(pfa, length, n_segments_est, n_segments_reset,
+                [this](double blanked_percentage) {
+                    pmt::pmt_t msg = pmt::make_dict();
+                    msg = pmt::dict_add(msg, pmt::mp("blanked_percentage"), pmt::from_double(blanked_percentage));
+                    this->message_port_pub(pmt::mp("interference"), msg);
+                });
+            lookahead_ = blanker_->lookahead();
+            this->message_port_register_out(pmt::mp("interference"));
+        }
+
+    history_ = ntaps - 1;
+    buffer_ = volk_gnsssdr::vector<gr_complex>(history_ + chunk_samples_ + lookahead_);
+}
+
+
+void fused_conditioner::convert(const void *in, gr_complex *out, int32_t nsamples) const
+{
+    switch (input_format_)
+        {
+        case Input_Format::complex_float:
+            std::memcpy(out, in, nsamples * sizeof(gr_complex));
+            break;
+        case Input_Format::complex_short:
+            volk_16i_s32f_convert_32f(reinterpret_cast<float *>(out), static_cast<const int16_t *>(in), 1.0, 2 * nsamples);
+            break;
+        case Input_Format::complex_byte:
+            volk_8i_s32f_convert_32f(reinterpret_cast<float *>(out), static_cast<const int8_t *>(in), 1.0, 2 * nsamples);
+            break;
+        case Input_Format::real_float:
+            {
+                const auto *samples = static_cast<const float *>(in);
+                for (int32_t i = 0; i < nsamples; i++)
+                    {
+                        out[i] = gr_complex(samples[i], 0.0);
+                    }
+            }
+            break;
+        case Input_Format::real_short:
+            {
+                const auto *samples = static_cast<const int16_t *>(in);
+                for (int32_t i = 0; i < nsamples; i++)
+                    {
+                        out[i] = gr_complex(static_cast<float>(samples[i]), 0.0);
+                    }
+            }
+            break;
+        case Input_Format::real_byte:
+            {
+                const auto *samples = static_cast<const int8_t *>(in);
+                for (int32_t i = 0; i < nsamples; i++)
+                    {
+                        out[i] = gr_complex(static_cast<float>(samples[i]), 0.0);
+                    }
+            }
+            break;
+        }
+}
+
+
+void fused_conditioner::remove_dc(gr_complex *samples, int32_t nsamples)
+{
+    float sum_i = 0.0;
+    float sum_q = 0.0;
+    for (int32_t i = 0; i < nsamples; i++)
+        {
+            sum_i += samples[i].real();
+            sum_q += samples[i].imag();
+        }
+    const gr_complex mean(sum_i / static_cast<float>(nsamples), sum_q / static_cast<float>(nsamples));
+    if (dc_initialized_)
+        {
+            dc_ += DC_ESTIMATION_WEIGHT * (mean - dc_);
+        }
+    else
+        {
+            dc_ = mean;
+            dc_initialized_ = true;
+        }
+    for (int32_t i = 0; i < nsamples; i++)
+        {
+            samples[i] -= dc_;
+        }
+}
+
+
+int fused_conditioner::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    const auto *in = static_cast<const uint8_t *>(input_items[0]);
+    auto *out = static_cast<gr_complex *>(output_items[0]);
+    const int32_t chunk_outputs = chunk_samples_ / decimation_factor_;
+    const auto ntaps = static_cast<unsigned int>(taps_.size());
+    gr_complex *chunk = buffer_.data() + history_;
+    // The blanker needs lookahead_ samples after the chunk, so the new
+    // samples are appended after those kept from the previous chunk
+    gr_complex *new_samples = chunk + lookahead_;
+
+    for (int32_t produced = 0; produced < noutput_items; produced += chunk_outputs)
+        {
+            convert(in, new_samples, chunk_samples_);
+            in += chunk_samples_ * input_size_;
+            if (remove_dc_)
+                {
+                    remove_dc(new_samples, chunk_samples_);
+                }
+            if (blanker_)
+                {
+                    blanker_->blank(chunk, chunk, chunk_samples_);
+                }
+
+            // Polyphase decimation: only the outputs that are kept are computed
+            for (int32_t m = 0; m < chunk_outputs; m++)
+                {
+                    volk_32fc_x2_dot_prod_32fc(&out[m], buffer_.data() + m * decimation_factor_, taps_.data(), ntaps);
+                }
+            if (xlat_)
+                {
+                    for (int32_t m = 0; m < chunk_outputs; m++)
+                        {
+                            out[m] *= phase_;
+                            phase_ *= phase_step_;
+                        }
+                    phase_ /= std::abs(phase_);
+                }
+            out += chunk_outputs;
+
+            // Keep the last filtered samples as the history of the next
+            // chunk, and the samples not blanked yet
+            std::copy(buffer_.begin() + chunk_samples_, buffer_.end(), buffer_.begin());
+        }
+    return noutput_items;
+}
@@ -0,0 +1,131 @@
+/*!
+ * \file fused_conditioner.h
+ * \brief GNU Radio block that converts the sample type, removes the DC
+ * offset, blanks pulses, translates the frequency and decimates the input
+ * signal in a single pass
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_FUSED_CONDITIONER_H
+#define GNSS_SDR_FUSED_CONDITIONER_H
+
+#include "gnss_block_interface.h"
+#include "pulse_blanking_detector.h"
+#include <gnuradio/gr_complex.h>
+#include <gnuradio/sync_decimator.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+/** \addtogroup Signal_Conditioner
+ * \{ */
+/** \addtogroup Signal_Conditioner_gnuradio_blocks conditioner_gr_blocks
+ * GNU Radio blocks implementing signal conditioners
+ * \{ */
+
+
+class fused_conditioner;
+
+using fused_conditioner_sptr = gnss_shared_ptr<fused_conditioner>;
+
+fused_conditioner_sptr make_fused_conditioner(
+    const std::string &input_item_type,
+    const std::vector<float> &taps,
+    double intermediate_freq,
+    double sampling_freq,
+    int32_t decimation_factor,
+    bool remove_dc,
+    bool pulse_blanking,
+    float pfa,
+    int32_t length,
+    int32_t n_segments_est,
+    int32_t n_segments_reset);
+
+/*!
+ * \brief Does the work of a data type adapter, a pulse blanking filter, a
+ * frequency translating FIR filter and a decimator in one block.
+ *
+ * The input samples are processed in chunks of a few thousand samples.
+ * Each chunk is converted to gr_complex into a buffer that stays in cache,
+ * the DC offset and the pulses are removed in place, and only the
+ * decimated outputs of the filter are computed. The frequency translation
+ * is folded into the (complex) taps, and the remaining phase rotation is
+ * applied at the output rate.
+ *
+ * Pulses are detected by the same Pulse_Blanking_Detector as the
+ * Pulse_Blanking_Filter, which publishes the percentage of blanked samples
+ * on the "interference" message port when \a pulse_blanking is set. Since
+ * the window of each sample is centered on it, the output is then delayed
+ * by \a length / 2 input samples.
+ *
+ * Accepted input item types are "gr_complex", "cshort", "cbyte" (complex
+ * samples), "ishort", "ibyte" (interleaved I/Q values), and "float",
+ * "short" and "byte" (real samples). The output is always gr_complex.
+ * Throws std::invalid_argument for other item types or parameters.
+ */
+class fused_conditioner : public gr::sync_decimator
+{
+public:
+    ~fused_conditioner() = default;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend fused_conditioner_sptr make_fused_conditioner(const std::string &input_item_type,
+        const std::vector<float> &taps, double intermediate_freq, double sampling_freq,
+        int32_t decimation_factor, bool remove_dc, bool pulse_blanking, float pfa,
+        int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
+
+    fused_conditioner(const std::string &input_item_type,
+        const std::vector<float> &taps, double intermediate_freq, double sampling_freq,
+        int32_t decimation_factor, bool remove_dc, bool pulse_blanking, float pfa,
+        int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
+
+    void convert(const void *in, gr_complex *out, int32_t nsamples) const;
+    void remove_dc(gr_complex *samples, int32_t nsamples);
+
+    enum class Input_Format
+    {
+        complex_float,
+        complex_short,
+        complex_byte,
+        real_float,
+        real_short,
+        real_byte
+    };
+
+    volk_gnsssdr::vector<gr_complex> taps_;    // reversed, frequency-translated taps
+    volk_gnsssdr::vector<gr_complex> buffer_;  // filter history, current chunk, and lookahead of the blanker
+    std::unique_ptr<Pulse_Blanking_Detector> blanker_;
+    gr_complex dc_{0.0, 0.0};
+    gr_complex phase_{1.0, 0.0};  // output phase rotation
+    gr_complex phase_step_{1.0, 0.0};
+    Input_Format input_format_;
+    size_t input_size_;  // bytes of input per complex sample
+    int32_t history_;
+    int32_t lookahead_{0};
+    int32_t decimation_factor_;
+    int32_t chunk_samples_;
+    bool remove_dc_;
+    bool dc_initialized_{false};
+    bool xlat_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_FUSED_CONDITIONER_H
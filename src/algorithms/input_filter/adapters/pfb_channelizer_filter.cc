@@ -0,0 +1,127 @@
+/*!
+ * \file pfb_channelizer_filter.cc
+ * \brief Adapts a polyphase filter bank channelizer that splits the input
+ * into several decimated sub-bands
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pfb_channelizer_filter.h"
+#include "configuration_interface.h"
+#include <glog/logging.h>
+#include <gnuradio/filter/firdes.h>
+#include <cstdint>
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+
+PfbChannelizerFilter::PfbChannelizerFilter(const ConfigurationInterface* configuration, std::string role,
+    unsigned int in_streams, unsigned int out_streams) : role_(std::move(role)), in_streams_(in_streams), out_streams_(out_streams)
+{
+    const std::string default_item_type("gr_complex");
+    const std::string default_dump_filename("../data/input_filter.dat");
+    const double default_sampling_freq = 4000000.0;
+    const int default_number_of_channels = 2;
+    const int default_number_of_subbands = 1;
+
+    DLOG(INFO) << "role " << role_;
+
+    item_type_ = configuration->property(role_ + ".item_type", default_item_type);
+    dump_ = configuration->property(role_ + ".dump", false);
+    dump_filename_ = configuration->property(role_ + ".dump_filename", default_dump_filename);
+    const double sampling_freq = configuration->property(role_ + ".sampling_frequency", default_sampling_freq);
+    const int number_of_channels = configuration->property(role_ + ".number_of_channels", default_number_of_channels);
+    const int number_of_subbands = configuration->property(role_ + ".number_of_subbands", default_number_of_subbands);
+    const double default_bw = (sampling_freq / number_of_channels) / 2.0;
+    const double bw = configuration->property(role_ + ".bw", default_bw);
+    const double default_tw = bw / 5.0;
+    const double tw = configuration->property(role_ + ".tw", default_tw);
+
+    std::vector<int32_t> channel_map;
+    for (int j = 0; j < number_of_subbands; j++)
+        {
+            const int channel = configuration->property(role_ + ".subband" + std::to_string(j) + "_channel", j);
+            channel_map.push_back(channel);
+            LOG(INFO) << role_ << " sub-band " << j << " is channel " << channel << ", centered at "
+                      << (channel < (number_of_channels + 1) / 2 ? channel : channel - number_of_channels) * sampling_freq / number_of_channels << " Hz";
+        }
+
+    if (item_type_ == "gr_complex")
+        {
+            item_size_ = sizeof(gr_complex);
+            try
+                {
+                    const std::vector<float> taps = gr::filter::firdes::low_pass(1.0, sampling_freq, bw, tw);
+                    pfb_channelizer_cc_ = make_pfb_channelizer_cc(number_of_channels, taps, channel_map);
+                    DLOG(INFO) << "input_filter(" << pfb_channelizer_cc_->unique_id() << ")";
+                    LOG(INFO) << "Created pfb_channelizer_cc with " << taps.size() << " taps";
+                }
+            catch (const std::invalid_argument& e)
+                {
+                    LOG(ERROR) << e.what();
+                    item_size_ = 0;  // notifies wrong configuration
+                }
+        }
+    else
+        {
+            LOG(ERROR) << item_type_ << " unrecognized item type for the polyphase channelizer";
+            item_size_ = 0;  // notifies wrong configuration
+        }
+
+    if (dump_ and item_size_ != 0)
+        {
+            // One file per sub-band, with the sub-band number before the extension
+            const size_t dot = dump_filename_.find_last_of('.');
+            for (int j = 0; j < number_of_subbands; j++)
+                {
+                    std::string filename = dump_filename_;
+                    filename.insert(dot == std::string::npos ? filename.size() : dot, "_subband" + std::to_string(j));
+                    DLOG(INFO) << "Dumping output into file " << filename;
+                    std::cout << "Dumping output into file " << filename << '\n';
+                    file_sinks_.push_back(gr::blocks::file_sink::make(item_size_, filename.c_str()));
+                }
+        }
+    if (in_streams_ > 1)
+        {
+            LOG(ERROR) << "This implementation only supports one input stream";
+        }
+}
+
+
+void PfbChannelizerFilter::connect(gr::top_block_sptr top_block)
+{
+    for (size_t j = 0; j < file_sinks_.size(); j++)
+        {
+            top_block->connect(pfb_channelizer_cc_, j, file_sinks_[j], 0);
+        }
+}
+
+
+void PfbChannelizerFilter::disconnect(gr::top_block_sptr top_block)
+{
+    for (size_t j = 0; j < file_sinks_.size(); j++)
+        {
+            top_block->disconnect(pfb_channelizer_cc_, j, file_sinks_[j], 0);
+        }
+}
+
+
+gr::basic_block_sptr PfbChannelizerFilter::get_left_block()
+{
+    return pfb_channelizer_cc_;
+}
+
+
+gr::basic_block_sptr PfbChannelizerFilter::get_right_block()
+{
+    return pfb_channelizer_cc_;
+}
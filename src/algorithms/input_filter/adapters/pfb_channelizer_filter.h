@@ -0,0 +1,91 @@
+/*!
+ * \file pfb_channelizer_filter.h
+ * \brief Adapts a polyphase filter bank channelizer that splits the input
+ * into several decimated sub-bands
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PFB_CHANNELIZER_FILTER_H
+#define GNSS_SDR_PFB_CHANNELIZER_FILTER_H
+
+#include "gnss_block_interface.h"
+#include "pfb_channelizer_cc.h"
+#include <gnuradio/blocks/file_sink.h>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_adapters
+ * \{ */
+
+
+class ConfigurationInterface;
+
+/*!
+ * \brief This class adapts a pfb_channelizer_cc block.
+ *
+ * The input band (sampling_frequency) is split into number_of_channels
+ * channels of width sampling_frequency / number_of_channels, and the
+ * channels subband0_channel, subband1_channel, ... are delivered on output
+ * ports 0, 1, ... at the decimated rate. Channel k is centered at
+ * k * sampling_frequency / number_of_channels. The Signal Conditioner
+ * exposes the sub-bands as its own output ports, and each Channel selects
+ * one with Channel.subband_ID.
+ */
+class PfbChannelizerFilter : public GNSSBlockInterface
+{
+public:
+    PfbChannelizerFilter(const ConfigurationInterface* configuration,
+        std::string role, unsigned int in_streams,
+        unsigned int out_streams);
+
+    ~PfbChannelizerFilter() = default;
+
+    inline std::string role() override
+    {
+        return role_;
+    }
+
+    //! Returns "Pfb_Channelizer_Filter"
+    inline std::string implementation() override
+    {
+        return "Pfb_Channelizer_Filter";
+    }
+
+    inline size_t item_size() override
+    {
+        return item_size_;
+    }
+
+    void connect(gr::top_block_sptr top_block) override;
+    void disconnect(gr::top_block_sptr top_block) override;
+    gr::basic_block_sptr get_left_block() override;
+    gr::basic_block_sptr get_right_block() override;
+
+private:
+    pfb_channelizer_cc_sptr pfb_channelizer_cc_;
+    std::vector<gr::blocks::file_sink::sptr> file_sinks_;
+    std::string dump_filename_;
+    std::string item_type_;
+    std::string role_;
+    size_t item_size_;
+    unsigned int in_streams_;
+    unsigned int out_streams_;
+    bool dump_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PFB_CHANNELIZER_FILTER_H
@@ -45,7 +45,7 @@ PulseBlankingFilter::PulseBlankingFilter(const ConfigurationInterface* configura
     const int length_ = configuration->property(role_ + ".length", default_length_);
     const int default_n_segments_est = 12500;
     const int n_segments_est = configuration->property(role_ + ".segments_est", default_n_segments_est);
-    const int default_n_segments_reset = 5000000;
+    const int default_n_segments_reset = 1000;
     const int n_segments_reset = configuration->property(role_ + ".segments_reset", default_n_segments_reset);
     if (item_type_ == "gr_complex")
         {
@@ -36,6 +36,16 @@
 
 class ConfigurationInterface;
 
+/*!
+ * \brief Input filter implementation "Pulse_Blanking_Filter".
+ *
+ * Replaces by zeros the samples whose centered window of \p length samples
+ * (default: 32) exceeds the threshold given by \p pfa (default: 0.04). The
+ * noise floor is the mean energy of the last \p segments_est (default:
+ * 12500) windows that were not blanked, and it is estimated again from
+ * scratch after \p segments_reset (default: 1000) consecutive blanked
+ * windows.
+ */
 class PulseBlankingFilter : public GNSSBlockInterface
 {
 public:
@@ -15,6 +15,7 @@
  */
 
 #include "notch_cc.h"
+#include "MATH_CONSTANTS.h"
 #include <boost/math/distributions/chi_squared.hpp>
 #include <gnuradio/io_signature.h>
 #include <volk/volk.h>
@@ -24,9 +25,10 @@
 
 
 notch_sptr make_notch_filter(float pfa, float p_c_factor,
-    int32_t length, int32_t n_segments_est, int32_t n_segments_reset)
+    int32_t length, int32_t n_segments_est, int32_t n_segments_reset,
+    double sampling_frequency)
 {
-    return notch_sptr(new Notch(pfa, p_c_factor, length, n_segments_est, n_segments_reset));
+    return notch_sptr(new Notch(pfa, p_c_factor, length, n_segments_est, n_segments_reset, sampling_frequency));
 }
 
 
@@ -34,9 +36,10 @@ Notch::Notch(float pfa,
     float p_c_factor,
     int32_t length,
     int32_t n_segments_est,
-    int32_t n_segments_reset) : gr::block("Notch",
-                                    gr::io_signature::make(1, 1, sizeof(gr_complex)),
-                                    gr::io_signature::make(1, 1, sizeof(gr_complex)))
+    int32_t n_segments_reset,
+    double sampling_frequency) : gr::block("Notch",
+                                     gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                                     gr::io_signature::make(1, 1, sizeof(gr_complex)))
 {
     const int32_t alignment_multiple = volk_get_alignment() / sizeof(gr_complex);
     set_alignment(std::max(1, alignment_multiple));
@@ -49,14 +52,35 @@ Notch::Notch(float pfa,
     n_segments_ = 0;
     n_segments_est_ = n_segments_est;      // Set the number of segments for noise power estimation
     n_segments_reset_ = n_segments_reset;  // Set the period (in segments) when the noise power is estimated
+    n_segments_spect_ = 0;
+    n_segments_report_ = 0;
+    n_segments_notched_ = 0;
+    sampling_frequency_ = sampling_frequency;
     z_0_ = gr_complex(0.0, 0.0);
+    notch_phasor_ = gr_complex(0.0, 0.0);
     boost::math::chi_squared_distribution<float> my_dist_(n_deg_fred_);
     thres_ = boost::math::quantile(boost::math::complement(my_dist_, pfa_));
     c_samples_ = volk_gnsssdr::vector<gr_complex>(length_);
-    angle_ = volk_gnsssdr::vector<float>(length_);
+    magnitude_ = volk_gnsssdr::vector<float>(length_);
     power_spect_ = volk_gnsssdr::vector<float>(length_);
     last_out_ = gr_complex(0.0, 0.0);
     d_fft_ = gnss_fft_fwd_make_unique(length_);
+    this->message_port_register_out(pmt::mp("interference"));
+}
+
+
+void Notch::publish_statistics()
+{
+    pmt::pmt_t msg = pmt::make_dict();
+    msg = pmt::dict_add(msg, pmt::mp("notched_percentage"), pmt::from_double(100.0 * static_cast<double>(n_segments_notched_) / static_cast<double>(n_segments_report_)));
+    if (n_segments_notched_ > 0)
+        {
+            msg = pmt::dict_add(msg, pmt::mp("notch_frequency"), pmt::from_double(static_cast<double>(std::arg(notch_phasor_)) / TWO_PI * sampling_frequency_));
+        }
+    this->message_port_pub(pmt::mp("interference"), msg);
+    n_segments_report_ = 0;
+    n_segments_notched_ = 0;
+    notch_phasor_ = gr_complex(0.0, 0.0);
 }
 
 
@@ -65,7 +89,6 @@ int Notch::general_work(int noutput_items, gr_vector_int &ninput_items __attribu
 {
     int32_t index_out = 0;
     float sig2dB = 0.0;
-    float sig2lin = 0.0;
     lv_32fc_t dot_prod_;
     const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
     auto *out = reinterpret_cast<gr_complex *>(output_items[0]);
@@ -74,12 +97,21 @@ int Notch::general_work(int noutput_items, gr_vector_int &ninput_items __attribu
         {
             if ((n_segments_ < n_segments_est_) && (filter_state_ == false))
                 {
+                    // Accumulate the power spectrum, the noise floor is computed once at the end
                     memcpy(d_fft_->get_inbuf(), in, sizeof(gr_complex) * length_);
                     d_fft_->execute();
-                    volk_32fc_s32f_power_spectrum_32f(power_spect_.data(), d_fft_->get_outbuf(), 1.0, length_);
-                    volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect_.data(), 15.0, length_);
-                    sig2lin = std::pow(10.0F, (sig2dB / 10.0F)) / (static_cast<float>(n_deg_fred_));
-                    noise_pow_est_ = (static_cast<float>(n_segments_) * noise_pow_est_ + sig2lin) / (static_cast<float>(n_segments_ + 1));
+                    volk_32fc_magnitude_squared_32f(magnitude_.data(), d_fft_->get_outbuf(), length_);
+                    volk_32f_x2_add_32f(power_spect_.data(), power_spect_.data(), magnitude_.data(), length_);
+                    n_segments_spect_++;
+                    if (n_segments_ == n_segments_est_ - 1)
+                        {
+                            for (int32_t i = 0; i < length_; i++)
+                                {
+                                    power_spect_[i] = 10.0F * std::log10(power_spect_[i] / static_cast<float>(n_segments_spect_) + 1e-20F);
+                                }
+                            volk_32f_s32f_calc_spectral_noise_floor_32f(&sig2dB, power_spect_.data(), 15.0, length_);
+                            noise_pow_est_ = std::pow(10.0F, (sig2dB / 10.0F)) / (static_cast<float>(n_deg_fred_));
+                        }
                     memcpy(out, in, sizeof(gr_complex) * length_);
                 }
             else
@@ -92,20 +124,25 @@ int Notch::general_work(int noutput_items, gr_vector_int &ninput_items __attribu
                                     filter_state_ = true;
                                     last_out_ = gr_complex(0.0, 0.0);
                                 }
+                            // The zero of the filter is at the phase increment between consecutive samples
                             volk_32fc_x2_multiply_conjugate_32fc(c_samples_.data(), in, (in - 1), length_);
-                            volk_32fc_s32f_atan2_32f(angle_.data(), c_samples_.data(), static_cast<float>(1.0), length_);
+                            volk_32fc_magnitude_32f(magnitude_.data(), c_samples_.data(), length_);
                             for (int32_t aux = 0; aux < length_; aux++)
                                 {
-                                    z_0_ = std::exp(gr_complex(0.0, 1.0) * (*(angle_.data() + aux)));
+                                    z_0_ = (magnitude_[aux] > 0.0F) ? c_samples_[aux] / magnitude_[aux] : gr_complex(1.0, 0.0);
+                                    notch_phasor_ += c_samples_[aux];
                                     *(out + aux) = *(in + aux) - z_0_ * (*(in + aux - 1)) + p_c_factor_ * z_0_ * last_out_;
                                     last_out_ = *(out + aux);
                                 }
+                            n_segments_notched_++;
                         }
                     else
                         {
                             if (n_segments_ > n_segments_reset_)
                                 {
                                     n_segments_ = 0;
+                                    n_segments_spect_ = 0;
+                                    std::fill(power_spect_.begin(), power_spect_.end(), 0.0F);
                                 }
                             filter_state_ = false;
                             memcpy(out, in, sizeof(gr_complex) * length_);
@@ -115,6 +152,10 @@ int Notch::general_work(int noutput_items, gr_vector_int &ninput_items __attribu
             n_segments_++;
             in += length_;
             out += length_;
+            if (++n_segments_report_ == std::max(n_segments_est_, 1U))
+                {
+                    publish_statistics();
+                }
         }
     consume_each(index_out);
     return index_out;
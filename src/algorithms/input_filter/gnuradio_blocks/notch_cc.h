@@ -40,10 +40,17 @@ notch_sptr make_notch_filter(
     float p_c_factor,
     int32_t length,
     int32_t n_segments_est,
-    int32_t n_segments_reset);
+    int32_t n_segments_reset,
+    double sampling_frequency);
 
 /*!
  * \brief This class implements a real-time software-defined multi state notch filter
+ *
+ * The noise floor is estimated from the power spectrum of \a n_segments_est
+ * segments of \a length samples, accumulated over the segments. Every
+ * \a n_segments_est segments, the percentage of notched samples and the
+ * frequency of the interference, in Hz from the center of the band, are
+ * published on the "interference" message port.
  */
 class Notch : public gr::block
 {
@@ -55,16 +62,20 @@ public:
         gr_vector_void_star &output_items);
 
 private:
-    friend notch_sptr make_notch_filter(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
-    Notch(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
+    friend notch_sptr make_notch_filter(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, double sampling_frequency);
+    Notch(float pfa, float p_c_factor, int32_t length, int32_t n_segments_est, int32_t n_segments_reset, double sampling_frequency);
+
+    void publish_statistics();
 
     std::unique_ptr<gnss_fft_complex_fwd> d_fft_;
     volk_gnsssdr::vector<gr_complex> c_samples_;
-    volk_gnsssdr::vector<float> angle_;
-    volk_gnsssdr::vector<float> power_spect_;
+    volk_gnsssdr::vector<float> magnitude_;
+    volk_gnsssdr::vector<float> power_spect_;  // accumulated during the noise floor estimation
     gr_complex last_out_;
     gr_complex z_0_;
     gr_complex p_c_factor_;
+    gr_complex notch_phasor_;  // sum of the phase increments of the notched samples
+    double sampling_frequency_;
     float pfa_;
     float noise_pow_est_;
     float thres_;
@@ -73,6 +84,9 @@ private:
     uint32_t n_segments_;
     uint32_t n_segments_est_;
     uint32_t n_segments_reset_;
+    uint32_t n_segments_spect_;
+    uint32_t n_segments_report_;
+    uint32_t n_segments_notched_;
     bool filter_state_;
 };
 
@@ -0,0 +1,95 @@
+/*!
+ * \file pfb_channelizer_cc.cc
+ * \brief Polyphase filter bank channelizer that splits a wideband signal
+ * into decimated sub-bands with one FFT per block of input samples
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ *
+ */
+
+#include "pfb_channelizer_cc.h"
+#include <gnuradio/io_signature.h>
+#include <algorithm>  // for std::copy
+#include <stdexcept>
+#include <string>
+
+
+pfb_channelizer_cc_sptr make_pfb_channelizer_cc(int32_t n_channels,
+    const std::vector<float> &taps,
+    const std::vector<int32_t> &channel_map)
+{
+    return pfb_channelizer_cc_sptr(new pfb_channelizer_cc(n_channels, taps, channel_map));
+}
+
+
+pfb_channelizer_cc::pfb_channelizer_cc(int32_t n_channels,
+    const std::vector<float> &taps,
+    const std::vector<int32_t> &channel_map) : gr::sync_decimator("pfb_channelizer_cc",
+                                                   gr::io_signature::make(1, 1, sizeof(gr_complex)),
+                                                   gr::io_signature::make(channel_map.size(), channel_map.size(), sizeof(gr_complex)),
+                                                   std::max(n_channels, 1)),
+                                               channel_map_(channel_map),
+                                               n_channels_(n_channels)
+{
+    if (n_channels_ < 1 or taps.empty() or channel_map_.empty())
+        {
+            throw std::invalid_argument("pfb_channelizer_cc: invalid number of channels, taps or channel map");
+        }
+    for (const auto channel : channel_map_)
+        {
+            if (channel < 0 or channel >= n_channels_)
+                {
+                    throw std::invalid_argument("pfb_channelizer_cc: channel " + std::to_string(channel) + " out of range");
+                }
+        }
+    taps_per_branch_ = (static_cast<int32_t>(taps.size()) + n_channels_ - 1) / n_channels_;
+    taps_ = volk_gnsssdr::vector<float>(taps_per_branch_ * n_channels_, 0.0);
+    std::copy(taps.begin(), taps.end(), taps_.begin());
+    set_history(taps_.size());
+    d_fft_ = gnss_fft_rev_make_unique(n_channels_);
+}
+
+
+int pfb_channelizer_cc::work(int noutput_items,
+    gr_vector_const_void_star &input_items,
+    gr_vector_void_star &output_items)
+{
+    const auto *in = reinterpret_cast<const gr_complex *>(input_items[0]);
+    gr_complex *branches = d_fft_->get_inbuf();
+    const gr_complex *channels = d_fft_->get_outbuf();
+    const auto n_outputs = static_cast<int32_t>(channel_map_.size());
+
+    for (int m = 0; m < noutput_items; m++)
+        {
+            // Newest input sample of this block, after the history
+            const gr_complex *newest = in + taps_.size() - 1 + (m + 1) * n_channels_ - 1;
+            for (int32_t r = 0; r < n_channels_; r++)
+                {
+                    // Branch r filters the samples newest[-r - p * n_channels_].
+                    // It goes to FFT bin r + 1, which folds the phase of the
+                    // channel mixers (referred to the newest sample) into the FFT.
+                    gr_complex acc(0.0, 0.0);
+                    const gr_complex *sample = newest - r;
+                    for (int32_t p = 0; p < taps_per_branch_; p++)
+                        {
+                            acc += taps_[p * n_channels_ + r] * *sample;
+                            sample -= n_channels_;
+                        }
+                    branches[(r + 1) % n_channels_] = acc;
+                }
+            d_fft_->execute();
+            for (int32_t j = 0; j < n_outputs; j++)
+                {
+                    static_cast<gr_complex *>(output_items[j])[m] = channels[channel_map_[j]];
+                }
+        }
+    return noutput_items;
+}
@@ -0,0 +1,80 @@
+/*!
+ * \file pfb_channelizer_cc.h
+ * \brief Polyphase filter bank channelizer that splits a wideband signal
+ * into decimated sub-bands with one FFT per block of input samples
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ *
+ */
+
+#ifndef GNSS_SDR_PFB_CHANNELIZER_CC_H
+#define GNSS_SDR_PFB_CHANNELIZER_CC_H
+
+#include "gnss_block_interface.h"
+#include "gnss_sdr_fft.h"
+#include <gnuradio/sync_decimator.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/** \addtogroup Input_Filter
+ * \{ */
+/** \addtogroup Input_filter_gnuradio_blocks
+ * \{ */
+
+
+class pfb_channelizer_cc;
+
+using pfb_channelizer_cc_sptr = gnss_shared_ptr<pfb_channelizer_cc>;
+
+pfb_channelizer_cc_sptr make_pfb_channelizer_cc(
+    int32_t n_channels,
+    const std::vector<float> &taps,
+    const std::vector<int32_t> &channel_map);
+
+/*!
+ * \brief Critically sampled polyphase filter bank channelizer.
+ *
+ * The input band is divided into \a n_channels channels of width
+ * fs / n_channels, channel k being centered at k * fs / n_channels (channels
+ * above n_channels / 2 hold the negative frequencies). Output j delivers
+ * channel channel_map[j], decimated by n_channels. The result is the same
+ * as shifting channel k to zero Hz, filtering with the low-pass prototype
+ * \a taps and keeping one out of n_channels samples, but each block of
+ * n_channels input samples costs taps.size() multiplications and one FFT
+ * for all the channels.
+ * Throws std::invalid_argument if the parameters are not valid.
+ */
+class pfb_channelizer_cc : public gr::sync_decimator
+{
+public:
+    ~pfb_channelizer_cc() = default;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend pfb_channelizer_cc_sptr make_pfb_channelizer_cc(int32_t n_channels, const std::vector<float> &taps, const std::vector<int32_t> &channel_map);
+    pfb_channelizer_cc(int32_t n_channels, const std::vector<float> &taps, const std::vector<int32_t> &channel_map);
+
+    std::unique_ptr<gnss_fft_complex_rev> d_fft_;
+    volk_gnsssdr::vector<float> taps_;  // prototype filter, padded to a multiple of n_channels_
+    std::vector<int32_t> channel_map_;
+    int32_t n_channels_;
+    int32_t taps_per_branch_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PFB_CHANNELIZER_CC_H
@@ -20,8 +20,8 @@
 #define GNSS_SDR_PULSE_BLANKING_CC_H
 
 #include "gnss_block_interface.h"
+#include "pulse_blanking_detector.h"
 #include <gnuradio/block.h>
-#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstdint>
 
 /** \addtogroup Input_Filter
@@ -41,27 +41,32 @@ pulse_blanking_cc_sptr make_pulse_blanking_cc(
     int32_t n_segments_est,
     int32_t n_segments_reset);
 
+/*!
+ * \brief Replaces by zeros the samples affected by pulsed interference,
+ * detected by a Pulse_Blanking_Detector.
+ *
+ * A window of \a length samples centered on each sample is compared with a
+ * threshold given by \a pfa and by the noise power, which is estimated on
+ * the last \a n_segments_est clean windows, and estimated again from
+ * scratch after \a n_segments_reset consecutive blanked windows. Every
+ * \a n_segments_est windows, the percentage of blanked samples is
+ * published on the "interference" message port.
+ */
 class pulse_blanking_cc : public gr::block
 {
 public:
     ~pulse_blanking_cc() = default;
 
-    int general_work(int noutput_items __attribute__((unused)), gr_vector_int &ninput_items __attribute__((unused)),
+    void forecast(int noutput_items, gr_vector_int &ninput_items_required);
+
+    int general_work(int noutput_items, gr_vector_int &ninput_items,
         gr_vector_const_void_star &input_items, gr_vector_void_star &output_items);
 
 private:
     friend pulse_blanking_cc_sptr make_pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
     pulse_blanking_cc(float pfa, int32_t length, int32_t n_segments_est, int32_t n_segments_reset);
-    volk_gnsssdr::vector<gr_complex> zeros_;
-    float noise_power_estimation_;
-    float thres_;
-    float pfa_;
-    int32_t length_;
-    int32_t n_segments_;
-    int32_t n_segments_est_;
-    int32_t n_segments_reset_;
-    int32_t n_deg_fred_;
-    bool last_filtered_;
+
+    Pulse_Blanking_Detector detector_;
 };
 
 
@@ -0,0 +1,239 @@
+/*!
+ * \file gnss_dump_writer.cc
+ * \brief Buffered binary writer for the dump files of the processing blocks,
+ * flushed by a background I/O thread
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_dump_writer.h"
+#include <glog/logging.h>
+#include <algorithm>  // for std::max, std::min
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <utility>  // for std::move
+
+
+struct Gnss_Dump_Writer::State
+{
+    std::string filename;
+    std::ofstream file;
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::vector<char>> full_batches;
+    std::vector<std::vector<char>> free_batches;
+    bool scheduled{false};  // queued in, or being written by, the I/O thread
+    bool failed{false};
+};
+
+
+/*
+ * Single thread that writes the batches of all the writers, one writer at
+ * a time, in the order in which they have pending data.
+ */
+class Gnss_Dump_Writer::Io_Thread
+{
+public:
+    static Io_Thread& instance()
+    {
+        static Io_Thread io_thread;
+        return io_thread;
+    }
+
+    // Called with state->mutex held and state->scheduled false
+    void schedule(std::shared_ptr<State> state)
+    {
+        state->scheduled = true;
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_pending.push_back(std::move(state));
+        d_cv.notify_one();
+    }
+
+    ~Io_Thread()
+    {
+        {
+            std::lock_guard<std::mutex> lock(d_mutex);
+            d_stop = true;
+        }
+        d_cv.notify_one();
+        d_thread.join();
+    }
+
+private:
+    Io_Thread() : d_thread(&Io_Thread::run, this) {}
+
+    void run()
+    {
+        std::unique_lock<std::mutex> lock(d_mutex);
+        while (true)
+            {
+                d_cv.wait(lock, [this] { return d_stop || !d_pending.empty(); });
+                if (d_pending.empty())
+                    {
+                        return;  // stop requested and nothing left to write
+                    }
+                std::shared_ptr<State> state = std::move(d_pending.front());
+                d_pending.pop_front();
+                lock.unlock();
+                drain(*state);
+                lock.lock();
+            }
+    }
+
+    static void drain(State& state)
+    {
+        std::unique_lock<std::mutex> lock(state.mutex);
+        while (!state.full_batches.empty())
+            {
+                std::vector<char> batch = std::move(state.full_batches.front());
+                state.full_batches.pop_front();
+                const bool failed = state.failed;
+                lock.unlock();
+                bool ok = true;
+                if (!failed)
+                    {
+                        state.file.write(batch.data(), static_cast<std::streamsize>(batch.size()));
+                        ok = state.file.good();
+                        if (!ok)
+                            {
+                                LOG(WARNING) << "Error writing dump file " << state.filename;
+                            }
+                    }
+                batch.clear();
+                lock.lock();
+                state.failed = state.failed || !ok;
+                state.free_batches.push_back(std::move(batch));
+                state.cv.notify_all();
+            }
+        state.scheduled = false;
+        state.cv.notify_all();
+    }
+
+    std::mutex d_mutex;
+    std::condition_variable d_cv;
+    std::deque<std::shared_ptr<State>> d_pending;
+    bool d_stop{false};
+    std::thread d_thread;
+};
+
+
+Gnss_Dump_Writer::~Gnss_Dump_Writer()
+{
+    close();
+}
+
+
+bool Gnss_Dump_Writer::open(const std::string& filename, size_t batch_bytes, size_t num_batches)
+{
+    close();
+    auto state = std::make_shared<State>();
+    state->filename = filename;
+    state->file.open(filename.c_str(), std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!state->file.is_open())
+        {
+            return false;
+        }
+    d_batch_bytes = batch_bytes > 0 ? batch_bytes : 1;
+    d_batch.reserve(d_batch_bytes);
+    for (size_t i = 1; i < std::max<size_t>(num_batches, 2); i++)
+        {
+            state->free_batches.emplace_back();
+            state->free_batches.back().reserve(d_batch_bytes);
+        }
+    d_bytes_written = 0;
+    d_state = std::move(state);
+    Io_Thread::instance();  // so that it outlives this writer
+    return true;
+}
+
+
+void Gnss_Dump_Writer::write(const void* data, size_t size)
+{
+    if (d_state == nullptr)
+        {
+            return;
+        }
+    const auto* bytes = static_cast<const char*>(data);
+    d_bytes_written += size;
+    while (size > 0)
+        {
+            if (d_batch.size() == d_batch_bytes)
+                {
+                    submit_batch();
+                }
+            const size_t n = std::min(size, d_batch_bytes - d_batch.size());
+            d_batch.insert(d_batch.end(), bytes, bytes + n);
+            bytes += n;
+            size -= n;
+        }
+}
+
+
+void Gnss_Dump_Writer::submit_batch()
+{
+    std::unique_lock<std::mutex> lock(d_state->mutex);
+    d_state->full_batches.push_back(std::move(d_batch));
+    if (!d_state->scheduled)
+        {
+            Io_Thread::instance().schedule(d_state);
+        }
+    // Back-pressure: wait for the I/O thread if all the batches are full
+    d_state->cv.wait(lock, [this] { return !d_state->free_batches.empty(); });
+    d_batch = std::move(d_state->free_batches.back());
+    d_state->free_batches.pop_back();
+    d_batch.reserve(d_batch_bytes);
+}
+
+
+void Gnss_Dump_Writer::flush()
+{
+    if (d_state == nullptr)
+        {
+            return;
+        }
+    if (!d_batch.empty())
+        {
+            submit_batch();
+        }
+    std::unique_lock<std::mutex> lock(d_state->mutex);
+    d_state->cv.wait(lock, [this] { return !d_state->scheduled; });
+    if (!d_state->failed)
+        {
+            d_state->file.flush();
+        }
+}
+
+
+void Gnss_Dump_Writer::close()
+{
+    if (d_state == nullptr)
+        {
+            return;
+        }
+    flush();
+    d_state->file.close();
+    d_state.reset();
+    d_batch = std::vector<char>();
+}
+
+
+bool Gnss_Dump_Writer::failed() const
+{
+    if (d_state == nullptr)
+        {
+            return false;
+        }
+    std::lock_guard<std::mutex> lock(d_state->mutex);
+    return d_state->failed;
+}
@@ -0,0 +1,120 @@
+/*!
+ * \file gnss_dump_writer.h
+ * \brief Buffered binary writer for the dump files of the processing blocks,
+ * flushed by a background I/O thread
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_DUMP_WRITER_H
+#define GNSS_SDR_GNSS_DUMP_WRITER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Writes fixed-layout records to a binary dump file without doing
+ * any I/O in the calling thread.
+ *
+ * Records are appended to a pre-allocated batch. Full batches are handed to
+ * an I/O thread shared by all the writers of the process, which writes them
+ * to disk and gives the memory back. The caller only waits if all the
+ * batches of the writer are pending to be written. The file contents are
+ * the same as writing each record with std::ofstream::write().
+ */
+class Gnss_Dump_Writer
+{
+public:
+    Gnss_Dump_Writer() = default;
+    ~Gnss_Dump_Writer();
+
+    Gnss_Dump_Writer(const Gnss_Dump_Writer&) = delete;
+    Gnss_Dump_Writer& operator=(const Gnss_Dump_Writer&) = delete;
+
+    /*!
+     * \brief Creates (or truncates) \a filename. Returns false if the file
+     * cannot be opened.
+     */
+    bool open(const std::string& filename, size_t batch_bytes = 65536, size_t num_batches = 4);
+
+    bool is_open() const
+    {
+        return d_state != nullptr;
+    }
+
+    /*!
+     * \brief Appends a record, which must be trivially copyable. Use
+     * packed structures to get layouts without padding.
+     */
+    template <typename Record>
+    void write(const Record& record)
+    {
+        static_assert(std::is_trivially_copyable<Record>::value, "Dump records must be trivially copyable");
+        write(&record, sizeof(Record));
+    }
+
+    /*!
+     * \brief Appends \a size bytes
+     */
+    void write(const void* data, size_t size);
+
+    /*!
+     * \brief Writes all the pending records and waits until they are on the
+     * file
+     */
+    void flush();
+
+    /*!
+     * \brief Flushes and closes the file
+     */
+    void close();
+
+    /*!
+     * \brief Number of bytes appended since the file was opened, written or
+     * not yet
+     */
+    uint64_t bytes_written() const
+    {
+        return d_bytes_written;
+    }
+
+    /*!
+     * \brief True if writing to the file has failed. Further records are
+     * discarded.
+     */
+    bool failed() const;
+
+private:
+    struct State;
+    class Io_Thread;
+
+    void submit_batch();
+
+    std::shared_ptr<State> d_state;
+    std::vector<char> d_batch;
+    size_t d_batch_bytes{0};
+    uint64_t d_bytes_written{0};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_DUMP_WRITER_H
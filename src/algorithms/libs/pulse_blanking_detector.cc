@@ -0,0 +1,145 @@
+/*!
+ * \file pulse_blanking_detector.cc
+ * \brief Detector of pulsed interference shared by the pulse blanking blocks
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pulse_blanking_detector.h"
+#include <boost/math/distributions/chi_squared.hpp>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+
+Pulse_Blanking_Detector::Pulse_Blanking_Detector(float pfa,
+    int32_t length,
+    int32_t n_segments_est,
+    int32_t n_segments_reset,
+    std::function<void(double)> report) : d_report(std::move(report)),
+                                          d_length(length),
+                                          d_lookahead(length / 2),
+                                          d_n_segments_est(std::max(1, n_segments_est)),
+                                          d_n_segments_reset(n_segments_reset),
+                                          d_n_deg_fred(2 * length)
+{
+    boost::math::chi_squared_distribution<float> my_dist_(d_n_deg_fred);
+    d_thres = boost::math::quantile(boost::math::complement(my_dist_, pfa));
+    d_noise_energies = std::vector<float>(d_n_segments_est);
+    d_magnitude = volk_gnsssdr::vector<float>(d_length);
+}
+
+
+void Pulse_Blanking_Detector::update_noise_estimation(float window_energy)
+{
+    if (d_n_segments < d_n_segments_est)
+        {
+            d_noise_energies[d_n_segments] = window_energy;
+            d_noise_energy_sum += window_energy;
+            d_n_segments++;
+            d_next_noise_energy = 0;
+            d_n_segments_blanked = 0;
+        }
+    else if (window_energy <= d_threshold)
+        {
+            // Slide the estimation window over the clean windows
+            d_noise_energy_sum += window_energy - d_noise_energies[d_next_noise_energy];
+            d_noise_energies[d_next_noise_energy] = window_energy;
+            d_next_noise_energy = (d_next_noise_energy + 1) % d_noise_energies.size();
+            d_n_segments_blanked = 0;
+        }
+    else if (++d_n_segments_blanked > d_n_segments_reset)
+        {
+            // The noise floor has probably changed, estimate it again
+            d_n_segments = 0;
+            d_noise_energy_sum = 0.0;
+            return;
+        }
+    if (d_n_segments == d_n_segments_est)
+        {
+            const double noise_power_estimation = d_noise_energy_sum / (static_cast<double>(d_n_segments_est) * static_cast<double>(d_n_deg_fred));
+            d_threshold = static_cast<float>(d_thres * noise_power_estimation);
+        }
+}
+
+
+void Pulse_Blanking_Detector::blank(const gr_complex* in, gr_complex* out, int32_t nsamples)
+{
+    if (nsamples <= 0)
+        {
+            return;
+        }
+    if (!d_started)
+        {
+            // The windows of the first samples extend before the start of the stream
+            volk_32fc_magnitude_squared_32f(d_magnitude.data() + d_length - d_lookahead, in, d_lookahead);
+            for (int32_t i = d_length - d_lookahead; i < d_length; i++)
+                {
+                    d_window_energy += d_magnitude[i];
+                }
+            d_started = true;
+        }
+    if (d_energy.size() < static_cast<size_t>(nsamples))
+        {
+            d_energy.resize(nsamples);
+            d_magnitude.resize(d_length + nsamples);
+        }
+
+    // Slide the window: sample k + d_lookahead enters, sample k + d_lookahead - d_length leaves
+    volk_32fc_magnitude_squared_32f(d_magnitude.data() + d_length, in + d_lookahead, nsamples);
+    for (int32_t k = 0; k < nsamples; k++)
+        {
+            d_window_energy += d_magnitude[d_length + k] - d_magnitude[k];
+            d_energy[k] = static_cast<float>(d_window_energy);
+        }
+    std::memmove(d_magnitude.data(), d_magnitude.data() + nsamples, sizeof(float) * d_length);
+
+    // The threshold is updated once per window of d_length samples
+    int32_t k = 0;
+    while (k < nsamples)
+        {
+            const int32_t run = std::min(nsamples - k, d_length - d_window_phase);
+            if (d_n_segments < d_n_segments_est)
+                {
+                    if (out != in)
+                        {
+                            std::memcpy(out + k, in + k, sizeof(gr_complex) * run);
+                        }
+                }
+            else
+                {
+                    volk_gnsssdr_32fc_32f_s32f_blank_32fc(out + k, in + k, d_energy.data() + k, d_threshold, run);
+                    for (int32_t i = k; i < k + run; i++)
+                        {
+                            d_blanked_samples += !(d_energy[i] <= d_threshold);
+                        }
+                }
+            k += run;
+            d_window_phase += run;
+            if (d_window_phase == d_length)
+                {
+                    d_window_phase = 0;
+                    update_noise_estimation(d_energy[k - 1]);
+                    if (++d_n_segments_report == d_n_segments_est)
+                        {
+                            if (d_report)
+                                {
+                                    const double processed_samples = static_cast<double>(d_n_segments_report) * static_cast<double>(d_length);
+                                    d_report(100.0 * static_cast<double>(d_blanked_samples) / processed_samples);
+                                }
+                            d_n_segments_report = 0;
+                            d_blanked_samples = 0;
+                        }
+                }
+        }
+}
@@ -0,0 +1,97 @@
+/*!
+ * \file pulse_blanking_detector.h
+ * \brief Detector of pulsed interference shared by the pulse blanking blocks
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_PULSE_BLANKING_DETECTOR_H
+#define GNSS_SDR_PULSE_BLANKING_DETECTOR_H
+
+#include <gnuradio/gr_complex.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+/** \addtogroup Algorithms_Library
+ * \{ */
+/** \addtogroup Algorithm_libs algorithms_libs
+ * \{ */
+
+
+/*!
+ * \brief Replaces by zeros the samples affected by pulsed interference.
+ *
+ * The energy of a window of \a length samples centered on each sample is
+ * updated as the window slides, and the sample is blanked if it exceeds the
+ * threshold given by \a pfa. The noise power is the mean energy of the last
+ * \a n_segments_est non-overlapping windows that were not blanked, so it
+ * follows slow changes of the noise floor. It is estimated again from
+ * scratch after \a n_segments_reset consecutive blanked windows.
+ * Every \a n_segments_est windows, the percentage of blanked samples is
+ * passed to \a report, if set.
+ */
+class Pulse_Blanking_Detector
+{
+public:
+    Pulse_Blanking_Detector(float pfa,
+        int32_t length,
+        int32_t n_segments_est,
+        int32_t n_segments_reset,
+        std::function<void(double)> report = nullptr);
+
+    /*!
+     * \brief Number of samples after the last one to blank that are needed,
+     * since the window of each sample is centered on it
+     */
+    int32_t lookahead() const
+    {
+        return d_lookahead;
+    }
+
+    /*!
+     * \brief Copies \a nsamples samples from \a in to \a out, replacing by
+     * zeros those affected by pulses. \a in must hold lookahead() samples
+     * more, which are the first ones of the next call. \a out can be \a in.
+     */
+    void blank(const gr_complex* in, gr_complex* out, int32_t nsamples);
+
+private:
+    void update_noise_estimation(float window_energy);
+
+    std::function<void(double)> d_report;
+    volk_gnsssdr::vector<float> d_magnitude;  // |x|^2, starting d_length samples before the first new one
+    volk_gnsssdr::vector<float> d_energy;     // energy of the window centered on each output sample
+    std::vector<float> d_noise_energies;      // energies of the last d_n_segments_est clean windows
+    double d_window_energy{0.0};
+    double d_noise_energy_sum{0.0};
+    uint64_t d_blanked_samples{0};
+    float d_threshold{0.0};  // blanking threshold, in units of window energy
+    float d_thres;
+    int32_t d_length;
+    int32_t d_lookahead;
+    int32_t d_window_phase{0};
+    int32_t d_n_segments{0};
+    int32_t d_n_segments_est;
+    int32_t d_n_segments_reset;
+    int32_t d_n_segments_blanked{0};
+    int32_t d_n_segments_report{0};
+    int32_t d_n_deg_fred;
+    size_t d_next_noise_energy{0};
+    bool d_started{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_PULSE_BLANKING_DETECTOR_H
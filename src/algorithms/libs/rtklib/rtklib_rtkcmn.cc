@@ -2069,11 +2069,12 @@ void time2str(gtime_t t, char *s, int n)
  * args   : gtime_t t        I   gtime_t struct
  *          int    n         I   number of decimals
  * return : time string
- * notes  : not reentrant, do not use multiple in a function
+ * notes  : not reentrant, do not use multiple in a function. The buffer is
+ *          per thread, so that several solvers can run at once
  *-----------------------------------------------------------------------------*/
 char *time_str(gtime_t t, int n)
 {
-    static char buff[64];
+    thread_local char buff[64];
     time2str(t, buff, n);
     return buff;
 }
@@ -2548,14 +2549,14 @@ void nut_iau1980(double t, const double *f, double *dpsi, double *deps)
  *                               (NULL: no output)
  * return : none
  * note   : see ref [3] chap 5
- *          not thread-safe
+ *          the cache of the last transformation is per thread
  *-----------------------------------------------------------------------------*/
 void eci2ecef(gtime_t tutc, const double *erpv, double *U, double *gmst)
 {
     const double ep2000[] = {2000, 1, 1, 12, 0, 0};
-    static gtime_t tutc_;
-    static double U_[9];
-    static double gmst_;
+    thread_local gtime_t tutc_;
+    thread_local double U_[9];
+    thread_local double gmst_;
     gtime_t tgps;
     double eps;
     double ze;
@@ -1097,6 +1097,8 @@ void getmet(double lat, double *met)
  *          double   *azel   I   satellite azimuth/elavation (rad)
  *          double   *var    O   variance of troposphric error (m^2)
  * return : slant tropospheric delay (m)
+ * notes  : the zenith delays are cached per thread, so that several solvers
+ *          can run at once
  *-----------------------------------------------------------------------------*/
 double sbstropcorr(gtime_t time, const double *pos, const double *azel,
     double *var)
@@ -1106,9 +1108,9 @@ double sbstropcorr(gtime_t time, const double *pos, const double *azel,
     const double rd = 287.054;
     const double gm = 9.784;
     const double g = 9.80665;
-    static double pos_[3] = {};
-    static double zh = 0.0;
-    static double zw = 0.0;
+    thread_local double pos_[3] = {};
+    thread_local double zh = 0.0;
+    thread_local double zw = 0.0;
     int i;
     double c;
     double met[10];
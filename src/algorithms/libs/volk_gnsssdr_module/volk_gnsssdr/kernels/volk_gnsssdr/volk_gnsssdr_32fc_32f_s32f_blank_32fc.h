@@ -0,0 +1,234 @@
+/*!
+ * \file volk_gnsssdr_32fc_32f_s32f_blank_32fc.h
+ * \brief VOLK_GNSSSDR kernel: blanks the samples whose energy exceeds a threshold.
+ *
+ * VOLK_GNSSSDR kernel that copies complex samples to the output, replacing by
+ * zero those whose associated energy is above a threshold
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_32fc_32f_s32f_blank_32fc
+ *
+ * \b Overview
+ *
+ * Blanking decision of a pulse blanker. Each sample is copied to the output
+ * if its energy is lower than or equal to the threshold, and replaced by zero
+ * otherwise (including if the energy is not a number):
+ *
+ * result[n] = (energy[n] <= threshold) ? in[n] : 0
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_32fc_32f_s32f_blank_32fc(lv_32fc_t* result, const lv_32fc_t* in, const float* energy, float threshold, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li in: The input samples
+ * \li energy: The energy associated with each sample
+ * \li threshold: The blanking threshold
+ * \li num_points: The number of samples
+ *
+ * \b Outputs
+ * \li result: The blanked samples. It can be the same buffer as \p in.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_32fc_32f_s32f_blank_32fc_H
+#define INCLUDED_volk_gnsssdr_32fc_32f_s32f_blank_32fc_H
+
+#include <volk_gnsssdr/volk_gnsssdr_complex.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_32fc_32f_s32f_blank_32fc_generic(lv_32fc_t* result, const lv_32fc_t* in, const float* energy, const float threshold, unsigned int num_points)
+{
+    unsigned int n;
+    for (n = 0; n < num_points; n++)
+        {
+            result[n] = (energy[n] <= threshold) ? in[n] : lv_cmake(0.0F, 0.0F);
+        }
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+/*
+ * The SIMD implementations compare the energies with the threshold and
+ * duplicate each lane of the resulting mask, so that it covers the real and
+ * imaginary parts of its sample.
+ */
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_gnsssdr_32fc_32f_s32f_blank_32fc_u_sse(lv_32fc_t* result, const lv_32fc_t* in, const float* energy, const float threshold, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 4;
+    const __m128 thres = _mm_set1_ps(threshold);
+    __m128 mask;
+    unsigned int number;
+    const float* in_ptr = (const float*)in;
+    const float* energy_ptr = energy;
+    float* out_ptr = (float*)result;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            mask = _mm_cmple_ps(_mm_loadu_ps(energy_ptr), thres);
+            _mm_storeu_ps(out_ptr, _mm_and_ps(_mm_loadu_ps(in_ptr), _mm_unpacklo_ps(mask, mask)));
+            _mm_storeu_ps(out_ptr + 4, _mm_and_ps(_mm_loadu_ps(in_ptr + 4), _mm_unpackhi_ps(mask, mask)));
+            in_ptr += 8;
+            energy_ptr += 4;
+            out_ptr += 8;
+        }
+
+    for (number = sse_iters * 4; number < num_points; number++)
+        {
+            result[number] = (energy[number] <= threshold) ? in[number] : lv_cmake(0.0F, 0.0F);
+        }
+}
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_SSE
+#include <xmmintrin.h>
+
+static inline void volk_gnsssdr_32fc_32f_s32f_blank_32fc_a_sse(lv_32fc_t* result, const lv_32fc_t* in, const float* energy, const float threshold, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 4;
+    const __m128 thres = _mm_set1_ps(threshold);
+    __m128 mask;
+    unsigned int number;
+    const float* in_ptr = (const float*)in;
+    const float* energy_ptr = energy;
+    float* out_ptr = (float*)result;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            mask = _mm_cmple_ps(_mm_load_ps(energy_ptr), thres);
+            _mm_store_ps(out_ptr, _mm_and_ps(_mm_load_ps(in_ptr), _mm_unpacklo_ps(mask, mask)));
+            _mm_store_ps(out_ptr + 4, _mm_and_ps(_mm_load_ps(in_ptr + 4), _mm_unpackhi_ps(mask, mask)));
+            in_ptr += 8;
+            energy_ptr += 4;
+            out_ptr += 8;
+        }
+
+    for (number = sse_iters * 4; number < num_points; number++)
+        {
+            result[number] = (energy[number] <= threshold) ? in[number] : lv_cmake(0.0F, 0.0F);
+        }
+}
+#endif /* LV_HAVE_SSE */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_32f_s32f_blank_32fc_u_avx(lv_32fc_t* result, const lv_32fc_t* in, const float* energy, const float threshold, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 8;
+    const __m256 thres = _mm256_set1_ps(threshold);
+    __m256 mask, lo, hi;
+    unsigned int number;
+    const float* in_ptr = (const float*)in;
+    const float* energy_ptr = energy;
+    float* out_ptr = (float*)result;
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            mask = _mm256_cmp_ps(_mm256_loadu_ps(energy_ptr), thres, _CMP_LE_OQ);
+            // Within each 128-bit lane: lo holds samples 0-1, hi holds samples 2-3
+            lo = _mm256_unpacklo_ps(mask, mask);
+            hi = _mm256_unpackhi_ps(mask, mask);
+            _mm256_storeu_ps(out_ptr, _mm256_and_ps(_mm256_loadu_ps(in_ptr), _mm256_permute2f128_ps(lo, hi, 0x20)));
+            _mm256_storeu_ps(out_ptr + 8, _mm256_and_ps(_mm256_loadu_ps(in_ptr + 8), _mm256_permute2f128_ps(lo, hi, 0x31)));
+            in_ptr += 16;
+            energy_ptr += 8;
+            out_ptr += 16;
+        }
+
+    for (number = avx_iters * 8; number < num_points; number++)
+        {
+            result[number] = (energy[number] <= threshold) ? in[number] : lv_cmake(0.0F, 0.0F);
+        }
+}
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_AVX
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_32fc_32f_s32f_blank_32fc_a_avx(lv_32fc_t* result, const lv_32fc_t* in, const float* energy, const float threshold, unsigned int num_points)
+{
+    const unsigned int avx_iters = num_points / 8;
+    const __m256 thres = _mm256_set1_ps(threshold);
+    __m256 mask, lo, hi;
+    unsigned int number;
+    const float* in_ptr = (const float*)in;
+    const float* energy_ptr = energy;
+    float* out_ptr = (float*)result;
+
+    for (number = 0; number < avx_iters; number++)
+        {
+            mask = _mm256_cmp_ps(_mm256_load_ps(energy_ptr), thres, _CMP_LE_OQ);
+            // Within each 128-bit lane: lo holds samples 0-1, hi holds samples 2-3
+            lo = _mm256_unpacklo_ps(mask, mask);
+            hi = _mm256_unpackhi_ps(mask, mask);
+            _mm256_store_ps(out_ptr, _mm256_and_ps(_mm256_load_ps(in_ptr), _mm256_permute2f128_ps(lo, hi, 0x20)));
+            _mm256_store_ps(out_ptr + 8, _mm256_and_ps(_mm256_load_ps(in_ptr + 8), _mm256_permute2f128_ps(lo, hi, 0x31)));
+            in_ptr += 16;
+            energy_ptr += 8;
+            out_ptr += 16;
+        }
+
+    for (number = avx_iters * 8; number < num_points; number++)
+        {
+            result[number] = (energy[number] <= threshold) ? in[number] : lv_cmake(0.0F, 0.0F);
+        }
+}
+#endif /* LV_HAVE_AVX */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_32fc_32f_s32f_blank_32fc_neon(lv_32fc_t* result, const lv_32fc_t* in, const float* energy, const float threshold, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 4;
+    const float32x4_t thres = vdupq_n_f32(threshold);
+    uint32x4_t mask;
+    uint32x4x2_t masks;
+    unsigned int number;
+    const float* in_ptr = (const float*)in;
+    const float* energy_ptr = energy;
+    float* out_ptr = (float*)result;
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            mask = vcleq_f32(vld1q_f32(energy_ptr), thres);
+            masks = vzipq_u32(mask, mask);
+            __VOLK_GNSSSDR_PREFETCH(in_ptr + 16);
+            vst1q_f32(out_ptr, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(vld1q_f32(in_ptr)), masks.val[0])));
+            vst1q_f32(out_ptr + 4, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(vld1q_f32(in_ptr + 4)), masks.val[1])));
+            in_ptr += 8;
+            energy_ptr += 4;
+            out_ptr += 8;
+        }
+
+    for (number = neon_iters * 4; number < num_points; number++)
+        {
+            result[number] = (energy[number] <= threshold) ? in[number] : lv_cmake(0.0F, 0.0F);
+        }
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_32fc_32f_s32f_blank_32fc_H */
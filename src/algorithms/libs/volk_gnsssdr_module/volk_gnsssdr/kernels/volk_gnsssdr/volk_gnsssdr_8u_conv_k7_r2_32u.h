@@ -0,0 +1,409 @@
+/*!
+ * \file volk_gnsssdr_8u_conv_k7_r2_32u.h
+ * \brief VOLK_GNSSSDR kernel: add-compare-select steps of a Viterbi decoder
+ * for the K=7, rate 1/2 convolutional code, with 8-bit soft symbols.
+ *
+ * VOLK_GNSSSDR kernel that updates the 64 path metrics of a K=7, rate 1/2
+ * Viterbi decoder and stores one decision bit per state and decoded bit.
+ * The trellis and the decision layout are those of Phil Karn's viterbi27
+ * (also used by libswiftcnav), so decisions can be traced back in the same way.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_conv_k7_r2_32u
+ *
+ * \b Overview
+ *
+ * Runs \p num_bits add-compare-select steps of a Viterbi decoder for a K=7,
+ * rate 1/2 convolutional code. The encoder register holds the newest bit in
+ * its least significant bit, so the state after a bit b is
+ * ((state << 1) | b) & 63.
+ *
+ * For each decoded bit, the branch metric of old state i (i < 32) is
+ * m = (branch_table[i] ^ sym0) + (branch_table[32 + i] ^ sym1), and the
+ * butterfly is:
+ *
+ * new[2i]     = min(old[i] + m,         old[i + 32] + (510 - m))
+ * new[2i + 1] = min(old[i] + (510 - m), old[i + 32] + m)
+ *
+ * The decision bit of new state s is set when the survivor comes from the old
+ * state s / 2 + 32, and it is stored in bit (s % 32) of decisions[2 * n + s / 32],
+ * n being the index of the decoded bit.
+ *
+ * Path metrics are signed 16-bit integers. Whenever the metric of state 0
+ * exceeds 16384 after a step, the minimum metric is subtracted from all of
+ * them, so that they never overflow. All the implementations produce exactly
+ * the same decisions and metrics.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_conv_k7_r2_32u(uint32_t* decisions, int16_t* path_metrics, const uint8_t* symbols, const uint8_t* branch_table, unsigned int num_bits)
+ * \endcode
+ *
+ * \b Inputs
+ * \li path_metrics: The 64 path metrics before the first step (updated in place).
+ * \li symbols: 2 * num_bits soft symbols, from 0 (strong 0) to 255 (strong 1).
+ * \li branch_table: Expected encoder outputs (0 or 255) for the 32 butterflies,
+ * first polynomial in the first 32 bytes, second polynomial in the last 32 bytes.
+ * \li num_bits: Number of decoded bits (trellis steps).
+ *
+ * \b Outputs
+ * \li decisions: 2 * num_bits words with the decision bits of each step.
+ * \li path_metrics: The 64 path metrics after the last step.
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_conv_k7_r2_32u_H
+#define INCLUDED_volk_gnsssdr_8u_conv_k7_r2_32u_H
+
+#include <volk_gnsssdr/volk_gnsssdr_common.h>
+#include <stdint.h>
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_conv_k7_r2_32u_generic(uint32_t* decisions, int16_t* path_metrics, const uint8_t* symbols, const uint8_t* branch_table, unsigned int num_bits)
+{
+    int16_t old_metrics[64];
+    unsigned int n;
+    int i;
+    for (i = 0; i < 64; i++)
+        {
+            old_metrics[i] = path_metrics[i];
+        }
+
+    for (n = 0; n < num_bits; n++)
+        {
+            const uint8_t sym0 = symbols[2 * n];
+            const uint8_t sym1 = symbols[2 * n + 1];
+            uint32_t d0 = 0;
+            uint32_t d1 = 0;
+            for (i = 0; i < 32; i++)
+                {
+                    const int metric = (branch_table[i] ^ sym0) + (branch_table[32 + i] ^ sym1);
+                    const int m0 = old_metrics[i] + metric;
+                    const int m1 = old_metrics[i + 32] + (510 - metric);
+                    const int m2 = old_metrics[i] + (510 - metric);
+                    const int m3 = old_metrics[i + 32] + metric;
+                    const uint32_t decision0 = m0 > m1;
+                    const uint32_t decision1 = m2 > m3;
+                    path_metrics[2 * i] = (int16_t)(decision0 ? m1 : m0);
+                    path_metrics[2 * i + 1] = (int16_t)(decision1 ? m3 : m2);
+                    if (i < 16)
+                        {
+                            d0 |= (decision0 << (2 * i)) | (decision1 << (2 * i + 1));
+                        }
+                    else
+                        {
+                            d1 |= (decision0 << (2 * i - 32)) | (decision1 << (2 * i - 31));
+                        }
+                }
+            decisions[2 * n] = d0;
+            decisions[2 * n + 1] = d1;
+
+            if (path_metrics[0] > 16384)
+                {
+                    int16_t min_metric = path_metrics[0];
+                    for (i = 1; i < 64; i++)
+                        {
+                            if (path_metrics[i] < min_metric)
+                                {
+                                    min_metric = path_metrics[i];
+                                }
+                        }
+                    for (i = 0; i < 64; i++)
+                        {
+                            path_metrics[i] = (int16_t)(path_metrics[i] - min_metric);
+                        }
+                }
+            for (i = 0; i < 64; i++)
+                {
+                    old_metrics[i] = path_metrics[i];
+                }
+        }
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+#include <emmintrin.h>
+
+static inline void volk_gnsssdr_8u_conv_k7_r2_32u_u_sse2(uint32_t* decisions, int16_t* path_metrics, const uint8_t* symbols, const uint8_t* branch_table, unsigned int num_bits)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max_metric = _mm_set1_epi16(510);
+    const __m128i c0_a = _mm_loadu_si128((const __m128i*)branch_table);
+    const __m128i c0_b = _mm_loadu_si128((const __m128i*)(branch_table + 16));
+    const __m128i c1_a = _mm_loadu_si128((const __m128i*)(branch_table + 32));
+    const __m128i c1_b = _mm_loadu_si128((const __m128i*)(branch_table + 48));
+    __m128i metrics[8];
+    __m128i branch[4];
+    __m128i x0, x1, m0, m1, m2, m3, even, odd, d_even, d_odd, lo, hi;
+    unsigned int n;
+    int k;
+    uint32_t mask[4];
+
+    for (k = 0; k < 8; k++)
+        {
+            metrics[k] = _mm_loadu_si128((const __m128i*)(path_metrics + 8 * k));
+        }
+
+    for (n = 0; n < num_bits; n++)
+        {
+            // Branch metrics of the 32 butterflies, as 16-bit integers
+            x0 = _mm_xor_si128(c0_a, _mm_set1_epi8((char)symbols[2 * n]));
+            x1 = _mm_xor_si128(c1_a, _mm_set1_epi8((char)symbols[2 * n + 1]));
+            branch[0] = _mm_add_epi16(_mm_unpacklo_epi8(x0, zero), _mm_unpacklo_epi8(x1, zero));
+            branch[1] = _mm_add_epi16(_mm_unpackhi_epi8(x0, zero), _mm_unpackhi_epi8(x1, zero));
+            x0 = _mm_xor_si128(c0_b, _mm_set1_epi8((char)symbols[2 * n]));
+            x1 = _mm_xor_si128(c1_b, _mm_set1_epi8((char)symbols[2 * n + 1]));
+            branch[2] = _mm_add_epi16(_mm_unpacklo_epi8(x0, zero), _mm_unpacklo_epi8(x1, zero));
+            branch[3] = _mm_add_epi16(_mm_unpackhi_epi8(x0, zero), _mm_unpackhi_epi8(x1, zero));
+
+            // Butterflies i = 8k ... 8k + 7 write the new states 16k ... 16k + 15,
+            // so the new metrics are kept apart until all the old ones are read
+            {
+                __m128i new_metrics[8];
+                for (k = 0; k < 4; k++)
+                    {
+                        m0 = _mm_add_epi16(metrics[k], branch[k]);
+                        m1 = _mm_add_epi16(metrics[k + 4], _mm_sub_epi16(max_metric, branch[k]));
+                        m2 = _mm_add_epi16(metrics[k], _mm_sub_epi16(max_metric, branch[k]));
+                        m3 = _mm_add_epi16(metrics[k + 4], branch[k]);
+                        even = _mm_min_epi16(m0, m1);
+                        odd = _mm_min_epi16(m2, m3);
+                        d_even = _mm_cmpgt_epi16(m0, m1);
+                        d_odd = _mm_cmpgt_epi16(m2, m3);
+                        new_metrics[2 * k] = _mm_unpacklo_epi16(even, odd);
+                        new_metrics[2 * k + 1] = _mm_unpackhi_epi16(even, odd);
+                        lo = _mm_unpacklo_epi16(d_even, d_odd);
+                        hi = _mm_unpackhi_epi16(d_even, d_odd);
+                        mask[k] = (uint32_t)_mm_movemask_epi8(_mm_packs_epi16(lo, hi));
+                    }
+                for (k = 0; k < 8; k++)
+                    {
+                        metrics[k] = new_metrics[k];
+                    }
+            }
+            decisions[2 * n] = mask[0] | (mask[1] << 16);
+            decisions[2 * n + 1] = mask[2] | (mask[3] << 16);
+
+            if ((int16_t)_mm_extract_epi16(metrics[0], 0) > 16384)
+                {
+                    __m128i min_metric = metrics[0];
+                    for (k = 1; k < 8; k++)
+                        {
+                            min_metric = _mm_min_epi16(min_metric, metrics[k]);
+                        }
+                    min_metric = _mm_min_epi16(min_metric, _mm_shuffle_epi32(min_metric, 0x4E));
+                    min_metric = _mm_min_epi16(min_metric, _mm_shuffle_epi32(min_metric, 0xB1));
+                    min_metric = _mm_min_epi16(min_metric, _mm_srli_epi32(min_metric, 16));
+                    min_metric = _mm_set1_epi16((short)_mm_extract_epi16(min_metric, 0));
+                    for (k = 0; k < 8; k++)
+                        {
+                            metrics[k] = _mm_sub_epi16(metrics[k], min_metric);
+                        }
+                }
+        }
+
+    for (k = 0; k < 8; k++)
+        {
+            _mm_storeu_si128((__m128i*)(path_metrics + 8 * k), metrics[k]);
+        }
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_conv_k7_r2_32u_u_avx2(uint32_t* decisions, int16_t* path_metrics, const uint8_t* symbols, const uint8_t* branch_table, unsigned int num_bits)
+{
+    const __m256i max_metric = _mm256_set1_epi16(510);
+    const __m128i c0_a = _mm_loadu_si128((const __m128i*)branch_table);
+    const __m128i c0_b = _mm_loadu_si128((const __m128i*)(branch_table + 16));
+    const __m128i c1_a = _mm_loadu_si128((const __m128i*)(branch_table + 32));
+    const __m128i c1_b = _mm_loadu_si128((const __m128i*)(branch_table + 48));
+    __m256i metrics[4];
+    __m256i new_metrics[4];
+    __m256i branch[2];
+    __m256i d_new[4];
+    __m256i m0, m1, m2, m3, even, odd, d_even, d_odd, lo, hi;
+    __m128i s0, s1;
+    __m128i min_metric_128;
+    unsigned int n;
+    int k;
+
+    for (k = 0; k < 4; k++)
+        {
+            metrics[k] = _mm256_loadu_si256((const __m256i*)(path_metrics + 16 * k));
+        }
+
+    for (n = 0; n < num_bits; n++)
+        {
+            // Branch metrics of the 32 butterflies, as 16-bit integers
+            s0 = _mm_set1_epi8((char)symbols[2 * n]);
+            s1 = _mm_set1_epi8((char)symbols[2 * n + 1]);
+            branch[0] = _mm256_add_epi16(_mm256_cvtepu8_epi16(_mm_xor_si128(c0_a, s0)), _mm256_cvtepu8_epi16(_mm_xor_si128(c1_a, s1)));
+            branch[1] = _mm256_add_epi16(_mm256_cvtepu8_epi16(_mm_xor_si128(c0_b, s0)), _mm256_cvtepu8_epi16(_mm_xor_si128(c1_b, s1)));
+
+            // Butterflies i = 16k ... 16k + 15 write the new states 32k ... 32k + 31.
+            // Unpacking works within 128-bit lanes, hence the lane permutations.
+            for (k = 0; k < 2; k++)
+                {
+                    m0 = _mm256_add_epi16(metrics[k], branch[k]);
+                    m1 = _mm256_add_epi16(metrics[k + 2], _mm256_sub_epi16(max_metric, branch[k]));
+                    m2 = _mm256_add_epi16(metrics[k], _mm256_sub_epi16(max_metric, branch[k]));
+                    m3 = _mm256_add_epi16(metrics[k + 2], branch[k]);
+                    even = _mm256_min_epi16(m0, m1);
+                    odd = _mm256_min_epi16(m2, m3);
+                    d_even = _mm256_cmpgt_epi16(m0, m1);
+                    d_odd = _mm256_cmpgt_epi16(m2, m3);
+                    lo = _mm256_unpacklo_epi16(even, odd);
+                    hi = _mm256_unpackhi_epi16(even, odd);
+                    new_metrics[2 * k] = _mm256_permute2x128_si256(lo, hi, 0x20);
+                    new_metrics[2 * k + 1] = _mm256_permute2x128_si256(lo, hi, 0x31);
+                    lo = _mm256_unpacklo_epi16(d_even, d_odd);
+                    hi = _mm256_unpackhi_epi16(d_even, d_odd);
+                    d_new[2 * k] = _mm256_permute2x128_si256(lo, hi, 0x20);
+                    d_new[2 * k + 1] = _mm256_permute2x128_si256(lo, hi, 0x31);
+                }
+            for (k = 0; k < 2; k++)
+                {
+                    // packs interleaves the lanes of its operands: restore the state order
+                    decisions[2 * n + k] = (uint32_t)_mm256_movemask_epi8(_mm256_permute4x64_epi64(_mm256_packs_epi16(d_new[2 * k], d_new[2 * k + 1]), 0xD8));
+                }
+            for (k = 0; k < 4; k++)
+                {
+                    metrics[k] = new_metrics[k];
+                }
+
+            if ((int16_t)_mm256_extract_epi16(metrics[0], 0) > 16384)
+                {
+                    __m256i min_metric = _mm256_min_epi16(_mm256_min_epi16(metrics[0], metrics[1]), _mm256_min_epi16(metrics[2], metrics[3]));
+                    min_metric_128 = _mm_min_epi16(_mm256_castsi256_si128(min_metric), _mm256_extracti128_si256(min_metric, 1));
+                    min_metric_128 = _mm_min_epi16(min_metric_128, _mm_shuffle_epi32(min_metric_128, 0x4E));
+                    min_metric_128 = _mm_min_epi16(min_metric_128, _mm_shuffle_epi32(min_metric_128, 0xB1));
+                    min_metric_128 = _mm_min_epi16(min_metric_128, _mm_srli_epi32(min_metric_128, 16));
+                    min_metric = _mm256_broadcastw_epi16(min_metric_128);
+                    for (k = 0; k < 4; k++)
+                        {
+                            metrics[k] = _mm256_sub_epi16(metrics[k], min_metric);
+                        }
+                }
+        }
+
+    for (k = 0; k < 4; k++)
+        {
+            _mm256_storeu_si256((__m256i*)(path_metrics + 16 * k), metrics[k]);
+        }
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_conv_k7_r2_32u_neon(uint32_t* decisions, int16_t* path_metrics, const uint8_t* symbols, const uint8_t* branch_table, unsigned int num_bits)
+{
+    const int16x8_t max_metric = vdupq_n_s16(510);
+    const uint8_t weights_array[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+    const uint8x8_t weights = vld1_u8(weights_array);
+    uint8x8_t c0[4];
+    uint8x8_t c1[4];
+    int16x8_t metrics[8];
+    int16x8_t new_metrics[8];
+    int16x8_t branch, m0, m1, m2, m3, even, odd;
+    int16x8x2_t zipped;
+    uint16x8x2_t d_zipped;
+    uint8x8_t s0, s1, bits_lo, bits_hi;
+    int16x4_t min_metric_4;
+    uint32_t mask[4];
+    unsigned int n;
+    int k;
+
+    for (k = 0; k < 4; k++)
+        {
+            c0[k] = vld1_u8(branch_table + 8 * k);
+            c1[k] = vld1_u8(branch_table + 32 + 8 * k);
+        }
+    for (k = 0; k < 8; k++)
+        {
+            metrics[k] = vld1q_s16(path_metrics + 8 * k);
+        }
+
+    for (n = 0; n < num_bits; n++)
+        {
+            s0 = vdup_n_u8(symbols[2 * n]);
+            s1 = vdup_n_u8(symbols[2 * n + 1]);
+
+            // Butterflies i = 8k ... 8k + 7 write the new states 16k ... 16k + 15
+            for (k = 0; k < 4; k++)
+                {
+                    branch = vreinterpretq_s16_u16(vaddl_u8(veor_u8(c0[k], s0), veor_u8(c1[k], s1)));
+                    m0 = vaddq_s16(metrics[k], branch);
+                    m1 = vaddq_s16(metrics[k + 4], vsubq_s16(max_metric, branch));
+                    m2 = vaddq_s16(metrics[k], vsubq_s16(max_metric, branch));
+                    m3 = vaddq_s16(metrics[k + 4], branch);
+                    even = vminq_s16(m0, m1);
+                    odd = vminq_s16(m2, m3);
+                    zipped = vzipq_s16(even, odd);
+                    new_metrics[2 * k] = zipped.val[0];
+                    new_metrics[2 * k + 1] = zipped.val[1];
+                    d_zipped = vzipq_u16(vcgtq_s16(m0, m1), vcgtq_s16(m2, m3));
+
+                    // One bit per state: weight the 0xFF masks and add them pairwise
+                    bits_lo = vand_u8(vmovn_u16(d_zipped.val[0]), weights);
+                    bits_hi = vand_u8(vmovn_u16(d_zipped.val[1]), weights);
+                    bits_lo = vpadd_u8(bits_lo, bits_hi);
+                    bits_lo = vpadd_u8(bits_lo, bits_lo);
+                    bits_lo = vpadd_u8(bits_lo, bits_lo);
+                    mask[k] = (uint32_t)vget_lane_u8(bits_lo, 0) | ((uint32_t)vget_lane_u8(bits_lo, 1) << 8);
+                }
+            for (k = 0; k < 8; k++)
+                {
+                    metrics[k] = new_metrics[k];
+                }
+            decisions[2 * n] = mask[0] | (mask[1] << 16);
+            decisions[2 * n + 1] = mask[2] | (mask[3] << 16);
+
+            if (vgetq_lane_s16(metrics[0], 0) > 16384)
+                {
+                    int16x8_t min_metric = metrics[0];
+                    for (k = 1; k < 8; k++)
+                        {
+                            min_metric = vminq_s16(min_metric, metrics[k]);
+                        }
+                    min_metric_4 = vpmin_s16(vget_low_s16(min_metric), vget_high_s16(min_metric));
+                    min_metric_4 = vpmin_s16(min_metric_4, min_metric_4);
+                    min_metric_4 = vpmin_s16(min_metric_4, min_metric_4);
+                    min_metric = vdupq_lane_s16(min_metric_4, 0);
+                    for (k = 0; k < 8; k++)
+                        {
+                            metrics[k] = vsubq_s16(metrics[k], min_metric);
+                        }
+                }
+        }
+
+    for (k = 0; k < 8; k++)
+        {
+            vst1q_s16(path_metrics + 8 * k, metrics[k]);
+        }
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_conv_k7_r2_32u_H */
@@ -0,0 +1,102 @@
+/*!
+ * \file volk_gnsssdr_8u_conv_k7_r2puppet_32u.h
+ * \brief VOLK_GNSSSDR puppet for the K=7, rate 1/2 Viterbi kernel.
+ *
+ * VOLK_GNSSSDR puppet for integrating the K=7, rate 1/2 Viterbi kernel into
+ * the test system. It uses the GPS CNAV / Galileo polynomials and starts from
+ * state 0.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_conv_k7_r2puppet_32u_H
+#define INCLUDED_volk_gnsssdr_8u_conv_k7_r2puppet_32u_H
+
+#include "volk_gnsssdr/volk_gnsssdr_8u_conv_k7_r2_32u.h"
+#include <stdint.h>
+
+
+static inline void volk_gnsssdr_8u_conv_k7_r2puppet_32u_init(uint8_t* branch_table, int16_t* path_metrics, uint32_t* decisions, unsigned int num_points)
+{
+    /* Bit-reversed G1 = 171 (octal) and G2 = 133 (octal) */
+    const unsigned int polys[2] = {0x4F, 0x6D};
+    unsigned int i, j, x;
+    for (j = 0; j < 2; j++)
+        {
+            for (i = 0; i < 32; i++)
+                {
+                    x = (2 * i) & polys[j];
+                    x ^= x >> 4;
+                    x ^= x >> 2;
+                    x ^= x >> 1;
+                    branch_table[32 * j + i] = (x & 1) ? 255 : 0;
+                }
+        }
+    for (i = 0; i < 64; i++)
+        {
+            path_metrics[i] = 63;
+        }
+    path_metrics[0] = 0;
+    if (num_points % 2)
+        {
+            decisions[num_points - 1] = 0;
+        }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+static inline void volk_gnsssdr_8u_conv_k7_r2puppet_32u_generic(uint32_t* decisions, const uint8_t* symbols, unsigned int num_points)
+{
+    uint8_t branch_table[64];
+    int16_t path_metrics[64];
+    volk_gnsssdr_8u_conv_k7_r2puppet_32u_init(branch_table, path_metrics, decisions, num_points);
+    volk_gnsssdr_8u_conv_k7_r2_32u_generic(decisions, path_metrics, symbols, branch_table, num_points / 2);
+}
+
+#endif /* LV_HAVE_GENERIC */
+
+
+#ifdef LV_HAVE_SSE2
+static inline void volk_gnsssdr_8u_conv_k7_r2puppet_32u_u_sse2(uint32_t* decisions, const uint8_t* symbols, unsigned int num_points)
+{
+    uint8_t branch_table[64];
+    int16_t path_metrics[64];
+    volk_gnsssdr_8u_conv_k7_r2puppet_32u_init(branch_table, path_metrics, decisions, num_points);
+    volk_gnsssdr_8u_conv_k7_r2_32u_u_sse2(decisions, path_metrics, symbols, branch_table, num_points / 2);
+}
+
+#endif /* LV_HAVE_SSE2 */
+
+
+#ifdef LV_HAVE_AVX2
+static inline void volk_gnsssdr_8u_conv_k7_r2puppet_32u_u_avx2(uint32_t* decisions, const uint8_t* symbols, unsigned int num_points)
+{
+    uint8_t branch_table[64];
+    int16_t path_metrics[64];
+    volk_gnsssdr_8u_conv_k7_r2puppet_32u_init(branch_table, path_metrics, decisions, num_points);
+    volk_gnsssdr_8u_conv_k7_r2_32u_u_avx2(decisions, path_metrics, symbols, branch_table, num_points / 2);
+}
+
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+static inline void volk_gnsssdr_8u_conv_k7_r2puppet_32u_neon(uint32_t* decisions, const uint8_t* symbols, unsigned int num_points)
+{
+    uint8_t branch_table[64];
+    int16_t path_metrics[64];
+    volk_gnsssdr_8u_conv_k7_r2puppet_32u_init(branch_table, path_metrics, decisions, num_points);
+    volk_gnsssdr_8u_conv_k7_r2_32u_neon(decisions, path_metrics, symbols, branch_table, num_points / 2);
+}
+
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_conv_k7_r2puppet_32u_H */
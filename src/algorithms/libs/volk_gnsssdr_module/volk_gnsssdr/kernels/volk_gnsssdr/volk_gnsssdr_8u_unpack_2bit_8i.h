@@ -0,0 +1,300 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack_2bit_8i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks 2-bit samples into 8-bit integers.
+ *
+ * VOLK_GNSSSDR kernel that unpacks bytes holding four 2-bit two's complement
+ * samples each into odd-valued 8-bit integers
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack_2bit_8i
+ *
+ * \b Overview
+ *
+ * Unpacks bytes holding four 2-bit two's complement samples each. The first
+ * sample is in the two least significant bits. Each sample s is stored as
+ * 2 * s + 1, that is, one of {-3, -1, 1, 3}.
+ *
+ * Pairs of samples can be read as lv_8sc_t values if the samples are
+ * interleaved I/Q.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack_2bit_8i(int8_t* result, const uint8_t* packed, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed samples, (num_points + 3) / 4 bytes
+ * \li num_points: The number of samples to unpack
+ *
+ * \b Outputs
+ * \li result: The unpacked samples
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack_2bit_8i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack_2bit_8i_H
+
+#include <stdint.h>
+#include <string.h>
+
+// Value of each 2-bit field, and samples of each of the 256 bytes
+#define VOLK_GNSSSDR_2BIT_VALUE(x) ((x) < 2 ? 2 * (x) + 1 : 2 * (x)-7)
+#define VOLK_GNSSSDR_2BIT_ENTRY(b)                                                                     \
+    {                                                                                                  \
+        VOLK_GNSSSDR_2BIT_VALUE((b)&3), VOLK_GNSSSDR_2BIT_VALUE(((b) >> 2) & 3),                       \
+            VOLK_GNSSSDR_2BIT_VALUE(((b) >> 4) & 3), VOLK_GNSSSDR_2BIT_VALUE(((b) >> 6) & 3) \
+    }
+#define VOLK_GNSSSDR_2BIT_ROW4(b) VOLK_GNSSSDR_2BIT_ENTRY(b), VOLK_GNSSSDR_2BIT_ENTRY((b) + 1), VOLK_GNSSSDR_2BIT_ENTRY((b) + 2), VOLK_GNSSSDR_2BIT_ENTRY((b) + 3)
+#define VOLK_GNSSSDR_2BIT_ROW16(b) VOLK_GNSSSDR_2BIT_ROW4(b), VOLK_GNSSSDR_2BIT_ROW4((b) + 4), VOLK_GNSSSDR_2BIT_ROW4((b) + 8), VOLK_GNSSSDR_2BIT_ROW4((b) + 12)
+#define VOLK_GNSSSDR_2BIT_ROW64(b) VOLK_GNSSSDR_2BIT_ROW16(b), VOLK_GNSSSDR_2BIT_ROW16((b) + 16), VOLK_GNSSSDR_2BIT_ROW16((b) + 32), VOLK_GNSSSDR_2BIT_ROW16((b) + 48)
+
+static const int8_t volk_gnsssdr_8u_unpack_2bit_8i_table[256][4] = {
+    VOLK_GNSSSDR_2BIT_ROW64(0), VOLK_GNSSSDR_2BIT_ROW64(64), VOLK_GNSSSDR_2BIT_ROW64(128), VOLK_GNSSSDR_2BIT_ROW64(192)};
+
+
+static inline void volk_gnsssdr_8u_unpack_2bit_8i_tail(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int num_bytes = num_points / 4;
+    unsigned int i;
+    for (i = 0; i < num_bytes; i++)
+        {
+            memcpy(result + 4 * i, volk_gnsssdr_8u_unpack_2bit_8i_table[packed[i]], 4);
+        }
+    if (num_points % 4 != 0)
+        {
+            memcpy(result + 4 * num_bytes, volk_gnsssdr_8u_unpack_2bit_8i_table[packed[num_bytes]], num_points % 4);
+        }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack_2bit_8i_generic(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_8u_unpack_2bit_8i_tail(result, packed, num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+/*
+ * The SIMD implementations split each byte into its low and high nibbles,
+ * repeat them as (low, low, high, high) so that there is one byte per
+ * sample, mask the field of each sample (0x03 or 0x0C) and look the masked
+ * value up in a 16-entry table with a byte shuffle.
+ */
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_2bit_8i_u_ssse3(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 64;
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i field_mask = _mm_set1_epi32(0x0C030C03);
+    const __m128i values = _mm_setr_epi8(1, 3, -3, -1, 3, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i repeat_lo = _mm_setr_epi8(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m128i repeat_hi = _mm_setr_epi8(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+    __m128i in, lo, hi, a, b;
+    unsigned int number;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            in = _mm_loadu_si128((const __m128i*)in_ptr);
+            lo = _mm_and_si128(in, nibble_mask);
+            hi = _mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask);
+            a = _mm_unpacklo_epi8(lo, hi);
+            b = _mm_unpackhi_epi8(lo, hi);
+            _mm_storeu_si128((__m128i*)out_ptr, _mm_shuffle_epi8(values, _mm_and_si128(_mm_shuffle_epi8(a, repeat_lo), field_mask)));
+            _mm_storeu_si128((__m128i*)(out_ptr + 16), _mm_shuffle_epi8(values, _mm_and_si128(_mm_shuffle_epi8(a, repeat_hi), field_mask)));
+            _mm_storeu_si128((__m128i*)(out_ptr + 32), _mm_shuffle_epi8(values, _mm_and_si128(_mm_shuffle_epi8(b, repeat_lo), field_mask)));
+            _mm_storeu_si128((__m128i*)(out_ptr + 48), _mm_shuffle_epi8(values, _mm_and_si128(_mm_shuffle_epi8(b, repeat_hi), field_mask)));
+            in_ptr += 16;
+            out_ptr += 64;
+        }
+
+    volk_gnsssdr_8u_unpack_2bit_8i_tail(out_ptr, in_ptr, num_points - sse_iters * 64);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_2bit_8i_a_ssse3(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 64;
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i field_mask = _mm_set1_epi32(0x0C030C03);
+    const __m128i values = _mm_setr_epi8(1, 3, -3, -1, 3, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i repeat_lo = _mm_setr_epi8(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m128i repeat_hi = _mm_setr_epi8(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+    __m128i in, lo, hi, a, b;
+    unsigned int number;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            in = _mm_load_si128((const __m128i*)in_ptr);
+            lo = _mm_and_si128(in, nibble_mask);
+            hi = _mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask);
+            a = _mm_unpacklo_epi8(lo, hi);
+            b = _mm_unpackhi_epi8(lo, hi);
+            _mm_store_si128((__m128i*)out_ptr, _mm_shuffle_epi8(values, _mm_and_si128(_mm_shuffle_epi8(a, repeat_lo), field_mask)));
+            _mm_store_si128((__m128i*)(out_ptr + 16), _mm_shuffle_epi8(values, _mm_and_si128(_mm_shuffle_epi8(a, repeat_hi), field_mask)));
+            _mm_store_si128((__m128i*)(out_ptr + 32), _mm_shuffle_epi8(values, _mm_and_si128(_mm_shuffle_epi8(b, repeat_lo), field_mask)));
+            _mm_store_si128((__m128i*)(out_ptr + 48), _mm_shuffle_epi8(values, _mm_and_si128(_mm_shuffle_epi8(b, repeat_hi), field_mask)));
+            in_ptr += 16;
+            out_ptr += 64;
+        }
+
+    volk_gnsssdr_8u_unpack_2bit_8i_tail(out_ptr, in_ptr, num_points - sse_iters * 64);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_2bit_8i_u_avx2(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int avx2_iters = num_points / 128;
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    const __m256i field_mask = _mm256_set1_epi32(0x0C030C03);
+    const __m256i values = _mm256_setr_epi8(1, 3, -3, -1, 3, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0,
+        1, 3, -3, -1, 3, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0);
+    const __m256i repeat_lo = _mm256_setr_epi8(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7,
+        0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m256i repeat_hi = _mm256_setr_epi8(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15,
+        8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+    __m256i in, lo, hi, a, b, a_lo, a_hi, b_lo, b_hi;
+    unsigned int number;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    for (number = 0; number < avx2_iters; number++)
+        {
+            in = _mm256_loadu_si256((const __m256i*)in_ptr);
+            lo = _mm256_and_si256(in, nibble_mask);
+            hi = _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble_mask);
+            // Within each 128-bit lane: a holds bytes 0-7, b holds bytes 8-15
+            a = _mm256_unpacklo_epi8(lo, hi);
+            b = _mm256_unpackhi_epi8(lo, hi);
+            a_lo = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_shuffle_epi8(a, repeat_lo), field_mask));
+            a_hi = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_shuffle_epi8(a, repeat_hi), field_mask));
+            b_lo = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_shuffle_epi8(b, repeat_lo), field_mask));
+            b_hi = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_shuffle_epi8(b, repeat_hi), field_mask));
+            _mm256_storeu_si256((__m256i*)out_ptr, _mm256_permute2x128_si256(a_lo, a_hi, 0x20));
+            _mm256_storeu_si256((__m256i*)(out_ptr + 32), _mm256_permute2x128_si256(b_lo, b_hi, 0x20));
+            _mm256_storeu_si256((__m256i*)(out_ptr + 64), _mm256_permute2x128_si256(a_lo, a_hi, 0x31));
+            _mm256_storeu_si256((__m256i*)(out_ptr + 96), _mm256_permute2x128_si256(b_lo, b_hi, 0x31));
+            in_ptr += 32;
+            out_ptr += 128;
+        }
+
+    volk_gnsssdr_8u_unpack_2bit_8i_tail(out_ptr, in_ptr, num_points - avx2_iters * 128);
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_2bit_8i_a_avx2(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int avx2_iters = num_points / 128;
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    const __m256i field_mask = _mm256_set1_epi32(0x0C030C03);
+    const __m256i values = _mm256_setr_epi8(1, 3, -3, -1, 3, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0,
+        1, 3, -3, -1, 3, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0);
+    const __m256i repeat_lo = _mm256_setr_epi8(0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7,
+        0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7);
+    const __m256i repeat_hi = _mm256_setr_epi8(8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15,
+        8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13, 14, 14, 15, 15);
+    __m256i in, lo, hi, a, b, a_lo, a_hi, b_lo, b_hi;
+    unsigned int number;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    for (number = 0; number < avx2_iters; number++)
+        {
+            in = _mm256_load_si256((const __m256i*)in_ptr);
+            lo = _mm256_and_si256(in, nibble_mask);
+            hi = _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble_mask);
+            // Within each 128-bit lane: a holds bytes 0-7, b holds bytes 8-15
+            a = _mm256_unpacklo_epi8(lo, hi);
+            b = _mm256_unpackhi_epi8(lo, hi);
+            a_lo = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_shuffle_epi8(a, repeat_lo), field_mask));
+            a_hi = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_shuffle_epi8(a, repeat_hi), field_mask));
+            b_lo = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_shuffle_epi8(b, repeat_lo), field_mask));
+            b_hi = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_shuffle_epi8(b, repeat_hi), field_mask));
+            _mm256_store_si256((__m256i*)out_ptr, _mm256_permute2x128_si256(a_lo, a_hi, 0x20));
+            _mm256_store_si256((__m256i*)(out_ptr + 32), _mm256_permute2x128_si256(b_lo, b_hi, 0x20));
+            _mm256_store_si256((__m256i*)(out_ptr + 64), _mm256_permute2x128_si256(a_lo, a_hi, 0x31));
+            _mm256_store_si256((__m256i*)(out_ptr + 96), _mm256_permute2x128_si256(b_lo, b_hi, 0x31));
+            in_ptr += 32;
+            out_ptr += 128;
+        }
+
+    volk_gnsssdr_8u_unpack_2bit_8i_tail(out_ptr, in_ptr, num_points - avx2_iters * 128);
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack_2bit_8i_neon(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 64;
+    const uint8x16_t nibble_mask = vdupq_n_u8(0x0F);
+    const uint8x16_t field_mask = vreinterpretq_u8_u32(vdupq_n_u32(0x0C030C03));
+    const int8_t values_array[16] = {1, 3, -3, -1, 3, 0, 0, 0, -3, 0, 0, 0, -1, 0, 0, 0};
+    int8x8x2_t values;
+    uint8x16_t in, index;
+    uint8x16x2_t nibbles, repeated;
+    unsigned int number;
+    int k;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    values.val[0] = vld1_s8(values_array);
+    values.val[1] = vld1_s8(values_array + 8);
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            in = vld1q_u8(in_ptr);
+            __VOLK_GNSSSDR_PREFETCH(in_ptr + 64);
+            nibbles = vzipq_u8(vandq_u8(in, nibble_mask), vshrq_n_u8(in, 4));
+            for (k = 0; k < 2; k++)
+                {
+                    repeated = vzipq_u8(nibbles.val[k], nibbles.val[k]);
+                    index = vandq_u8(repeated.val[0], field_mask);
+                    vst1_s8(out_ptr, vtbl2_s8(values, vreinterpret_s8_u8(vget_low_u8(index))));
+                    vst1_s8(out_ptr + 8, vtbl2_s8(values, vreinterpret_s8_u8(vget_high_u8(index))));
+                    index = vandq_u8(repeated.val[1], field_mask);
+                    vst1_s8(out_ptr + 16, vtbl2_s8(values, vreinterpret_s8_u8(vget_low_u8(index))));
+                    vst1_s8(out_ptr + 24, vtbl2_s8(values, vreinterpret_s8_u8(vget_high_u8(index))));
+                    out_ptr += 32;
+                }
+            in_ptr += 16;
+        }
+
+    volk_gnsssdr_8u_unpack_2bit_8i_tail(out_ptr, in_ptr, num_points - neon_iters * 64);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack_2bit_8i_H */
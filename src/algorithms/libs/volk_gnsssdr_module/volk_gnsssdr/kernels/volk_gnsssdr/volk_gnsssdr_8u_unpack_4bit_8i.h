@@ -0,0 +1,242 @@
+/*!
+ * \file volk_gnsssdr_8u_unpack_4bit_8i.h
+ * \brief VOLK_GNSSSDR kernel: unpacks 4-bit samples into 8-bit integers.
+ *
+ * VOLK_GNSSSDR kernel that unpacks bytes holding two 4-bit two's complement
+ * samples each into odd-valued 8-bit integers
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+/*!
+ * \page volk_gnsssdr_8u_unpack_4bit_8i
+ *
+ * \b Overview
+ *
+ * Unpacks bytes holding two 4-bit two's complement samples each. The first
+ * sample is in the least significant nibble. Each sample s is stored as
+ * 2 * s + 1, that is, an odd value between -15 and 15.
+ *
+ * Pairs of samples can be read as lv_8sc_t values if the samples are
+ * interleaved I/Q.
+ *
+ * <b>Dispatcher Prototype</b>
+ * \code
+ * void volk_gnsssdr_8u_unpack_4bit_8i(int8_t* result, const uint8_t* packed, unsigned int num_points);
+ * \endcode
+ *
+ * \b Inputs
+ * \li packed: Packed samples, (num_points + 1) / 2 bytes
+ * \li num_points: The number of samples to unpack
+ *
+ * \b Outputs
+ * \li result: The unpacked samples
+ *
+ */
+
+#ifndef INCLUDED_volk_gnsssdr_8u_unpack_4bit_8i_H
+#define INCLUDED_volk_gnsssdr_8u_unpack_4bit_8i_H
+
+#include <stdint.h>
+
+static const int8_t volk_gnsssdr_8u_unpack_4bit_8i_values[16] = {1, 3, 5, 7, 9, 11, 13, 15, -15, -13, -11, -9, -7, -5, -3, -1};
+
+
+static inline void volk_gnsssdr_8u_unpack_4bit_8i_tail(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int num_bytes = num_points / 2;
+    unsigned int i;
+    for (i = 0; i < num_bytes; i++)
+        {
+            result[2 * i] = volk_gnsssdr_8u_unpack_4bit_8i_values[packed[i] & 0x0F];
+            result[2 * i + 1] = volk_gnsssdr_8u_unpack_4bit_8i_values[packed[i] >> 4];
+        }
+    if (num_points % 2 != 0)
+        {
+            result[2 * num_bytes] = volk_gnsssdr_8u_unpack_4bit_8i_values[packed[num_bytes] & 0x0F];
+        }
+}
+
+
+#ifdef LV_HAVE_GENERIC
+
+static inline void volk_gnsssdr_8u_unpack_4bit_8i_generic(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    volk_gnsssdr_8u_unpack_4bit_8i_tail(result, packed, num_points);
+}
+#endif /* LV_HAVE_GENERIC */
+
+
+/*
+ * The SIMD implementations look the low and high nibbles up in a 16-entry
+ * table with a byte shuffle, and interleave the results.
+ */
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_4bit_8i_u_ssse3(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 32;
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i values = _mm_loadu_si128((const __m128i*)volk_gnsssdr_8u_unpack_4bit_8i_values);
+    __m128i in, lo, hi;
+    unsigned int number;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            in = _mm_loadu_si128((const __m128i*)in_ptr);
+            lo = _mm_shuffle_epi8(values, _mm_and_si128(in, nibble_mask));
+            hi = _mm_shuffle_epi8(values, _mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask));
+            _mm_storeu_si128((__m128i*)out_ptr, _mm_unpacklo_epi8(lo, hi));
+            _mm_storeu_si128((__m128i*)(out_ptr + 16), _mm_unpackhi_epi8(lo, hi));
+            in_ptr += 16;
+            out_ptr += 32;
+        }
+
+    volk_gnsssdr_8u_unpack_4bit_8i_tail(out_ptr, in_ptr, num_points - sse_iters * 32);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_SSSE3
+#include <tmmintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_4bit_8i_a_ssse3(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int sse_iters = num_points / 32;
+    const __m128i nibble_mask = _mm_set1_epi8(0x0F);
+    const __m128i values = _mm_loadu_si128((const __m128i*)volk_gnsssdr_8u_unpack_4bit_8i_values);
+    __m128i in, lo, hi;
+    unsigned int number;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    for (number = 0; number < sse_iters; number++)
+        {
+            in = _mm_load_si128((const __m128i*)in_ptr);
+            lo = _mm_shuffle_epi8(values, _mm_and_si128(in, nibble_mask));
+            hi = _mm_shuffle_epi8(values, _mm_and_si128(_mm_srli_epi16(in, 4), nibble_mask));
+            _mm_store_si128((__m128i*)out_ptr, _mm_unpacklo_epi8(lo, hi));
+            _mm_store_si128((__m128i*)(out_ptr + 16), _mm_unpackhi_epi8(lo, hi));
+            in_ptr += 16;
+            out_ptr += 32;
+        }
+
+    volk_gnsssdr_8u_unpack_4bit_8i_tail(out_ptr, in_ptr, num_points - sse_iters * 32);
+}
+#endif /* LV_HAVE_SSSE3 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_4bit_8i_u_avx2(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int avx2_iters = num_points / 64;
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    const __m256i values = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)volk_gnsssdr_8u_unpack_4bit_8i_values));
+    __m256i in, lo, hi, a, b;
+    unsigned int number;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    for (number = 0; number < avx2_iters; number++)
+        {
+            in = _mm256_loadu_si256((const __m256i*)in_ptr);
+            lo = _mm256_shuffle_epi8(values, _mm256_and_si256(in, nibble_mask));
+            hi = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble_mask));
+            // Within each 128-bit lane: a holds bytes 0-7, b holds bytes 8-15
+            a = _mm256_unpacklo_epi8(lo, hi);
+            b = _mm256_unpackhi_epi8(lo, hi);
+            _mm256_storeu_si256((__m256i*)out_ptr, _mm256_permute2x128_si256(a, b, 0x20));
+            _mm256_storeu_si256((__m256i*)(out_ptr + 32), _mm256_permute2x128_si256(a, b, 0x31));
+            in_ptr += 32;
+            out_ptr += 64;
+        }
+
+    volk_gnsssdr_8u_unpack_4bit_8i_tail(out_ptr, in_ptr, num_points - avx2_iters * 64);
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_AVX2
+#include <immintrin.h>
+
+static inline void volk_gnsssdr_8u_unpack_4bit_8i_a_avx2(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int avx2_iters = num_points / 64;
+    const __m256i nibble_mask = _mm256_set1_epi8(0x0F);
+    const __m256i values = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)volk_gnsssdr_8u_unpack_4bit_8i_values));
+    __m256i in, lo, hi, a, b;
+    unsigned int number;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    for (number = 0; number < avx2_iters; number++)
+        {
+            in = _mm256_load_si256((const __m256i*)in_ptr);
+            lo = _mm256_shuffle_epi8(values, _mm256_and_si256(in, nibble_mask));
+            hi = _mm256_shuffle_epi8(values, _mm256_and_si256(_mm256_srli_epi16(in, 4), nibble_mask));
+            // Within each 128-bit lane: a holds bytes 0-7, b holds bytes 8-15
+            a = _mm256_unpacklo_epi8(lo, hi);
+            b = _mm256_unpackhi_epi8(lo, hi);
+            _mm256_store_si256((__m256i*)out_ptr, _mm256_permute2x128_si256(a, b, 0x20));
+            _mm256_store_si256((__m256i*)(out_ptr + 32), _mm256_permute2x128_si256(a, b, 0x31));
+            in_ptr += 32;
+            out_ptr += 64;
+        }
+
+    volk_gnsssdr_8u_unpack_4bit_8i_tail(out_ptr, in_ptr, num_points - avx2_iters * 64);
+}
+#endif /* LV_HAVE_AVX2 */
+
+
+#ifdef LV_HAVE_NEON
+#include <arm_neon.h>
+
+static inline void volk_gnsssdr_8u_unpack_4bit_8i_neon(int8_t* result, const uint8_t* packed, unsigned int num_points)
+{
+    const unsigned int neon_iters = num_points / 32;
+    const uint8x16_t nibble_mask = vdupq_n_u8(0x0F);
+    int8x8x2_t values;
+    uint8x16_t in, lo, hi;
+    int8x16_t lo_values, hi_values;
+    int8x16x2_t unpacked;
+    unsigned int number;
+    const uint8_t* in_ptr = packed;
+    int8_t* out_ptr = result;
+
+    values.val[0] = vld1_s8(volk_gnsssdr_8u_unpack_4bit_8i_values);
+    values.val[1] = vld1_s8(volk_gnsssdr_8u_unpack_4bit_8i_values + 8);
+
+    for (number = 0; number < neon_iters; number++)
+        {
+            in = vld1q_u8(in_ptr);
+            __VOLK_GNSSSDR_PREFETCH(in_ptr + 64);
+            lo = vandq_u8(in, nibble_mask);
+            hi = vshrq_n_u8(in, 4);
+            lo_values = vcombine_s8(vtbl2_s8(values, vreinterpret_s8_u8(vget_low_u8(lo))), vtbl2_s8(values, vreinterpret_s8_u8(vget_high_u8(lo))));
+            hi_values = vcombine_s8(vtbl2_s8(values, vreinterpret_s8_u8(vget_low_u8(hi))), vtbl2_s8(values, vreinterpret_s8_u8(vget_high_u8(hi))));
+            unpacked = vzipq_s8(lo_values, hi_values);
+            vst1q_s8(out_ptr, unpacked.val[0]);
+            vst1q_s8(out_ptr + 16, unpacked.val[1]);
+            in_ptr += 16;
+            out_ptr += 32;
+        }
+
+    volk_gnsssdr_8u_unpack_4bit_8i_tail(out_ptr, in_ptr, num_points - neon_iters * 32);
+}
+#endif /* LV_HAVE_NEON */
+
+#endif /* INCLUDED_volk_gnsssdr_8u_unpack_4bit_8i_H */
@@ -31,6 +31,7 @@
 #include <cmath>      // for round
 #include <cstdlib>    // for size_t, llabs
 #include <exception>  // for exception
+#include <fstream>    // for ifstream
 #include <iostream>   // for cerr, cout
 #include <limits>     // for numeric_limits
 #include <utility>    // for move
@@ -41,6 +42,22 @@
 #endif
 
 
+namespace
+{
+// Contents of each channel and epoch in the dump file, as read by save_matfile()
+struct Obs_Dump_Record
+{
+    double RX_time;
+    double TOW_at_current_symbol_s;
+    double Carrier_Doppler_hz;
+    double Carrier_phase_cycles;
+    double Pseudorange_m;
+    double PRN;
+    double Flag_valid_pseudorange;
+};
+}  // namespace
+
+
 hybrid_observables_gs_sptr hybrid_observables_gs_make(const Obs_Conf &conf_)
 {
     return hybrid_observables_gs_sptr(new hybrid_observables_gs(conf_));
@@ -105,15 +122,13 @@ hybrid_observables_gs::hybrid_observables_gs(const Obs_Conf &conf_) : gr::block(
                     std::cerr << "GNSS-SDR cannot create dump file for the Observables block. Wrong permissions?\n";
                     d_dump = false;
                 }
-            d_dump_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-            try
+            if (d_dump_file.open(d_dump_filename))
                 {
-                    d_dump_file.open(d_dump_filename.c_str(), std::ios::out | std::ios::binary);
                     LOG(INFO) << "Observables dump enabled Log file: " << d_dump_filename.c_str();
                 }
-            catch (const std::ifstream::failure &e)
+            else
                 {
-                    LOG(WARNING) << "Exception opening observables dump file " << e.what();
+                    LOG(WARNING) << "Error opening observables dump file " << d_dump_filename;
                     d_dump = false;
                 }
         }
@@ -152,15 +167,8 @@ hybrid_observables_gs::~hybrid_observables_gs()
     DLOG(INFO) << "Observables block destructor called.";
     if (d_dump_file.is_open())
         {
-            const auto pos = d_dump_file.tellp();
-            try
-                {
-                    d_dump_file.close();
-                }
-            catch (const std::exception &ex)
-                {
-                    LOG(WARNING) << "Exception in destructor closing the dump file " << ex.what();
-                }
+            const auto pos = d_dump_file.bytes_written();
+            d_dump_file.close();
             if (pos == 0)
                 {
                     errorlib::error_code ec;
@@ -185,6 +193,15 @@ hybrid_observables_gs::~hybrid_observables_gs()
 }
 
 
+bool hybrid_observables_gs::stop()
+{
+    // Called by GNU Radio when the flowgraph stops, so that the dump file
+    // is complete before this block is destroyed.
+    d_dump_file.flush();
+    return true;
+}
+
+
 void hybrid_observables_gs::msg_handler_pvt_to_observables(const pmt::pmt_t &msg)
 {
     gr::thread::scoped_lock lock(d_setlock);  // require mutex with work function called by the scheduler
@@ -713,31 +730,17 @@ int hybrid_observables_gs::general_work(int noutput_items __attribute__((unused)
             if (d_dump)
                 {
                     // MULTIPLEXED FILE RECORDING - Record results to file
-                    try
-                        {
-                            double tmp_double;
-                            for (uint32_t i = 0; i < d_nchannels_out; i++)
-                                {
-                                    tmp_double = out[i][0].RX_time;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].interp_TOW_ms / 1000.0;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_Doppler_hz;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Carrier_phase_rads / TWO_PI;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = out[i][0].Pseudorange_m;
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].PRN);
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                    tmp_double = static_cast<double>(out[i][0].Flag_valid_pseudorange);
-                                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                                }
-                        }
-                    catch (const std::ifstream::failure &e)
+                    for (uint32_t i = 0; i < d_nchannels_out; i++)
                         {
-                            LOG(WARNING) << "Exception writing observables dump file " << e.what();
-                            d_dump = false;
+                            Obs_Dump_Record record;
+                            record.RX_time = out[i][0].RX_time;
+                            record.TOW_at_current_symbol_s = out[i][0].interp_TOW_ms / 1000.0;
+                            record.Carrier_Doppler_hz = out[i][0].Carrier_Doppler_hz;
+                            record.Carrier_phase_cycles = out[i][0].Carrier_phase_rads / TWO_PI;
+                            record.Pseudorange_m = out[i][0].Pseudorange_m;
+                            record.PRN = static_cast<double>(out[i][0].PRN);
+                            record.Flag_valid_pseudorange = static_cast<double>(out[i][0].Flag_valid_pseudorange);
+                            d_dump_file.write(record);
                         }
                 }
 
@@ -21,13 +21,13 @@
 #define GNSS_SDR_HYBRID_OBSERVABLES_GS_H
 
 #include "gnss_block_interface.h"
+#include "gnss_dump_writer.h"
 #include "obs_conf.h"
 #include <boost/circular_buffer.hpp>  // for boost::circular_buffer
 #include <gnuradio/block.h>           // for block
 #include <gnuradio/types.h>           // for gr_vector_int
 #include <cstddef>                    // for size_t
 #include <cstdint>                    // for int32_t
-#include <fstream>                    // for std::ofstream
 #include <map>                        // for std::map
 #include <memory>                     // for std::shared, std:unique_ptr
 #include <string>                     // for std::string
@@ -58,6 +58,7 @@ class hybrid_observables_gs : public gr::block
 {
 public:
     ~hybrid_observables_gs();
+    bool stop();  //!< Writes the pending dump records
     void forecast(int noutput_items, gr_vector_int& ninput_items_required);
     int general_work(int noutput_items, gr_vector_int& ninput_items,
         gr_vector_const_void_star& input_items, gr_vector_void_star& output_items);
@@ -108,7 +109,7 @@ private:
 
     std::string d_dump_filename;
 
-    std::ofstream d_dump_file;
+    Gnss_Dump_Writer d_dump_file;
 
     double d_smooth_filter_M;
     double d_T_rx_step_s;
@@ -19,7 +19,7 @@
 #ifndef GNSS_SDR_SIGNAL_GENERATOR_H
 #define GNSS_SDR_SIGNAL_GENERATOR_H
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "gnss_block_interface.h"
 #include "signal_generator_c.h"
 #include <gnuradio/blocks/file_sink.h>
@@ -41,7 +41,7 @@ class SignalGenerator : public GNSSBlockInterface
 public:
     SignalGenerator(const ConfigurationInterface* configuration,
         const std::string& role, unsigned int in_stream,
-        unsigned int out_stream, Concurrent_Queue<pmt::pmt_t>* queue);
+        unsigned int out_stream, Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~SignalGenerator() = default;
 
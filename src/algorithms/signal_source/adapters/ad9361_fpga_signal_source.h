@@ -18,7 +18,7 @@
 #ifndef GNSS_SDR_AD9361_FPGA_SIGNAL_SOURCE_H
 #define GNSS_SDR_AD9361_FPGA_SIGNAL_SOURCE_H
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "fpga_buffer_monitor.h"
 #include "fpga_dynamic_bit_selection.h"
 #include "fpga_switch.h"
@@ -45,7 +45,7 @@ class Ad9361FpgaSignalSource : public SignalSourceBase
 public:
     Ad9361FpgaSignalSource(const ConfigurationInterface *configuration,
         const std::string &role, unsigned int in_stream,
-        unsigned int out_stream, Concurrent_Queue<pmt::pmt_t> *queue);
+        unsigned int out_stream, Concurrent_Ring_Queue<pmt::pmt_t> *queue);
 
     ~Ad9361FpgaSignalSource();
 
@@ -82,7 +82,7 @@ private:
         int64_t &samples,
         bool &repeat,
         uint32_t &dma_buff_offset_pos,
-        Concurrent_Queue<pmt::pmt_t> *queue);
+        Concurrent_Ring_Queue<pmt::pmt_t> *queue);
 
     void run_dynamic_bit_selection_process();
     void run_buffer_monitor_process();
@@ -149,7 +149,7 @@ private:
     uint32_t num_freq_bands_;
     uint32_t dma_buff_offset_pos_;
 
-    Concurrent_Queue<pmt::pmt_t> *queue_;
+    Concurrent_Ring_Queue<pmt::pmt_t> *queue_;
 };
 
 
@@ -18,7 +18,7 @@
 #ifndef GNSS_SDR_CUSTOM_UDP_SIGNAL_SOURCE_H
 #define GNSS_SDR_CUSTOM_UDP_SIGNAL_SOURCE_H
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "gr_complex_ip_packet_source.h"
 #include "signal_source_base.h"
 #include <gnuradio/blocks/file_sink.h>
@@ -45,7 +45,7 @@ class CustomUDPSignalSource : public SignalSourceBase
 public:
     CustomUDPSignalSource(const ConfigurationInterface* configuration,
         const std::string& role, unsigned int in_stream,
-        unsigned int out_stream, Concurrent_Queue<pmt::pmt_t>* queue);
+        unsigned int out_stream, Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~CustomUDPSignalSource() = default;
 
@@ -24,7 +24,7 @@ using namespace std::string_literals;
 
 FileSignalSource::FileSignalSource(ConfigurationInterface const* configuration,
     std::string const& role, unsigned int in_streams, unsigned int out_streams,
-    Concurrent_Queue<pmt::pmt_t>* queue)
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue)
     : FileSourceBase(configuration, role, "File_Signal_Source"s, queue, "short"s)
 {
     if (in_streams > 0)
@@ -42,7 +42,7 @@ class FileSignalSource : public FileSourceBase
 public:
     FileSignalSource(ConfigurationInterface const* configuration, std::string const& role,
         unsigned int in_streams, unsigned int out_streams,
-        Concurrent_Queue<pmt::pmt_t>* queue);
+        Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~FileSignalSource() = default;
 
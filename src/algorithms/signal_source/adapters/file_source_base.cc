@@ -20,6 +20,7 @@
 #include "gnss_sdr_flags.h"
 #include "gnss_sdr_string_literals.h"
 #include "gnss_sdr_valve.h"
+#include "mmap_file_source.h"
 #include <glog/logging.h>
 #include <cmath>  // ceil, floor
 #include <fstream>
@@ -29,7 +30,7 @@
 using namespace std::string_literals;
 
 FileSourceBase::FileSourceBase(ConfigurationInterface const* configuration, std::string const& role, std::string impl,
-    Concurrent_Queue<pmt::pmt_t>* queue,
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue,
     std::string default_item_type)
     : SignalSourceBase(configuration, role, std::move(impl)), filename_(configuration->property(role + ".filename"s, "../data/example_capture.dat"s)),
 
@@ -43,6 +44,7 @@ FileSourceBase::FileSourceBase(ConfigurationInterface const* configuration, std:
       header_size_(configuration->property(role + ".header_size"s, uint64_t(0))),
       seconds_to_skip_(configuration->property(role + ".seconds_to_skip"s, 0.0)),
       repeat_(configuration->property(role + ".repeat"s, false)),
+      enable_mmap_(configuration->property(role + ".enable_mmap"s, false)),
 
       samples_(configuration->property(role + ".samples"s, uint64_t(0))),
       sampling_frequency_(configuration->property(role + ".sampling_frequency"s, int64_t(0))),
@@ -90,6 +92,7 @@ void FileSourceBase::init()
     DLOG(INFO) << "Item type " << item_type_;
     DLOG(INFO) << "Item size " << item_size_;
     DLOG(INFO) << "Repeat " << repeat_;
+    DLOG(INFO) << "Memory-mapped " << enable_mmap_;
 
     DLOG(INFO) << "Dump " << dump_;
     DLOG(INFO) << "Dump filename " << dump_filename_;
@@ -397,7 +400,7 @@ gnss_shared_ptr<gr::block> FileSourceBase::throttle() const { return throttle_;
 gnss_shared_ptr<gr::block> FileSourceBase::sink() const { return sink_; }
 
 
-gr::blocks::file_source::sptr FileSourceBase::create_file_source()
+gnss_shared_ptr<gr::block> FileSourceBase::create_file_source()
 {
     auto item_tuple = itemTypeToSize();
     item_size_ = std::get<0>(item_tuple);
@@ -408,15 +411,32 @@ gr::blocks::file_source::sptr FileSourceBase::create_file_source()
             // TODO: why are we manually seeking, instead of passing the samples_to_skip to the file_source factory?
             auto samples_to_skip = samplesToSkip();
 
-            file_source_ = gr::blocks::file_source::make(item_size(), filename().data(), repeat());
-
-            if (samples_to_skip > 0)
+            if (enable_mmap_)
+                {
+                    // Skipping only moves the reading position
+                    auto mmap_source = make_mmap_file_source(item_size(), filename(), repeat());
+                    if (samples_to_skip > 0)
+                        {
+                            LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file";
+                            if (not mmap_source->seek(samples_to_skip))
+                                {
+                                    LOG(ERROR) << "Error skipping bytes!";
+                                }
+                        }
+                    file_source_ = mmap_source;
+                }
+            else
                 {
-                    LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file";
-                    if (not file_source_->seek(samples_to_skip, SEEK_SET))
+                    auto stdio_source = gr::blocks::file_source::make(item_size(), filename().data(), repeat());
+                    if (samples_to_skip > 0)
                         {
-                            LOG(ERROR) << "Error skipping bytes!";
+                            LOG(INFO) << "Skipping " << samples_to_skip << " samples of the input file";
+                            if (not stdio_source->seek(samples_to_skip, SEEK_SET))
+                                {
+                                    LOG(ERROR) << "Error skipping bytes!";
+                                }
                         }
+                    file_source_ = stdio_source;
                 }
         }
     catch (const std::exception& e)
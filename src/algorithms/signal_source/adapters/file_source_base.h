@@ -18,7 +18,7 @@
 #ifndef GNSS_SDR_FILE_SOURCE_BASE_H
 #define GNSS_SDR_FILE_SOURCE_BASE_H
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "signal_source_base.h"
 #include <gnuradio/blocks/file_source.h>
 #include <gnuradio/blocks/throttle.h>
@@ -56,6 +56,9 @@ class ConfigurationInterface;
 //!
 //!   .repeat   - whether to rewind and continue at end of file (default false)
 //!
+//!   .enable_mmap - whether to read the file through a memory mapping, with prefetching of the
+//!             samples ahead and constant-time skipping (default false)
+//!
 //! (probably abstracted to the base class)
 //!
 //!   .dump     - whether to archive input data
@@ -98,7 +101,7 @@ protected:
     //! type supported. Rather than require the item type to be specified in the config file, allow
     //! sub-classes to impose their will
     FileSourceBase(ConfigurationInterface const* configuration, std::string const& role, std::string impl,
-        Concurrent_Queue<pmt::pmt_t>* queue,
+        Concurrent_Ring_Queue<pmt::pmt_t>* queue,
         std::string default_item_type = "short");
 
     //! Perform post-construction initialization
@@ -134,7 +137,7 @@ protected:
 
     // The methods create the various blocks, if enabled, and return access to them. The created
     // object is also held in this class
-    gr::blocks::file_source::sptr create_file_source();
+    gnss_shared_ptr<gr::block> create_file_source();
     gr::blocks::throttle::sptr create_throttle();
     gnss_shared_ptr<gr::block> create_valve();
     gr::blocks::file_sink::sptr create_sink();
@@ -153,7 +156,7 @@ protected:
 
 private:
     std::string filename_;
-    gr::blocks::file_source::sptr file_source_;
+    gnss_shared_ptr<gr::block> file_source_;
 
     std::string item_type_;
     size_t item_size_;
@@ -162,6 +165,7 @@ private:
     size_t header_size_;  // length (in samples) of the header (if any)
     double seconds_to_skip_;
     bool repeat_;
+    bool enable_mmap_;
 
     // The valve allows only the configured number of samples through, then it closes.
 
@@ -172,7 +176,7 @@ private:
     uint64_t samples_;
     int64_t sampling_frequency_;  // why is this signed
     gnss_shared_ptr<gr::block> valve_;
-    Concurrent_Queue<pmt::pmt_t>* queue_;
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue_;
 
     bool enable_throttle_control_;
     gr::blocks::throttle::sptr throttle_;
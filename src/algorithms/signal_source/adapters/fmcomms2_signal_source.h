@@ -27,7 +27,7 @@
 #else
 #include <iio/fmcomms2_source.h>
 #endif
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include <pmt/pmt.h>
 #include <cstdint>
 #include <string>
@@ -46,7 +46,7 @@ class Fmcomms2SignalSource : public SignalSourceBase
 public:
     Fmcomms2SignalSource(const ConfigurationInterface* configuration,
         const std::string& role, unsigned int in_stream,
-        unsigned int out_stream, Concurrent_Queue<pmt::pmt_t>* queue);
+        unsigned int out_stream, Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~Fmcomms2SignalSource();
 
@@ -32,7 +32,7 @@ using namespace std::string_literals;
 
 MultichannelFileSignalSource::MultichannelFileSignalSource(const ConfigurationInterface* configuration,
     const std::string& role, unsigned int in_streams, unsigned int out_streams,
-    Concurrent_Queue<pmt::pmt_t>* queue)
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue)
     : SignalSourceBase(configuration, role, "Multichannel_File_Signal_Source"s), in_streams_(in_streams), out_streams_(out_streams)
 {
     const std::string default_filename("./example_capture.dat"s);
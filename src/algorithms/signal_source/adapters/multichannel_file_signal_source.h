@@ -21,7 +21,7 @@
 #ifndef GNSS_SDR_MULTICHANNEL_FILE_SIGNAL_SOURCE_H
 #define GNSS_SDR_MULTICHANNEL_FILE_SIGNAL_SOURCE_H
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "gnss_block_interface.h"
 #include "signal_source_base.h"
 #include <gnuradio/blocks/file_sink.h>
@@ -51,7 +51,7 @@ class MultichannelFileSignalSource : public SignalSourceBase
 public:
     MultichannelFileSignalSource(const ConfigurationInterface* configuration, const std::string& role,
         unsigned int in_streams, unsigned int out_streams,
-        Concurrent_Queue<pmt::pmt_t>* queue);
+        Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~MultichannelFileSignalSource() = default;
 
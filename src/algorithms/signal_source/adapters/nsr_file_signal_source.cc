@@ -24,7 +24,7 @@ using namespace std::string_literals;
 
 NsrFileSignalSource::NsrFileSignalSource(const ConfigurationInterface* configuration,
     const std::string& role, unsigned int in_streams, unsigned int out_streams,
-    Concurrent_Queue<pmt::pmt_t>* queue)
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue)
     : FileSourceBase(configuration, role, "Nsr_File_Signal_Source"s, queue, "byte"s)
 {
     if (in_streams > 0)
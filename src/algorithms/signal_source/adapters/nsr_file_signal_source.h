@@ -40,7 +40,7 @@ class NsrFileSignalSource : public FileSourceBase
 public:
     NsrFileSignalSource(const ConfigurationInterface* configuration, const std::string& role,
         unsigned int in_streams, unsigned int out_streams,
-        Concurrent_Queue<pmt::pmt_t>* queue);
+        Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~NsrFileSignalSource() = default;
 
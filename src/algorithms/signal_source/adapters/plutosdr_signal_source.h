@@ -26,7 +26,7 @@
 #else
 #include <iio/pluto_source.h>
 #endif
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include <pmt/pmt.h>
 #include <cstdint>
 #include <string>
@@ -47,7 +47,7 @@ class PlutosdrSignalSource : public SignalSourceBase
 public:
     PlutosdrSignalSource(const ConfigurationInterface* configuration,
         const std::string& role, unsigned int in_stream,
-        unsigned int out_stream, Concurrent_Queue<pmt::pmt_t>* queue);
+        unsigned int out_stream, Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~PlutosdrSignalSource() = default;
 
@@ -15,7 +15,7 @@
  */
 
 #include "raw_array_signal_source.h"
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "configuration_interface.h"
 #include "gnss_sdr_string_literals.h"
 #include <glog/logging.h>
@@ -27,7 +27,7 @@
 using namespace std::string_literals;
 
 RawArraySignalSource::RawArraySignalSource(const ConfigurationInterface* configuration,
-    std::string role, unsigned int in_stream, unsigned int out_stream, Concurrent_Queue<pmt::pmt_t>* queue)
+    std::string role, unsigned int in_stream, unsigned int out_stream, Concurrent_Ring_Queue<pmt::pmt_t>* queue)
     : SignalSourceBase(configuration, role, "Raw_Array_Signal_Source"s), in_stream_(in_stream), out_stream_(out_stream)
 {
     const std::string default_item_type("gr_complex");
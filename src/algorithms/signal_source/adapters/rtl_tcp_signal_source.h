@@ -18,7 +18,7 @@
 #ifndef GNSS_SDR_RTL_TCP_SIGNAL_SOURCE_H
 #define GNSS_SDR_RTL_TCP_SIGNAL_SOURCE_H
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "rtl_tcp_signal_source_c.h"
 #include "signal_source_base.h"
 #include <gnuradio/blocks/deinterleave.h>
@@ -49,7 +49,7 @@ public:
         const std::string& role,
         unsigned int in_stream,
         unsigned int out_stream,
-        Concurrent_Queue<pmt::pmt_t>* queue);
+        Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~RtlTcpSignalSource() = default;
 
@@ -39,7 +39,7 @@ class SpirFileSignalSource : public FileSourceBase
 public:
     SpirFileSignalSource(const ConfigurationInterface* configuration, const std::string& role,
         unsigned int in_streams, unsigned int out_streams,
-        Concurrent_Queue<pmt::pmt_t>* queue);
+        Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~SpirFileSignalSource() = default;
 
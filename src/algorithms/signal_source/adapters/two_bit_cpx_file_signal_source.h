@@ -43,7 +43,7 @@ public:
         const std::string& role,
         unsigned int in_streams,
         unsigned int out_streams,
-        Concurrent_Queue<pmt::pmt_t>* queue);
+        Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~TwoBitCpxFileSignalSource() = default;
 
@@ -29,7 +29,7 @@ TwoBitPackedFileSignalSource::TwoBitPackedFileSignalSource(
     const std::string& role,
     unsigned int in_streams,
     unsigned int out_streams,
-    Concurrent_Queue<pmt::pmt_t>* queue)
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue)
     : FileSourceBase(configuration, role, "Two_Bit_Packed_File_Signal_Source"s, queue, "byte"s), sample_type_(configuration->property(role + ".sample_type", "real"s)),  // options: "real", "iq", "qi"
       big_endian_items_(configuration->property(role + ".big_endian_items", true)),
       big_endian_bytes_(configuration->property(role + ".big_endian_bytes", false)),
@@ -17,7 +17,7 @@
 #ifndef GNSS_SDR_UHD_SIGNAL_SOURCE_H
 #define GNSS_SDR_UHD_SIGNAL_SOURCE_H
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "signal_source_base.h"
 #include <gnuradio/blocks/file_sink.h>
 #include <gnuradio/hier_block2.h>
@@ -43,7 +43,7 @@ class UhdSignalSource : public SignalSourceBase
 public:
     UhdSignalSource(const ConfigurationInterface* configuration,
         const std::string& role, unsigned int in_stream,
-        unsigned int out_stream, Concurrent_Queue<pmt::pmt_t>* queue);
+        unsigned int out_stream, Concurrent_Ring_Queue<pmt::pmt_t>* queue);
 
     ~UhdSignalSource() = default;
 
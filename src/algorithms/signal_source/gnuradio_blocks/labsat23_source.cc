@@ -32,7 +32,7 @@
 #include <utility>
 
 
-labsat23_source_sptr labsat23_make_source_sptr(const char *signal_file_basename, const std::vector<int> &channel_selector, Concurrent_Queue<pmt::pmt_t> *queue, bool digital_io_enabled)
+labsat23_source_sptr labsat23_make_source_sptr(const char *signal_file_basename, const std::vector<int> &channel_selector, Concurrent_Ring_Queue<pmt::pmt_t> *queue, bool digital_io_enabled)
 {
     return labsat23_source_sptr(new labsat23_source(signal_file_basename, channel_selector, queue, digital_io_enabled));
 }
@@ -40,7 +40,7 @@ labsat23_source_sptr labsat23_make_source_sptr(const char *signal_file_basename,
 
 labsat23_source::labsat23_source(const char *signal_file_basename,
     const std::vector<int> &channel_selector,
-    Concurrent_Queue<pmt::pmt_t> *queue,
+    Concurrent_Ring_Queue<pmt::pmt_t> *queue,
     bool digital_io_enabled) : gr::block("labsat23_source",
                                    gr::io_signature::make(0, 0, 0),
                                    gr::io_signature::make(1, 3, sizeof(gr_complex))),
@@ -19,7 +19,7 @@
 #ifndef GNSS_SDR_LABSAT23_SOURCE_H
 #define GNSS_SDR_LABSAT23_SOURCE_H
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "gnss_block_interface.h"
 #include <gnuradio/block.h>
 #include <pmt/pmt.h>
@@ -42,7 +42,7 @@ using labsat23_source_sptr = gnss_shared_ptr<labsat23_source>;
 labsat23_source_sptr labsat23_make_source_sptr(
     const char *signal_file_basename,
     const std::vector<int> &channel_selector,
-    Concurrent_Queue<pmt::pmt_t> *queue,
+    Concurrent_Ring_Queue<pmt::pmt_t> *queue,
     bool digital_io_enabled);
 
 /*!
@@ -63,12 +63,12 @@ private:
     friend labsat23_source_sptr labsat23_make_source_sptr(
         const char *signal_file_basename,
         const std::vector<int> &channel_selector,
-        Concurrent_Queue<pmt::pmt_t> *queue,
+        Concurrent_Ring_Queue<pmt::pmt_t> *queue,
         bool digital_io_enabled);
 
     labsat23_source(const char *signal_file_basename,
         const std::vector<int> &channel_selector,
-        Concurrent_Queue<pmt::pmt_t> *queue,
+        Concurrent_Ring_Queue<pmt::pmt_t> *queue,
         bool digital_io_enabled);
 
     std::string generate_filename();
@@ -83,7 +83,7 @@ private:
 
     std::ifstream binary_input_file;
     std::string d_signal_file_basename;
-    Concurrent_Queue<pmt::pmt_t> *d_queue;
+    Concurrent_Ring_Queue<pmt::pmt_t> *d_queue;
     std::vector<int> d_channel_selector_config;
     int d_current_file_number;
     uint8_t d_labsat_version;
@@ -0,0 +1,204 @@
+/*!
+ * \file mmap_file_source.cc
+ * \brief GNU Radio block that reads samples from a memory-mapped file, with a
+ * thread that prefetches the pages ahead of the reading position
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "mmap_file_source.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+#include <algorithm>  // for std::min
+#include <cerrno>
+#include <cstring>  // for memcpy, strerror
+#include <fcntl.h>
+#include <stdexcept>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Bytes kept loaded ahead of the reading position, and granularity of the
+// loads and releases. Both are multiples of any page size.
+constexpr size_t PREFETCH_WINDOW_BYTES = 64 * 1024 * 1024;
+constexpr size_t PREFETCH_CHUNK_BYTES = 4 * 1024 * 1024;
+
+
+mmap_file_source_sptr make_mmap_file_source(size_t item_size, const std::string &filename, bool repeat)
+{
+    return mmap_file_source_sptr(new mmap_file_source(item_size, filename, repeat));
+}
+
+
+mmap_file_source::mmap_file_source(size_t item_size, const std::string &filename, bool repeat)
+    : gr::sync_block("mmap_file_source",
+          gr::io_signature::make(0, 0, 0),
+          gr::io_signature::make(1, 1, item_size)),
+      d_item_size(item_size),
+      d_repeat(repeat)
+{
+    d_fd = ::open(filename.c_str(), O_RDONLY);
+    if (d_fd < 0)
+        {
+            throw std::runtime_error("mmap_file_source: cannot open " + filename + ": " + std::strerror(errno));
+        }
+    struct stat file_status
+    {
+    };
+    if (::fstat(d_fd, &file_status) != 0 || file_status.st_size < static_cast<off_t>(item_size))
+        {
+            ::close(d_fd);
+            throw std::runtime_error("mmap_file_source: " + filename + " does not contain any sample");
+        }
+    d_mapped_size = static_cast<size_t>(file_status.st_size);
+    d_size = d_mapped_size - d_mapped_size % d_item_size;
+
+    void *data = ::mmap(nullptr, d_mapped_size, PROT_READ, MAP_SHARED, d_fd, 0);
+    if (data == MAP_FAILED)
+        {
+            ::close(d_fd);
+            throw std::runtime_error("mmap_file_source: cannot map " + filename + ": " + std::strerror(errno));
+        }
+    d_data = static_cast<const uint8_t *>(data);
+    if (::madvise(data, d_mapped_size, MADV_SEQUENTIAL) != 0)
+        {
+            LOG(WARNING) << "mmap_file_source: madvise failed for " << filename;
+        }
+
+    d_prefetch_thread = std::thread(&mmap_file_source::prefetch, this);
+}
+
+
+mmap_file_source::~mmap_file_source()
+{
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_stop = true;
+    }
+    d_cv.notify_one();
+    d_prefetch_thread.join();
+    ::munmap(const_cast<uint8_t *>(d_data), d_mapped_size);
+    ::close(d_fd);
+}
+
+
+bool mmap_file_source::seek(uint64_t item)
+{
+    if (item >= items())
+        {
+            return false;
+        }
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        d_position = static_cast<size_t>(item) * d_item_size;
+    }
+    d_cv.notify_one();
+    return true;
+}
+
+
+uint64_t mmap_file_source::items() const
+{
+    return d_size / d_item_size;
+}
+
+
+int mmap_file_source::work(int noutput_items,
+    gr_vector_const_void_star &input_items __attribute__((unused)),
+    gr_vector_void_star &output_items)
+{
+    auto *out = static_cast<uint8_t *>(output_items[0]);
+    const size_t requested = static_cast<size_t>(noutput_items) * d_item_size;
+    size_t copied = 0;
+    bool wake_prefetcher = false;
+    {
+        std::lock_guard<std::mutex> lock(d_mutex);
+        while (copied < requested)
+            {
+                if (d_position == d_size)
+                    {
+                        if (!d_repeat)
+                            {
+                                break;
+                            }
+                        d_position = 0;
+                    }
+                const size_t n = std::min(requested - copied, d_size - d_position);
+                std::memcpy(out + copied, d_data + d_position, n);
+                copied += n;
+                d_position += n;
+            }
+        wake_prefetcher = d_prefetched < d_position + PREFETCH_WINDOW_BYTES / 2 || d_position >= d_released + 2 * PREFETCH_CHUNK_BYTES;
+    }
+    if (wake_prefetcher)
+        {
+            d_cv.notify_one();
+        }
+
+    if (copied == 0)
+        {
+            return -1;  // end of file
+        }
+    return static_cast<int>(copied / d_item_size);
+}
+
+
+void mmap_file_source::prefetch()
+{
+    const auto page_size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+    auto *data = const_cast<uint8_t *>(d_data);
+    std::unique_lock<std::mutex> lock(d_mutex);
+    while (!d_stop)
+        {
+            const size_t position_page = d_position - d_position % page_size;
+            if (d_prefetched < d_position || d_prefetched > d_position + PREFETCH_WINDOW_BYTES + PREFETCH_CHUNK_BYTES)
+                {
+                    // The reading position was moved by seek() or by a repetition
+                    d_prefetched = position_page;
+                }
+            if (d_released > position_page)
+                {
+                    d_released = position_page;
+                }
+
+            // Release the pages that were already read, they stay in the page cache
+            if (position_page >= d_released + PREFETCH_CHUNK_BYTES)
+                {
+                    const size_t begin = d_released;
+                    d_released = position_page;
+                    lock.unlock();
+                    ::madvise(data + begin, position_page - begin, MADV_DONTNEED);
+                    lock.lock();
+                    continue;
+                }
+
+            const size_t target = std::min(d_position + PREFETCH_WINDOW_BYTES, d_size);
+            if (d_prefetched >= target)
+                {
+                    d_cv.wait(lock);
+                    continue;
+                }
+
+            const size_t begin = d_prefetched;
+            const size_t end = std::min(begin + PREFETCH_CHUNK_BYTES, d_size);
+            d_prefetched = end;
+            lock.unlock();
+            ::madvise(data + begin, end - begin, MADV_WILLNEED);
+            // Touch the pages, so that work() does not even take minor faults
+            uint8_t sum = 0;
+            for (size_t i = begin; i < end; i += page_size)
+                {
+                    sum += *static_cast<volatile const uint8_t *>(d_data + i);
+                }
+            (void)sum;
+            lock.lock();
+        }
+}
@@ -0,0 +1,92 @@
+/*!
+ * \file mmap_file_source.h
+ * \brief GNU Radio block that reads samples from a memory-mapped file, with a
+ * thread that prefetches the pages ahead of the reading position
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_MMAP_FILE_SOURCE_H
+#define GNSS_SDR_MMAP_FILE_SOURCE_H
+
+#include "gnss_block_interface.h"
+#include <gnuradio/sync_block.h>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+/** \addtogroup Signal_Source
+ * \{ */
+/** \addtogroup Signal_Source_gnuradio_blocks
+ * \{ */
+
+
+class mmap_file_source;
+
+using mmap_file_source_sptr = gnss_shared_ptr<mmap_file_source>;
+
+mmap_file_source_sptr make_mmap_file_source(size_t item_size, const std::string &filename, bool repeat);
+
+/*!
+ * \brief Reads items of \a item_size bytes from a memory-mapped file.
+ *
+ * Samples are copied straight from the page cache to the output buffer,
+ * without going through stdio. A thread keeps the pages ahead of the
+ * reading position loaded, so that work() does not wait for the disk, and
+ * releases the pages already read. seek() only moves the reading position.
+ * Throws std::runtime_error if the file cannot be mapped.
+ */
+class mmap_file_source : public gr::sync_block
+{
+public:
+    ~mmap_file_source();
+
+    /*!
+     * \brief Moves the reading position to \a item, counted from the start
+     * of the file. Returns false if it is beyond the end of the file.
+     */
+    bool seek(uint64_t item);
+
+    //! Number of items in the file
+    uint64_t items() const;
+
+    int work(int noutput_items,
+        gr_vector_const_void_star &input_items,
+        gr_vector_void_star &output_items);
+
+private:
+    friend mmap_file_source_sptr make_mmap_file_source(size_t item_size, const std::string &filename, bool repeat);
+    mmap_file_source(size_t item_size, const std::string &filename, bool repeat);
+
+    void prefetch();
+
+    std::mutex d_mutex;
+    std::condition_variable d_cv;
+    std::thread d_prefetch_thread;
+    const uint8_t *d_data{nullptr};
+    size_t d_item_size;
+    size_t d_size{0};        // bytes of whole items in the file
+    size_t d_mapped_size{0};
+    size_t d_position{0};    // next byte to be read
+    size_t d_prefetched{0};  // end of the pages already loaded
+    size_t d_released{0};    // end of the pages already released
+    int d_fd{-1};
+    bool d_repeat;
+    bool d_stop{false};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_MMAP_FILE_SOURCE_H
@@ -18,21 +18,7 @@
 
 #include "unpack_2bit_samples.h"
 #include <gnuradio/io_signature.h>
-
-struct byte_2bit_struct
-{
-    signed sample_0 : 2;  // <- 2 bits wide only
-    signed sample_1 : 2;  // <- 2 bits wide only
-    signed sample_2 : 2;  // <- 2 bits wide only
-    signed sample_3 : 2;  // <- 2 bits wide only
-};
-
-
-union byte_and_samples
-{
-    int8_t byte;
-    byte_2bit_struct samples;
-};
+#include <volk_gnsssdr/volk_gnsssdr.h>
 
 
 bool systemIsBigEndian()
@@ -47,20 +33,7 @@ bool systemIsBigEndian()
 }
 
 
-bool systemBytesAreBigEndian()
-{
-    byte_and_samples b{};
-    b.byte = static_cast<int8_t>(0x01);
-    if (*reinterpret_cast<char *>(&b.byte) == 1)
-        {
-            return false;
-        }
-
-    return true;
-}
-
-
-void swapEndianness(int8_t const *in, std::vector<int8_t> &out, size_t item_size, unsigned int ninput_items)
+void swapEndianness(uint8_t const *in, std::vector<uint8_t> &out, size_t item_size, unsigned int ninput_items)
 {
     unsigned int i;
     unsigned int j = 0;
@@ -105,6 +78,7 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
       big_endian_bytes_(big_endian_bytes),
       big_endian_items_(big_endian_items),
       swap_endian_items_(false),
+      reorder_samples_(false),
       reverse_interleaving_(reverse_interleaving)
 {
     bool big_endian_system = systemIsBigEndian();
@@ -114,9 +88,24 @@ unpack_2bit_samples::unpack_2bit_samples(bool big_endian_bytes,
     swap_endian_items_ = (item_size_ > 1) &&
                          (big_endian_system != big_endian_items);
 
-    bool big_endian_bytes_system = systemBytesAreBigEndian();
-
-    swap_endian_bytes_ = (big_endian_bytes_system != big_endian_bytes_);
+    // The unpacking kernel outputs first the sample in the least significant
+    // bits of each byte. Other orders are obtained by moving the samples
+    // within the byte beforehand.
+    reorder_samples_ = big_endian_bytes_ || reverse_interleaving_;
+    for (unsigned int byte = 0; byte < 256; byte++)
+        {
+            unsigned int reordered = 0;
+            for (unsigned int k = 0; k < 4; k++)
+                {
+                    unsigned int field = big_endian_bytes_ ? 3 - k : k;
+                    if (reverse_interleaving_)
+                        {
+                            field ^= 1;
+                        }
+                    reordered |= ((byte >> (2 * field)) & 3) << (2 * k);
+                }
+            sample_order_[byte] = static_cast<uint8_t>(reordered);
+        }
 }
 
 
@@ -124,87 +113,33 @@ int unpack_2bit_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    auto const *in = reinterpret_cast<signed char const *>(input_items[0]);
+    const auto *in = reinterpret_cast<const uint8_t *>(input_items[0]);
     auto *out = reinterpret_cast<int8_t *>(output_items[0]);
 
-    size_t ninput_bytes = noutput_items / 4;
-    size_t ninput_items = ninput_bytes / item_size_;
+    const size_t ninput_bytes = noutput_items / 4;
+    const size_t ninput_items = ninput_bytes / item_size_;
 
     // Handle endian swap if needed
     if (swap_endian_items_)
         {
-            work_buffer_.reserve(ninput_bytes);
+            work_buffer_.resize(ninput_bytes);
             swapEndianness(in, work_buffer_, item_size_, ninput_items);
-
-            in = const_cast<signed char const *>(&work_buffer_[0]);
+            in = work_buffer_.data();
         }
 
     // Here the in pointer can be interpreted as a stream of bytes to be
-    // converted. But we now have two possibilities:
-    // 1) The samples in a byte are in big endian order
-    // 2) The samples in a byte are in little endian order
-
-    byte_and_samples raw_byte{};
-    int n = 0;
-
-    if (!reverse_interleaving_)
+    // converted, with the samples of each byte in the output order
+    if (reorder_samples_)
         {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                        }
-                }
-            else
+            work_buffer_.resize(ninput_bytes);
+            for (size_t i = 0; i < ninput_bytes; ++i)
                 {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                        }
+                    work_buffer_[i] = sample_order_[in[i]];
                 }
+            in = work_buffer_.data();
         }
-    else
-        {
-            if (swap_endian_bytes_)
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
-
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                        }
-                }
-            else
-                {
-                    for (size_t i = 0; i < ninput_bytes; ++i)
-                        {
-                            // Read packed input sample (1 byte = 4 samples)
-                            raw_byte.byte = in[i];
 
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_1 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_0 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_3 + 1);
-                            out[n++] = static_cast<int8_t>(2 * raw_byte.samples.sample_2 + 1);
-                        }
-                }
-        }
+    volk_gnsssdr_8u_unpack_2bit_8i(out, in, static_cast<unsigned int>(ninput_bytes * 4));
 
     return noutput_items;
 }
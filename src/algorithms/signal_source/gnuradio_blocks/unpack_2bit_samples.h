@@ -57,6 +57,7 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_interpolator.h>
+#include <array>
 #include <cstdint>
 #include <vector>
 
@@ -102,12 +103,13 @@ private:
         bool big_endian_items,
         bool reverse_interleaving);
 
-    std::vector<int8_t> work_buffer_;
+    std::vector<uint8_t> work_buffer_;
+    std::array<uint8_t, 256> sample_order_{};  // byte with its samples in the output order
     size_t item_size_;
     bool big_endian_bytes_;
     bool big_endian_items_;
     bool swap_endian_items_;
-    bool swap_endian_bytes_;
+    bool reorder_samples_;
     bool reverse_interleaving_;
 };
 
@@ -22,12 +22,7 @@
 #include "unpack_byte_2bit_cpx_samples.h"
 #include <gnuradio/io_signature.h>
 #include <cstdint>
-
-struct byte_2bit_struct
-{
-    signed two_bit_sample : 2;  // <- 2 bits wide only
-};
-
+#include <cstring>  // for memcpy
 
 unpack_byte_2bit_cpx_samples_sptr make_unpack_byte_2bit_cpx_samples()
 {
@@ -40,6 +35,18 @@ unpack_byte_2bit_cpx_samples::unpack_byte_2bit_cpx_samples() : sync_interpolator
                                                                    gr::io_signature::make(1, 1, sizeof(int16_t)),
                                                                    4)
 {
+    // Packing order: the most significant nibble holds sample n, and the
+    // least significant nibble holds sample n+1. Packing order in each
+    // nibble: Q1 Q0 I1 I0 (I/Q swap)
+    const std::array<int, 4> field_order = {2, 3, 0, 1};
+    for (int byte = 0; byte < 256; byte++)
+        {
+            for (int k = 0; k < 4; k++)
+                {
+                    const int field = (byte >> (2 * field_order[k])) & 3;
+                    samples_[byte][k] = static_cast<int16_t>(2 * (field < 2 ? field : field - 4) + 1);
+                }
+        }
 }
 
 
@@ -47,47 +54,13 @@ int unpack_byte_2bit_cpx_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    const auto *in = reinterpret_cast<const int8_t *>(input_items[0]);
+    const auto *in = reinterpret_cast<const uint8_t *>(input_items[0]);
     auto *out = reinterpret_cast<int16_t *>(output_items[0]);
 
-    byte_2bit_struct sample{};
-    int n = 0;
+    // Read packed input sample (1 byte = 2 complex samples)
     for (int i = 0; i < noutput_items / 4; i++)
         {
-            // Read packed input sample (1 byte = 2 complex samples)
-            // *     Packing Order
-            // *     Most Significant Nibble  - Sample n
-            // *     Least Significant Nibble - Sample n+1
-            // *     Packing order in Nibble Q1 Q0 I1 I0
-            // normal
-            //  int8_t c = in[i];
-            //  //Q[n]
-            //  sample.two_bit_sample = (c>>6) & 3;
-            //  out[n++] = (2*(int16_t)sample.two_bit_sample+1);
-            //  //I[n]
-            //  sample.two_bit_sample = (c>>4) & 3;
-            //  out[n++] = (2*(int16_t)sample.two_bit_sample+1);
-            //  //Q[n+1]
-            //  sample.two_bit_sample = (c>>2) & 3;
-            //  out[n++] = (2*(int16_t)sample.two_bit_sample+1);
-            //  //I[n+1]
-            //  sample.two_bit_sample = c & 3;
-            //  out[n++] = (2*(int16_t)sample.two_bit_sample+1);
-
-            // I/Q swap
-            int8_t c = in[i];
-            // I[n]
-            sample.two_bit_sample = (c >> 4) & 3;
-            out[n++] = (2 * static_cast<int16_t>(sample.two_bit_sample) + 1);
-            // Q[n]
-            sample.two_bit_sample = (c >> 6) & 3;
-            out[n++] = (2 * static_cast<int16_t>(sample.two_bit_sample) + 1);
-            // I[n+1]
-            sample.two_bit_sample = c & 3;
-            out[n++] = (2 * static_cast<int16_t>(sample.two_bit_sample) + 1);
-            // Q[n+1]
-            sample.two_bit_sample = (c >> 2) & 3;
-            out[n++] = (2 * static_cast<int16_t>(sample.two_bit_sample) + 1);
+            std::memcpy(&out[4 * i], samples_[in[i]].data(), sizeof(samples_[0]));
         }
     return noutput_items;
 }
@@ -24,6 +24,8 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_interpolator.h>
+#include <array>
+#include <cstdint>
 
 /** \addtogroup Signal_Source
  * \{ */
@@ -52,6 +54,7 @@ public:
 
 private:
     friend unpack_byte_2bit_cpx_samples_sptr make_unpack_byte_2bit_cpx_samples_sptr();
+    std::array<std::array<int16_t, 4>, 256> samples_{};  // unpacked I/Q samples of each byte value
 };
 
 
@@ -17,12 +17,7 @@
 
 #include "unpack_byte_2bit_samples.h"
 #include <gnuradio/io_signature.h>
-
-struct byte_2bit_struct
-{
-    signed two_bit_sample : 2;  // <- 2 bits wide only
-};
-
+#include <cstring>  // for memcpy
 
 unpack_byte_2bit_samples_sptr make_unpack_byte_2bit_samples()
 {
@@ -35,6 +30,15 @@ unpack_byte_2bit_samples::unpack_byte_2bit_samples() : sync_interpolator("unpack
                                                            gr::io_signature::make(1, 1, sizeof(float)),
                                                            4)
 {
+    // Samples of each byte, starting from the least significant bits
+    for (int byte = 0; byte < 256; byte++)
+        {
+            for (int k = 0; k < 4; k++)
+                {
+                    const int field = (byte >> (2 * k)) & 3;
+                    samples_[byte][k] = static_cast<float>(field < 2 ? field : field - 4);
+                }
+        }
 }
 
 
@@ -42,26 +46,13 @@ int unpack_byte_2bit_samples::work(int noutput_items,
     gr_vector_const_void_star &input_items,
     gr_vector_void_star &output_items)
 {
-    const auto *in = reinterpret_cast<const signed char *>(input_items[0]);
+    const auto *in = reinterpret_cast<const uint8_t *>(input_items[0]);
     auto *out = reinterpret_cast<float *>(output_items[0]);
 
-    byte_2bit_struct sample{};
-    int n = 0;
+    // Read packed input sample (1 byte = 4 samples)
     for (int i = 0; i < noutput_items / 4; i++)
         {
-            // Read packed input sample (1 byte = 4 samples)
-            signed char c = in[i];
-            sample.two_bit_sample = c & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-
-            sample.two_bit_sample = (c >> 2) & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-
-            sample.two_bit_sample = (c >> 4) & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
-
-            sample.two_bit_sample = (c >> 6) & 3;
-            out[n++] = static_cast<float>(sample.two_bit_sample);
+            std::memcpy(&out[4 * i], samples_[in[i]].data(), sizeof(samples_[0]));
         }
     return noutput_items;
 }
@@ -20,6 +20,7 @@
 
 #include "gnss_block_interface.h"
 #include <gnuradio/sync_interpolator.h>
+#include <array>
 
 
 /** \addtogroup Signal_Source
@@ -48,6 +49,7 @@ public:
 
 private:
     friend unpack_byte_2bit_samples_sptr make_unpack_byte_2bit_samples_sptr();
+    std::array<std::array<float, 4>, 256> samples_{};  // unpacked samples of each byte value
 };
 
 
@@ -17,6 +17,7 @@
 
 #include "unpack_intspir_1bit_samples.h"
 #include <gnuradio/io_signature.h>
+#include <array>
 
 
 unpack_intspir_1bit_samples_sptr make_unpack_intspir_1bit_samples()
@@ -40,29 +41,17 @@ int unpack_intspir_1bit_samples::work(int noutput_items,
     const auto *in = reinterpret_cast<const signed int *>(input_items[0]);
     auto *out = reinterpret_cast<float *>(output_items[0]);
 
-    int n = 0;
-    int channel = 1;
+    // Read packed input sample (1 int = 1 complex sample, channel 1 in the two least significant bits)
+    // For historical reasons, values are float versions of short int limits (32767)
+    const std::array<std::array<float, 2>, 4> samples = {{{-32767.0F, -32767.0F},
+        {32767.0F, -32767.0F},
+        {-32767.0F, 32767.0F},
+        {32767.0F, 32767.0F}}};
     for (int i = 0; i < noutput_items / 2; i++)
         {
-            // Read packed input sample (1 byte = 1 complex sample)
-            // For historical reasons, values are float versions of short int limits (32767)
-            signed int val = in[i];
-            if (((val >> ((channel - 1) * 2)) & 1) == 1)
-                {
-                    out[n++] = static_cast<float>(32767.0);
-                }
-            else
-                {
-                    out[n++] = static_cast<float>(-32767.0);
-                }
-            if (((val >> (2 * channel - 1)) & 1) == 1)
-                {
-                    out[n++] = static_cast<float>(32767.0);
-                }
-            else
-                {
-                    out[n++] = static_cast<float>(-32767.0);
-                }
+            const auto &sample = samples[in[i] & 3];
+            out[2 * i] = sample[0];
+            out[2 * i + 1] = sample[1];
         }
     return noutput_items;
 }
@@ -131,15 +131,8 @@ beidou_b1i_telemetry_decoder_gs::~beidou_b1i_telemetry_decoder_gs()
     size_t pos = 0;
     if (d_dump_file.is_open() == true)
         {
-            pos = d_dump_file.tellp();
-            try
-                {
-                    d_dump_file.close();
-                }
-            catch (const std::exception &ex)
-                {
-                    LOG(WARNING) << "Exception in destructor closing the dump file " << ex.what();
-                }
+            pos = d_dump_file.bytes_written();
+            d_dump_file.close();
             if (pos == 0)
                 {
                     if (!tlm_remove_file(d_dump_filename))
@@ -162,6 +155,15 @@ beidou_b1i_telemetry_decoder_gs::~beidou_b1i_telemetry_decoder_gs()
 }
 
 
+bool beidou_b1i_telemetry_decoder_gs::stop()
+{
+    // Called by GNU Radio when the flowgraph stops, so that the dump file
+    // is complete before this block is destroyed.
+    d_dump_file.flush();
+    return true;
+}
+
+
 void beidou_b1i_telemetry_decoder_gs::decode_bch15_11_01(const int32_t *bits, std::array<int32_t, 15> &decbits)
 {
     int32_t bit;
@@ -401,17 +403,15 @@ void beidou_b1i_telemetry_decoder_gs::set_channel(int32_t channel)
         {
             if (d_dump_file.is_open() == false)
                 {
-                    try
+                    d_dump_filename.append(std::to_string(d_channel));
+                    d_dump_filename.append(".dat");
+                    if (d_dump_file.open(d_dump_filename))
                         {
-                            d_dump_filename.append(std::to_string(d_channel));
-                            d_dump_filename.append(".dat");
-                            d_dump_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-                            d_dump_file.open(d_dump_filename.c_str(), std::ios::out | std::ios::binary);
                             LOG(INFO) << "Telemetry decoder dump enabled on channel " << d_channel << " Log file: " << d_dump_filename.c_str();
                         }
-                    catch (const std::ifstream::failure &e)
+                    else
                         {
-                            LOG(WARNING) << "channel " << d_channel << ": exception opening Beidou TLM dump file. " << e.what();
+                            LOG(WARNING) << "channel " << d_channel << ": error opening Beidou TLM dump file. " << d_dump_filename;
                         }
                 }
         }
@@ -650,26 +650,13 @@ int beidou_b1i_telemetry_decoder_gs::general_work(int noutput_items __attribute_
             if (d_dump == true)
                 {
                     // MULTIPLEXED FILE RECORDING - Record results to file
-                    try
-                        {
-                            double tmp_double;
-                            uint64_t tmp_ulong_int;
-                            int32_t tmp_int;
-                            tmp_double = static_cast<double>(d_TOW_at_current_symbol_ms) / 1000.0;
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                            tmp_ulong_int = current_symbol.Tracking_sample_counter;
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_ulong_int), sizeof(uint64_t));
-                            tmp_double = static_cast<double>(d_TOW_at_Preamble_ms) / 1000.0;
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                            tmp_int = (current_symbol.Prompt_I > 0.0 ? 1 : -1);
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_int), sizeof(int32_t));
-                            tmp_int = static_cast<int32_t>(current_symbol.PRN);
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_int), sizeof(int32_t));
-                        }
-                    catch (const std::ifstream::failure &e)
-                        {
-                            LOG(WARNING) << "Exception writing Telemetry GPS L5 dump file " << e.what();
-                        }
+                    Tlm_Dump_Record record{};
+                    record.TOW_at_current_symbol_s = static_cast<double>(d_TOW_at_current_symbol_ms) / 1000.0;
+                    record.Tracking_sample_counter = current_symbol.Tracking_sample_counter;
+                    record.TOW_at_Preamble_s = static_cast<double>(d_TOW_at_Preamble_ms) / 1000.0;
+                    record.nav_symbol = (current_symbol.Prompt_I > 0.0 ? 1 : -1);
+                    record.PRN = static_cast<int32_t>(current_symbol.PRN);
+                    d_dump_file.write(record);
                 }
 
             // 3. Make the output (copy the object contents to the GNURadio reserved memory)
@@ -22,6 +22,7 @@
 
 #include "beidou_dnav_navigation_message.h"
 #include "gnss_block_interface.h"
+#include "gnss_dump_writer.h"
 #include "gnss_satellite.h"
 #include "nav_message_packet.h"
 #include "tlm_conf.h"
@@ -31,7 +32,6 @@
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>
 #include <cstdint>
-#include <fstream>
 #include <memory>  // for std::unique_ptr
 #include <string>
 
@@ -58,6 +58,7 @@ class beidou_b1i_telemetry_decoder_gs : public gr::block
 {
 public:
     ~beidou_b1i_telemetry_decoder_gs();                   //!< Class destructor
+    bool stop();                                          //!< Writes the pending dump records
     void set_satellite(const Gnss_Satellite &satellite);  //!< Set satellite PRN
     void set_channel(int channel);                        //!< Set receiver's channel
     void reset();
@@ -96,7 +97,7 @@ private:
     // Satellite Information and logging capacity
     Gnss_Satellite d_satellite;
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Dump_Writer d_dump_file;
 
     uint64_t d_sample_counter;  // Sample counter as an index (1,2,3,..etc) indicating number of samples processed
     uint64_t d_preamble_index;  // Index of sample number where preamble was found
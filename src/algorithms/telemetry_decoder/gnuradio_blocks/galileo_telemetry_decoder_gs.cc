@@ -22,7 +22,6 @@
 #include "Galileo_E5a.h"  // for GALILEO_E5A_CODE_PERIOD_MS
 #include "Galileo_E5b.h"  // for GALILEO_E5B_CODE_PERIOD_MS
 #include "Galileo_E6.h"   // for GALILEO_E6_CODE_PERIOD_MS
-#include "convolutional.h"
 #include "display.h"
 #include "galileo_almanac_helper.h"  // for Galileo_Almanac_Helper
 #include "galileo_ephemeris.h"       // for Galileo_Ephemeris
@@ -33,6 +32,7 @@
 #include "gnss_synchro.h"
 #include "tlm_crc_stats.h"
 #include "tlm_utils.h"
+#include "viterbi_k7_r2_decoder.h"
 #include <glog/logging.h>
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
@@ -226,20 +226,12 @@ galileo_telemetry_decoder_gs::galileo_telemetry_decoder_gs(
     d_cnav_dummy_page = false;
     d_print_cnav_page = true;
 
-    // vars for Viterbi decoder
-    const int32_t max_states = 1U << static_cast<uint32_t>(d_mm);  // 2^d_mm
-    std::array<int32_t, 2> g_encoder{{121, 91}};                   // Polynomial G1 and G2
-    d_out0.reserve(max_states);
-    d_out1.reserve(max_states);
-    d_state0.reserve(max_states);
-    d_state1.reserve(max_states);
+    // Viterbi decoder for the pages, G1 = 171 and G2 = 133 (octal)
+    const std::array<int32_t, 2> g_encoder{{121, 91}};
+    d_viterbi = std::make_unique<Viterbi_K7_R2_Decoder>(g_encoder, d_datalength);
 
     d_inav_nav.init_PRN(d_satellite.get_PRN());
     d_first_eph_sent = false;
-
-    // create appropriate transition matrices
-    nsc_transit(d_out0.data(), d_state0.data(), 0, g_encoder.data(), d_KK, d_nn);
-    nsc_transit(d_out1.data(), d_state1.data(), 1, g_encoder.data(), d_KK, d_nn);
 }
 
 
@@ -249,15 +241,8 @@ galileo_telemetry_decoder_gs::~galileo_telemetry_decoder_gs()
     size_t pos = 0;
     if (d_dump_file.is_open() == true)
         {
-            pos = d_dump_file.tellp();
-            try
-                {
-                    d_dump_file.close();
-                }
-            catch (const std::exception &ex)
-                {
-                    LOG(WARNING) << "Exception in destructor closing the dump file " << ex.what();
-                }
+            pos = d_dump_file.bytes_written();
+            d_dump_file.close();
             if (pos == 0)
                 {
                     if (!tlm_remove_file(d_dump_filename))
@@ -280,10 +265,18 @@ galileo_telemetry_decoder_gs::~galileo_telemetry_decoder_gs()
 }
 
 
+bool galileo_telemetry_decoder_gs::stop()
+{
+    // Called by GNU Radio when the flowgraph stops, so that the dump file
+    // is complete before this block is destroyed.
+    d_dump_file.flush();
+    return true;
+}
+
+
 void galileo_telemetry_decoder_gs::viterbi_decoder(float *page_part_symbols, int32_t *page_part_bits)
 {
-    Viterbi(page_part_bits, d_out0.data(), d_state0.data(), d_out1.data(), d_state1.data(),
-        page_part_symbols, d_KK, d_nn, d_datalength);
+    d_viterbi->decode(page_part_symbols, page_part_bits, d_datalength);
 }
 
 
@@ -630,17 +623,15 @@ void galileo_telemetry_decoder_gs::set_channel(int32_t channel)
         {
             if (d_dump_file.is_open() == false)
                 {
-                    try
+                    d_dump_filename.append(std::to_string(d_channel));
+                    d_dump_filename.append(".dat");
+                    if (d_dump_file.open(d_dump_filename))
                         {
-                            d_dump_filename.append(std::to_string(d_channel));
-                            d_dump_filename.append(".dat");
-                            d_dump_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-                            d_dump_file.open(d_dump_filename.c_str(), std::ios::out | std::ios::binary);
                             LOG(INFO) << "Telemetry decoder dump enabled on channel " << d_channel << " Log file: " << d_dump_filename.c_str();
                         }
-                    catch (const std::ifstream::failure &e)
+                    else
                         {
-                            LOG(WARNING) << "channel " << d_channel << " Exception opening trk dump file " << e.what();
+                            LOG(WARNING) << "channel " << d_channel << " Error opening trk dump file " << d_dump_filename;
                         }
                 }
         }
@@ -1045,40 +1036,27 @@ int galileo_telemetry_decoder_gs::general_work(int noutput_items __attribute__((
             if (d_dump == true)
                 {
                     // MULTIPLEXED FILE RECORDING - Record results to file
-                    try
-                        {
-                            double tmp_double;
-                            uint64_t tmp_ulong_int;
-                            int32_t tmp_int;
-                            tmp_double = static_cast<double>(d_TOW_at_current_symbol_ms) / 1000.0;
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                            tmp_ulong_int = current_symbol.Tracking_sample_counter;
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_ulong_int), sizeof(uint64_t));
-                            tmp_double = static_cast<double>(d_TOW_at_Preamble_ms) / 1000.0;
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                            switch (d_frame_type)
-                                {
-                                case 1:
-                                    tmp_int = (current_symbol.Prompt_I > 0.0 ? 1 : -1);
-                                    break;
-                                case 2:
-                                    tmp_int = (current_symbol.Prompt_Q > 0.0 ? 1 : -1);
-                                    break;
-                                case 3:
-                                    tmp_int = (current_symbol.Prompt_I > 0.0 ? 1 : -1);
-                                    break;
-                                default:
-                                    tmp_int = 0;
-                                    break;
-                                }
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_int), sizeof(int32_t));
-                            tmp_int = static_cast<int32_t>(current_symbol.PRN);
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_int), sizeof(int32_t));
-                        }
-                    catch (const std::ifstream::failure &e)
+                    Tlm_Dump_Record record{};
+                    record.TOW_at_current_symbol_s = static_cast<double>(d_TOW_at_current_symbol_ms) / 1000.0;
+                    record.Tracking_sample_counter = current_symbol.Tracking_sample_counter;
+                    record.TOW_at_Preamble_s = static_cast<double>(d_TOW_at_Preamble_ms) / 1000.0;
+                    switch (d_frame_type)
                         {
-                            LOG(WARNING) << "Exception writing navigation data dump file " << e.what();
+                        case 1:
+                            record.nav_symbol = (current_symbol.Prompt_I > 0.0 ? 1 : -1);
+                            break;
+                        case 2:
+                            record.nav_symbol = (current_symbol.Prompt_Q > 0.0 ? 1 : -1);
+                            break;
+                        case 3:
+                            record.nav_symbol = (current_symbol.Prompt_I > 0.0 ? 1 : -1);
+                            break;
+                        default:
+                            record.nav_symbol = 0;
+                            break;
                         }
+                    record.PRN = static_cast<int32_t>(current_symbol.PRN);
+                    d_dump_file.write(record);
                 }
             // 3. Make the output (copy the object contents to the GNURadio reserved memory)
             *out[0] = current_symbol;
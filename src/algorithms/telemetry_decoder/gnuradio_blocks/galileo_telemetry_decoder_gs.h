@@ -24,15 +24,16 @@
 #include "galileo_fnav_message.h"
 #include "galileo_inav_message.h"
 #include "gnss_block_interface.h"
+#include "gnss_dump_writer.h"
 #include "gnss_satellite.h"
 #include "nav_message_packet.h"
 #include "tlm_conf.h"
 #include "tlm_crc_stats.h"
+#include "viterbi_k7_r2_decoder.h"
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <cstdint>
-#include <fstream>
 #include <memory>  // for std::unique_ptr
 #include <string>
 #include <vector>
@@ -59,6 +60,7 @@ class galileo_telemetry_decoder_gs : public gr::block
 {
 public:
     ~galileo_telemetry_decoder_gs();
+    bool stop();  //!< Writes the pending dump records
     void set_satellite(const Gnss_Satellite &satellite);  //!< Set satellite PRN
     void set_channel(int32_t channel);                    //!< Set receiver's channel
     void reset();
@@ -91,13 +93,10 @@ private:
     // vars for Viterbi decoder
     std::vector<int32_t> d_preamble_samples;
     std::vector<float> d_page_part_symbols;
-    std::vector<int32_t> d_out0;
-    std::vector<int32_t> d_out1;
-    std::vector<int32_t> d_state0;
-    std::vector<int32_t> d_state1;
+    std::unique_ptr<Viterbi_K7_R2_Decoder> d_viterbi;
 
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Dump_Writer d_dump_file;
 
     boost::circular_buffer<float> d_symbol_history;
 
@@ -22,6 +22,7 @@
 #include "GLONASS_L1_L2_CA.h"
 #include "glonass_gnav_navigation_message.h"
 #include "gnss_block_interface.h"
+#include "gnss_dump_writer.h"
 #include "gnss_satellite.h"
 #include "gnss_synchro.h"
 #include "nav_message_packet.h"
@@ -32,7 +33,6 @@
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>
 #include <cstdint>
-#include <fstream>  // for ofstream
 #include <memory>   // for std::unique_ptr
 #include <string>
 
@@ -60,6 +60,7 @@ class glonass_l1_ca_telemetry_decoder_gs : public gr::block
 {
 public:
     ~glonass_l1_ca_telemetry_decoder_gs();                //!< Class destructor
+    bool stop();                                          //!< Writes the pending dump records
     void set_satellite(const Gnss_Satellite &satellite);  //!< Set satellite PRN
     void set_channel(int32_t channel);                    //!< Set receiver's channel
     inline void reset()
@@ -102,7 +103,7 @@ private:
     std::unique_ptr<Tlm_CRC_Stats> d_Tlm_CRC_Stats;
 
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Dump_Writer d_dump_file;
 
     double d_preamble_time_samples;
     double d_TOW_at_current_symbol;
@@ -19,6 +19,7 @@
 
 #include "GPS_L1_CA.h"
 #include "gnss_block_interface.h"
+#include "gnss_dump_writer.h"
 #include "gnss_satellite.h"
 #include "gnss_synchro.h"
 #include "gps_navigation_message.h"
@@ -30,7 +31,6 @@
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <array>             // for array
 #include <cstdint>           // for int32_t
-#include <fstream>           // for ofstream
 #include <memory>            // for std::unique_ptr
 #include <string>            // for string
 
@@ -56,6 +56,7 @@ class gps_l1_ca_telemetry_decoder_gs : public gr::block
 {
 public:
     ~gps_l1_ca_telemetry_decoder_gs();
+    bool stop();  //!< Writes the pending dump records
     void set_satellite(const Gnss_Satellite &satellite);  //!< Set satellite PRN
     void set_channel(int channel);                        //!< Set receiver's channel
     void reset();
@@ -84,7 +85,7 @@ private:
     std::array<int32_t, GPS_CA_PREAMBLE_LENGTH_BITS> d_preamble_samples{};
 
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Dump_Writer d_dump_file;
 
     boost::circular_buffer<float> d_symbol_history;
 
@@ -19,6 +19,7 @@
 
 
 #include "gnss_block_interface.h"
+#include "gnss_dump_writer.h"
 #include "gnss_satellite.h"
 #include "gps_cnav_navigation_message.h"
 #include "nav_message_packet.h"
@@ -27,7 +28,6 @@
 #include <gnuradio/block.h>
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <cstdint>
-#include <fstream>
 #include <memory>  // for std::unique_ptr
 #include <string>
 
@@ -57,6 +57,7 @@ class gps_l2c_telemetry_decoder_gs : public gr::block
 {
 public:
     ~gps_l2c_telemetry_decoder_gs();
+    bool stop();  //!< Writes the pending dump records
     void set_satellite(const Gnss_Satellite &satellite);  //!< Set satellite PRN
     void set_channel(int32_t channel);                    //!< Set receiver's channel
     void reset();
@@ -84,7 +85,7 @@ private:
     std::unique_ptr<Tlm_CRC_Stats> d_Tlm_CRC_Stats;
 
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Dump_Writer d_dump_file;
 
     double d_TOW_at_current_symbol;
     double d_TOW_at_Preamble;
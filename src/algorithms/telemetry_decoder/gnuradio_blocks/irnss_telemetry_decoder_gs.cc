@@ -19,7 +19,6 @@
 
 #include "irnss_telemetry_decoder_gs.h"
 #include "IRNSS_at_1.h"   // for GALILEO_E1_CODE_PERIOD_MS // for GALILEO_E6_CODE_PERIOD_MS
-#include "convolutional.h"
 #include "display.h"
 // #include "galileo_almanac_helper.h"  // for Galileo_Almanac_Helper
 #include "irnss_ephemeris.h"       // for irnss_Ephemeris
@@ -31,7 +30,6 @@
 #include <gnuradio/io_signature.h>
 #include <pmt/pmt.h>        // for make_any
 #include <pmt/pmt_sugar.h>  // for mp
-#include <array>
 #include <cmath>      // for fmod
 #include <cstddef>    // for size_t
 #include <cstdlib>    // for abs
@@ -83,13 +81,12 @@ irnss_telemetry_decoder_gs::irnss_telemetry_decoder_gs(
     // preamble bits to sampled symbols
     d_preamble_samples.reserve(d_samples_per_preamble);
     d_frame_length_symbols = IRNSS_L5_SUBFRAME_BITS - IRNSS_L5_PREAMBLE_LENGTH_BITS;
-    d_codelength = static_cast<int32_t>(d_frame_length_symbols);
-    d_datalength = (d_codelength / d_nn) - d_mm;
     d_max_symbols_without_valid_frame = IRNSS_L5_SUBFRAME_BITS * 20;  // rise alarm 60 seconds without valid tlm
 
                
 
-    d_page_part_symbols.reserve(d_frame_length_symbols);
+    d_preamble_samples.resize(d_samples_per_preamble);
+    d_page_part_symbols.resize(d_frame_length_symbols, 0.0);
     for (int32_t i = 0; i < d_bits_per_preamble; i++)
         {
             
@@ -122,18 +119,6 @@ irnss_telemetry_decoder_gs::irnss_telemetry_decoder_gs(
     d_channel = 0;
     d_flag_PLL_180_deg_phase_locked = false;
     d_symbol_history.set_capacity(d_required_symbols + 1);
-
-    // vars for Viterbi decoder
-    const int32_t max_states = 1U << static_cast<uint32_t>(d_mm);  // 2^d_mm
-    std::array<int32_t, 2> g_encoder{{121, 91}};                   // Polynomial G1 and G2
-    d_out0.reserve(max_states);
-    d_out1.reserve(max_states);
-    d_state0.reserve(max_states);
-    d_state1.reserve(max_states);
-
-    // create appropriate transition matrices
-    nsc_transit(d_out0.data(), d_state0.data(), 0, g_encoder.data(), d_KK, d_nn);
-    nsc_transit(d_out1.data(), d_state1.data(), 1, g_encoder.data(), d_KK, d_nn);
 }
 
 
@@ -143,15 +128,8 @@ irnss_telemetry_decoder_gs::~irnss_telemetry_decoder_gs()
     size_t pos = 0;
     if (d_dump_file.is_open() == true)
         {
-            pos = d_dump_file.tellp();
-            try
-                {
-                    d_dump_file.close();
-                }
-            catch (const std::exception &ex)
-                {
-                    LOG(WARNING) << "Exception in destructor closing the dump file " << ex.what();
-                }
+            pos = d_dump_file.bytes_written();
+            d_dump_file.close();
             if (pos == 0)
                 {
                     if (!tlm_remove_file(d_dump_filename))
@@ -174,66 +152,41 @@ irnss_telemetry_decoder_gs::~irnss_telemetry_decoder_gs()
 }
 
 
-void irnss_telemetry_decoder_gs::viterbi_decoder(float *page_part_symbols, int32_t *page_part_bits)
+bool irnss_telemetry_decoder_gs::stop()
 {
-    Viterbi(page_part_bits, d_out0.data(), d_state0.data(), d_out1.data(), d_state1.data(),
-        page_part_symbols, d_KK, d_nn, d_datalength);
+    // Called by GNU Radio when the flowgraph stops, so that the dump file
+    // is complete before this block is destroyed.
+    d_dump_file.flush();
+    return true;
 }
 
 
-void irnss_telemetry_decoder_gs::deinterleaver(int32_t rows, int32_t cols, const float *in, float *out)
+void irnss_telemetry_decoder_gs::fetch_page_symbols()
 {
-    for (int32_t r = 0; r < rows; r++)
+    if (d_symbol_history.size() < d_frame_length_symbols + static_cast<uint32_t>(d_samples_per_preamble))
         {
-            for (int32_t c = 0; c < cols; c++)
-                {
-                    out[c * rows + r] = in[r * cols + c];
-                }
+            return;
         }
-}
-
-
-bool irnss_telemetry_decoder_gs::decode_subframe(float *page_symbols, int32_t frame_length)
-{
-    // 1. De-interleave
-    std::vector<float> page_symbols_deint(frame_length);
-    deinterleaver(IRNSS_NAV_INTERLEAVER_ROWS, IRNSS_NAV_INTERLEAVER_COLS, page_symbols, page_symbols_deint.data());
-
-    // 2. Viterbi decoder
-    // 2.1 Take into account the NOT gate in G2 polynomial (Galileo ICD Figure 13, FEC encoder)
-    // 2.2 Take into account the possible inversion of the polarity due to PLL lock at 180 degrees
-    for (int32_t i = 0; i < frame_length; i++)
+    // 0. fetch the symbols into an array, correcting the polarity of a PLL locked at 180 degrees
+    const float polarity = d_flag_PLL_180_deg_phase_locked ? -1.0 : 1.0;
+    for (uint32_t i = 0; i < d_frame_length_symbols; i++)
         {
-            if ((i + 1) % 2 == 0)
-                {
-                    page_symbols_deint[i] = -page_symbols_deint[i];
-                }
+            d_page_part_symbols[i] = polarity * d_symbol_history[i + d_samples_per_preamble];
         }
+}
 
-    const int32_t decoded_length = frame_length / 2;
-    std::vector<int32_t> page_bits(decoded_length);
-    viterbi_decoder(page_symbols_deint.data(), page_bits.data());
 
-    // 3. Call the Galileo page decoder
-    std::string page_String;
-    page_String.reserve(decoded_length);
-    for (int32_t i = 0; i < decoded_length; i++)
+bool irnss_telemetry_decoder_gs::decode_subframe(const float *page_symbols)
+{
+    // 1. De-interleave and Viterbi decoder
+    // 2. DECODE COMPLETE WORD (even + odd) and TEST CRC
+    const int32_t subframe_ID = d_nav.subframe_decoder(d_subframe_decoder.decode(page_symbols));
+    if (!d_nav.get_flag_CRC_test())
         {
-            if (page_bits[i] > 0)
-                {
-                    page_String.push_back('1');
-                }
-            else
-                {
-                    page_String.push_back('0');
-                }
+            DLOG(INFO) << "IRNSS L5 CRC error in channel " << d_channel << " from satellite " << d_satellite;
         }
 
-    // DECODE COMPLETE WORD (even + odd) and TEST CRC
-    const int32_t subframe_ID = d_nav.subframe_decoder(page_String);
-    
-
-    // 4. Push the new navigation data to the queues
+    // 3. Push the new navigation data to the queues
     // if (subframe_synchro_confirmation)
     //     {
             // const int32_t subframe_ID = d_nav.subframe_decoder(subframe.data());  // decode the subframe
@@ -346,17 +299,15 @@ void irnss_telemetry_decoder_gs::set_channel(int32_t channel)
         {
             if (d_dump_file.is_open() == false)
                 {
-                    try
+                    d_dump_filename.append(std::to_string(d_channel));
+                    d_dump_filename.append(".dat");
+                    if (d_dump_file.open(d_dump_filename))
                         {
-                            d_dump_filename.append(std::to_string(d_channel));
-                            d_dump_filename.append(".dat");
-                            d_dump_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-                            d_dump_file.open(d_dump_filename.c_str(), std::ios::out | std::ios::binary);
                             LOG(INFO) << "Telemetry decoder dump enabled on channel " << d_channel << " Log file: " << d_dump_filename.c_str();
                         }
-                    catch (const std::ifstream::failure &e)
+                    else
                         {
-                            LOG(WARNING) << "channel " << d_channel << " Exception opening trk dump file " << e.what();
+                            LOG(WARNING) << "channel " << d_channel << " Error opening trk dump file " << d_dump_filename;
                         }
                 }
         }
@@ -415,7 +366,8 @@ int irnss_telemetry_decoder_gs::general_work(int noutput_items __attribute__((un
                             {
                                 d_preamble_index = d_sample_counter;  // record the preamble sample stamp
                                 DLOG(INFO) << "Preamble detection for IRNSS satellite " << this->d_satellite;
-                                decode_subframe(d_page_part_symbols.data(), d_frame_length_symbols);
+                                fetch_page_symbols();
+                                decode_subframe(d_page_part_symbols.data());
                                 d_stat = 1;  // enter into frame pre-detection status
                             }
                     
@@ -458,7 +410,8 @@ int irnss_telemetry_decoder_gs::general_work(int noutput_items __attribute__((un
                                             {
                                                 d_flag_PLL_180_deg_phase_locked = false;
                                             }
-                                        decode_subframe(d_page_part_symbols.data(), d_frame_length_symbols);
+                                        fetch_page_symbols();
+                                        decode_subframe(d_page_part_symbols.data());
                                         
                                         d_stat = 2;
                                     }
@@ -480,10 +433,9 @@ int irnss_telemetry_decoder_gs::general_work(int noutput_items __attribute__((un
                     {
                         DLOG(INFO) << "Preamble received for SAT " << this->d_satellite << "d_sample_counter=" << d_sample_counter << "\n";
                         // call the decoder
-                        // 0. fetch the symbols into an array
                         d_preamble_index = d_sample_counter;  // record the preamble sample stamp (t_P)
-
-                        if (decode_subframe(d_page_part_symbols.data(), d_frame_length_symbols))
+                        fetch_page_symbols();
+                        if (decode_subframe(d_page_part_symbols.data()))
                             {
                                 d_CRC_error_counter = 0;
                                 d_flag_preamble = true;  // valid preamble indicator (initialized to false every work())
@@ -552,26 +504,13 @@ int irnss_telemetry_decoder_gs::general_work(int noutput_items __attribute__((un
             if (d_dump == true)
                 {
                     // MULTIPLEXED FILE RECORDING - Record results to file
-                    try
-                        {
-                            double tmp_double;
-                            uint64_t tmp_ulong_int;
-                            int32_t tmp_int;
-                            tmp_double = static_cast<double>(d_TOW_at_current_symbol_ms) / 1000.0;
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                            tmp_ulong_int = current_symbol.Tracking_sample_counter;
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_ulong_int), sizeof(uint64_t));
-                            tmp_double = static_cast<double>(d_TOW_at_Preamble_ms) / 1000.0;
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                            tmp_int = (current_symbol.Prompt_I > 0.0 ? 1 : -1);
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_int), sizeof(int32_t));
-                            tmp_int = static_cast<int32_t>(current_symbol.PRN);
-                            d_dump_file.write(reinterpret_cast<char *>(&tmp_int), sizeof(int32_t));
-                        }
-                    catch (const std::ifstream::failure &e)
-                        {
-                            LOG(WARNING) << "Exception writing observables dump file " << e.what();
-                        }
+                    Tlm_Dump_Record record{};
+                    record.TOW_at_current_symbol_s = static_cast<double>(d_TOW_at_current_symbol_ms) / 1000.0;
+                    record.Tracking_sample_counter = current_symbol.Tracking_sample_counter;
+                    record.TOW_at_Preamble_s = static_cast<double>(d_TOW_at_Preamble_ms) / 1000.0;
+                    record.nav_symbol = (current_symbol.Prompt_I > 0.0 ? 1 : -1);
+                    record.PRN = static_cast<int32_t>(current_symbol.PRN);
+                    d_dump_file.write(record);
                 }
 
             // 3. Make the output (copy the object contents to the GNU Radio reserved memory)
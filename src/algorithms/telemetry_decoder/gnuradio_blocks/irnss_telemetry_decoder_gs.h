@@ -24,13 +24,14 @@
 #include "irnss_navigation_message.h"
 #include "gnss_synchro.h"
 #include "gnss_block_interface.h"
+#include "gnss_dump_writer.h"
 #include "gnss_satellite.h"
+#include "irnss_l5_subframe_decoder.h"
 #include "tlm_conf.h"
 #include <boost/circular_buffer.hpp>
 #include <gnuradio/block.h>  // for block
 #include <gnuradio/types.h>  // for gr_vector_const_void_star
 #include <cstdint>
-#include <fstream>
 #include <string>
 #include <vector>
 
@@ -55,6 +56,7 @@ class irnss_telemetry_decoder_gs : public gr::block
 {
 public:
     ~irnss_telemetry_decoder_gs();
+    bool stop();  //!< Writes the pending dump records
     void set_satellite(const Gnss_Satellite &satellite);  //!< Set satellite PRN
     void set_channel(int32_t channel);                    //!< Set receiver's channel
     void reset();
@@ -65,7 +67,6 @@ public:
     int general_work(int noutput_items, gr_vector_int &ninput_items,
         gr_vector_const_void_star &input_items, gr_vector_void_star &output_items);
 
-
 private:
     friend irnss_telemetry_decoder_gs_sptr irnss_make_telemetry_decoder_gs(
         const Gnss_Satellite &satellite,
@@ -73,26 +74,18 @@ private:
 
     irnss_telemetry_decoder_gs(const Gnss_Satellite &satellite, const Tlm_Conf &conf);
 
-    const int32_t d_nn = 2;  // Coding rate 1/n
-    const int32_t d_KK = 7;  // Constraint Length
-
-    void viterbi_decoder(float *page_part_symbols, int32_t *page_part_bits);
-    void deinterleaver(int32_t rows, int32_t cols, const float *in, float *out);
-    bool decode_subframe(float *page_symbols, int32_t frame_length);
+    void fetch_page_symbols();
+    bool decode_subframe(const float *page_symbols);
 
     Irnss_Navigation_Message d_nav;
     Gnss_Satellite d_satellite;
 
-    // vars for Viterbi decoder
     std::vector<int32_t> d_preamble_samples;
     std::vector<float> d_page_part_symbols;
-    std::vector<int32_t> d_out0;
-    std::vector<int32_t> d_out1;
-    std::vector<int32_t> d_state0;
-    std::vector<int32_t> d_state1;
+    Irnss_L5_Subframe_Decoder d_subframe_decoder;
 
     std::string d_dump_filename;
-    std::ofstream d_dump_file;
+    Gnss_Dump_Writer d_dump_file;
 
     boost::circular_buffer<float> d_symbol_history;
 
@@ -103,9 +96,6 @@ private:
     uint64_t d_preamble_index;
     uint64_t d_last_valid_preamble;
 
-    int32_t d_mm = d_KK - 1;
-    int32_t d_codelength;
-    int32_t d_datalength;
     int32_t d_bits_per_preamble;
     int32_t d_samples_per_preamble;
     int32_t d_preamble_period_symbols;
@@ -211,7 +211,7 @@ inline void Viterbi(int output_u_int[],
     /* go through trellis */
     for (t = 0; t < LL + mm; t++)
         {
-            rec_array.assign(input_c + nn * t, input_c + nn * t + (nn - 1));
+            rec_array.assign(input_c + nn * t, input_c + nn * t + nn);
 
             /* precompute all possible branch metrics */
             for (i = 0; i < number_symbols; i++)
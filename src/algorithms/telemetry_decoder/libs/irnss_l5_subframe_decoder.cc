@@ -0,0 +1,63 @@
+/*!
+ * \file irnss_l5_subframe_decoder.cc
+ * \brief De-interleaving and Viterbi decoding of the IRNSS L5 SPS subframes
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "irnss_l5_subframe_decoder.h"
+#include "nav_message_field.h"
+
+
+Irnss_L5_Subframe_Decoder::Irnss_L5_Subframe_Decoder() : d_viterbi({{121, 91}}, DATA_BITS),  // G1 = 171 and G2 = 133 (octal)
+                                                         d_deinterleaver_index(FRAME_SYMBOLS),
+                                                         d_deinterleaver_sign(FRAME_SYMBOLS),
+                                                         d_page_symbols_deint(FRAME_SYMBOLS, 0.0),
+                                                         d_page_bits(DATA_BITS, 0)
+{
+    // Position c * rows + r of the de-interleaved page takes the input symbol
+    // r * cols + c. The NOT gate in G2 is undone by flipping the sign of
+    // every second de-interleaved symbol.
+    for (int32_t r = 0; r < IRNSS_NAV_INTERLEAVER_ROWS; r++)
+        {
+            for (int32_t c = 0; c < IRNSS_NAV_INTERLEAVER_COLS; c++)
+                {
+                    const int32_t out_index = c * IRNSS_NAV_INTERLEAVER_ROWS + r;
+                    d_deinterleaver_index[out_index] = static_cast<uint32_t>(r * IRNSS_NAV_INTERLEAVER_COLS + c);
+                    d_deinterleaver_sign[out_index] = ((out_index + 1) % 2 == 0) ? -1.0 : 1.0;
+                }
+        }
+}
+
+
+const std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS>& Irnss_L5_Subframe_Decoder::decode(const float* page_symbols)
+{
+    // 1. De-interleave and take into account the NOT gate in G2
+    for (int32_t i = 0; i < FRAME_SYMBOLS; i++)
+        {
+            d_page_symbols_deint[i] = page_symbols[d_deinterleaver_index[i]] * d_deinterleaver_sign[i];
+        }
+
+    // 2. Viterbi decoder
+    d_viterbi.decode(d_page_symbols_deint.data(), d_page_bits.data(), DATA_BITS);
+
+    // 3. Pack the decoded bits, first transmitted bit in the MSB of the first word.
+    // The tail bits are zeros.
+    d_subframe_words.fill(0ULL);
+    for (int32_t i = 0; i < DATA_BITS; i++)
+        {
+            if (d_page_bits[i] > 0)
+                {
+                    set_nav_message_bit(d_subframe_words, static_cast<uint32_t>(i));
+                }
+        }
+    return d_subframe_words;
+}
@@ -0,0 +1,69 @@
+/*!
+ * \file irnss_l5_subframe_decoder.h
+ * \brief De-interleaving and Viterbi decoding of the IRNSS L5 SPS subframes
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_IRNSS_L5_SUBFRAME_DECODER_H
+#define GNSS_SDR_IRNSS_L5_SUBFRAME_DECODER_H
+
+#include "IRNSS_at_1.h"
+#include "viterbi_k7_r2_decoder.h"
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <array>
+#include <cstdint>
+#include <vector>
+
+/** \addtogroup Telemetry_Decoder
+ * \{ */
+/** \addtogroup Telemetry_Decoder_libs
+ * \{ */
+
+
+/*!
+ * \brief Turns the symbols of an IRNSS L5 SPS subframe into the packed bits
+ * read by Irnss_Navigation_Message::subframe_decoder().
+ *
+ * The symbols after the preamble are de-interleaved (8 rows by 73 columns),
+ * the NOT gate in G2 is undone and the K=7, rate 1/2 code is decoded with
+ * Viterbi_K7_R2_Decoder. All the buffers are allocated in the constructor.
+ */
+class Irnss_L5_Subframe_Decoder
+{
+public:
+    Irnss_L5_Subframe_Decoder();
+
+    /*!
+     * \brief Decodes the IRNSS_L5_SUBFRAME_BITS - IRNSS_L5_PREAMBLE_LENGTH_BITS
+     * soft symbols that follow the preamble, with the polarity already
+     * corrected (positive symbols are ones).
+     * \return The decoded bits, first transmitted bit in the MSB of the first
+     * word. The reference is valid until the next call.
+     */
+    const std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS>& decode(const float* page_symbols);
+
+private:
+    static constexpr int32_t FRAME_SYMBOLS = IRNSS_L5_SUBFRAME_BITS - IRNSS_L5_PREAMBLE_LENGTH_BITS;
+    static constexpr int32_t DATA_BITS = FRAME_SYMBOLS / 2 - 6;  // without the tail of the encoder
+
+    Viterbi_K7_R2_Decoder d_viterbi;
+    std::vector<uint32_t> d_deinterleaver_index;       // input symbol feeding each de-interleaved position
+    volk_gnsssdr::vector<float> d_deinterleaver_sign;  // NOT gate in G2, applied after de-interleaving
+    volk_gnsssdr::vector<float> d_page_symbols_deint;
+    std::vector<int32_t> d_page_bits;
+    std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS> d_subframe_words{};
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_IRNSS_L5_SUBFRAME_DECODER_H
@@ -22,6 +22,8 @@
 #ifndef GNSS_SDR_FEC_H
 #define GNSS_SDR_FEC_H
 
+#include <stdint.h>
+
 /* r=1/2 k=7 convolutional encoder polynomials
  * The NASA-DSN convention is to use V27POLYA inverted, then V27POLYB
  * The CCSDS/NASA-GSFC convention is to use V27POLYB, then V27POLYA inverted
@@ -44,10 +46,7 @@ typedef struct
  */
 typedef struct
 {
-    unsigned int metrics1[64]; /* Path metric buffer 1 */
-    unsigned int metrics2[64]; /* Path metric buffer 2 */
-    /* Pointers to path metrics, swapped on every bit */
-    unsigned int *old_metrics, *new_metrics;
+    int16_t metrics[64];          /* Path metrics, updated in place by the volk_gnsssdr kernel */
     const v27_poly_t *poly;       /* Polynomial to use */
     v27_decision_t *decisions;    /* Beginning of decisions for block */
     unsigned int decisions_index; /* Index of current decision */
@@ -20,6 +20,7 @@
 
 
 #include "fec.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
 #include <stdlib.h>
 
 static inline unsigned int parity(unsigned int x)
@@ -65,8 +66,6 @@ void v27_init(v27_t *v, v27_decision_t *decisions, unsigned int decisions_count,
 {
     int i;
 
-    v->old_metrics = v->metrics1;
-    v->new_metrics = v->metrics2;
     v->poly = poly;
     v->decisions = decisions;
     v->decisions_index = 0;
@@ -74,33 +73,13 @@ void v27_init(v27_t *v, v27_decision_t *decisions, unsigned int decisions_count,
 
     for (i = 0; i < 64; i++)
         {
-            v->old_metrics[i] = 63;
+            v->metrics[i] = 63;
         }
 
-    v->old_metrics[initial_state & 63] = 0; /* Bias known start state */
+    v->metrics[initial_state & 63] = 0; /* Bias known start state */
 }
 
 
-/* C-language butterfly */
-#define BFLY(i)                                                     \
-    {                                                               \
-        unsigned int metric;                                        \
-        unsigned int m0;                                            \
-        unsigned int m1;                                            \
-        unsigned int decision;                                      \
-        metric = (v->poly->c0[i] ^ sym0) + (v->poly->c1[i] ^ sym1); \
-        m0 = v->old_metrics[i] + metric;                            \
-        m1 = v->old_metrics[(i) + 32] + (510 - metric);             \
-        decision = (signed int)(m0 - m1) > 0;                       \
-        v->new_metrics[2 * (i)] = decision ? m1 : m0;               \
-        d->w[(i) / 16] |= decision << ((2U * (i)) & 31U);           \
-        m0 -= (metric + metric - 510);                              \
-        m1 += (metric + metric - 510);                              \
-        decision = (signed int)(m0 - m1) > 0;                       \
-        v->new_metrics[2 * (i) + 1] = decision ? m1 : m0;           \
-        d->w[(i) / 16] |= decision << ((2U * (i) + 1U) & 31U);      \
-    }
-
 /** Update a v27_t decoder with a block of symbols.
  *
  * \param v Structure to update.
@@ -110,81 +89,30 @@ void v27_init(v27_t *v, v27_decision_t *decisions, unsigned int decisions_count,
  */
 void v27_update(v27_t *v, const unsigned char *syms, int nbits)
 {
-    unsigned char sym0;
-    unsigned char sym1;
-    unsigned int *tmp;
-
-    while (nbits--)
+    /* The butterflies run in volk_gnsssdr_8u_conv_k7_r2_32u, which takes the
+     * polynomial tables and writes the decisions in the same layout as
+     * v27_poly_t and v27_decision_t. The decisions are a circular buffer, so
+     * the bits are processed in chunks that do not wrap around.
+     */
+    while (nbits > 0)
         {
-            v27_decision_t *d = &v->decisions[v->decisions_index];
-
-            d->w[0] = d->w[1] = 0;
-            sym0 = *syms++;
-            sym1 = *syms++;
-
-            BFLY(0U);
-            BFLY(1U);
-            BFLY(2U);
-            BFLY(3U);
-            BFLY(4U);
-            BFLY(5U);
-            BFLY(6U);
-            BFLY(7U);
-            BFLY(8U);
-            BFLY(9U);
-            BFLY(10U);
-            BFLY(11U);
-            BFLY(12U);
-            BFLY(13U);
-            BFLY(14U);
-            BFLY(15U);
-            BFLY(16U);
-            BFLY(17U);
-            BFLY(18U);
-            BFLY(19U);
-            BFLY(20U);
-            BFLY(21U);
-            BFLY(22U);
-            BFLY(23U);
-            BFLY(24U);
-            BFLY(25U);
-            BFLY(26U);
-            BFLY(27U);
-            BFLY(28U);
-            BFLY(29U);
-            BFLY(30U);
-            BFLY(31U);
-
-            /* Normalize metrics if they are nearing overflow */
-            if (v->new_metrics[0] > (1U << 30U))
+            unsigned int chunk = v->decisions_count - v->decisions_index;
+            if (chunk > (unsigned int)nbits)
                 {
-                    int i;
-                    unsigned int minmetric = 1U << 31U;
-
-                    for (i = 0; i < 64; i++)
-                        {
-                            if (v->new_metrics[i] < minmetric)
-                                {
-                                    minmetric = v->new_metrics[i];
-                                }
-                        }
-
-                    for (i = 0; i < 64; i++)
-                        {
-                            v->new_metrics[i] -= minmetric;
-                        }
+                    chunk = (unsigned int)nbits;
                 }
 
+            volk_gnsssdr_8u_conv_k7_r2_32u(v->decisions[v->decisions_index].w, v->metrics, syms, v->poly->c0, chunk);
+
+            syms += 2 * chunk;
+            nbits -= (int)chunk;
+
             /* Advance decision index */
-            if (++v->decisions_index >= v->decisions_count)
+            v->decisions_index += chunk;
+            if (v->decisions_index >= v->decisions_count)
                 {
                     v->decisions_index = 0;
                 }
-
-            /* Swap pointers to old and new metrics */
-            tmp = v->old_metrics;
-            v->old_metrics = v->new_metrics;
-            v->new_metrics = tmp;
         }
 }
 
@@ -234,13 +162,13 @@ void v27_chainback_likely(v27_t *v, unsigned char *data, unsigned int nbits)
     /* Determine state with minimum metric */
 
     int i;
-    unsigned int best_metric = 0xffffffff;
+    int16_t best_metric = INT16_MAX;
     unsigned char best_state = 0;
     for (i = 0; i < 64; i++)
         {
-            if (v->new_metrics[i] < best_metric)
+            if (v->metrics[i] < best_metric)
                 {
-                    best_metric = v->new_metrics[i];
+                    best_metric = v->metrics[i];
                     best_state = i;
                 }
         }
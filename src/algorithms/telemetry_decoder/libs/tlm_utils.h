@@ -17,6 +17,7 @@
 #ifndef GNSS_SDR_TLM_UTILS_H
 #define GNSS_SDR_TLM_UTILS_H
 
+#include <cstdint>
 #include <string>
 
 /** \addtogroup Telemetry_Decoder
@@ -24,6 +25,21 @@
 /** \addtogroup Telemetry_Decoder_libs
  * \{ */
 
+/*!
+ * \brief Contents of each record of the telemetry decoder dump files, as
+ * read by save_tlm_matfile()
+ */
+struct Tlm_Dump_Record
+{
+    double TOW_at_current_symbol_s;
+    uint64_t Tracking_sample_counter;
+    double TOW_at_Preamble_s;
+    int32_t nav_symbol;
+    int32_t PRN;
+};
+
+static_assert(sizeof(Tlm_Dump_Record) == 2 * sizeof(double) + sizeof(uint64_t) + 2 * sizeof(int32_t), "Unexpected padding in Tlm_Dump_Record");
+
 int save_tlm_matfile(const std::string &dumpfile);
 
 bool tlm_remove_file(const std::string &file_to_remove);
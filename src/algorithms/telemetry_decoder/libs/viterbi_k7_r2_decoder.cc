@@ -0,0 +1,94 @@
+/*!
+ * \file viterbi_k7_r2_decoder.cc
+ * \brief Soft-decision Viterbi decoder for the K=7, rate 1/2 convolutional
+ * code used by the IRNSS, Galileo and GPS CNAV navigation messages.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "viterbi_k7_r2_decoder.h"
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <cmath>
+
+
+namespace
+{
+uint32_t parity(uint32_t x)
+{
+    x ^= x >> 4U;
+    x ^= x >> 2U;
+    x ^= x >> 1U;
+    return x & 1U;
+}
+}  // namespace
+
+
+Viterbi_K7_R2_Decoder::Viterbi_K7_R2_Decoder(const std::array<int32_t, 2>& g_encoder,
+    int32_t max_data_bits) : d_symbols(2 * (max_data_bits + KK - 1)),
+                             d_decisions(2 * (max_data_bits + KK - 1)),
+                             d_max_data_bits(max_data_bits)
+{
+    // nsc_transit() shifts the new bit in at the most significant bit of the
+    // register, while the kernel shifts it in at the least significant one
+    for (int32_t j = 0; j < 2; j++)
+        {
+            uint32_t poly = 0U;
+            for (int32_t b = 0; b < KK; b++)
+                {
+                    poly |= ((static_cast<uint32_t>(g_encoder[j]) >> b) & 1U) << (KK - 1 - b);
+                }
+            for (uint32_t i = 0; i < NUM_STATES / 2; i++)
+                {
+                    d_branch_table[j * NUM_STATES / 2 + i] = parity((2U * i) & poly) ? 255 : 0;
+                }
+        }
+}
+
+
+void Viterbi_K7_R2_Decoder::decode(const float* symbols, int32_t* bits, int32_t num_data_bits)
+{
+    num_data_bits = std::min(num_data_bits, d_max_data_bits);
+    const int32_t num_steps = num_data_bits + KK - 1;
+    const int32_t num_symbols = 2 * num_steps;
+
+    // Quantize around 128, the mean amplitude being mapped to +-32 to leave
+    // headroom for the noise peaks
+    float mean_amplitude = 0.0F;
+    for (int32_t i = 0; i < num_symbols; i++)
+        {
+            mean_amplitude += std::fabs(symbols[i]);
+        }
+    mean_amplitude /= static_cast<float>(num_symbols);
+    const float scale = mean_amplitude > 0.0F ? 32.0F / mean_amplitude : 0.0F;
+    for (int32_t i = 0; i < num_symbols; i++)
+        {
+            const float q = std::round(128.0F + symbols[i] * scale);
+            d_symbols[i] = static_cast<uint8_t>(std::min(std::max(q, 0.0F), 255.0F));
+        }
+
+    // Start in the all-zeros state
+    d_path_metrics.fill(4096);
+    d_path_metrics[0] = 0;
+    volk_gnsssdr_8u_conv_k7_r2_32u(d_decisions.data(), d_path_metrics.data(), d_symbols.data(), d_branch_table.data(), num_steps);
+
+    // Trace back from the all-zeros state reached after the tail bits
+    uint32_t state = 0U;
+    for (int32_t t = num_steps - 1; t >= 0; t--)
+        {
+            const uint32_t decision = (d_decisions[2 * t + state / 32U] >> (state % 32U)) & 1U;
+            if (t < num_data_bits)
+                {
+                    bits[t] = static_cast<int32_t>(state & 1U);
+                }
+            state = (state >> 1U) | (decision << 5U);
+        }
+}
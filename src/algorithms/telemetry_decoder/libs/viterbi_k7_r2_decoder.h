@@ -0,0 +1,72 @@
+/*!
+ * \file viterbi_k7_r2_decoder.h
+ * \brief Soft-decision Viterbi decoder for the K=7, rate 1/2 convolutional
+ * code used by the IRNSS, Galileo and GPS CNAV navigation messages.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_VITERBI_K7_R2_DECODER_H
+#define GNSS_SDR_VITERBI_K7_R2_DECODER_H
+
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
+#include <array>
+#include <cstdint>
+
+/** \addtogroup Telemetry_Decoder
+ * \{ */
+/** \addtogroup Telemetry_Decoder_libs telemetry_decoder_libs
+ * \{ */
+
+
+/*!
+ * \brief Decodes zero-terminated blocks of a K=7, rate 1/2 convolutional code.
+ *
+ * The symbols are quantized to 8 bits and the add-compare-select steps run in
+ * the volk_gnsssdr_8u_conv_k7_r2_32u kernel (SSE2, AVX2 or NEON when
+ * available). It is a drop-in replacement of Viterbi() in convolutional.h:
+ * same polynomial convention, same symbol order (G1 first) and polarity
+ * (positive symbols are ones), and the encoder is assumed to start and end
+ * in the all-zeros state. All the buffers are allocated in the constructor.
+ */
+class Viterbi_K7_R2_Decoder
+{
+public:
+    /*!
+     * \brief Constructor.
+     * \param g_encoder - Generator polynomials G1 and G2, as given to
+     * nsc_transit() (e.g. {121, 91} for GPS CNAV, Galileo and IRNSS).
+     * \param max_data_bits - Maximum number of data bits per block, without
+     * the tail.
+     */
+    Viterbi_K7_R2_Decoder(const std::array<int32_t, 2>& g_encoder, int32_t max_data_bits);
+
+    /*!
+     * \brief Decodes \a num_data_bits bits from 2 * (\a num_data_bits + 6)
+     * soft symbols. Writes 0 or 1 in \a bits.
+     */
+    void decode(const float* symbols, int32_t* bits, int32_t num_data_bits);
+
+private:
+    static constexpr int32_t KK = 7;
+    static constexpr int32_t NUM_STATES = 64;
+
+    std::array<uint8_t, NUM_STATES> d_branch_table{};  // G1 outputs, then G2 outputs
+    std::array<int16_t, NUM_STATES> d_path_metrics{};
+    volk_gnsssdr::vector<uint8_t> d_symbols;
+    volk_gnsssdr::vector<uint32_t> d_decisions;
+    int32_t d_max_data_bits;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_VITERBI_K7_R2_DECODER_H
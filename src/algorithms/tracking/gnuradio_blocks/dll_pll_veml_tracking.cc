@@ -57,6 +57,7 @@
 #include <array>
 #include <cmath>      // for fmod, round, floor
 #include <exception>  // for exception
+#include <fstream>    // for ifstream
 #include <iostream>   // for cout, cerr
 #include <map>
 #include <numeric>
@@ -68,6 +69,40 @@
 #endif
 
 
+namespace
+{
+// Contents of each epoch in the dump file, as read by save_matfile()
+#pragma pack(push, 1)
+struct Trk_Dump_Record
+{
+    float abs_VE;
+    float abs_E;
+    float abs_P;
+    float abs_L;
+    float abs_VL;
+    float prompt_I;
+    float prompt_Q;
+    uint64_t PRN_start_sample_count;
+    float acc_carrier_phase_rad;
+    float carrier_doppler_hz;
+    float carrier_doppler_rate_hz;
+    float code_freq_chips;
+    float code_freq_rate_chips;
+    float carr_error_hz;
+    float carr_error_filt_hz;
+    float code_error_chips;
+    float code_error_filt_chips;
+    float CN0_SNV_dB_Hz;
+    float carrier_lock_test;
+    float aux1;
+    double aux2;
+    uint32_t PRN;
+};
+#pragma pack(pop)
+static_assert(sizeof(Trk_Dump_Record) == 19 * sizeof(float) + sizeof(uint64_t) + sizeof(double) + sizeof(uint32_t), "Unexpected padding in Trk_Dump_Record");
+}  // namespace
+
+
 dll_pll_veml_tracking_sptr dll_pll_veml_make_tracking(const Dll_Pll_Conf &conf_)
 {
     return dll_pll_veml_tracking_sptr(new dll_pll_veml_tracking(conf_));
@@ -905,17 +940,7 @@ void dll_pll_veml_tracking::start_tracking()
 
 dll_pll_veml_tracking::~dll_pll_veml_tracking()
 {
-    if (d_dump_file.is_open())
-        {
-            try
-                {
-                    d_dump_file.close();
-                }
-            catch (const std::exception &ex)
-                {
-                    LOG(WARNING) << "Exception in Tracking block destructor: " << ex.what();
-                }
-        }
+    d_dump_file.close();
     if (d_dump_mat)
         {
             try
@@ -942,6 +967,15 @@ dll_pll_veml_tracking::~dll_pll_veml_tracking()
 }
 
 
+bool dll_pll_veml_tracking::stop()
+{
+    // Called by GNU Radio when the flowgraph stops, so that the dump file
+    // is complete before this block is destroyed.
+    d_dump_file.flush();
+    return true;
+}
+
+
 bool dll_pll_veml_tracking::acquire_secondary()
 {
     // ******* preamble correlation ********
@@ -1412,96 +1446,56 @@ void dll_pll_veml_tracking::log_data()
     if (d_dump)
         {
             // Dump results to file
-            float prompt_I;
-            float prompt_Q;
-            float tmp_VE;
-            float tmp_E;
-            float tmp_P;
-            float tmp_L;
-            float tmp_VL;
-            float tmp_float;
-            double tmp_double;
-            uint64_t tmp_long_int;
+            Trk_Dump_Record record;
             if (d_trk_parameters.track_pilot)
                 {
-                    prompt_I = d_Prompt_Data.data()->real();
-                    prompt_Q = d_Prompt_Data.data()->imag();
+                    record.prompt_I = d_Prompt_Data.data()->real();
+                    record.prompt_Q = d_Prompt_Data.data()->imag();
                 }
             else
                 {
-                    prompt_I = d_Prompt->real();
-                    prompt_Q = d_Prompt->imag();
+                    record.prompt_I = d_Prompt->real();
+                    record.prompt_Q = d_Prompt->imag();
                 }
             if (d_veml)
                 {
-                    tmp_VE = std::abs<float>(d_VE_accu);
-                    tmp_VL = std::abs<float>(d_VL_accu);
+                    record.abs_VE = std::abs<float>(d_VE_accu);
+                    record.abs_VL = std::abs<float>(d_VL_accu);
                 }
             else
                 {
-                    tmp_VE = 0.0;
-                    tmp_VL = 0.0;
-                }
-            tmp_E = std::abs<float>(d_E_accu);
-            tmp_P = std::abs<float>(d_P_accu);
-            tmp_L = std::abs<float>(d_L_accu);
-
-            try
-                {
-                    // Dump correlators output
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_VE), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_E), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_P), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_L), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_VL), sizeof(float));
-                    // PROMPT I and Q (to analyze navigation symbols)
-                    d_dump_file.write(reinterpret_cast<char *>(&prompt_I), sizeof(float));
-                    d_dump_file.write(reinterpret_cast<char *>(&prompt_Q), sizeof(float));
-                    // PRN start sample stamp
-                    tmp_long_int = d_sample_counter + static_cast<uint64_t>(d_current_prn_length_samples);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_long_int), sizeof(uint64_t));
-                    // accumulated carrier phase
-                    tmp_float = static_cast<float>(d_acc_carrier_phase_rad);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // carrier and code frequency
-                    tmp_float = static_cast<float>(d_carrier_doppler_hz);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // carrier phase rate [Hz/s]
-                    tmp_float = static_cast<float>(d_carrier_phase_rate_step_rad * d_trk_parameters.fs_in * d_trk_parameters.fs_in / TWO_PI);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_float = static_cast<float>(d_code_freq_chips);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // code phase rate [chips/s^2]
-                    tmp_float = static_cast<float>(d_code_phase_rate_step_chips * d_trk_parameters.fs_in * d_trk_parameters.fs_in);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // PLL commands
-                    tmp_float = static_cast<float>(d_carr_phase_error_hz);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_float = static_cast<float>(d_carr_error_filt_hz);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // DLL commands
-                    tmp_float = static_cast<float>(d_code_error_chips);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_float = static_cast<float>(d_code_error_filt_chips);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // CN0 and carrier lock test
-                    tmp_float = static_cast<float>(d_CN0_SNV_dB_Hz);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_float = static_cast<float>(d_carrier_lock_test);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    // AUX vars (for debug purposes)
-                    tmp_float = static_cast<float>(d_rem_code_phase_samples);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_float), sizeof(float));
-                    tmp_double = static_cast<double>(d_sample_counter + d_current_prn_length_samples);
-                    d_dump_file.write(reinterpret_cast<char *>(&tmp_double), sizeof(double));
-                    // PRN
-                    uint32_t prn_ = d_acquisition_gnss_synchro->PRN;
-                    d_dump_file.write(reinterpret_cast<char *>(&prn_), sizeof(uint32_t));
-                }
-            catch (const std::ifstream::failure &e)
-                {
-                    LOG(WARNING) << "Exception writing trk dump file " << e.what();
-                }
+                    record.abs_VE = 0.0;
+                    record.abs_VL = 0.0;
+                }
+            record.abs_E = std::abs<float>(d_E_accu);
+            record.abs_P = std::abs<float>(d_P_accu);
+            record.abs_L = std::abs<float>(d_L_accu);
+            // PRN start sample stamp
+            record.PRN_start_sample_count = d_sample_counter + static_cast<uint64_t>(d_current_prn_length_samples);
+            // accumulated carrier phase
+            record.acc_carrier_phase_rad = static_cast<float>(d_acc_carrier_phase_rad);
+            // carrier and code frequency
+            record.carrier_doppler_hz = static_cast<float>(d_carrier_doppler_hz);
+            // carrier phase rate [Hz/s]
+            record.carrier_doppler_rate_hz = static_cast<float>(d_carrier_phase_rate_step_rad * d_trk_parameters.fs_in * d_trk_parameters.fs_in / TWO_PI);
+            record.code_freq_chips = static_cast<float>(d_code_freq_chips);
+            // code phase rate [chips/s^2]
+            record.code_freq_rate_chips = static_cast<float>(d_code_phase_rate_step_chips * d_trk_parameters.fs_in * d_trk_parameters.fs_in);
+            // PLL commands
+            record.carr_error_hz = static_cast<float>(d_carr_phase_error_hz);
+            record.carr_error_filt_hz = static_cast<float>(d_carr_error_filt_hz);
+            // DLL commands
+            record.code_error_chips = static_cast<float>(d_code_error_chips);
+            record.code_error_filt_chips = static_cast<float>(d_code_error_filt_chips);
+            // CN0 and carrier lock test
+            record.CN0_SNV_dB_Hz = static_cast<float>(d_CN0_SNV_dB_Hz);
+            record.carrier_lock_test = static_cast<float>(d_carrier_lock_test);
+            // AUX vars (for debug purposes)
+            record.aux1 = static_cast<float>(d_rem_code_phase_samples);
+            record.aux2 = static_cast<double>(d_sample_counter + d_current_prn_length_samples);
+            // PRN
+            record.PRN = d_acquisition_gnss_synchro->PRN;
+            d_dump_file.write(record);
         }
 }
 
@@ -1722,15 +1716,13 @@ void dll_pll_veml_tracking::set_channel(uint32_t channel)
 
             if (!d_dump_file.is_open())
                 {
-                    try
+                    if (d_dump_file.open(dump_filename_))
                         {
-                            d_dump_file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-                            d_dump_file.open(dump_filename_.c_str(), std::ios::out | std::ios::binary);
                             LOG(INFO) << "Tracking dump enabled on channel " << d_channel << " Log file: " << dump_filename_.c_str();
                         }
-                    catch (const std::ifstream::failure &e)
+                    else
                         {
-                            LOG(WARNING) << "channel " << d_channel << " Exception opening trk dump file " << e.what();
+                            LOG(WARNING) << "channel " << d_channel << " Error opening trk dump file " << dump_filename_;
                         }
                 }
         }
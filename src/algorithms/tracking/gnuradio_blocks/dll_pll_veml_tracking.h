@@ -22,6 +22,7 @@
 #include "dll_pll_conf.h"
 #include "exponential_smoother.h"
 #include "gnss_block_interface.h"
+#include "gnss_dump_writer.h"
 #include "tracking_FLL_PLL_filter.h"  // for PLL/FLL filter
 #include "tracking_loop_filter.h"     // for DLL filter
 #include <boost/circular_buffer.hpp>
@@ -32,7 +33,6 @@
 #include <volk_gnsssdr/volk_gnsssdr_alloc.h>  // for volk_gnsssdr::vector
 #include <cstddef>                            // for size_t
 #include <cstdint>                            // for int32_t
-#include <fstream>                            // for ofstream
 #include <string>                             // for string
 #include <typeinfo>                           // for typeid
 #include <utility>                            // for pair
@@ -58,6 +58,7 @@ class dll_pll_veml_tracking : public gr::block
 {
 public:
     ~dll_pll_veml_tracking();
+    bool stop();  //!< Writes the pending dump records
 
     void set_channel(uint32_t channel);
     void set_gnss_synchro(Gnss_Synchro *p_gnss_synchro);
@@ -161,7 +162,7 @@ private:
     std::string d_signal_pretty_name;
     std::string d_dump_filename;
 
-    std::ofstream d_dump_file;
+    Gnss_Dump_Writer d_dump_file;
 
     uint64_t d_sample_counter;
     uint64_t d_acq_sample_stamp;
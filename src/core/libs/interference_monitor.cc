@@ -0,0 +1,80 @@
+/*!
+ * \file interference_monitor.cc
+ * \brief GNU Radio block that receives the statistics of the interference
+ * mitigation filters and sends them via UDP.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "interference_monitor.h"
+#include <glog/logging.h>
+#include <gnuradio/io_signature.h>
+
+#if HAS_GENERIC_LAMBDA
+#else
+#include <boost/bind/bind.hpp>
+#endif
+
+
+interference_monitor_sptr interference_monitor_make(int32_t n_signal_conditioners, const std::vector<std::string>& addresses, uint16_t port)
+{
+    return interference_monitor_sptr(new interference_monitor(n_signal_conditioners, addresses, port));
+}
+
+
+interference_monitor::interference_monitor(int32_t n_signal_conditioners,
+    const std::vector<std::string>& addresses,
+    uint16_t port) : gr::block("interference_monitor", gr::io_signature::make(0, 0, 0), gr::io_signature::make(0, 0, 0)),
+                     udp_sender_(addresses, port)
+{
+    for (int32_t i = 0; i < n_signal_conditioners; i++)
+        {
+            const pmt::pmt_t port_name = pmt::mp("interference" + std::to_string(i));
+            this->message_port_register_in(port_name);
+            this->set_msg_handler(port_name,
+#if HAS_GENERIC_LAMBDA
+                [this, i](auto&& PH1) { msg_handler_interference(i, PH1); });
+#else
+#if USE_BOOST_BIND_PLACEHOLDERS
+                boost::bind(&interference_monitor::msg_handler_interference, this, i, boost::placeholders::_1));
+#else
+                boost::bind(&interference_monitor::msg_handler_interference, this, i, _1));
+#endif
+#endif
+        }
+}
+
+
+void interference_monitor::msg_handler_interference(int32_t signal_conditioner, const pmt::pmt_t& msg)
+{
+    gr::thread::scoped_lock lock(d_setlock);  // the handlers of all the ports share the sender
+
+    if (!pmt::is_dict(msg))
+        {
+            LOG(WARNING) << "interference_monitor received an unknown object type!";
+            return;
+        }
+    std::string& datagram = udp_sender_.new_datagram();
+    datagram += "signal_conditioner=";
+    datagram += std::to_string(signal_conditioner);
+    for (pmt::pmt_t items = pmt::dict_items(msg); pmt::is_pair(items); items = pmt::cdr(items))
+        {
+            const pmt::pmt_t item = pmt::car(items);
+            if (pmt::is_symbol(pmt::car(item)) and (pmt::is_real(pmt::cdr(item)) or pmt::is_integer(pmt::cdr(item))))
+                {
+                    datagram += ',';
+                    datagram += pmt::symbol_to_string(pmt::car(item));
+                    datagram += '=';
+                    datagram += std::to_string(pmt::to_double(pmt::cdr(item)));
+                }
+        }
+    udp_sender_.send();
+}
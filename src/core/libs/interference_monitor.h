@@ -0,0 +1,63 @@
+/*!
+ * \file interference_monitor.h
+ * \brief GNU Radio block that receives the statistics of the interference
+ * mitigation filters and sends them via UDP.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_INTERFERENCE_MONITOR_H
+#define GNSS_SDR_INTERFERENCE_MONITOR_H
+
+#include "gnss_block_interface.h"
+#include "udp_datagram_sender.h"
+#include <gnuradio/block.h>
+#include <pmt/pmt.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver_Library
+ * \{ */
+
+class interference_monitor;
+
+using interference_monitor_sptr = gnss_shared_ptr<interference_monitor>;
+
+interference_monitor_sptr interference_monitor_make(int32_t n_signal_conditioners, const std::vector<std::string>& addresses, uint16_t port);
+
+/*!
+ * \brief GNU Radio block that receives the statistics published by the input
+ * filters of the signal conditioners and sends them via UDP.
+ *
+ * The statistics of the input filter of signal conditioner i are received on
+ * the "interference<i>" message port, as a dictionary of numbers. Each one is
+ * sent as a text datagram such as
+ * "signal_conditioner=0,blanked_percentage=1.250000".
+ */
+class interference_monitor : public gr::block
+{
+public:
+    ~interference_monitor() = default;  //!< Default destructor
+
+private:
+    friend interference_monitor_sptr interference_monitor_make(int32_t n_signal_conditioners, const std::vector<std::string>& addresses, uint16_t port);
+    interference_monitor(int32_t n_signal_conditioners, const std::vector<std::string>& addresses, uint16_t port);
+    void msg_handler_interference(int32_t signal_conditioner, const pmt::pmt_t& msg);
+    Udp_Datagram_Sender udp_sender_;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_INTERFERENCE_MONITOR_H
@@ -20,7 +20,8 @@
 
 #include "nav_message_packet.h"
 #include "serdes_nav_message.h"
-#include <boost/asio.hpp>
+#include "udp_datagram_sender.h"
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <vector>
@@ -30,12 +31,6 @@
 /** \addtogroup Core_Receiver_Library
  * \{ */
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 class Nav_Message_Udp_Sink
 {
 public:
@@ -44,10 +39,7 @@ public:
 
 private:
     Serdes_Nav_Message serdes_nav;
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
-    boost::system::error_code error;
+    Udp_Datagram_Sender sender;
 };
 
 
@@ -48,6 +48,8 @@ gnss_synchro_monitor::gnss_synchro_monitor(int n_channels,
 {
     d_decimation_factor = decimation_factor;
     d_nchannels = n_channels;
+    d_count = std::vector<int>(n_channels, 0);
+    d_stocks = std::vector<Gnss_Synchro>(1);
 
     udp_sink_ptr = std::make_unique<Gnss_Synchro_Udp_Sink>(udp_addresses, udp_port, enable_protobuf);
 }
@@ -73,23 +75,27 @@ int gnss_synchro_monitor::general_work(int noutput_items __attribute__((unused))
     for (int channel_index = 0; channel_index < d_nchannels; channel_index++)
         {
             // Loop through each item in each input stream channel
-            int count = 0;
             for (int item_index = 0; item_index < ninput_items[channel_index]; item_index++)
                 {
                     // Use the count variable to limit how many items are sent per channel
-                    count++;
-                    if (count >= d_decimation_factor)
+                    d_count[channel_index]++;
+                    if (d_count[channel_index] >= d_decimation_factor)
                         {
-                            // Convert to a vector and write to the UDP sink
-                            std::vector<Gnss_Synchro> stocks;
-                            stocks.push_back(in[channel_index][item_index]);
-                            udp_sink_ptr->write_gnss_synchro(stocks);
+                            // Serialize into the UDP sink queue, reusing the vector and the output buffers
+                            d_stocks[0] = in[channel_index][item_index];
+                            udp_sink_ptr->queue_gnss_synchro(d_stocks);
                             // Reset count variable
-                            count = 0;
-                            // Consume the number of items for the input stream channel
-                            consume(channel_index, ninput_items[channel_index]);
+                            d_count[channel_index] = 0;
                         }
                 }
+            // Consume the number of items for the input stream channel
+            consume(channel_index, ninput_items[channel_index]);
+        }
+
+    // Send all the datagrams of this call at once
+    if (udp_sink_ptr->queued_datagrams() > 0)
+        {
+            udp_sink_ptr->flush();
         }
 
     // Not producing any outputs
@@ -71,9 +71,11 @@ private:
         const std::vector<std::string>& udp_addresses,
         bool enable_protobuf);
 
+    std::unique_ptr<Gnss_Synchro_Udp_Sink> udp_sink_ptr;
+    std::vector<Gnss_Synchro> d_stocks;
+    std::vector<int> d_count;
     int d_nchannels;
     int d_decimation_factor;
-    std::unique_ptr<Gnss_Synchro_Udp_Sink> udp_sink_ptr;
 };
 
 
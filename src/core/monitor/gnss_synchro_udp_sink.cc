@@ -18,55 +18,40 @@
 #include "gnss_synchro_udp_sink.h"
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/vector.hpp>
-#include <iostream>
-#include <sstream>
 
-Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf) : socket{io_context}
+
+Gnss_Synchro_Udp_Sink::Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf) : sender(addresses, port)
 {
     use_protobuf = enable_protobuf;
     if (enable_protobuf)
         {
             serdes = Serdes_Gnss_Synchro();
         }
-    for (const auto& address : addresses)
-        {
-            boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
-            endpoints.push_back(endpoint);
-        }
 }
 
 
 bool Gnss_Synchro_Udp_Sink::write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
 {
-    std::string outbound_data;
+    queue_gnss_synchro(stocks);
+    return flush();
+}
+
+
+void Gnss_Synchro_Udp_Sink::queue_gnss_synchro(const std::vector<Gnss_Synchro>& stocks)
+{
     if (use_protobuf == false)
         {
-            std::ostringstream archive_stream;
-            boost::archive::binary_oarchive oa{archive_stream};
+            boost::archive::binary_oarchive oa{sender.new_datagram_streambuf()};
             oa << stocks;
-            outbound_data = archive_stream.str();
         }
     else
         {
-            outbound_data = serdes.createProtobuffer(stocks);
+            serdes.appendProtobuffer(stocks, sender.new_datagram());
         }
-    for (const auto& endpoint : endpoints)
-        {
-            socket.open(endpoint.protocol(), error);
-            socket.connect(endpoint, error);
+}
 
-            try
-                {
-                    if (socket.send(boost::asio::buffer(outbound_data)) == 0)
-                        {
-                            std::cerr << "Gnss_Synchro_Udp_Sink sent 0 bytes\n";
-                        }
-                }
-            catch (boost::system::system_error const& e)
-                {
-                    std::cerr << e.what() << '\n';
-                    return false;
-                }
-        }
-    return true;
+
+bool Gnss_Synchro_Udp_Sink::flush()
+{
+    return sender.send();
 }
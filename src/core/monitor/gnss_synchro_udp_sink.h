@@ -20,8 +20,8 @@
 
 #include "gnss_synchro.h"
 #include "serdes_gnss_synchro.h"
-#include <boost/asio.hpp>
-#include <boost/system/error_code.hpp>
+#include "udp_datagram_sender.h"
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -32,12 +32,6 @@
  * \{ */
 
 
-#if USE_BOOST_ASIO_IO_CONTEXT
-using b_io_context = boost::asio::io_context;
-#else
-using b_io_context = boost::asio::io_service;
-#endif
-
 /*!
  * \brief This class sends serialized Gnss_Synchro objects
  * over UDP to one or multiple endpoints.
@@ -46,13 +40,31 @@ class Gnss_Synchro_Udp_Sink
 {
 public:
     Gnss_Synchro_Udp_Sink(const std::vector<std::string>& addresses, const uint16_t& port, bool enable_protobuf);
+
+    /*!
+     * \brief Sends \a stocks in one datagram, together with any datagram
+     * queued with queue_gnss_synchro()
+     */
     bool write_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);
 
+    /*!
+     * \brief Serializes \a stocks in one datagram, to be sent with the next
+     * call to write_gnss_synchro() or flush()
+     */
+    void queue_gnss_synchro(const std::vector<Gnss_Synchro>& stocks);
+
+    /*!
+     * \brief Sends all the queued datagrams at once
+     */
+    bool flush();
+
+    size_t queued_datagrams() const
+    {
+        return sender.queued_datagrams();
+    }
+
 private:
-    b_io_context io_context;
-    boost::asio::ip::udp::socket socket;
-    boost::system::error_code error;
-    std::vector<boost::asio::ip::udp::endpoint> endpoints;
+    Udp_Datagram_Sender sender;
     Serdes_Gnss_Synchro serdes;
     bool use_protobuf;
 };
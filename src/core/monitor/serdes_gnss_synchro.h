@@ -20,7 +20,6 @@
 
 #include "gnss_synchro.h"
 #include "gnss_synchro.pb.h"  // file created by Protocol Buffers at compile time
-#include <array>
 #include <string>
 #include <utility>
 #include <vector>
@@ -71,21 +70,19 @@ public:
 
     inline std::string createProtobuffer(const std::vector<Gnss_Synchro>& vgs)  //!< Serialization into a string
     {
-        observables.Clear();
         std::string data;
-        for (auto gs : vgs)
+        appendProtobuffer(vgs, data);
+        return data;
+    }
+
+    inline void appendProtobuffer(const std::vector<Gnss_Synchro>& vgs, std::string& data)  //!< Serialization appended to a string, reusing its capacity
+    {
+        observables.Clear();
+        for (const auto& gs : vgs)
             {
                 gnss_sdr::GnssSynchro* obs = observables.add_observable();
-                char c = gs.System;
-                const std::string sys(1, c);
-
-                std::array<char, 2> cc;
-                cc[0] = gs.Signal[0];
-                cc[1] = gs.Signal[1];
-                const std::string sig(cc.cbegin(), cc.cend());
-
-                obs->set_system(sys);
-                obs->set_signal(sig);
+                obs->set_system(&gs.System, 1);
+                obs->set_signal(gs.Signal, 2);
                 obs->set_prn(gs.PRN);
                 obs->set_channel_id(gs.Channel_ID);
 
@@ -114,8 +111,7 @@ public:
                 obs->set_flag_valid_pseudorange(gs.Flag_valid_pseudorange);
                 obs->set_interp_tow_ms(gs.interp_TOW_ms);
             }
-        observables.SerializeToString(&data);
-        return data;
+        observables.AppendToString(&data);
     }
 
     inline std::vector<Gnss_Synchro> readProtobuffer(const gnss_sdr::Observables& obs) const  //!< Deserialization
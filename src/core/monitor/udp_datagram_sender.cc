@@ -0,0 +1,141 @@
+/*!
+ * \file udp_datagram_sender.cc
+ * \brief Sends datagrams over UDP to one or multiple endpoints through
+ * persistent connected sockets and reused output buffers
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "udp_datagram_sender.h"
+#include <boost/system/error_code.hpp>
+#include <iostream>
+#include <utility>  // for std::move
+#if defined(__linux__)
+#include <cerrno>
+#endif
+
+
+Udp_Datagram_Sender::Udp_Datagram_Sender(const std::vector<std::string>& addresses, uint16_t port)
+{
+    d_sockets.reserve(addresses.size());
+    for (const auto& address : addresses)
+        {
+            boost::system::error_code error;
+            const boost::asio::ip::udp::endpoint endpoint(boost::asio::ip::address::from_string(address, error), port);
+            boost::asio::ip::udp::socket socket(d_io_context);
+            if (!error)
+                {
+                    socket.open(endpoint.protocol(), error);
+                }
+            if (!error)
+                {
+                    socket.connect(endpoint, error);
+                }
+            if (error)
+                {
+                    std::cerr << "Cannot send UDP datagrams to " << address << ':' << port << ": " << error.message() << '\n';
+                    continue;
+                }
+            d_sockets.push_back(std::move(socket));
+        }
+}
+
+
+std::string& Udp_Datagram_Sender::new_datagram()
+{
+    if (d_num_queued == d_datagrams.size())
+        {
+            d_datagrams.emplace_back();
+        }
+    std::string& datagram = d_datagrams[d_num_queued++];
+    datagram.clear();
+    return datagram;
+}
+
+
+std::streambuf& Udp_Datagram_Sender::new_datagram_streambuf()
+{
+    d_streambuf.datagram = &new_datagram();
+    return d_streambuf;
+}
+
+
+bool Udp_Datagram_Sender::send()
+{
+    const size_t num_datagrams = d_num_queued;
+    d_num_queued = 0;
+    bool success = true;
+#if defined(__linux__)
+    d_iovecs.resize(num_datagrams);
+    d_headers.resize(num_datagrams);
+    for (size_t i = 0; i < num_datagrams; i++)
+        {
+            d_iovecs[i].iov_base = &d_datagrams[i][0];
+            d_iovecs[i].iov_len = d_datagrams[i].size();
+            d_headers[i] = mmsghdr();
+            d_headers[i].msg_hdr.msg_iov = &d_iovecs[i];
+            d_headers[i].msg_hdr.msg_iovlen = 1;
+        }
+    for (auto& socket : d_sockets)
+        {
+            size_t sent = 0;
+            while (sent < num_datagrams)
+                {
+                    const int ret = sendmmsg(socket.native_handle(), &d_headers[sent], static_cast<unsigned int>(num_datagrams - sent), 0);
+                    if (ret > 0)
+                        {
+                            sent += static_cast<size_t>(ret);
+                        }
+                    else if (ret < 0 && errno == EINTR)
+                        {
+                            continue;
+                        }
+                    else
+                        {
+                            // For instance, ECONNREFUSED if nobody listened to the previous datagrams.
+                            // Skip the datagram that failed and keep the socket.
+                            success = false;
+                            sent++;
+                        }
+                }
+        }
+#else
+    for (auto& socket : d_sockets)
+        {
+            for (size_t i = 0; i < num_datagrams; i++)
+                {
+                    boost::system::error_code error;
+                    if (socket.send(boost::asio::buffer(d_datagrams[i]), 0, error) == 0 || error)
+                        {
+                            success = false;
+                        }
+                }
+        }
+#endif
+    return success;
+}
+
+
+Udp_Datagram_Sender::Datagram_Streambuf::int_type Udp_Datagram_Sender::Datagram_Streambuf::overflow(int_type c)
+{
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+        {
+            datagram->push_back(traits_type::to_char_type(c));
+        }
+    return traits_type::not_eof(c);
+}
+
+
+std::streamsize Udp_Datagram_Sender::Datagram_Streambuf::xsputn(const char* s, std::streamsize n)
+{
+    datagram->append(s, static_cast<size_t>(n));
+    return n;
+}
@@ -0,0 +1,112 @@
+/*!
+ * \file udp_datagram_sender.h
+ * \brief Sends datagrams over UDP to one or multiple endpoints through
+ * persistent connected sockets and reused output buffers
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_UDP_DATAGRAM_SENDER_H
+#define GNSS_SDR_UDP_DATAGRAM_SENDER_H
+
+#include <boost/asio.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <streambuf>
+#include <string>
+#include <vector>
+#if defined(__linux__)
+#include <sys/socket.h>  // for mmsghdr
+#include <sys/uio.h>     // for iovec
+#endif
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Gnss_Synchro_Monitor
+ * \{ */
+
+
+#if USE_BOOST_ASIO_IO_CONTEXT
+using b_io_context = boost::asio::io_context;
+#else
+using b_io_context = boost::asio::io_service;
+#endif
+
+/*!
+ * \brief Common transport of the monitor UDP sinks.
+ *
+ * One socket per endpoint is opened and connected at construction. Datagrams
+ * are serialized into buffers that are kept from one call to the next, so
+ * that no memory is allocated once the buffers have grown to the size of the
+ * messages. All the datagrams queued between two calls to send() are sent
+ * with a single sendmmsg() system call per endpoint where available.
+ */
+class Udp_Datagram_Sender
+{
+public:
+    Udp_Datagram_Sender(const std::vector<std::string>& addresses, uint16_t port);
+
+    Udp_Datagram_Sender(const Udp_Datagram_Sender&) = delete;
+    Udp_Datagram_Sender& operator=(const Udp_Datagram_Sender&) = delete;
+
+    /*!
+     * \brief Queues a new datagram and returns its (empty) buffer, valid
+     * until the next call to new_datagram() or new_datagram_streambuf()
+     */
+    std::string& new_datagram();
+
+    /*!
+     * \brief Same as new_datagram(), for serializers that write to a stream
+     */
+    std::streambuf& new_datagram_streambuf();
+
+    /*!
+     * \brief Sends the queued datagrams to all the endpoints and empties the
+     * queue. Returns false if any of them could not be sent.
+     */
+    bool send();
+
+    size_t queued_datagrams() const
+    {
+        return d_num_queued;
+    }
+
+    size_t connected_endpoints() const
+    {
+        return d_sockets.size();
+    }
+
+private:
+    class Datagram_Streambuf : public std::streambuf
+    {
+    public:
+        std::string* datagram{nullptr};
+
+    protected:
+        int_type overflow(int_type c) override;
+        std::streamsize xsputn(const char* s, std::streamsize n) override;
+    };
+
+    b_io_context d_io_context;
+    std::vector<boost::asio::ip::udp::socket> d_sockets;
+    std::vector<std::string> d_datagrams;
+    size_t d_num_queued{0};
+    Datagram_Streambuf d_streambuf;
+#if defined(__linux__)
+    std::vector<struct iovec> d_iovecs;
+    std::vector<struct mmsghdr> d_headers;
+#endif
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_UDP_DATAGRAM_SENDER_H
@@ -0,0 +1,270 @@
+/*!
+ * \file concurrent_ring_queue.h
+ * \brief Interface of a bounded, lock-free multiple-producer single-consumer
+ * queue with the same API as Concurrent_Queue
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_CONCURRENT_RING_QUEUE_H
+#define GNSS_SDR_CONCURRENT_RING_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup Core_Receiver
+ * \{ */
+
+
+template <typename Data>
+
+/*!
+ * \brief This class implements a bounded, lock-free multiple-producer
+ * single-consumer ring buffer with the API of Concurrent_Queue
+ *
+ * Any number of threads can push() concurrently without taking a lock: each
+ * one claims a slot with a compare-and-swap of the write position and then
+ * publishes it through a per-slot sequence number (D. Vyukov's bounded queue).
+ * Only one thread may pop. The consumer only sleeps on a condition variable
+ * when the queue is empty, and producers only take the mutex to wake it up
+ * when it is actually sleeping.
+ *
+ * The capacity is rounded up to a power of two. When the queue is full,
+ * push() drops the item and returns false. The current depth, the highest
+ * depth ever reached and the number of dropped items are available to
+ * monitor the back-pressure.
+ */
+class Concurrent_Ring_Queue
+{
+public:
+    explicit Concurrent_Ring_Queue(size_t capacity = 1024)
+        : d_capacity(round_up_to_power_of_two(capacity)),
+          d_mask(d_capacity - 1),
+          d_slots(new Slot[d_capacity])
+    {
+        for (size_t i = 0; i < d_capacity; i++)
+            {
+                d_slots[i].sequence.store(i, std::memory_order_relaxed);
+            }
+    }
+
+    Concurrent_Ring_Queue(const Concurrent_Ring_Queue&) = delete;
+    Concurrent_Ring_Queue& operator=(const Concurrent_Ring_Queue&) = delete;
+
+    /*!
+     * \brief Adds \a data to the queue. Returns false, and counts a drop,
+     * if the queue is full. Can be called from any thread.
+     */
+    bool push(Data const& data)
+    {
+        size_t pos = d_enqueue_pos.load(std::memory_order_relaxed);
+        Slot* slot;
+        while (true)
+            {
+                slot = &d_slots[pos & d_mask];
+                const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+                const auto diff = static_cast<std::ptrdiff_t>(sequence - pos);
+                if (diff == 0)
+                    {
+                        if (d_enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                            {
+                                break;
+                            }
+                    }
+                else if (diff < 0)
+                    {
+                        d_drops.fetch_add(1, std::memory_order_relaxed);
+                        return false;
+                    }
+                else
+                    {
+                        pos = d_enqueue_pos.load(std::memory_order_relaxed);
+                    }
+            }
+        slot->data = data;
+        slot->sequence.store(pos + 1, std::memory_order_release);
+
+        const size_t dequeue_pos = d_dequeue_pos.load(std::memory_order_relaxed);
+        if (pos + 1 > dequeue_pos)
+            {
+                update_high_watermark(pos + 1 - dequeue_pos);
+            }
+
+        // Pairs with the fence in wait_for_data(): either the consumer sees
+        // the new item, or this thread sees that the consumer is waiting
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (d_consumer_waiting.load(std::memory_order_relaxed))
+            {
+                std::lock_guard<std::mutex> lock(d_mutex);
+                d_condition_variable.notify_one();
+            }
+        return true;
+    }
+
+    bool empty() const
+    {
+        const size_t pos = d_dequeue_pos.load(std::memory_order_relaxed);
+        return d_slots[pos & d_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+    }
+
+    /*!
+     * \brief Pops the oldest item, if any. Must be called from the consumer
+     * thread only.
+     */
+    bool try_pop(Data& popped_value)
+    {
+        const size_t pos = d_dequeue_pos.load(std::memory_order_relaxed);
+        Slot& slot = d_slots[pos & d_mask];
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1)
+            {
+                return false;
+            }
+        popped_value = std::move(slot.data);
+        slot.data = Data();
+        // Advance the read position before releasing the slot, so that a
+        // producer reusing it never sees a stale depth
+        d_dequeue_pos.store(pos + 1, std::memory_order_relaxed);
+        slot.sequence.store(pos + d_capacity, std::memory_order_release);
+        return true;
+    }
+
+    void wait_and_pop(Data& popped_value)
+    {
+        while (!try_pop(popped_value))
+            {
+                std::unique_lock<std::mutex> lock(d_mutex);
+                wait_for_data(lock, std::chrono::steady_clock::time_point::max());
+            }
+    }
+
+    bool timed_wait_and_pop(Data& popped_value, int wait_ms)
+    {
+        if (try_pop(popped_value))
+            {
+                return true;
+            }
+        std::unique_lock<std::mutex> lock(d_mutex);
+        wait_for_data(lock, std::chrono::steady_clock::now() + std::chrono::milliseconds(wait_ms));
+        lock.unlock();
+        return try_pop(popped_value);
+    }
+
+    /*!
+     * \brief Returns the maximum number of items in the queue.
+     */
+    size_t capacity() const
+    {
+        return d_capacity;
+    }
+
+    /*!
+     * \brief Returns the number of items currently in the queue (approximate
+     * if producers are pushing concurrently).
+     */
+    size_t size() const
+    {
+        const size_t dequeue_pos = d_dequeue_pos.load(std::memory_order_acquire);
+        const size_t enqueue_pos = d_enqueue_pos.load(std::memory_order_relaxed);
+        return enqueue_pos > dequeue_pos ? enqueue_pos - dequeue_pos : 0;
+    }
+
+    /*!
+     * \brief Returns the highest number of items ever found in the queue
+     * right after a push.
+     */
+    size_t high_watermark() const
+    {
+        return d_high_watermark.load(std::memory_order_relaxed);
+    }
+
+    /*!
+     * \brief Returns the number of items dropped because the queue was full.
+     */
+    uint64_t drops() const
+    {
+        return d_drops.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Slot
+    {
+        std::atomic<size_t> sequence{0};
+        Data data{};
+    };
+
+    static size_t round_up_to_power_of_two(size_t n)
+    {
+        size_t capacity = 2;
+        while (capacity < n)
+            {
+                capacity <<= 1U;
+            }
+        return capacity;
+    }
+
+    void update_high_watermark(size_t depth)
+    {
+        size_t current = d_high_watermark.load(std::memory_order_relaxed);
+        while (depth > current && !d_high_watermark.compare_exchange_weak(current, depth, std::memory_order_relaxed))
+            {
+            }
+    }
+
+    // Called with d_mutex held. Returns when there is data to pop or the
+    // deadline expires.
+    void wait_for_data(std::unique_lock<std::mutex>& lock, std::chrono::steady_clock::time_point deadline)
+    {
+        d_consumer_waiting.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (empty())
+            {
+                if (deadline == std::chrono::steady_clock::time_point::max())
+                    {
+                        d_condition_variable.wait(lock);
+                    }
+                else if (d_condition_variable.wait_until(lock, deadline) == std::cv_status::timeout)
+                    {
+                        break;
+                    }
+            }
+        d_consumer_waiting.store(false, std::memory_order_relaxed);
+    }
+
+    const size_t d_capacity;
+    const size_t d_mask;
+    std::unique_ptr<Slot[]> d_slots;
+
+    // Producers and consumer positions in separate cache lines
+    std::atomic<size_t> d_enqueue_pos{0};
+    char d_pad0[64 - sizeof(std::atomic<size_t>)]{};
+    std::atomic<size_t> d_dequeue_pos{0};
+    char d_pad1[64 - sizeof(std::atomic<size_t>)]{};
+
+    std::atomic<size_t> d_high_watermark{0};
+    std::atomic<uint64_t> d_drops{0};
+    std::atomic<bool> d_consumer_waiting{false};
+
+    std::mutex d_mutex;
+    std::condition_variable d_condition_variable;
+};
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CONCURRENT_RING_QUEUE_H
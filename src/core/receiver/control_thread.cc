@@ -24,6 +24,7 @@
 
 #include "control_thread.h"
 #include "concurrent_map.h"
+#include "concurrent_queue.h"
 #include "configuration_interface.h"
 #include "file_configuration.h"
 #include "galileo_almanac.h"
@@ -145,7 +146,7 @@ void ControlThread::init()
     // OPTIONAL: specify a custom year to override the system time in order to postprocess old gnss records and avoid wrong week rollover
     pre_2009_file_ = configuration_->property("GNSS-SDR.pre_2009_file", false);
     // Instantiates a control queue, a GNSS flowgraph, and a control message factory
-    control_queue_ = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    control_queue_ = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>(control_queue_capacity_);
     cmd_interface_.set_msg_queue(control_queue_);  // set also the queue pointer for the telecommand thread
     if (well_formatted_configuration_)
         {
@@ -164,6 +165,7 @@ void ControlThread::init()
         }
 
     stop_ = false;
+    control_queue_drops_ = 0;
     processed_control_messages_ = 0;
     applied_actions_ = 0;
     supl_mcc_ = 0;
@@ -409,6 +411,11 @@ int ControlThread::run()
             LOG(INFO)<<"doing event dispatcher";
             event_dispatcher(valid_event, msg);
             LOG(INFO)<<"DONE 1 iteration";
+            if (control_queue_->drops() != control_queue_drops_)
+                {
+                    control_queue_drops_ = control_queue_->drops();
+                    LOG(WARNING) << "The control queue is full: " << control_queue_drops_ << " control messages dropped so far";
+                }
         }
     std::cout << "Stopping GNSS-SDR, please wait!\n";
     flowgraph_->stop();
@@ -451,7 +458,7 @@ int ControlThread::run()
 }
 
 
-void ControlThread::set_control_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue)
+void ControlThread::set_control_queue(std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> control_queue)
 {
     if (flowgraph_->running())
         {
@@ -459,6 +466,7 @@ void ControlThread::set_control_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_
             return;
         }
     control_queue_ = std::move(control_queue);
+    control_queue_drops_ = control_queue_->drops();
     cmd_interface_.set_msg_queue(control_queue_);
 }
 
@@ -21,16 +21,17 @@
 #ifndef GNSS_SDR_CONTROL_THREAD_H
 #define GNSS_SDR_CONTROL_THREAD_H
 
-#include "agnss_ref_location.h"    // for Agnss_Ref_Location
-#include "agnss_ref_time.h"        // for Agnss_Ref_Time
-#include "channel_event.h"         // for channel_event_sptr
-#include "command_event.h"         // for command_event_sptr
-#include "concurrent_queue.h"      // for Concurrent_Queue
-#include "gnss_sdr_supl_client.h"  // for Gnss_Sdr_Supl_Client
-#include "tcp_cmd_interface.h"     // for TcpCmdInterface
+#include "agnss_ref_location.h"     // for Agnss_Ref_Location
+#include "agnss_ref_time.h"         // for Agnss_Ref_Time
+#include "channel_event.h"          // for channel_event_sptr
+#include "command_event.h"          // for command_event_sptr
+#include "concurrent_ring_queue.h"  // for Concurrent_Ring_Queue
+#include "gnss_sdr_supl_client.h"   // for Gnss_Sdr_Supl_Client
+#include "tcp_cmd_interface.h"      // for TcpCmdInterface
 #include <pmt/pmt.h>
 #include <array>     // for array
 #include <cstddef>   // for size_t
+#include <cstdint>   // for uint64_t
 #include <memory>    // for shared_ptr
 #include <string>    // for string
 #include <thread>    // for std::thread
@@ -97,9 +98,9 @@ public:
     /*!
      * \brief Sets the control_queue
      *
-     * \param[in] std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue
+     * \param[in] std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> control_queue
      */
-    void set_control_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue);
+    void set_control_queue(std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> control_queue);
 
     unsigned int processed_control_messages() const
     {
@@ -178,9 +179,10 @@ private:
 
     const size_t channel_event_type_hash_code_ = typeid(channel_event_sptr).hash_code();
     const size_t command_event_type_hash_code_ = typeid(command_event_sptr).hash_code();
+    const size_t control_queue_capacity_ = 4096;  // control messages that can wait to be dispatched
 
     std::shared_ptr<ConfigurationInterface> configuration_;
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue_;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> control_queue_;
     std::shared_ptr<GNSSFlowgraph> flowgraph_;
 
     std::thread cmd_interface_thread_;
@@ -205,6 +207,7 @@ private:
     Agnss_Ref_Location agnss_ref_location_;
     Agnss_Ref_Time agnss_ref_time_;
 
+    uint64_t control_queue_drops_;
     unsigned int processed_control_messages_;
     unsigned int applied_actions_;
     int msqid_;
@@ -41,6 +41,7 @@
 #include "file_signal_source.h"
 #include "fir_filter.h"
 #include "freq_xlating_fir_filter.h"
+#include "fused_signal_conditioner.h"
 #include "galileo_e1_dll_pll_veml_tracking.h"
 #include "galileo_e1_pcps_8ms_ambiguous_acquisition.h"
 #include "galileo_e1_pcps_ambiguous_acquisition.h"
@@ -102,6 +103,7 @@
 #include "notch_filter_lite.h"
 #include "nsr_file_signal_source.h"
 #include "pass_through.h"
+#include "pfb_channelizer_filter.h"
 #include "pulse_blanking_filter.h"
 #include "rtklib_pvt.h"
 #include "rtl_tcp_signal_source.h"
@@ -210,7 +212,7 @@ auto findRole(ConfigurationInterface const* configuration, std::string const& ba
 
 
 std::unique_ptr<SignalSourceInterface> GNSSBlockFactory::GetSignalSource(
-    const ConfigurationInterface* configuration, Concurrent_Queue<pmt::pmt_t>* queue, int ID)
+    const ConfigurationInterface* configuration, Concurrent_Ring_Queue<pmt::pmt_t>* queue, int ID)
 {
     auto role = findRole(configuration, "SignalSource"s, ID);
     auto implementation = configuration->property(role + impl_prop, ""s);
@@ -268,6 +270,22 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetSignalConditioner(
             return conditioner_;
         }
 
+    if (signal_conditioner == "Fused_Conditioner")
+        {
+            if (!data_type_adapter.empty() or !input_filter.empty() or !resampler.empty())
+                {
+                    LOG(WARNING) << "Configuration warning: if " << role_conditioner << impl_prop << "\n"
+                                 << "is set to Fused_Conditioner, the " << role_datatypeadapter << ", "
+                                 << role_inputfilter << " and " << role_resampler << " blocks are not used.\n"
+                                 << "Their configuration parameters will be ignored.";
+                }
+            LOG(INFO) << "Getting " << role_conditioner << " with Fused_Conditioner implementation";
+
+            std::unique_ptr<GNSSBlockInterface> conditioner_ = std::make_unique<FusedSignalConditioner>(configuration, role_conditioner, 1, 1);
+
+            return conditioner_;
+        }
+
     LOG(INFO) << "Getting " << role_conditioner << " with " << role_datatypeadapter << " implementation: "
               << data_type_adapter << ", " << role_inputfilter << " implementation: "
               << input_filter << ", and " << role_resampler << " implementation: "
@@ -370,7 +388,7 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetChannel(
     const ConfigurationInterface* configuration,
     const std::string& signal,
     int channel,
-    Concurrent_Queue<pmt::pmt_t>* queue)
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue)
 {
     // "appendix" is added to the "role" with the aim of Acquisition, Tracking and Telemetry Decoder adapters
     // can find their specific configurations for channels
@@ -439,7 +457,7 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetChannel(
 
 std::unique_ptr<std::vector<std::unique_ptr<GNSSBlockInterface>>> GNSSBlockFactory::GetChannels(
     const ConfigurationInterface* configuration,
-    Concurrent_Queue<pmt::pmt_t>* queue)
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue)
 {
     int channel_absolute_id = 0;
 
@@ -653,7 +671,7 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
     const std::string& role,
     unsigned int in_streams,
     unsigned int out_streams,
-    Concurrent_Queue<pmt::pmt_t>* queue)
+    Concurrent_Ring_Queue<pmt::pmt_t>* queue)
 {
     std::unique_ptr<GNSSBlockInterface> block;
     const std::string implementation = configuration->property(role + impl_prop, "Pass_Through"s);
@@ -864,6 +882,12 @@ std::unique_ptr<GNSSBlockInterface> GNSSBlockFactory::GetBlock(
                         out_streams);
                     block = std::move(block_);
                 }
+            else if (implementation == "Pfb_Channelizer_Filter")
+                {
+                    std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<PfbChannelizerFilter>(configuration, role, in_streams,
+                        out_streams);
+                    block = std::move(block_);
+                }
             else if (implementation == "Notch_Filter")
                 {
                     std::unique_ptr<GNSSBlockInterface> block_ = std::make_unique<NotchFilter>(configuration, role, in_streams,
@@ -37,7 +37,9 @@
 #include "gnss_satellite.h"
 #include "gnss_sdr_make_unique.h"
 #include "gnss_synchro_monitor.h"
+#include "interference_monitor.h"
 #include "nav_message_monitor.h"
+#include "signal_conditioner.h"
 #include "signal_source_interface.h"
 #include <boost/lexical_cast.hpp>    // for boost::lexical_cast
 #include <boost/tokenizer.hpp>       // for boost::tokenizer
@@ -47,7 +49,7 @@
 #include <gnuradio/io_signature.h>   // for io_signature
 #include <gnuradio/top_block.h>      // for top_block, make_top_block
 #include <pmt/pmt_sugar.h>           // for mp
-#include <algorithm>                 // for transform, sort, unique
+#include <algorithm>                 // for max, transform, sort, unique
 #include <cmath>                     // for floor
 #include <cstddef>                   // for size_t
 #include <exception>                 // for exception
@@ -70,7 +72,7 @@
 #define GNSS_SDR_ARRAY_SIGNAL_CONDITIONER_CHANNELS 8
 
 
-GNSSFlowgraph::GNSSFlowgraph(std::shared_ptr<ConfigurationInterface> configuration, std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue)  // NOLINT(performance-unnecessary-value-param)
+GNSSFlowgraph::GNSSFlowgraph(std::shared_ptr<ConfigurationInterface> configuration, std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue)  // NOLINT(performance-unnecessary-value-param)
 {
     connected_ = false;
     running_ = false;
@@ -134,7 +136,7 @@ void GNSSFlowgraph::init()
         }
     if (!sig_conditioner_.empty())
         {
-            signal_conditioner_connected_ = std::vector<bool>(sig_conditioner_.size(), false);
+            signal_conditioner_connected_ = std::vector<std::vector<bool>>(sig_conditioner_.size());
         }
 
     observables_ = block_factory->GetObservables(configuration_.get());
@@ -262,6 +264,20 @@ void GNSSFlowgraph::init()
             udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
             NavDataMonitor_ = nav_message_monitor_make(udp_addr_vec, configuration_->property("NavDataMonitor.port", 1237));
         }
+
+    /*
+     * Instantiate the receiver interference monitor block, if required
+     */
+    enable_interference_monitor_ = configuration_->property("InterferenceMonitor.enable_monitor", false);
+    if (enable_interference_monitor_)
+        {
+            // Retrieve monitor properties
+            std::string address_string = configuration_->property("InterferenceMonitor.client_addresses", std::string("127.0.0.1"));
+            std::vector<std::string> udp_addr_vec = split_string(address_string, '_');
+            std::sort(udp_addr_vec.begin(), udp_addr_vec.end());
+            udp_addr_vec.erase(std::unique(udp_addr_vec.begin(), udp_addr_vec.end()), udp_addr_vec.end());
+            InterferenceMonitor_ = interference_monitor_make(static_cast<int32_t>(sig_conditioner_.size()), udp_addr_vec, configuration_->property("InterferenceMonitor.port", 1238));
+        }
 }
 
 
@@ -1222,6 +1238,8 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
     for (int i = 0; i < channels_count_; i++)
         {
             int selected_signal_conditioner_ID = 0;
+            // Output port (sub-band) of the signal conditioner, for multi-band input filters
+            const int subband_ID = configuration_->property("Channel" + std::to_string(i) + ".subband_ID", 0);
             const bool use_acq_resampler = configuration_->property("GNSS-SDR.use_acquisition_resampler", false);
             const uint32_t fs = configuration_->property("GNSS-SDR.internal_fs_sps", 0);
 
@@ -1287,7 +1305,7 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                             if (acq_fs < fs)
                                 {
                                     // check if the resampler is already created for the channel system/signal and for the specific RF Channel
-                                    const std::string map_key = channels_.at(i)->get_signal().get_signal_str() + std::to_string(selected_signal_conditioner_ID);
+                                    const std::string map_key = channels_.at(i)->get_signal().get_signal_str() + std::to_string(selected_signal_conditioner_ID) + "_" + std::to_string(subband_ID);
                                     resampler_ratio = static_cast<double>(fs) / acq_fs;
                                     int decimation = floor(resampler_ratio);
                                     while (fs % decimation > 0)
@@ -1310,7 +1328,7 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                                             ret = acq_resamplers_.insert(std::pair<std::string, gr::basic_block_sptr>(map_key, fir_filter_ccf_));
                                             if (ret.second == true)
                                                 {
-                                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), subband_ID,
                                                         acq_resamplers_.at(map_key), 0);
                                                     LOG(INFO) << "Created "
                                                               << channels_.at(i)->get_signal().get_signal_str()
@@ -1333,24 +1351,24 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                                         {
                                             LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
                                             // resampler not required!
-                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), subband_ID,
                                                 channels_.at(i)->get_left_block_acq(), 0);
                                         }
                                 }
                             else
                                 {
                                     LOG(INFO) << "Disabled acquisition resampler because the input sampling frequency is too low";
-                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), subband_ID,
                                         channels_.at(i)->get_left_block_acq(), 0);
                                 }
                         }
                     else
                         {
                             LOG(INFO)<<"INSIDE ELSE ";
-                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                            top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), subband_ID,
                                 channels_.at(i)->get_left_block_acq(), 0);
                         }
-                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                    top_block_->connect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), subband_ID,
                         channels_.at(i)->get_left_block_trk(), 0);
                 }
             catch (const std::exception& e)
@@ -1360,8 +1378,14 @@ int GNSSFlowgraph::connect_signal_conditioners_to_channels()
                     return 1;
                 }
 
-            signal_conditioner_connected_.at(selected_signal_conditioner_ID) = true;  // annotate that this signal conditioner is connected
-            DLOG(INFO) << "Signal conditioner " << selected_signal_conditioner_ID << " successfully connected to channel " << i;
+            // annotate that this signal conditioner output is connected
+            auto& connected_ports = signal_conditioner_connected_.at(selected_signal_conditioner_ID);
+            if (connected_ports.size() <= static_cast<size_t>(subband_ID))
+                {
+                    connected_ports.resize(subband_ID + 1, false);
+                }
+            connected_ports.at(subband_ID) = true;
+            DLOG(INFO) << "Signal conditioner " << selected_signal_conditioner_ID << " (sub-band " << subband_ID << ") successfully connected to channel " << i;
         }
     return 0;
 }
@@ -1372,6 +1396,7 @@ int GNSSFlowgraph::disconnect_signal_conditioners_from_channels()
     for (int i = 0; i < channels_count_; i++)
         {
             int selected_signal_conditioner_ID;
+            const int subband_ID = configuration_->property("Channel" + std::to_string(i) + ".subband_ID", 0);
             try
                 {
                     selected_signal_conditioner_ID = configuration_->property("Channel" + std::to_string(i) + ".RF_channel_ID", 0);
@@ -1384,7 +1409,7 @@ int GNSSFlowgraph::disconnect_signal_conditioners_from_channels()
                 }
             try
                 {
-                    top_block_->disconnect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), 0,
+                    top_block_->disconnect(sig_conditioner_.at(selected_signal_conditioner_ID)->get_right_block(), subband_ID,
                         channels_.at(i)->get_left_block_trk(), 0);
                 }
             catch (const std::exception& e)
@@ -1582,6 +1607,56 @@ int GNSSFlowgraph::connect_navdata_monitor()
 }
 
 
+gr::basic_block_sptr GNSSFlowgraph::get_interference_filter(size_t signal_conditioner)
+{
+    // Only the pulse blanking and notch filters publish interference
+    // statistics, either as the input filter of a Signal_Conditioner or
+    // inside a Fused_Conditioner
+    gr::basic_block_sptr block = nullptr;
+    const auto conditioner = std::dynamic_pointer_cast<SignalConditioner>(sig_conditioner_.at(signal_conditioner));
+    if (conditioner != nullptr)
+        {
+            if (conditioner->input_filter() != nullptr)
+                {
+                    block = conditioner->input_filter()->get_right_block();
+                }
+        }
+    else
+        {
+            block = sig_conditioner_.at(signal_conditioner)->get_right_block();
+        }
+    if (block != nullptr and block->has_msg_port(pmt::mp("interference")))
+        {
+            return block;
+        }
+    return nullptr;
+}
+
+
+int GNSSFlowgraph::connect_interference_monitor()
+{
+    try
+        {
+            for (size_t i = 0; i < sig_conditioner_.size(); i++)
+                {
+                    const gr::basic_block_sptr input_filter = get_interference_filter(i);
+                    if (input_filter != nullptr)
+                        {
+                            top_block_->msg_connect(input_filter, pmt::mp("interference"), InterferenceMonitor_, pmt::mp("interference" + std::to_string(i)));
+                        }
+                }
+        }
+    catch (const std::exception& e)
+        {
+            LOG(ERROR) << "Can't connect input filters to Monitor block: " << e.what();
+            top_block_->disconnect_all();
+            return 1;
+        }
+    DLOG(INFO) << "interference monitor successfully connected to input filters";
+    return 0;
+}
+
+
 int GNSSFlowgraph::connect_monitors()
 {
     // GNSS SYNCHRO MONITOR
@@ -1619,6 +1694,15 @@ int GNSSFlowgraph::connect_monitors()
                     return 1;
                 }
         }
+
+    // INTERFERENCE MONITOR
+    if (enable_interference_monitor_)
+        {
+            if (connect_interference_monitor() != 0)
+                {
+                    return 1;
+                }
+        }
     return 0;
 }
 
@@ -1683,6 +1767,17 @@ int GNSSFlowgraph::disconnect_monitors()
                             top_block_->msg_disconnect(gal_e6_has_rx_, pmt::mp("Nav_msg_from_TLM"), NavDataMonitor_, pmt::mp("Nav_msg_from_TLM"));
                         }
                 }
+            if (enable_interference_monitor_)
+                {
+                    for (size_t i = 0; i < sig_conditioner_.size(); i++)
+                        {
+                            const gr::basic_block_sptr input_filter = get_interference_filter(i);
+                            if (input_filter != nullptr)
+                                {
+                                    top_block_->msg_disconnect(input_filter, pmt::mp("interference"), InterferenceMonitor_, pmt::mp("interference" + std::to_string(i)));
+                                }
+                        }
+                }
         }
     catch (const std::exception& e)
         {
@@ -1700,12 +1795,18 @@ void GNSSFlowgraph::check_signal_conditioners()
     // in order to provide configuration flexibility to multiband files or signal sources
     for (size_t n = 0; n < sig_conditioner_.size(); n++)
         {
-            if (signal_conditioner_connected_.at(n) == false)
+            // Multi-band input filters have one output port per sub-band
+            const auto n_ports = static_cast<size_t>(std::max(1, sig_conditioner_.at(n)->get_right_block()->output_signature()->min_streams()));
+            const auto& connected_ports = signal_conditioner_connected_.at(n);
+            for (size_t port = 0; port < n_ports; port++)
                 {
-                    null_sinks_.push_back(gr::blocks::null_sink::make(sizeof(gr_complex)));
-                    top_block_->connect(sig_conditioner_.at(n)->get_right_block(), 0,
-                        null_sinks_.back(), 0);
-                    LOG(INFO) << "Null sink connected to signal conditioner " << n << " due to lack of connection to any channel\n";
+                    if (port >= connected_ports.size() or connected_ports.at(port) == false)
+                        {
+                            null_sinks_.push_back(gr::blocks::null_sink::make(sizeof(gr_complex)));
+                            top_block_->connect(sig_conditioner_.at(n)->get_right_block(), port,
+                                null_sinks_.back(), 0);
+                            LOG(INFO) << "Null sink connected to signal conditioner " << n << " (output " << port << ") due to lack of connection to any channel\n";
+                        }
                 }
         }
 }
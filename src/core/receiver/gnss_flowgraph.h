@@ -25,7 +25,7 @@
 #define GNSS_SDR_GNSS_FLOWGRAPH_H
 
 #include "channel_status_msg_receiver.h"
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "galileo_e6_has_msg_receiver.h"
 #include "gnss_sdr_sample_counter.h"
 #include "gnss_signal.h"
@@ -33,6 +33,7 @@
 #include <gnuradio/blocks/null_sink.h>  // for null_sink
 #include <gnuradio/runtime_types.h>     // for basic_block_sptr, top_block_sptr
 #include <pmt/pmt.h>                    // for pmt_t
+#include <cstddef>                      // for size_t
 #include <list>                         // for list
 #include <map>                          // for map
 #include <memory>                       // for for shared_ptr, dynamic_pointer_cast
@@ -67,7 +68,7 @@ public:
     /*!
      * \brief Constructor that initializes the receiver flow graph
      */
-    GNSSFlowgraph(std::shared_ptr<ConfigurationInterface> configuration, std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue);
+    GNSSFlowgraph(std::shared_ptr<ConfigurationInterface> configuration, std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue);
 
     /*!
      * \brief Destructor
@@ -182,6 +183,7 @@ private:
     int connect_acquisition_monitor();
     int connect_tracking_monitor();
     int connect_navdata_monitor();
+    int connect_interference_monitor();
 
     int disconnect_desktop_flowgraph();
 
@@ -207,6 +209,7 @@ private:
 
     void assign_channels();
     void check_signal_conditioners();
+    gr::basic_block_sptr get_interference_filter(size_t signal_conditioner);  // block of the signal conditioner that publishes interference statistics, if any
 
     void set_signals_list();
     void set_channels_state();  // Initializes the channels state (start acquisition or keep standby)
@@ -227,12 +230,12 @@ private:
     bool is_multiband() const;
 
     std::vector<std::string> split_string(const std::string& s, char delim);
-    std::vector<bool> signal_conditioner_connected_;
+    std::vector<std::vector<bool>> signal_conditioner_connected_;  // per output port
 
     gr::top_block_sptr top_block_;
 
     std::shared_ptr<ConfigurationInterface> configuration_;
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue_;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue_;
 
     std::vector<std::shared_ptr<SignalSourceInterface>> sig_source_;
     std::vector<std::shared_ptr<GNSSBlockInterface>> sig_conditioner_;
@@ -247,6 +250,7 @@ private:
     gr::basic_block_sptr GnssSynchroAcquisitionMonitor_;
     gr::basic_block_sptr GnssSynchroTrackingMonitor_;
     gr::basic_block_sptr NavDataMonitor_;
+    gr::basic_block_sptr InterferenceMonitor_;
     channel_status_msg_receiver_sptr channels_status_;  // class that receives and stores the current status of the receiver channels
     galileo_e6_has_msg_receiver_sptr gal_e6_has_rx_;
 
@@ -307,6 +311,7 @@ private:
     bool enable_acquisition_monitor_;
     bool enable_tracking_monitor_;
     bool enable_navdata_monitor_;
+    bool enable_interference_monitor_;
     bool enable_fpga_offloading_;
 };
 
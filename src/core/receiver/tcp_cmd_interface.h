@@ -19,7 +19,7 @@
 #define GNSS_SDR_TCP_CMD_INTERFACE_H
 
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include <pmt/pmt.h>
 #include <array>
 #include <cstdint>
@@ -44,7 +44,7 @@ public:
     TcpCmdInterface();
     ~TcpCmdInterface() = default;
     void run_cmd_server(int tcp_port);
-    void set_msg_queue(std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue);
+    void set_msg_queue(std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> control_queue);
 
     /*!
      * \brief gets the UTC time parsed from the last TC command issued
@@ -71,7 +71,7 @@ private:
 
     void register_functions();
 
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue_;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> control_queue_;
     std::shared_ptr<PvtInterface> PVT_sptr_;
 
     float rx_latitude_;
@@ -35,6 +35,7 @@
 // #include "GPS_CNAV.h"
 #include "MATH_CONSTANTS.h"
 #include "gnss_frequencies.h"
+#include "nav_message_field.h"
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -90,6 +91,7 @@ constexpr int32_t IRNSS_L5_WORD_LENGTH = 4;
 constexpr int32_t IRNSS_L5_SUBFRAME_LENGTH = 40;                                                                                     //!< IRNSS_L5_WORD_LENGTH x 10 = 40 bytes
 constexpr int32_t IRNSS_L5_SUBFRAME_BITS = 600; 
 constexpr int32_t IRNSS_L5_DATAFRAME_BITS = 292;                                                                                        //!< Number of bits per subframe in the NAV message [bits]
+constexpr int32_t IRNSS_L5_DATAFRAME_WORDS = (IRNSS_L5_DATAFRAME_BITS + 63) / 64;                                                  //!< Number of 64-bit words needed to store a packed subframe
 constexpr int32_t IRNSS_L5_SUBFRAME_SECONDS = 12;                                                                                     //!< Subframe duration [seconds]
 constexpr int32_t IRNSS_L5_SUBFRAME_MS = 12000;                                                                                       //!< Subframe duration [seconds]
 constexpr int32_t IRNSS_L5_WORD_BITS = 30;                                                                                           //!< Number of bits per word in the NAV message [bits]
@@ -101,127 +103,128 @@ constexpr char IRNSS_L5_PREAMBLE_SYMBOLS_STR[33] = "1111110011001111110000110000
 
 // SUBFRAME 1-5 (TLM and HOW)
 
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_TOW({{9, 17}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_ALERT_FLAG({{26, 1}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_AUTO_NAV({{27, 1}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_SUBFRAME_ID({{28, 2}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_CRC({{263, 24}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_TAIL({{287, 6}});
+constexpr Nav_Message_Field IRNSS_TOW(9, 17);
+constexpr Nav_Message_Field IRNSS_ALERT_FLAG(26, 1);
+constexpr Nav_Message_Field IRNSS_AUTO_NAV(27, 1);
+constexpr Nav_Message_Field IRNSS_SUBFRAME_ID(28, 2);
+constexpr Nav_Message_Field IRNSS_CRC(263, 24);
+constexpr uint32_t IRNSS_L5_CRC_DATA_BITS = 262;  //!< Bits 1 to 262 of the subframe are protected by the CRC
+constexpr Nav_Message_Field IRNSS_TAIL(287, 6);
 
 // SUBFRAME 1
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_WEEK({{31, 10}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_A_F0({{41, 22}});
+constexpr Nav_Message_Field IRNSS_WEEK(31, 10);
 constexpr double IRNSS_A_F0_LSB = TWO_N31;  
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_A_F1({{63, 16}});
+constexpr Nav_Message_Field IRNSS_A_F0 = signed_nav_field(41, 22, IRNSS_A_F0_LSB);
 constexpr double IRNSS_A_F1_LSB = TWO_N43;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_A_F2({{79, 8}});
+constexpr Nav_Message_Field IRNSS_A_F1 = signed_nav_field(63, 16, IRNSS_A_F1_LSB);
 constexpr double IRNSS_A_F2_LSB = TWO_N55;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_SV_ACCURACY({{87, 4}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_T_OC({{91, 16}});
+constexpr Nav_Message_Field IRNSS_A_F2 = signed_nav_field(79, 8, IRNSS_A_F2_LSB);
+constexpr Nav_Message_Field IRNSS_SV_ACCURACY(87, 4);
 constexpr int32_t IRNSS_T_OC_LSB = static_cast<int32_t>(TWO_P4);
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_T_GD({{107, 8}});
+constexpr Nav_Message_Field IRNSS_T_OC(91, 16, IRNSS_T_OC_LSB);
 constexpr double IRNSS_T_GD_LSB = TWO_N31;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_DELTA_N({{115, 22}});
+constexpr Nav_Message_Field IRNSS_T_GD = signed_nav_field(107, 8, IRNSS_T_GD_LSB);
 constexpr double IRNSS_DELTA_N_LSB = PI_TWO_N41;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_IODC({{137, 8}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_L5_FLAG({{155, 1}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_S_FLAG({{156, 1}});
+constexpr Nav_Message_Field IRNSS_DELTA_N = signed_nav_field(115, 22, IRNSS_DELTA_N_LSB);
+constexpr Nav_Message_Field IRNSS_IODC(137, 8);
+constexpr Nav_Message_Field IRNSS_L5_FLAG(155, 1);
+constexpr Nav_Message_Field IRNSS_S_FLAG(156, 1);
 
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_C_UC({{157, 15}});
 constexpr double IRNSS_C_UC_LSB = TWO_N28;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_C_US({{172, 15}});
+constexpr Nav_Message_Field IRNSS_C_UC = signed_nav_field(157, 15, IRNSS_C_UC_LSB);
 constexpr double IRNSS_C_US_LSB = TWO_N28;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_C_IC({{187, 15}});
+constexpr Nav_Message_Field IRNSS_C_US = signed_nav_field(172, 15, IRNSS_C_US_LSB);
 constexpr double IRNSS_C_IC_LSB = TWO_N28;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_C_IS({{202, 15}});
+constexpr Nav_Message_Field IRNSS_C_IC = signed_nav_field(187, 15, IRNSS_C_IC_LSB);
 constexpr double IRNSS_C_IS_LSB = TWO_N28;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_C_RC({{217, 15}});
+constexpr Nav_Message_Field IRNSS_C_IS = signed_nav_field(202, 15, IRNSS_C_IS_LSB);
 constexpr double IRNSS_C_RC_LSB = TWO_N4;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_C_RS({{232, 15}});
+constexpr Nav_Message_Field IRNSS_C_RC = signed_nav_field(217, 15, IRNSS_C_RC_LSB);
 constexpr double IRNSS_C_RS_LSB = TWO_N4;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_I_DOT({{247, 14}});
+constexpr Nav_Message_Field IRNSS_C_RS = signed_nav_field(232, 15, IRNSS_C_RS_LSB);
 constexpr double IRNSS_I_DOT_LSB = PI_TWO_N43;
+constexpr Nav_Message_Field IRNSS_I_DOT = signed_nav_field(247, 14, IRNSS_I_DOT_LSB);
 
 
 // SUBFRAME 2
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_M_0({{31, 32}});
 constexpr double IRNSS_M_0_LSB = PI_TWO_N31;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_T_OE({{63, 16}});
+constexpr Nav_Message_Field IRNSS_M_0 = signed_nav_field(31, 32, IRNSS_M_0_LSB);
 constexpr int32_t IRNSS_T_OE_LSB = static_cast<int32_t>(TWO_P4);
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_ECCENTRICITY({{79, 32}});
+constexpr Nav_Message_Field IRNSS_T_OE(63, 16, IRNSS_T_OE_LSB);
 constexpr double IRNSS_ECCENTRICITY_LSB = TWO_N33;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_SQRT_A({{111, 32}});
+constexpr Nav_Message_Field IRNSS_ECCENTRICITY(79, 32, IRNSS_ECCENTRICITY_LSB);
 constexpr double IRNSS_SQRT_A_LSB = TWO_N19;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_OMEGA_0({{143, 32}});
+constexpr Nav_Message_Field IRNSS_SQRT_A(111, 32, IRNSS_SQRT_A_LSB);
 constexpr double IRNSS_OMEGA_0_LSB = PI_TWO_N31;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_OMEGA({{143, 32}});
+constexpr Nav_Message_Field IRNSS_OMEGA_0 = signed_nav_field(143, 32, IRNSS_OMEGA_0_LSB);
 constexpr double IRNSS_OMEGA_LSB = PI_TWO_N31;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_OMEGA_DOT({{207, 22}});
+constexpr Nav_Message_Field IRNSS_OMEGA = signed_nav_field(143, 32, IRNSS_OMEGA_LSB);
 constexpr double IRNSS_OMEGA_DOT_LSB = PI_TWO_N41;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_I_0({{229, 32}});
+constexpr Nav_Message_Field IRNSS_OMEGA_DOT = signed_nav_field(207, 22, IRNSS_OMEGA_DOT_LSB);
 constexpr double IRNSS_I_0_LSB = PI_TWO_N31;
+constexpr Nav_Message_Field IRNSS_I_0 = signed_nav_field(229, 32, IRNSS_I_0_LSB);
 
 
 // SUBFRAME 3-4
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_SV_DATA_ID({{31, 6}});
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_SV_PAGE({{257, 6}});
+constexpr Nav_Message_Field IRNSS_SV_DATA_ID(31, 6);
+constexpr Nav_Message_Field IRNSS_SV_PAGE(257, 6);
 
 
 // SUBFRAME 3-4
 // MESSAGE TYPE-9
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_A_0({{37, 16}});
 constexpr double IRNSS_A_0_LSB = TWO_N35;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_A_1({{53, 13}});
+constexpr Nav_Message_Field IRNSS_A_0 = signed_nav_field(37, 16, IRNSS_A_0_LSB);
 constexpr double IRNSS_A_1_LSB = TWO_N51;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_A_2({{66, 7}});
+constexpr Nav_Message_Field IRNSS_A_1 = signed_nav_field(53, 13, IRNSS_A_1_LSB);
 constexpr double IRNSS_A_2_LSB = TWO_N68;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_DELTAT_LS({{73, 8}});
+constexpr Nav_Message_Field IRNSS_A_2 = signed_nav_field(66, 7, IRNSS_A_2_LSB);
 constexpr double IRNSS_DELTAT_LS_LSB = 1;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_T_OT({{81, 16}});
+constexpr Nav_Message_Field IRNSS_DELTAT_LS = signed_nav_field(73, 8, IRNSS_DELTAT_LS_LSB);
 constexpr double IRNSS_T_OT_LSB = TWO_P4;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_WN_T({{97, 10}});
+constexpr Nav_Message_Field IRNSS_T_OT(81, 16, IRNSS_T_OT_LSB);
 constexpr double IRNSS_WN_T_LSB = 1;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_WN_LSF({{107, 10}});
+constexpr Nav_Message_Field IRNSS_WN_T(97, 10, IRNSS_WN_T_LSB);
 constexpr double IRNSS_WN_LSF_LSB = 1;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_DN({{117, 4}});
+constexpr Nav_Message_Field IRNSS_WN_LSF(107, 10, IRNSS_WN_LSF_LSB);
 constexpr double IRNSS_DN_LSB = 1;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_DELTAT_LSF({{121, 8}});
+constexpr Nav_Message_Field IRNSS_DN(117, 4, IRNSS_DN_LSB);
 constexpr double IRNSS_DELTAT_LSF_LSB = 1;
+constexpr Nav_Message_Field IRNSS_DELTAT_LSF = signed_nav_field(121, 8, IRNSS_DELTAT_LSF_LSB);
 
 // MESSAGE TYPE-11
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_T_EOP({{37, 16}});
 constexpr double IRNSS_T_EOP_LSB = TWO_P4;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_PM_X({{53, 21}});
+constexpr Nav_Message_Field IRNSS_T_EOP(37, 16, IRNSS_T_EOP_LSB);
 constexpr double IRNSS_PM_X_LSB = TWO_N20;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_PM_X_DOT({{74, 15}});
+constexpr Nav_Message_Field IRNSS_PM_X = signed_nav_field(53, 21, IRNSS_PM_X_LSB);
 constexpr double IRNSS_PM_X_DOT_LSB = TWO_N21;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_PM_Y({{89, 21}});
+constexpr Nav_Message_Field IRNSS_PM_X_DOT = signed_nav_field(74, 15, IRNSS_PM_X_DOT_LSB);
 constexpr double IRNSS_PM_Y_LSB = TWO_N20;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_PM_Y_DOT({{110, 15}});
+constexpr Nav_Message_Field IRNSS_PM_Y = signed_nav_field(89, 21, IRNSS_PM_Y_LSB);
 constexpr double IRNSS_PM_Y_DOT_LSB = TWO_N21;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_DELTA_UT1({{125, 31}});
+constexpr Nav_Message_Field IRNSS_PM_Y_DOT = signed_nav_field(110, 15, IRNSS_PM_Y_DOT_LSB);
 constexpr double IRNSS_DELTA_UT1_LSB = TWO_N24;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_DELTA_UT1_DOT({{156, 19}});
+constexpr Nav_Message_Field IRNSS_DELTA_UT1 = signed_nav_field(125, 31, IRNSS_DELTA_UT1_LSB);
 constexpr double IRNSS_DELTA_UT1_DOT_LSB = TWO_N25;
+constexpr Nav_Message_Field IRNSS_DELTA_UT1_DOT = signed_nav_field(156, 19, IRNSS_DELTA_UT1_DOT_LSB);
 
 
 
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_ALPHA_0({{175, 8}});
 constexpr double IRNSS_ALPHA_0_LSB = TWO_N30;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_ALPHA_1({{183, 8}});
+constexpr Nav_Message_Field IRNSS_ALPHA_0 = signed_nav_field(175, 8, IRNSS_ALPHA_0_LSB);
 constexpr double IRNSS_ALPHA_1_LSB = TWO_N27;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_ALPHA_2({{191, 8}});
+constexpr Nav_Message_Field IRNSS_ALPHA_1 = signed_nav_field(183, 8, IRNSS_ALPHA_1_LSB);
 constexpr double IRNSS_ALPHA_2_LSB = TWO_N24;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_ALPHA_3({{199, 8}});
+constexpr Nav_Message_Field IRNSS_ALPHA_2 = signed_nav_field(191, 8, IRNSS_ALPHA_2_LSB);
 constexpr double IRNSS_ALPHA_3_LSB = TWO_N24;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_BETA_0({{207, 8}});
+constexpr Nav_Message_Field IRNSS_ALPHA_3 = signed_nav_field(199, 8, IRNSS_ALPHA_3_LSB);
 constexpr double IRNSS_BETA_0_LSB = TWO_P11;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_BETA_1({{215, 8}});
+constexpr Nav_Message_Field IRNSS_BETA_0 = signed_nav_field(207, 8, IRNSS_BETA_0_LSB);
 constexpr double IRNSS_BETA_1_LSB = TWO_P14;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_BETA_2({{223, 8}});
+constexpr Nav_Message_Field IRNSS_BETA_1 = signed_nav_field(215, 8, IRNSS_BETA_1_LSB);
 constexpr double IRNSS_BETA_2_LSB = TWO_P16;
-const std::vector<std::pair<int32_t, int32_t>> IRNSS_BETA_3({{231, 8}});
+constexpr Nav_Message_Field IRNSS_BETA_2 = signed_nav_field(223, 8, IRNSS_BETA_2_LSB);
 constexpr double IRNSS_BETA_3_LSB = TWO_P16;
+constexpr Nav_Message_Field IRNSS_BETA_3 = signed_nav_field(231, 8, IRNSS_BETA_3_LSB);
 
 
 
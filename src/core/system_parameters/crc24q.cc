@@ -0,0 +1,144 @@
+/*!
+ * \file crc24q.cc
+ * \brief Table-driven CRC-24Q, as used by the IRNSS, Galileo I/NAV, F/NAV,
+ * C/NAV and GPS CNAV navigation messages.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "crc24q.h"
+
+
+namespace
+{
+constexpr uint32_t CRC24Q_POLY = 0x864CFBU;  // 0x1864CFB without the implicit x^24 term
+constexpr uint32_t CRC24Q_MASK = 0xFFFFFFU;
+
+using Crc24q_Tables = std::array<std::array<uint32_t, 256>, 8>;
+
+// tables[k][b] is the CRC of byte b followed by k zero bytes
+Crc24q_Tables make_crc24q_tables()
+{
+    Crc24q_Tables tables{};
+    for (uint32_t b = 0; b < 256; b++)
+        {
+            uint32_t crc = b << 16U;
+            for (int32_t bit = 0; bit < 8; bit++)
+                {
+                    crc <<= 1U;
+                    if (crc & 0x1000000U)
+                        {
+                            crc ^= CRC24Q_POLY;
+                        }
+                }
+            tables[0][b] = crc & CRC24Q_MASK;
+        }
+    for (size_t k = 1; k < 8; k++)
+        {
+            for (uint32_t b = 0; b < 256; b++)
+                {
+                    const uint32_t prev = tables[k - 1][b];
+                    tables[k][b] = ((prev << 8U) & CRC24Q_MASK) ^ tables[0][(prev >> 16U) & 0xFFU];
+                }
+        }
+    return tables;
+}
+
+
+const Crc24q_Tables CRC24Q_TABLES = make_crc24q_tables();
+
+
+// One step of the slicing-by-8 algorithm, b0 being the first byte
+inline uint32_t crc24q_step(uint32_t crc, uint32_t b0, uint32_t b1, uint32_t b2, uint32_t b3,
+    uint32_t b4, uint32_t b5, uint32_t b6, uint32_t b7)
+{
+    const auto& t = CRC24Q_TABLES;
+    // The 24-bit register only overlaps the first three bytes of the block
+    return t[7][b0 ^ ((crc >> 16U) & 0xFFU)] ^
+           t[6][b1 ^ ((crc >> 8U) & 0xFFU)] ^
+           t[5][b2 ^ (crc & 0xFFU)] ^
+           t[4][b3] ^
+           t[3][b4] ^
+           t[2][b5] ^
+           t[1][b6] ^
+           t[0][b7];
+}
+
+
+// Feeds the num_bits least significant bits of bits, most significant first
+uint32_t crc24q_bits(uint64_t bits, uint32_t num_bits, uint32_t crc)
+{
+    for (uint32_t i = num_bits; i > 0; i--)
+        {
+            const uint32_t feedback = ((crc >> 23U) ^ static_cast<uint32_t>(bits >> (i - 1U))) & 1U;
+            crc = (crc << 1U) & CRC24Q_MASK;
+            if (feedback)
+                {
+                    crc ^= CRC24Q_POLY;
+                }
+        }
+    return crc;
+}
+}  // namespace
+
+
+uint32_t crc24q_bytewise(const uint8_t* data, size_t num_bytes, uint32_t crc)
+{
+    const auto& table = CRC24Q_TABLES[0];
+    for (size_t i = 0; i < num_bytes; i++)
+        {
+            crc = ((crc << 8U) & CRC24Q_MASK) ^ table[((crc >> 16U) ^ data[i]) & 0xFFU];
+        }
+    return crc;
+}
+
+
+uint32_t crc24q(const uint8_t* data, size_t num_bytes, uint32_t crc)
+{
+    crc &= CRC24Q_MASK;
+    while (num_bytes >= 8)
+        {
+            crc = crc24q_step(crc, data[0], data[1], data[2], data[3], data[4], data[5], data[6], data[7]);
+            data += 8;
+            num_bytes -= 8;
+        }
+    return crc24q_bytewise(data, num_bytes, crc);
+}
+
+
+uint32_t crc24q_packed(const uint64_t* words, uint32_t num_bits)
+{
+    uint32_t crc = 0U;
+    const uint32_t num_words = num_bits / 64U;
+    for (uint32_t i = 0; i < num_words; i++)
+        {
+            const uint64_t w = words[i];
+            crc = crc24q_step(crc, (w >> 56U) & 0xFFU, (w >> 48U) & 0xFFU, (w >> 40U) & 0xFFU, (w >> 32U) & 0xFFU,
+                (w >> 24U) & 0xFFU, (w >> 16U) & 0xFFU, (w >> 8U) & 0xFFU, w & 0xFFU);
+        }
+    const uint32_t remaining_bits = num_bits % 64U;
+    if (remaining_bits == 0U)
+        {
+            return crc;
+        }
+
+    // Whole bytes of the last word, then the remaining bits
+    const uint64_t last = words[num_words];
+    const auto& table = CRC24Q_TABLES[0];
+    uint32_t shift = 56U;
+    for (uint32_t i = 0; i < remaining_bits / 8U; i++)
+        {
+            crc = ((crc << 8U) & CRC24Q_MASK) ^ table[((crc >> 16U) ^ static_cast<uint32_t>(last >> shift)) & 0xFFU];
+            shift -= 8U;
+        }
+    const uint32_t tail = remaining_bits % 8U;
+    return crc24q_bits(last >> (shift + 8U - tail), tail, crc);
+}
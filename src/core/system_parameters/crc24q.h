@@ -0,0 +1,90 @@
+/*!
+ * \file crc24q.h
+ * \brief Table-driven CRC-24Q, as used by the IRNSS, Galileo I/NAV, F/NAV,
+ * C/NAV and GPS CNAV navigation messages.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+
+#ifndef GNSS_SDR_CRC24Q_H
+#define GNSS_SDR_CRC24Q_H
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Computes the CRC-24Q (generator polynomial 0x1864CFB, no reflection,
+ * no final XOR) of \a num_bytes bytes, processing eight bytes per step with
+ * the slicing-by-8 algorithm. \a crc is the value to start from, allowing
+ * incremental computations.
+ */
+uint32_t crc24q(const uint8_t* data, size_t num_bytes, uint32_t crc = 0U);
+
+/*!
+ * \brief Same as crc24q(), but processing one byte per step. Kept as a
+ * reference implementation.
+ */
+uint32_t crc24q_bytewise(const uint8_t* data, size_t num_bytes, uint32_t crc = 0U);
+
+
+/*!
+ * \brief Computes the CRC-24Q of the first \a num_bits bits of a message
+ * packed MSB first in 64-bit words (see nav_message_field.h), eight bytes
+ * per step. Since the register starts at zero, this is the same as padding
+ * with zeros at the start messages that are not a whole number of bytes.
+ */
+uint32_t crc24q_packed(const uint64_t* words, uint32_t num_bits);
+
+
+/*!
+ * \brief Computes the CRC-24Q of the first \a num_bits bits of a message
+ * packed MSB first in 64-bit words.
+ */
+template <size_t N>
+uint32_t crc24q(const std::array<uint64_t, N>& words, uint32_t num_bits)
+{
+    return crc24q_packed(words.data(), num_bits);
+}
+
+
+/*!
+ * \brief Computes the CRC-24Q of a message stored in a std::bitset, where
+ * bits[N - 1] is the first transmitted bit. Messages that are not a whole
+ * number of bytes are padded with zeros at the start.
+ */
+template <size_t N>
+uint32_t crc24q(const std::bitset<N>& bits)
+{
+    constexpr size_t num_bytes = (N + 7) / 8;
+    std::array<uint8_t, num_bytes> bytes{};
+    for (size_t i = 0; i < N; i++)
+        {
+            if (bits[i])
+                {
+                    bytes[num_bytes - 1 - i / 8] |= static_cast<uint8_t>(1U << (i % 8));
+                }
+        }
+    return crc24q(bytes.data(), num_bytes);
+}
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_CRC24Q_H
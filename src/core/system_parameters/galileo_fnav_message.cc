@@ -21,14 +21,9 @@
  */
 
 #include "galileo_fnav_message.h"
-#include <boost/crc.hpp>  // for boost::crc_basic, boost::crc_optimal
-#include <boost/dynamic_bitset.hpp>
+#include "crc24q.h"
 #include <glog/logging.h>
-#include <algorithm>  // for reverse
-#include <iostream>   // for string, operator<<
-#include <iterator>   // for back_insert_iterator
-
-using CRC_Galileo_FNAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
+#include <iostream>  // for string, operator<<
 
 
 void Galileo_Fnav_Message::split_page(const std::string& page_string)
@@ -52,29 +47,7 @@ void Galileo_Fnav_Message::split_page(const std::string& page_string)
 
 bool Galileo_Fnav_Message::_CRC_test(const std::bitset<GALILEO_FNAV_DATA_FRAME_BITS>& bits, uint32_t checksum) const
 {
-    CRC_Galileo_FNAV_type CRC_Galileo;
-
-    // Galileo FNAV frame for CRC is not an integer multiple of bytes
-    // it needs to be filled with zeroes at the start of the frame.
-    // This operation is done in the transformation from bits to bytes
-    // using boost::dynamic_bitset.
-    // ToDo: Use boost::dynamic_bitset for all the bitset operations in this class
-
-    boost::dynamic_bitset<uint8_t> frame_bits(std::string(bits.to_string()));
-
-    std::vector<uint8_t> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    CRC_Galileo.process_bytes(bytes.data(), GALILEO_FNAV_DATA_FRAME_BYTES);
-
-    const uint32_t crc_computed = CRC_Galileo.checksum();
-    if (checksum == crc_computed)
-        {
-            return true;
-        }
-
-    return false;
+    return crc24q(bits) == checksum;
 }
 
 
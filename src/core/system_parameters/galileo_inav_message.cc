@@ -17,18 +17,14 @@
  */
 
 #include "galileo_inav_message.h"
+#include "crc24q.h"
 #include "galileo_reduced_ced.h"
 #include "reed_solomon.h"
-#include <boost/crc.hpp>             // for boost::crc_basic, boost::crc_optimal
-#include <boost/dynamic_bitset.hpp>  // for boost::dynamic_bitset
-#include <glog/logging.h>            // for DLOG
-#include <algorithm>                 // for reverse
-#include <iostream>                  // for operator<<
-#include <limits>                    // for std::numeric_limits
-#include <numeric>                   // for std::accumulate
-
-
-using CRC_Galileo_INAV_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
+#include <glog/logging.h>  // for DLOG
+#include <iostream>        // for operator<<
+#include <limits>          // for std::numeric_limits
+#include <numeric>         // for std::accumulate
+#include <sstream>         // for std::stringstream
 
 
 Galileo_Inav_Message::Galileo_Inav_Message()
@@ -46,28 +42,7 @@ Galileo_Inav_Message::~Galileo_Inav_Message() = default;
 
 bool Galileo_Inav_Message::CRC_test(const std::bitset<GALILEO_DATA_FRAME_BITS>& bits, uint32_t checksum) const
 {
-    CRC_Galileo_INAV_type CRC_Galileo;
-
-    // Galileo INAV frame for CRC is not an integer multiple of bytes
-    // it needs to be filled with zeroes at the start of the frame.
-    // This operation is done in the transformation from bits to bytes
-    // using boost::dynamic_bitset.
-    // ToDo: Use boost::dynamic_bitset for all the bitset operations in this class
-
-    boost::dynamic_bitset<unsigned char> frame_bits(std::string(bits.to_string()));
-
-    std::vector<unsigned char> bytes;
-    boost::to_block_range(frame_bits, std::back_inserter(bytes));
-    std::reverse(bytes.begin(), bytes.end());
-
-    CRC_Galileo.process_bytes(bytes.data(), GALILEO_DATA_FRAME_BYTES);
-
-    const uint32_t crc_computed = CRC_Galileo.checksum();
-    if (checksum == crc_computed)
-        {
-            return true;
-        }
-    return false;
+    return crc24q(bits) == checksum;
 }
 
 
@@ -0,0 +1,137 @@
+/*!
+ * \file gnss_signal_id.h
+ * \brief Compact identifier of the GNSS signals processed by the receiver
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_GNSS_SIGNAL_ID_H
+#define GNSS_SDR_GNSS_SIGNAL_ID_H
+
+#include <cstdint>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Identifier of a signal, obtained from the system and two-character
+ * signal codes without building strings. Useful to index per-signal tables
+ * and to dispatch with switch statements in per-epoch code.
+ */
+enum class Gnss_Signal_Id : uint8_t
+{
+    UNKNOWN = 0,
+    GPS_1C,
+    GPS_2S,
+    GPS_L5,
+    SBAS_1C,
+    GAL_1B,
+    GAL_5X,
+    GAL_7X,
+    GAL_E6,
+    GLO_1G,
+    GLO_2G,
+    BDS_B1,
+    BDS_B2,
+    BDS_B3,
+    IRN_1I,
+    NUM_SIGNAL_IDS
+};
+
+
+/*!
+ * \brief Returns the identifier of the signal with system code \a system
+ * ('G', 'S', 'E', 'R', 'C' or 'I') and signal code \a signal ("1C", "2S",
+ * "L5", "1B", "5X", "7X", "E6", "1G", "2G", "B1", "B2", "B3" or "1I"), or
+ * Gnss_Signal_Id::UNKNOWN.
+ */
+inline Gnss_Signal_Id gnss_signal_id(char system, const char* signal)
+{
+    const auto code = static_cast<uint16_t>((static_cast<uint8_t>(signal[0]) << 8) | static_cast<uint8_t>(signal[1]));
+    switch (system)
+        {
+        case 'G':
+            switch (code)
+                {
+                case ('1' << 8) | 'C':
+                    return Gnss_Signal_Id::GPS_1C;
+                case ('2' << 8) | 'S':
+                    return Gnss_Signal_Id::GPS_2S;
+                case ('L' << 8) | '5':
+                    return Gnss_Signal_Id::GPS_L5;
+                default:
+                    break;
+                }
+            break;
+        case 'S':
+            if (code == (('1' << 8) | 'C'))
+                {
+                    return Gnss_Signal_Id::SBAS_1C;
+                }
+            break;
+        case 'E':
+            switch (code)
+                {
+                case ('1' << 8) | 'B':
+                    return Gnss_Signal_Id::GAL_1B;
+                case ('5' << 8) | 'X':
+                    return Gnss_Signal_Id::GAL_5X;
+                case ('7' << 8) | 'X':
+                    return Gnss_Signal_Id::GAL_7X;
+                case ('E' << 8) | '6':
+                    return Gnss_Signal_Id::GAL_E6;
+                default:
+                    break;
+                }
+            break;
+        case 'R':
+            switch (code)
+                {
+                case ('1' << 8) | 'G':
+                    return Gnss_Signal_Id::GLO_1G;
+                case ('2' << 8) | 'G':
+                    return Gnss_Signal_Id::GLO_2G;
+                default:
+                    break;
+                }
+            break;
+        case 'C':
+            switch (code)
+                {
+                case ('B' << 8) | '1':
+                    return Gnss_Signal_Id::BDS_B1;
+                case ('B' << 8) | '2':
+                    return Gnss_Signal_Id::BDS_B2;
+                case ('B' << 8) | '3':
+                    return Gnss_Signal_Id::BDS_B3;
+                default:
+                    break;
+                }
+            break;
+        case 'I':
+            if (code == (('1' << 8) | 'I'))
+                {
+                    return Gnss_Signal_Id::IRN_1I;
+                }
+            break;
+        default:
+            break;
+        }
+    return Gnss_Signal_Id::UNKNOWN;
+}
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_GNSS_SIGNAL_ID_H
@@ -11,7 +11,7 @@
  * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
  * This file is part of GNSS-SDR.
  *
- * Copyright (C) 2010-2020  (see AUTHORS file for a list of contributors)
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
  * SPDX-License-Identifier: GPL-3.0-or-later
  *
  * -----------------------------------------------------------------------------
@@ -20,9 +20,10 @@
 #ifndef GNSS_SDR_GNSS_SYNCHRO_H
 #define GNSS_SDR_GNSS_SYNCHRO_H
 
+#include "gnss_signal_id.h"
 #include <boost/serialization/nvp.hpp>
 #include <cstdint>
-#include <utility>
+#include <type_traits>
 
 /** \addtogroup Core
  * \{ */
@@ -34,135 +35,61 @@
 /*!
  * \brief This is the class that contains the information that is shared
  * by the processing blocks.
+ *
+ * It is trivially copyable, so GNU Radio buffers, containers and histories
+ * move it with plain memory copies. The members updated at every epoch are
+ * packed together in the first two cache lines, and the acquisition results,
+ * written once per acquisition, go last. Signal is still a null-terminated
+ * two-character code ("1C", "2S", "1B", ...), so that existing code can keep
+ * using it as a C string. The serialization order of serialize() does not
+ * depend on this layout.
  */
 class Gnss_Synchro
 {
 public:
-    Gnss_Synchro() = default;  //!< Default constructor
-
-    ~Gnss_Synchro() = default;  //!< Default destructor
-
     // Satellite and signal info
-    char System{};         //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
-    char Signal[3]{};      //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
-    uint32_t PRN{};        //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
-    int32_t Channel_ID{};  //!< Set by Channel constructor
-
-    // Acquisition
-    double Acq_delay_samples{};          //!< Set by Acquisition processing block
-    double Acq_doppler_hz{};             //!< Set by Acquisition processing block
-    uint64_t Acq_samplestamp_samples{};  //!< Set by Acquisition processing block
-    uint32_t Acq_doppler_step{};         //!< Set by Acquisition processing block
+    char System{};                        //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
+    char Signal[3]{};                     //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
+    uint32_t PRN{};                       //!< Set by Channel::set_signal(Gnss_Signal gnss_signal)
+    int32_t Channel_ID{};                 //!< Set by Channel constructor
+    uint32_t TOW_at_current_symbol_ms{};  //!< Set by Telemetry Decoder processing block
 
     // Tracking
+    uint64_t Tracking_sample_counter{};  //!< Set by Tracking processing block
     int64_t fs{};                        //!< Set by Tracking processing block
-    double Prompt_I{};                   //!< Set by Tracking processing block
-    double Prompt_Q{};                   //!< Set by Tracking processing block
-    double CN0_dB_hz{};                  //!< Set by Tracking processing block
-    double Carrier_Doppler_hz{};         //!< Set by Tracking processing block
     double Carrier_phase_rads{};         //!< Set by Tracking processing block
+    double Carrier_Doppler_hz{};         //!< Set by Tracking processing block
     double Code_phase_samples{};         //!< Set by Tracking processing block
-    uint64_t Tracking_sample_counter{};  //!< Set by Tracking processing block
-    int32_t correlation_length_ms{};     //!< Set by Tracking processing block
-
-    // Telemetry Decoder
-    uint32_t TOW_at_current_symbol_ms{};  //!< Set by Telemetry Decoder processing block
+    double CN0_dB_hz{};                  //!< Set by Tracking processing block
+    double Prompt_I{};                   //!< Set by Tracking processing block
+    double Prompt_Q{};                   //!< Set by Tracking processing block
 
     // Observables
     double Pseudorange_m{};  //!< Set by Observables processing block
     double RX_time{};        //!< Set by Observables processing block
     double interp_TOW_ms{};  //!< Set by Observables processing block
 
+    int32_t correlation_length_ms{};  //!< Set by Tracking processing block
+
     // Flags
     bool Flag_valid_acquisition{};    //!< Set by Acquisition processing block
     bool Flag_valid_symbol_output{};  //!< Set by Tracking processing block
     bool Flag_valid_word{};           //!< Set by Telemetry Decoder processing block
     bool Flag_valid_pseudorange{};    //!< Set by Observables processing block
 
-    /// Copy constructor
-    Gnss_Synchro(const Gnss_Synchro& other) noexcept
-    {
-        *this = other;
-    };
-
-    /// Copy assignment operator
-    Gnss_Synchro& operator=(const Gnss_Synchro& rhs) noexcept
-    {
-        // Only do assignment if RHS is a different object from this.
-        if (this != &rhs)
-            {
-                this->System = rhs.System;
-                this->Signal[0] = rhs.Signal[0];
-                this->Signal[1] = rhs.Signal[1];
-                this->Signal[2] = rhs.Signal[2];
-                this->PRN = rhs.PRN;
-                this->Channel_ID = rhs.Channel_ID;
-                this->Acq_delay_samples = rhs.Acq_delay_samples;
-                this->Acq_doppler_hz = rhs.Acq_doppler_hz;
-                this->Acq_samplestamp_samples = rhs.Acq_samplestamp_samples;
-                this->Acq_doppler_step = rhs.Acq_doppler_step;
-                this->fs = rhs.fs;
-                this->Prompt_I = rhs.Prompt_I;
-                this->Prompt_Q = rhs.Prompt_Q;
-                this->CN0_dB_hz = rhs.CN0_dB_hz;
-                this->Carrier_Doppler_hz = rhs.Carrier_Doppler_hz;
-                this->Carrier_phase_rads = rhs.Carrier_phase_rads;
-                this->Code_phase_samples = rhs.Code_phase_samples;
-                this->Tracking_sample_counter = rhs.Tracking_sample_counter;
-                this->correlation_length_ms = rhs.correlation_length_ms;
-                this->TOW_at_current_symbol_ms = rhs.TOW_at_current_symbol_ms;
-                this->Pseudorange_m = rhs.Pseudorange_m;
-                this->RX_time = rhs.RX_time;
-                this->interp_TOW_ms = rhs.interp_TOW_ms;
-                this->Flag_valid_acquisition = rhs.Flag_valid_acquisition;
-                this->Flag_valid_symbol_output = rhs.Flag_valid_symbol_output;
-                this->Flag_valid_word = rhs.Flag_valid_word;
-                this->Flag_valid_pseudorange = rhs.Flag_valid_pseudorange;
-            }
-        return *this;
-    };
-
-    /// Move constructor
-    Gnss_Synchro(Gnss_Synchro&& other) noexcept
-    {
-        *this = std::move(other);
-    };
+    // Acquisition
+    uint32_t Acq_doppler_step{};         //!< Set by Acquisition processing block
+    double Acq_delay_samples{};          //!< Set by Acquisition processing block
+    double Acq_doppler_hz{};             //!< Set by Acquisition processing block
+    uint64_t Acq_samplestamp_samples{};  //!< Set by Acquisition processing block
 
-    /// Move assignment operator
-    Gnss_Synchro& operator=(Gnss_Synchro&& other) noexcept
+    /*!
+     * \brief Identifier of the signal given by System and Signal
+     */
+    Gnss_Signal_Id signal_id() const
     {
-        if (this != &other)
-            {
-                this->System = other.System;
-                this->Signal[0] = other.Signal[0];
-                this->Signal[1] = other.Signal[1];
-                this->Signal[2] = other.Signal[2];
-                this->PRN = other.PRN;
-                this->Channel_ID = other.Channel_ID;
-                this->Acq_delay_samples = other.Acq_delay_samples;
-                this->Acq_doppler_hz = other.Acq_doppler_hz;
-                this->Acq_samplestamp_samples = other.Acq_samplestamp_samples;
-                this->Acq_doppler_step = other.Acq_doppler_step;
-                this->fs = other.fs;
-                this->Prompt_I = other.Prompt_I;
-                this->Prompt_Q = other.Prompt_Q;
-                this->CN0_dB_hz = other.CN0_dB_hz;
-                this->Carrier_Doppler_hz = other.Carrier_Doppler_hz;
-                this->Carrier_phase_rads = other.Carrier_phase_rads;
-                this->Code_phase_samples = other.Code_phase_samples;
-                this->Tracking_sample_counter = other.Tracking_sample_counter;
-                this->correlation_length_ms = other.correlation_length_ms;
-                this->TOW_at_current_symbol_ms = other.TOW_at_current_symbol_ms;
-                this->Pseudorange_m = other.Pseudorange_m;
-                this->RX_time = other.RX_time;
-                this->interp_TOW_ms = other.interp_TOW_ms;
-                this->Flag_valid_acquisition = other.Flag_valid_acquisition;
-                this->Flag_valid_symbol_output = other.Flag_valid_symbol_output;
-                this->Flag_valid_word = other.Flag_valid_word;
-                this->Flag_valid_pseudorange = other.Flag_valid_pseudorange;
-            }
-        return *this;
-    };
+        return gnss_signal_id(System, Signal);
+    }
 
     /*!
      * \brief This member function serializes and restores
@@ -210,6 +137,12 @@ public:
 };
 
 
+static_assert(std::is_trivially_copyable<Gnss_Synchro>::value, "Gnss_Synchro must be trivially copyable");
+// Targets that align double and 64-bit integers to 4 bytes in a class (e.g. i386) pack it tighter
+static_assert(sizeof(Gnss_Synchro) <= 144, "Unexpected Gnss_Synchro size, check the member layout");
+static_assert(alignof(Gnss_Synchro) != 8 || sizeof(Gnss_Synchro) == 144, "Unexpected Gnss_Synchro size, check the member layout");
+
+
 /** \} */
 /** \} */
 #endif  // GNSS_SDR_GNSS_SYNCHRO_H
@@ -20,11 +20,12 @@ m * \file irnss_navigation_message.cc
  */
 
 #include "irnss_navigation_message.h"
+#include "crc24q.h"
 #include "gnss_satellite.h"
-#include <cmath>     // for fmod, abs, floor
-#include <cstring>   // for memcpy
-#include <iostream>  // for operator<<, cout, endl
-#include <limits>    // for std::numeric_limits
+#include <algorithm>  // for std::min
+#include <cmath>      // for fmod, abs, floor
+#include <cstring>    // for memcpy
+#include <limits>     // for std::numeric_limits
 
 
 void Irnss_Navigation_Message::reset()
@@ -93,6 +94,7 @@ void Irnss_Navigation_Message::reset()
     d_subframe_timestamp_ms = 0.0;
 
     // flags
+    flag_CRC_test = false;
     b_alert_flag = false;
     b_integrity_status_flag = false;
   //b_antispoofing_flag = false;
@@ -155,100 +157,33 @@ Irnss_Navigation_Message::Irnss_Navigation_Message()
 }
 
 
-void Irnss_Navigation_Message::print_irnss_word_bytes(uint32_t IRNSS_word)
-{
-    std::cout << " Word =";
-    std::cout << std::bitset<32>(IRNSS_word);
-    std::cout << std::endl;
-}
-
-
-bool Irnss_Navigation_Message::read_navigation_bool(std::bitset<IRNSS_L5_DATAFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter)
-{
-    bool value;
-
-    if (static_cast<int>(bits[IRNSS_L5_DATAFRAME_BITS - parameter[0].first]) == 1)
-        {
-            value = true;
-        }
-    else
-        {
-            value = false;
-        }
-    return value;
-}
-
-
-uint64_t Irnss_Navigation_Message::read_navigation_unsigned(std::bitset<IRNSS_L5_DATAFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter)
+int32_t Irnss_Navigation_Message::subframe_decoder(std::string& subframe)
 {
-    uint64_t value = 0ULL;
-    int32_t num_of_slices = parameter.size();
-    for (int32_t i = 0; i < num_of_slices; i++)
+    // Pack the '0' / '1' characters, first transmitted bit in the MSB of the first word
+    std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS> subframe_words{};
+    const size_t num_bits = std::min(subframe.size(), static_cast<size_t>(IRNSS_L5_DATAFRAME_BITS));
+    for (size_t i = 0; i < num_bits; i++)
         {
-            for (int32_t j = 0; j < parameter[i].second; j++)
+            if (subframe[i] == '1')
                 {
-                    value <<= 1;  // shift left
-                    if (static_cast<int>(bits[IRNSS_L5_DATAFRAME_BITS - parameter[i].first - j]) == 1)
-                        {
-                            value += 1ULL;  // insert the bit
-                        }
+                    set_nav_message_bit(subframe_words, static_cast<uint32_t>(i));
                 }
         }
-    return value;
+    return subframe_decoder(subframe_words);
 }
 
 
-int64_t Irnss_Navigation_Message::read_navigation_signed(std::bitset<IRNSS_L5_DATAFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter)
+int32_t Irnss_Navigation_Message::subframe_decoder(const std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS>& subframe_words)
 {
-    int64_t value = 0LL;
-    int32_t num_of_slices = parameter.size();
+    int32_t subframe_ID = 0;
 
-    // read the MSB and perform the sign extension
-    if (static_cast<int>(bits[IRNSS_L5_DATAFRAME_BITS - parameter[0].first]) == 1)
-        {
-            value ^= 0xFFFFFFFFFFFFFFFFLL;  // 64 bits variable
-        }
-    else
+    flag_CRC_test = crc24q(subframe_words, IRNSS_L5_CRC_DATA_BITS) == read_nav_field_unsigned(subframe_words, IRNSS_CRC);
+    if (!flag_CRC_test)
         {
-            value &= 0LL;
+            return 0;
         }
 
-    for (int32_t i = 0; i < num_of_slices; i++)
-        {
-            for (int32_t j = 0; j < parameter[i].second; j++)
-                {
-                    value *= 2;                     // shift left the signed integer
-                    value &= 0xFFFFFFFFFFFFFFFELL;  // reset the corresponding bit (for the 64 bits variable)
-                    if (static_cast<int>(bits[IRNSS_L5_DATAFRAME_BITS - parameter[i].first - j]) == 1)
-                        {
-                            value += 1LL;  // insert the bit
-                        }
-                }
-        }
-    return value;
-}
-
-
-int32_t Irnss_Navigation_Message::subframe_decoder(std::string& subframe)
-{
-    int32_t subframe_ID = 0;
-    uint32_t irnss_word;
-
-    // UNPACK BYTES TO BITS AND REMOVE THE IRNSS_CRC REDUNDANCE
-    std::bitset<IRNSS_L5_DATAFRAME_BITS> subframe_bits(subframe);
-    // std::bitset<IRNSS_WORD_BITS + 2> word_bits;
-    // for (int32_t i = 0; i < 10; i++)
-    //     {
-    //         memcpy(&irnss_word, &subframe[i * 4], sizeof(char) * 4);
-    //         word_bits = std::bitset<(IRNSS_WORD_BITS + 2)>(irnss_word);
-    //         for (int32_t j = 0; j < IRNSS_WORD_BITS; j++)
-    //             {
-    //                 subframe_bits[IRNSS_WORD_BITS * (9 - i) + j] = word_bits[j];
-    //             }
-    //     }
-    // memcpy(&subframe_bits, &subframe);
-
-    subframe_ID = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_SUBFRAME_ID));
+    subframe_ID = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_SUBFRAME_ID));
 
     // Decode all 5 sub-frames
     switch (subframe_ID)
@@ -261,44 +196,31 @@ int32_t Irnss_Navigation_Message::subframe_decoder(std::string& subframe)
             // The transmitted IRNSS_TOW is actual IRNSS_TOW of the next subframe
             // (the variable subframe at this point contains bits of the last subframe).
             // IRNSS_TOW = bin2dec(subframe(9:25)) * 6;
-            d_TOW_SF1 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_TOW));
+            d_TOW_SF1 = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_TOW));
             // we are in the first subframe (the transmitted IRNSS_TOW is the start time of the next subframe) !
             d_TOW_SF1 = d_TOW_SF1 * 6;
             d_TOW = d_TOW_SF1;  // Set transmission time
             
-            b_alert_flag = read_navigation_bool(subframe_bits, IRNSS_ALERT_FLAG);
+            b_alert_flag = read_nav_field_bool(subframe_words, IRNSS_ALERT_FLAG);
             
-            i_IRNSS_week = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_WEEK));
-            d_A_f0 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_A_F0));
-            d_A_f0 = d_A_f0 * IRNSS_A_F0_LSB;
-            d_A_f1 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_A_F1));
-            d_A_f1 = d_A_f1 * IRNSS_A_F1_LSB;
-            d_A_f2 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_A_F2));
-            d_A_f2 = d_A_f2 * IRNSS_A_F2_LSB;
-            i_SV_accuracy = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_SV_ACCURACY));
-            d_Toc = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_T_OC));
-            d_Toc = d_Toc * IRNSS_T_OC_LSB;
-            d_TGD = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_T_GD));
-            d_TGD = d_TGD * IRNSS_T_GD_LSB;
-            d_Delta_n = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_DELTA_N));
-            d_Delta_n = d_Delta_n * IRNSS_DELTA_N_LSB;
-            d_IODEC_SF1 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_IODC));
-            b_L5_P_data_flag = read_navigation_bool(subframe_bits, IRNSS_L5_FLAG);
-            b_S_P_data_flag = read_navigation_bool(subframe_bits, IRNSS_S_FLAG); 
-            d_Cus = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_C_US));
-            d_Cus = d_Cus * IRNSS_C_US_LSB;
-            d_Cuc = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_C_UC));
-            d_Cuc = d_Cuc * IRNSS_C_UC_LSB;
-            d_Cic = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_C_IC));
-            d_Cic = d_Cic * IRNSS_C_IC_LSB;
-            d_Cis = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_C_IS));
-            d_Cis = d_Cis * IRNSS_C_IS_LSB;
-            d_Crc = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_C_RC));
-            d_Crc = d_Crc * IRNSS_C_RC_LSB;
-            d_Crs = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_C_RS));
-            d_Crs = d_Crs * IRNSS_C_RS_LSB;
-            d_IDOT = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_I_DOT));
-            d_IDOT = d_IDOT * IRNSS_I_DOT_LSB;
+            i_IRNSS_week = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_WEEK));
+            d_A_f0 = read_nav_field(subframe_words, IRNSS_A_F0);
+            d_A_f1 = read_nav_field(subframe_words, IRNSS_A_F1);
+            d_A_f2 = read_nav_field(subframe_words, IRNSS_A_F2);
+            i_SV_accuracy = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_SV_ACCURACY));
+            d_Toc = static_cast<int32_t>(read_nav_field(subframe_words, IRNSS_T_OC));
+            d_TGD = read_nav_field(subframe_words, IRNSS_T_GD);
+            d_Delta_n = read_nav_field(subframe_words, IRNSS_DELTA_N);
+            d_IODEC_SF1 = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_IODC));
+            b_L5_P_data_flag = read_nav_field_bool(subframe_words, IRNSS_L5_FLAG);
+            b_S_P_data_flag = read_nav_field_bool(subframe_words, IRNSS_S_FLAG); 
+            d_Cus = read_nav_field(subframe_words, IRNSS_C_US);
+            d_Cuc = read_nav_field(subframe_words, IRNSS_C_UC);
+            d_Cic = read_nav_field(subframe_words, IRNSS_C_IC);
+            d_Cis = read_nav_field(subframe_words, IRNSS_C_IS);
+            d_Crc = read_nav_field(subframe_words, IRNSS_C_RC);
+            d_Crs = read_nav_field(subframe_words, IRNSS_C_RS);
+            d_IDOT = read_nav_field(subframe_words, IRNSS_I_DOT);
 
             
               // 
@@ -318,40 +240,32 @@ int32_t Irnss_Navigation_Message::subframe_decoder(std::string& subframe)
             break;
 
         case 2:  // --- It is subframe 2 -------------------
-            d_TOW_SF2 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_TOW));
+            d_TOW_SF2 = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_TOW));
             d_TOW_SF2 = d_TOW_SF2 * 6;
             d_TOW = d_TOW_SF2;  // Set transmission time
-            b_alert_flag = read_navigation_bool(subframe_bits, IRNSS_ALERT_FLAG);
-            d_M_0 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_M_0));
-            d_M_0 = d_M_0 * IRNSS_M_0_LSB;
-            d_Toe = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_T_OE));
-            d_Toe = d_Toe * IRNSS_T_OE_LSB;
-            d_e_eccentricity = static_cast<double>(read_navigation_unsigned(subframe_bits, IRNSS_ECCENTRICITY));
-            d_e_eccentricity = d_e_eccentricity * IRNSS_ECCENTRICITY_LSB;
-            d_sqrt_A = static_cast<double>(read_navigation_unsigned(subframe_bits, IRNSS_SQRT_A));
-            d_sqrt_A = d_sqrt_A * IRNSS_SQRT_A_LSB;
-            d_OMEGA0 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_OMEGA_0));
-            d_OMEGA0 = d_OMEGA0 * IRNSS_OMEGA_0_LSB;
-            d_OMEGA = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_OMEGA));
-            d_OMEGA = d_OMEGA * IRNSS_OMEGA_LSB;
-            d_OMEGA_DOT = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_OMEGA_DOT));
-            d_OMEGA_DOT = d_OMEGA_DOT * IRNSS_OMEGA_DOT_LSB;
-            d_i_0 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_I_0));
-            d_i_0 = d_i_0 * IRNSS_I_0_LSB;
+            b_alert_flag = read_nav_field_bool(subframe_words, IRNSS_ALERT_FLAG);
+            d_M_0 = read_nav_field(subframe_words, IRNSS_M_0);
+            d_Toe = static_cast<int32_t>(read_nav_field(subframe_words, IRNSS_T_OE));
+            d_e_eccentricity = read_nav_field(subframe_words, IRNSS_ECCENTRICITY);
+            d_sqrt_A = read_nav_field(subframe_words, IRNSS_SQRT_A);
+            d_OMEGA0 = read_nav_field(subframe_words, IRNSS_OMEGA_0);
+            d_OMEGA = read_nav_field(subframe_words, IRNSS_OMEGA);
+            d_OMEGA_DOT = read_nav_field(subframe_words, IRNSS_OMEGA_DOT);
+            d_i_0 = read_nav_field(subframe_words, IRNSS_I_0);
             break;
 
         case 3:
         case 4:  // --- It is subframe 4 o 5---------- Almanac, ionospheric model, UTC parameters, SV health
             int32_t d_prn_ID;
             int32_t d_msg_ID;
-            d_TOW_SF4 = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_TOW));
+            d_TOW_SF4 = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_TOW));
             d_TOW_SF4 = d_TOW_SF4 * 6;
             d_TOW = d_TOW_SF4;  // Set transmission time
             //b_integrity_status_flag = read_navigation_bool(subframe_bits, INTEGRITY_STATUS_FLAG);
-            b_alert_flag = read_navigation_bool(subframe_bits, IRNSS_ALERT_FLAG);
+            b_alert_flag = read_nav_field_bool(subframe_words, IRNSS_ALERT_FLAG);
             //b_antispoofing_flag = read_navigation_bool(subframe_bits, ANTI_SPOOFING_FLAG);
-            d_prn_ID = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_SV_PAGE));
-            d_msg_ID = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_SV_DATA_ID));
+            d_prn_ID = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_SV_PAGE));
+            d_msg_ID = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_SV_DATA_ID));
             
                 
 
@@ -371,19 +285,15 @@ int32_t Irnss_Navigation_Message::subframe_decoder(std::string& subframe)
                 {
                     // UTC data
                     
-                    d_A2 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_A_2));
-                    d_A2 = d_A2 * IRNSS_A_2_LSB;
-                    d_A1 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_A_1));
-                    d_A1 = d_A1 * IRNSS_A_1_LSB;
-                    d_A0 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_A_0));
-                    d_A0 = d_A0 * IRNSS_A_0_LSB;
-                    d_t_OT = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_T_OT));
-                    d_t_OT = d_t_OT * IRNSS_T_OT_LSB;
-                    i_WN_T = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_WN_T));
-                    d_DeltaT_LS = static_cast<int32_t>(read_navigation_signed(subframe_bits, IRNSS_DELTAT_LS));
-                    i_WN_LSF = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_WN_LSF));
-                    i_DN = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_DN));  // Right-justified ?
-                    d_DeltaT_LSF = static_cast<int32_t>(read_navigation_signed(subframe_bits, IRNSS_DELTAT_LSF));
+                    d_A2 = read_nav_field(subframe_words, IRNSS_A_2);
+                    d_A1 = read_nav_field(subframe_words, IRNSS_A_1);
+                    d_A0 = read_nav_field(subframe_words, IRNSS_A_0);
+                    d_t_OT = static_cast<int32_t>(read_nav_field(subframe_words, IRNSS_T_OT));
+                    i_WN_T = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_WN_T));
+                    d_DeltaT_LS = static_cast<int32_t>(read_nav_field_signed(subframe_words, IRNSS_DELTAT_LS));
+                    i_WN_LSF = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_WN_LSF));
+                    i_DN = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_DN));  // Right-justified ?
+                    d_DeltaT_LSF = static_cast<int32_t>(read_nav_field_signed(subframe_words, IRNSS_DELTAT_LSF));
                     flag_utc_model_valid = true;
 
                     // TODO GPS offset parameters
@@ -391,38 +301,23 @@ int32_t Irnss_Navigation_Message::subframe_decoder(std::string& subframe)
             if (d_msg_ID == 11) //Earth observation parameters and ionospheric coefficients
                 {
                     //Earth orientation parameters
-                    d_t_EOP = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_T_EOP));
-                    d_t_EOP = d_t_EOP * IRNSS_T_EOP_LSB;
-                    d_pm_x = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_PM_X));
-                    d_pm_x = d_pm_x * IRNSS_PM_X_LSB;
-                    d_pm_x_dot = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_PM_X_DOT));
-                    d_pm_x_dot = d_pm_x_dot * IRNSS_PM_X_DOT_LSB;
-                    d_pm_y = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_PM_Y));
-                    d_pm_y = d_pm_y * IRNSS_PM_Y_LSB;
-                    d_pm_y_dot = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_PM_Y_DOT));
-                    d_pm_y_dot = d_pm_y_dot * IRNSS_PM_Y_DOT_LSB;
-                    d_delta_UT1 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_DELTA_UT1));
-                    d_delta_UT1 = d_delta_UT1 * IRNSS_DELTA_UT1_LSB;
-                    d_delta_UT1_dot = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_DELTA_UT1_DOT));
-                    d_delta_UT1_dot = d_delta_UT1_dot * IRNSS_DELTA_UT1_DOT_LSB;
+                    d_t_EOP = static_cast<int32_t>(read_nav_field(subframe_words, IRNSS_T_EOP));
+                    d_pm_x = read_nav_field(subframe_words, IRNSS_PM_X);
+                    d_pm_x_dot = read_nav_field(subframe_words, IRNSS_PM_X_DOT);
+                    d_pm_y = read_nav_field(subframe_words, IRNSS_PM_Y);
+                    d_pm_y_dot = read_nav_field(subframe_words, IRNSS_PM_Y_DOT);
+                    d_delta_UT1 = read_nav_field(subframe_words, IRNSS_DELTA_UT1);
+                    d_delta_UT1_dot = read_nav_field(subframe_words, IRNSS_DELTA_UT1_DOT);
 
                     // Ionospheric coefficients
-                    d_alpha0 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_ALPHA_0));
-                    d_alpha0 = d_alpha0 * IRNSS_ALPHA_0_LSB;
-                    d_alpha1 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_ALPHA_1));
-                    d_alpha1 = d_alpha1 * IRNSS_ALPHA_1_LSB;
-                    d_alpha2 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_ALPHA_2));
-                    d_alpha2 = d_alpha2 * IRNSS_ALPHA_2_LSB;
-                    d_alpha3 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_ALPHA_3));
-                    d_alpha3 = d_alpha3 * IRNSS_ALPHA_3_LSB;
-                    d_beta0 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_BETA_0));
-                    d_beta0 = d_beta0 * IRNSS_BETA_0_LSB;
-                    d_beta1 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_BETA_1));
-                    d_beta1 = d_beta1 * IRNSS_BETA_1_LSB;
-                    d_beta2 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_BETA_2));
-                    d_beta2 = d_beta2 * IRNSS_BETA_2_LSB;
-                    d_beta3 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_BETA_3));
-                    d_beta3 = d_beta3 * IRNSS_BETA_3_LSB;
+                    d_alpha0 = read_nav_field(subframe_words, IRNSS_ALPHA_0);
+                    d_alpha1 = read_nav_field(subframe_words, IRNSS_ALPHA_1);
+                    d_alpha2 = read_nav_field(subframe_words, IRNSS_ALPHA_2);
+                    d_alpha3 = read_nav_field(subframe_words, IRNSS_ALPHA_3);
+                    d_beta0 = read_nav_field(subframe_words, IRNSS_BETA_0);
+                    d_beta1 = read_nav_field(subframe_words, IRNSS_BETA_1);
+                    d_beta2 = read_nav_field(subframe_words, IRNSS_BETA_2);
+                    d_beta3 = read_nav_field(subframe_words, IRNSS_BETA_3);
                     flag_iono_valid = true;
 
                 }
@@ -441,19 +336,15 @@ int32_t Irnss_Navigation_Message::subframe_decoder(std::string& subframe)
 
             if (d_msg_ID == 26)
                 {   
-                    d_A2 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_A_2));
-                    d_A2 = d_A2 * IRNSS_A_2_LSB;
-                    d_A1 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_A_1));
-                    d_A1 = d_A1 * IRNSS_A_1_LSB;
-                    d_A0 = static_cast<double>(read_navigation_signed(subframe_bits, IRNSS_A_0));
-                    d_A0 = d_A0 * IRNSS_A_0_LSB;
-                    d_t_OT = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_T_OT));
-                    d_t_OT = d_t_OT * IRNSS_T_OT_LSB;
-                    i_WN_T = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_WN_T));
-                    d_DeltaT_LS = static_cast<int32_t>(read_navigation_signed(subframe_bits, IRNSS_DELTAT_LS));
-                    i_WN_LSF = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_WN_LSF));
-                    i_DN = static_cast<int32_t>(read_navigation_unsigned(subframe_bits, IRNSS_DN));  // Right-justified ?
-                    d_DeltaT_LSF = static_cast<int32_t>(read_navigation_signed(subframe_bits, IRNSS_DELTAT_LSF));
+                    d_A2 = read_nav_field(subframe_words, IRNSS_A_2);
+                    d_A1 = read_nav_field(subframe_words, IRNSS_A_1);
+                    d_A0 = read_nav_field(subframe_words, IRNSS_A_0);
+                    d_t_OT = static_cast<int32_t>(read_nav_field(subframe_words, IRNSS_T_OT));
+                    i_WN_T = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_WN_T));
+                    d_DeltaT_LS = static_cast<int32_t>(read_nav_field_signed(subframe_words, IRNSS_DELTAT_LS));
+                    i_WN_LSF = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_WN_LSF));
+                    i_DN = static_cast<int32_t>(read_nav_field_unsigned(subframe_words, IRNSS_DN));  // Right-justified ?
+                    d_DeltaT_LSF = static_cast<int32_t>(read_nav_field_signed(subframe_words, IRNSS_DELTAT_LSF));
                     // flag_iono_valid = true;
                     // flag_utc_model_valid = true;
                 }
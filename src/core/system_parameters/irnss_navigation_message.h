@@ -26,12 +26,10 @@
 #include "irnss_ephemeris.h"
 #include "irnss_iono.h"
 #include "irnss_utc_model.h"
-#include <bitset>
+#include <array>
 #include <cstdint>
 #include <map>
 #include <string>
-#include <utility>  // for pair
-#include <vector>
 
 
 /*!
@@ -67,6 +65,13 @@ public:
      */
     int32_t subframe_decoder(std::string& subframe);
 
+    /*!
+     * \brief Decodes the IRNSS NAV message from the packed subframe bits.
+     * The first transmitted bit is the most significant bit of subframe_words[0].
+     * Returns 0 if the subframe does not pass the CRC check.
+     */
+    int32_t subframe_decoder(const std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS>& subframe_words);
+
     /*!
      * \brief Computes the Coordinated Universal Time (UTC) and
      * returns it in [s] 
@@ -98,6 +103,11 @@ public:
         i_channel_ID = channel_id;
     }
 
+    inline bool get_flag_CRC_test() const
+    {
+        return flag_CRC_test;
+    }
+
     inline bool get_flag_iono_valid() const
     {
         return flag_iono_valid;
@@ -110,6 +120,7 @@ public:
 
     bool satellite_validation();
 
+    bool flag_CRC_test;               // flag indicating that the last subframe passed the CRC check
     bool b_valid_ephemeris_set_flag;  // flag indicating that this ephemeris set have passed the validation check
     // broadcast orbit 1
     int32_t d_TOW;      //!< Time of IRNSS Week of the ephemeris set (taken from subframes IRNSS_TOW) [s]
@@ -245,12 +256,6 @@ public:
 
     // public functions
     void reset();
-
-private:
-    uint64_t read_navigation_unsigned(std::bitset<IRNSS_L5_DATAFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter);
-    int64_t read_navigation_signed(std::bitset<IRNSS_L5_DATAFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter);
-    bool read_navigation_bool(std::bitset<IRNSS_L5_DATAFRAME_BITS> bits, const std::vector<std::pair<int32_t, int32_t>>& parameter);
-    void print_irnss_word_bytes(uint32_t IRNSS_word);
 };
 
 #endif
@@ -0,0 +1,158 @@
+/*!
+ * \file nav_message_field.h
+ * \brief Compile-time description of navigation message fields and their
+ * extraction from packed 64-bit words.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef GNSS_SDR_NAV_MESSAGE_FIELD_H
+#define GNSS_SDR_NAV_MESSAGE_FIELD_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/** \addtogroup Core
+ * \{ */
+/** \addtogroup System_Parameters
+ * \{ */
+
+
+/*!
+ * \brief Position, size and scale factor of a parameter in a navigation
+ * message, as given in the ICD tables.
+ *
+ * \a offset is the ICD position (starting at 1) of the most significant bit
+ * of the parameter, \a length its number of bits, and \a scale the value of
+ * its least significant bit. Signed parameters are two's complement.
+ */
+struct Nav_Message_Field
+{
+    constexpr Nav_Message_Field(int32_t offset_, int32_t length_, double scale_ = 1.0, bool is_signed_ = false)
+        : offset(offset_), length(length_), scale(scale_), is_signed(is_signed_)
+    {
+    }
+
+    int32_t offset;
+    int32_t length;
+    double scale;
+    bool is_signed;
+};
+
+
+/*!
+ * \brief Helper to declare two's complement fields.
+ */
+constexpr Nav_Message_Field signed_nav_field(int32_t offset, int32_t length, double scale = 1.0)
+{
+    return Nav_Message_Field(offset, length, scale, true);
+}
+
+
+/*!
+ * \brief Mask keeping the \a length least significant bits of a word.
+ */
+constexpr uint64_t nav_field_mask(uint32_t length)
+{
+    return (length >= 64U) ? 0xFFFFFFFFFFFFFFFFULL : ((1ULL << length) - 1ULL);
+}
+
+
+/*!
+ * \brief Returns the raw bits of \a field, right-aligned.
+ *
+ * The navigation message is stored MSB first: ICD bit position 1 is the most
+ * significant bit of words[0]. Fields can span two consecutive words. Since
+ * fields are compile-time constants, the shifts and masks are resolved by
+ * the compiler.
+ */
+template <size_t N>
+inline uint64_t read_nav_field_bits(const std::array<uint64_t, N>& words, const Nav_Message_Field& field)
+{
+    const auto start = static_cast<uint32_t>(field.offset - 1);
+    const auto length = static_cast<uint32_t>(field.length);
+    const uint32_t word = start / 64U;
+    const uint32_t bit = start % 64U;
+    if (bit + length <= 64U)
+        {
+            return (words[word] >> (64U - bit - length)) & nav_field_mask(length);
+        }
+    const uint32_t tail = bit + length - 64U;
+    return ((words[word] & nav_field_mask(64U - bit)) << tail) | (words[word + 1] >> (64U - tail));
+}
+
+
+/*!
+ * \brief Sets the bit transmitted in \a position (starting at 0) of a message
+ * stored as read by read_nav_field_bits().
+ */
+template <size_t N>
+inline void set_nav_message_bit(std::array<uint64_t, N>& words, uint32_t position)
+{
+    words[position / 64U] |= 1ULL << (63U - (position % 64U));
+}
+
+
+/*!
+ * \brief Returns \a field as an unsigned integer, without scaling.
+ */
+template <size_t N>
+inline uint64_t read_nav_field_unsigned(const std::array<uint64_t, N>& words, const Nav_Message_Field& field)
+{
+    return read_nav_field_bits(words, field);
+}
+
+
+/*!
+ * \brief Returns \a field as a two's complement integer, without scaling.
+ */
+template <size_t N>
+inline int64_t read_nav_field_signed(const std::array<uint64_t, N>& words, const Nav_Message_Field& field)
+{
+    const uint64_t value = read_nav_field_bits(words, field);
+    const auto length = static_cast<uint32_t>(field.length);
+    if (length < 64U && ((value >> (length - 1U)) & 1ULL) == 1ULL)
+        {
+            return static_cast<int64_t>(value | ~nav_field_mask(length));
+        }
+    return static_cast<int64_t>(value);
+}
+
+
+/*!
+ * \brief Returns the first bit of \a field as a flag.
+ */
+template <size_t N>
+inline bool read_nav_field_bool(const std::array<uint64_t, N>& words, const Nav_Message_Field& field)
+{
+    return read_nav_field_bits(words, Nav_Message_Field(field.offset, 1)) == 1ULL;
+}
+
+
+/*!
+ * \brief Returns \a field in physical units (raw value times its scale factor),
+ * taking into account its signedness.
+ */
+template <size_t N>
+inline double read_nav_field(const std::array<uint64_t, N>& words, const Nav_Message_Field& field)
+{
+    if (field.is_signed)
+        {
+            return static_cast<double>(read_nav_field_signed(words, field)) * field.scale;
+        }
+    return static_cast<double>(read_nav_field_unsigned(words, field)) * field.scale;
+}
+
+
+/** \} */
+/** \} */
+#endif  // GNSS_SDR_NAV_MESSAGE_FIELD_H
@@ -0,0 +1,141 @@
+/*!
+ * \file benchmark_concurrent_queue.cc
+ * \brief Benchmark for the mutex-based and lock-free concurrent queues
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+constexpr int ITEMS_PER_PRODUCER = 100000;
+
+
+// Concurrent_Queue is unbounded, its push() cannot fail
+template <typename Queue>
+void push_item(Queue& queue, int64_t item)
+{
+    queue.push(item);
+}
+
+
+template <>
+void push_item(Concurrent_Ring_Queue<int64_t>& queue, int64_t item)
+{
+    while (!queue.push(item))
+        {
+            std::this_thread::yield();
+        }
+}
+
+
+// N producers push ITEMS_PER_PRODUCER items each, one consumer pops them all
+template <typename Queue>
+void run_producers_consumer(Queue& queue, int num_producers)
+{
+    std::vector<std::thread> producers;
+    producers.reserve(num_producers);
+    for (int p = 0; p < num_producers; p++)
+        {
+            producers.emplace_back([&queue]() {
+                for (int64_t i = 0; i < ITEMS_PER_PRODUCER; i++)
+                    {
+                        push_item(queue, i);
+                    }
+            });
+        }
+    int64_t item;
+    int64_t sum = 0;
+    for (int64_t n = 0; n < static_cast<int64_t>(num_producers) * ITEMS_PER_PRODUCER; n++)
+        {
+            queue.wait_and_pop(item);
+            sum += item;
+        }
+    benchmark::DoNotOptimize(sum);
+    for (auto& producer : producers)
+        {
+            producer.join();
+        }
+}
+
+
+void bm_concurrent_queue(benchmark::State& state)
+{
+    const auto num_producers = static_cast<int>(state.range(0));
+    while (state.KeepRunning())
+        {
+            Concurrent_Queue<int64_t> queue;
+            run_producers_consumer(queue, num_producers);
+        }
+    state.SetItemsProcessed(state.iterations() * num_producers * ITEMS_PER_PRODUCER);
+}
+
+
+void bm_concurrent_ring_queue(benchmark::State& state)
+{
+    const auto num_producers = static_cast<int>(state.range(0));
+    uint64_t high_watermark = 0;
+    while (state.KeepRunning())
+        {
+            Concurrent_Ring_Queue<int64_t> queue(1024);
+            run_producers_consumer(queue, num_producers);
+            high_watermark = queue.high_watermark();
+        }
+    state.SetItemsProcessed(state.iterations() * num_producers * ITEMS_PER_PRODUCER);
+    state.counters["high_watermark"] = static_cast<double>(high_watermark);
+}
+
+
+// Uncontended cost of a push and a pop from the same thread
+template <typename Queue>
+void run_push_pop(benchmark::State& state, Queue& queue)
+{
+    int64_t item = 0;
+    while (state.KeepRunning())
+        {
+            for (int64_t i = 0; i < 64; i++)
+                {
+                    queue.push(i);
+                }
+            for (int64_t i = 0; i < 64; i++)
+                {
+                    queue.wait_and_pop(item);
+                }
+        }
+    benchmark::DoNotOptimize(item);
+    state.SetItemsProcessed(state.iterations() * 64);
+}
+
+
+void bm_concurrent_queue_push_pop(benchmark::State& state)
+{
+    Concurrent_Queue<int64_t> queue;
+    run_push_pop(state, queue);
+}
+
+
+void bm_concurrent_ring_queue_push_pop(benchmark::State& state)
+{
+    Concurrent_Ring_Queue<int64_t> queue(64);
+    run_push_pop(state, queue);
+}
+
+
+BENCHMARK(bm_concurrent_queue_push_pop);
+BENCHMARK(bm_concurrent_ring_queue_push_pop);
+BENCHMARK(bm_concurrent_queue)->Arg(1)->Arg(4)->Arg(8)->UseRealTime();
+BENCHMARK(bm_concurrent_ring_queue)->Arg(1)->Arg(4)->Arg(8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,96 @@
+/*!
+ * \file benchmark_crc24q.cc
+ * \brief Benchmark for the CRC-24Q implementations
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "crc24q.h"
+#include <benchmark/benchmark.h>
+#include <boost/crc.hpp>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using CRC_boost_type = boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false>;
+
+
+std::vector<uint8_t> random_bytes(size_t length)
+{
+    std::vector<uint8_t> bytes(length);
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> dist(0, 255);
+    for (auto& byte : bytes)
+        {
+            byte = static_cast<uint8_t>(dist(gen));
+        }
+    return bytes;
+}
+
+
+void bm_crc24q_boost(benchmark::State& state)
+{
+    const std::vector<uint8_t> bytes = random_bytes(state.range(0));
+    while (state.KeepRunning())
+        {
+            CRC_boost_type crc;
+            crc.process_bytes(bytes.data(), bytes.size());
+            benchmark::DoNotOptimize(crc.checksum());
+        }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+
+void bm_crc24q_bytewise(benchmark::State& state)
+{
+    const std::vector<uint8_t> bytes = random_bytes(state.range(0));
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(crc24q_bytewise(bytes.data(), bytes.size()));
+        }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+
+void bm_crc24q_slicing_by_8(benchmark::State& state)
+{
+    const std::vector<uint8_t> bytes = random_bytes(state.range(0));
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(crc24q(bytes.data(), bytes.size()));
+        }
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+}
+
+
+void bm_crc24q_irnss_subframe(benchmark::State& state)
+{
+    // 262 protected bits packed in 64-bit words, as in the IRNSS decoder
+    const std::vector<uint8_t> bytes = random_bytes(40);
+    std::array<uint64_t, 5> words{};
+    for (size_t i = 0; i < bytes.size(); i++)
+        {
+            words[i / 8] |= static_cast<uint64_t>(bytes[i]) << (56U - 8U * (i % 8));
+        }
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(crc24q(words, 262));
+        }
+}
+
+
+// 25, 27, 33 and 58 bytes are the Galileo I/NAV, F/NAV, IRNSS and Galileo C/NAV frame sizes
+BENCHMARK(bm_crc24q_boost)->Arg(25)->Arg(27)->Arg(33)->Arg(58)->Arg(4096);
+BENCHMARK(bm_crc24q_bytewise)->Arg(25)->Arg(27)->Arg(33)->Arg(58)->Arg(4096);
+BENCHMARK(bm_crc24q_slicing_by_8)->Arg(25)->Arg(27)->Arg(33)->Arg(58)->Arg(4096);
+BENCHMARK(bm_crc24q_irnss_subframe);
+BENCHMARK_MAIN();
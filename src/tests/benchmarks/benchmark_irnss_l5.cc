@@ -0,0 +1,370 @@
+/*!
+ * \file benchmark_irnss_l5.cc
+ * \brief Benchmarks for the stages of the IRNSS L5 SPS receive chain
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "IRNSS_at_1.h"
+#include "MATH_CONSTANTS.h"
+#include "acq_batch_engine.h"
+#include "acq_conf.h"
+#include "cpu_multicorrelator_real_codes.h"
+#include "crc24q.h"
+#include "dll_pll_conf.h"
+#include "dll_pll_veml_tracking.h"
+#include "gnss_sdr_fft.h"
+#include "gnss_synchro.h"
+#include "in_memory_configuration.h"
+#include "irnss_ephemeris.h"
+#include "irnss_l5_subframe_decoder.h"
+#include "irnss_navigation_message.h"
+#include "irnss_sdr_signal_replica.h"
+#include "pcps_acquisition.h"
+#include <benchmark/benchmark.h>
+#include <gnuradio/blocks/null_sink.h>
+#include <gnuradio/top_block.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <volk_gnsssdr/volk_gnsssdr_alloc.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+
+namespace
+{
+constexpr uint32_t PRN = 1;
+
+uint32_t samples_per_code(int64_t fs)
+{
+    return static_cast<uint32_t>(static_cast<double>(fs) * IRNSS_L5I_CHIP_PERIOD_S);
+}
+
+
+// Noisy IRNSS L5 signal with a given code delay and Doppler, num_codes code periods long
+volk_gnsssdr::vector<std::complex<float>> make_signal(int64_t fs, uint32_t delay_samples, float doppler_hz, uint32_t num_codes = 1)
+{
+    const uint32_t n = samples_per_code(fs);
+    std::vector<std::complex<float>> code(n);
+    irnss_l5_sps_code_gen_complex_sampled(code, PRN, static_cast<int32_t>(fs), 0);
+    volk_gnsssdr::vector<std::complex<float>> signal(n * num_codes);
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    for (uint32_t i = 0; i < n * num_codes; i++)
+        {
+            const double phase = TWO_PI * doppler_hz * static_cast<double>(i) / static_cast<double>(fs);
+            signal[i] = code[(i % n + n - delay_samples) % n] * std::complex<float>(std::cos(phase), std::sin(phase)) +
+                        std::complex<float>(noise(gen), noise(gen));
+        }
+    return signal;
+}
+
+
+void set_irnss_l5_signal(Gnss_Synchro& gnss_synchro)
+{
+    gnss_synchro.System = 'I';
+    gnss_synchro.Signal[0] = '1';
+    gnss_synchro.Signal[1] = 'I';
+    gnss_synchro.Signal[2] = '\0';
+    gnss_synchro.PRN = PRN;
+}
+
+
+void set_subframe_bits(std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS>& words, int32_t first, int32_t length, uint64_t value)
+{
+    for (int32_t j = 0; j < length; j++)
+        {
+            const int32_t i = first - 1 + j;
+            const uint64_t mask = 1ULL << (63 - (i % 64));
+            words[i / 64] = ((value >> (length - 1 - j)) & 1ULL) ? (words[i / 64] | mask) : (words[i / 64] & ~mask);
+        }
+}
+
+
+// Subframe with random contents, the given subframe ID and a valid CRC
+std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS> make_subframe(int32_t subframe_id)
+{
+    std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS> words{};
+    std::mt19937_64 gen(subframe_id);
+    for (auto& word : words)
+        {
+            word = gen();
+        }
+    set_subframe_bits(words, IRNSS_CRC.offset, 64 * IRNSS_L5_DATAFRAME_WORDS - IRNSS_CRC.offset + 1, 0ULL);
+    set_subframe_bits(words, IRNSS_SUBFRAME_ID.offset, IRNSS_SUBFRAME_ID.length, subframe_id);
+    set_subframe_bits(words, IRNSS_CRC.offset, IRNSS_CRC.length, crc24q(words, IRNSS_L5_CRC_DATA_BITS));
+    return words;
+}
+}  // namespace
+
+
+void bm_irnss_l5_code_gen_complex_sampled(benchmark::State& state)
+{
+    const int64_t fs = state.range(0);
+    std::vector<std::complex<float>> code(samples_per_code(fs));
+    while (state.KeepRunning())
+        {
+            irnss_l5_sps_code_gen_complex_sampled(code, PRN, static_cast<int32_t>(fs), 0);
+            benchmark::DoNotOptimize(code.data());
+        }
+    state.SetItemsProcessed(state.iterations() * code.size());
+}
+
+
+void bm_irnss_l5_acq_batch_engine_search(benchmark::State& state)
+{
+    // Doppler search and peak detection of Acq_Batch_Engine, as run by
+    // pcps_acquisition::acquisition_core with the default IRNSS configuration:
+    // +-5 kHz Doppler window in 250 Hz steps, one code period
+    const int64_t fs = state.range(0);
+    const uint32_t fft_size = samples_per_code(fs);
+    const int32_t doppler_max = 5000;
+    const int32_t doppler_step = 250;
+    const uint32_t num_doppler_bins = 2 * doppler_max / doppler_step + 1;
+
+    // Conjugated spectrum of the local code
+    std::vector<std::complex<float>> code(fft_size);
+    irnss_l5_sps_code_gen_complex_sampled(code, PRN, static_cast<int32_t>(fs), 0);
+    auto fft = gnss_fft_fwd_make_unique(fft_size);
+    std::copy(code.begin(), code.end(), fft->get_inbuf());
+    fft->execute();
+    volk_gnsssdr::vector<std::complex<float>> fft_code(fft_size);
+    volk_32fc_conjugate_32fc(fft_code.data(), fft->get_outbuf(), fft_size);
+
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> wipeoffs(num_doppler_bins, volk_gnsssdr::vector<std::complex<float>>(fft_size));
+    for (uint32_t i = 0; i < num_doppler_bins; i++)
+        {
+            const float doppler = static_cast<float>(-doppler_max + static_cast<int32_t>(i) * doppler_step);
+            const float phase_step_rad = static_cast<float>(TWO_PI) * doppler / static_cast<float>(fs);
+            std::array<float, 1> phase{};
+            volk_gnsssdr_s32f_sincos_32fc(wipeoffs[i].data(), -phase_step_rad, phase.data(), fft_size);
+        }
+
+    volk_gnsssdr::vector<volk_gnsssdr::vector<float>> grid(num_doppler_bins, volk_gnsssdr::vector<float>(fft_size));
+    const Acq_Batch_Target target{fft_code.data(), &grid};
+    Acq_Batch_Engine engine(fft_size, fft_size, 0, 1);
+    const auto signal = make_signal(fs, fft_size / 3, 1500.0);
+
+    while (state.KeepRunning())
+        {
+            engine.search(signal.data(), wipeoffs, num_doppler_bins, target, false);
+            benchmark::DoNotOptimize(engine.find_peak(grid, num_doppler_bins, fft_size));
+        }
+    state.SetItemsProcessed(state.iterations() * fft_size);
+}
+
+
+void bm_irnss_l5_multicorrelator(benchmark::State& state)
+{
+    // Cpu_Multicorrelator_Real_Codes over one integration period, as run by
+    // dll_pll_veml_tracking (one sample per chip in the local code): carrier
+    // wipe-off, code resampling and Very Early, Early, Prompt, Late and Very
+    // Late correlators
+    const int64_t fs = state.range(0);
+    const uint32_t vector_length = samples_per_code(fs);
+    std::array<float, 5> shifts_chips{{-0.5, -0.25, 0.0, 0.25, 0.5}};
+
+    volk_gnsssdr::vector<float> tracking_code(IRNSS_L5I_CODE_LENGTH_CHIPS);
+    irnss_l5_sps_gen_float(tracking_code, PRN, 0);
+    volk_gnsssdr::vector<std::complex<float>> correlator_outs(shifts_chips.size());
+
+    Cpu_Multicorrelator_Real_Codes correlator;
+    correlator.init(static_cast<int>(2 * vector_length), static_cast<int>(shifts_chips.size()));
+    correlator.set_local_code_and_taps(IRNSS_L5I_CODE_LENGTH_CHIPS, tracking_code.data(), shifts_chips.data());
+    const auto signal = make_signal(fs, 0, 1500.0);
+    correlator.set_input_output_vectors(correlator_outs.data(), signal.data());
+
+    const float carrier_phase_step_rad = static_cast<float>(TWO_PI) * 1500.0F / static_cast<float>(fs);
+    const float code_phase_step_chips = static_cast<float>(IRNSS_L5I_CODE_RATE_HZ) / static_cast<float>(fs);
+    while (state.KeepRunning())
+        {
+            correlator.Carrier_wipeoff_multicorrelator_resampler(0.0, carrier_phase_step_rad, 0.0,
+                0.0, code_phase_step_chips, 0.0, static_cast<int>(vector_length));
+            benchmark::DoNotOptimize(correlator_outs.data());
+        }
+    correlator.free();
+    state.SetItemsProcessed(state.iterations() * vector_length);
+}
+
+
+void bm_irnss_l5_pcps_acquisition(benchmark::State& state)
+{
+    // pcps_acquisition block configured as IrnssSpsL5PcpsAcquisition does
+    // (default +-5 kHz Doppler window in 250 Hz steps, one code period), run
+    // by the GNU Radio scheduler. Each iteration is one acquisition, including
+    // the start and stop of the flowgraph.
+    const int64_t fs = state.range(0);
+    const uint32_t code_length = samples_per_code(fs);
+    InMemoryConfiguration config;
+    config.set_property("GNSS-SDR.internal_fs_sps", std::to_string(fs));
+    Acq_Conf acq_conf;
+    acq_conf.ms_per_code = 1;
+    acq_conf.SetFromConfiguration(&config, "Acquisition_1I", IRNSS_L5I_CODE_RATE_HZ, IRNSS_L5_OPT_ACQ_FS_HZ);
+    auto acquisition = pcps_make_acquisition(acq_conf);
+
+    Gnss_Synchro gnss_synchro{};
+    set_irnss_l5_signal(gnss_synchro);
+    std::vector<std::complex<float>> code(code_length);
+    irnss_l5_sps_code_gen_complex_sampled(code, PRN, static_cast<int32_t>(fs), 0);
+    acquisition->set_gnss_synchro(&gnss_synchro);
+    acquisition->set_local_code(code.data());
+    acquisition->init();
+
+    // The acquisition runs when a second code period arrives
+    const auto signal = make_signal(fs, code_length / 3, 1500.0, 2);
+    auto source = gr::blocks::vector_source_c::make(std::vector<gr_complex>(signal.begin(), signal.end()), false);
+    auto top_block = gr::make_top_block("IRNSS L5 acquisition benchmark");
+    top_block->connect(source, 0, acquisition, 0);
+    while (state.KeepRunning())
+        {
+            source->rewind();
+            acquisition->set_state(1);
+            top_block->run();
+        }
+    state.SetItemsProcessed(state.iterations() * code_length);
+}
+
+
+void bm_irnss_l5_dll_pll_veml_tracking(benchmark::State& state)
+{
+    // dll_pll_veml_tracking block configured as Irnssspsl5DllPllTracking does,
+    // run by the GNU Radio scheduler over 100 ms of signal from the acquired
+    // code delay and Doppler. Each iteration includes the start and stop of the
+    // flowgraph and the pull-in of the loops.
+    const int64_t fs = state.range(0);
+    const uint32_t code_length = samples_per_code(fs);
+    const uint32_t num_codes = 100;
+    const uint32_t delay_samples = code_length / 3;
+    const float doppler_hz = 1500.0;
+    InMemoryConfiguration config;
+    config.set_property("GNSS-SDR.internal_fs_sps", std::to_string(fs));
+    Dll_Pll_Conf trk_conf;
+    trk_conf.SetFromConfiguration(&config, "Tracking_1I");
+    trk_conf.vector_length = static_cast<uint32_t>(std::round(trk_conf.fs_in / (IRNSS_L5I_CODE_RATE_HZ / IRNSS_L5I_CODE_LENGTH_CHIPS)));
+    trk_conf.system = 'I';
+    trk_conf.signal[0] = '1';
+    trk_conf.signal[1] = 'I';
+    trk_conf.signal[2] = '\0';
+    auto tracking = dll_pll_veml_make_tracking(trk_conf);
+    tracking->set_channel(0);
+
+    const auto signal = make_signal(fs, delay_samples, doppler_hz, num_codes);
+    auto source = gr::blocks::vector_source_c::make(std::vector<gr_complex>(signal.begin(), signal.end()), false);
+    auto sink = gr::blocks::null_sink::make(sizeof(Gnss_Synchro));
+    auto top_block = gr::make_top_block("IRNSS L5 tracking benchmark");
+    top_block->connect(source, 0, tracking, 0);
+    top_block->connect(tracking, 0, sink, 0);
+
+    Gnss_Synchro gnss_synchro{};
+    set_irnss_l5_signal(gnss_synchro);
+    while (state.KeepRunning())
+        {
+            source->rewind();
+            gnss_synchro.Acq_delay_samples = delay_samples;
+            gnss_synchro.Acq_doppler_hz = doppler_hz;
+            gnss_synchro.Acq_samplestamp_samples = 0;
+            tracking->set_gnss_synchro(&gnss_synchro);
+            tracking->start_tracking();
+            top_block->run();
+        }
+    state.SetItemsProcessed(state.iterations() * code_length * num_codes);
+}
+
+
+void bm_irnss_l5_subframe_deinterleave_viterbi(benchmark::State& state)
+{
+    // De-interleaving and Viterbi decoding of one subframe, as run by
+    // irnss_telemetry_decoder_gs for each subframe found
+    const int32_t frame_length = IRNSS_L5_SUBFRAME_BITS - IRNSS_L5_PREAMBLE_LENGTH_BITS;
+    std::vector<float> symbols(frame_length);
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> noise(0.0, 1.0);
+    for (auto& symbol : symbols)
+        {
+            symbol = noise(gen);
+        }
+    Irnss_L5_Subframe_Decoder decoder;
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(decoder.decode(symbols.data()).data());
+        }
+}
+
+
+void bm_irnss_l5_subframe_decoder(benchmark::State& state)
+{
+    // CRC check and field extraction of subframes 1 to 3 (the 2-bit subframe ID
+    // field cannot hold 4)
+    const std::array<std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS>, 3> subframes{{make_subframe(1), make_subframe(2), make_subframe(3)}};
+    Irnss_Navigation_Message nav;
+    size_t index = 0;
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(nav.subframe_decoder(subframes[index]));
+            index = (index + 1) % subframes.size();
+        }
+}
+
+
+void bm_irnss_satellite_position(benchmark::State& state)
+{
+    // Geosynchronous orbit, as the IRNSS constellation
+    Irnss_Ephemeris eph;
+    eph.i_satellite_PRN = PRN;
+    eph.d_sqrt_A = 6493.4;
+    eph.d_e_eccentricity = 0.0019;
+    eph.d_i_0 = 0.16;
+    eph.d_OMEGA0 = -0.45;
+    eph.d_OMEGA = 0.62;
+    eph.d_M_0 = 0.31;
+    eph.d_Delta_n = 1.0e-9;
+    eph.d_OMEGA_DOT = -2.5e-9;
+    eph.d_IDOT = 1.0e-10;
+    eph.d_Crs = 120.0;
+    eph.d_Crc = 250.0;
+    eph.d_Cuc = 3.0e-6;
+    eph.d_Cus = 5.0e-6;
+    eph.d_Cic = 1.0e-7;
+    eph.d_Cis = -1.0e-7;
+    eph.d_Toe = 345600;
+    eph.d_Toc = 345600;
+    eph.d_A_f0 = 1.0e-4;
+    eph.d_A_f1 = 1.0e-12;
+    double transmit_time = 345600.0;
+    while (state.KeepRunning())
+        {
+            benchmark::DoNotOptimize(eph.satellitePosition(transmit_time));
+            transmit_time += 1.0e-3;
+        }
+}
+
+
+// The argument is the sampling rate [Hz]
+BENCHMARK(bm_irnss_l5_code_gen_complex_sampled)->Arg(2048000)->Arg(4096000)->Arg(8192000)->Arg(16368000);
+BENCHMARK(bm_irnss_l5_acq_batch_engine_search)->Arg(2048000)->Arg(4096000)->Arg(8192000)->Arg(16368000);
+BENCHMARK(bm_irnss_l5_multicorrelator)->Arg(2048000)->Arg(4096000)->Arg(8192000)->Arg(16368000);
+BENCHMARK(bm_irnss_l5_pcps_acquisition)->Arg(2048000)->Arg(4096000)->Arg(8192000)->Arg(16368000);
+BENCHMARK(bm_irnss_l5_dll_pll_veml_tracking)->Arg(2048000)->Arg(4096000)->Arg(8192000)->Arg(16368000);
+BENCHMARK(bm_irnss_l5_subframe_deinterleave_viterbi);
+BENCHMARK(bm_irnss_l5_subframe_decoder);
+BENCHMARK(bm_irnss_satellite_position);
+BENCHMARK_MAIN();
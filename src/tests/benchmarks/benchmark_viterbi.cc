@@ -0,0 +1,78 @@
+/*!
+ * \file benchmark_viterbi.cc
+ * \brief Benchmark for the K=7, rate 1/2 Viterbi decoders
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "convolutional.h"
+#include "viterbi_k7_r2_decoder.h"
+#include <benchmark/benchmark.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+std::vector<float> random_symbols(int32_t num_data_bits)
+{
+    std::vector<float> symbols(2 * (num_data_bits + 6));
+    std::mt19937 gen(1234);
+    std::normal_distribution<float> dist(0.0, 1.0);
+    for (auto& s : symbols)
+        {
+            s = dist(gen);
+        }
+    return symbols;
+}
+
+
+void bm_viterbi_float(benchmark::State& state)
+{
+    const auto num_data_bits = static_cast<int32_t>(state.range(0));
+    const std::vector<float> symbols = random_symbols(num_data_bits);
+    std::array<int32_t, 2> g_encoder{{121, 91}};
+    std::array<int32_t, 64> out0{};
+    std::array<int32_t, 64> out1{};
+    std::array<int32_t, 64> state0{};
+    std::array<int32_t, 64> state1{};
+    nsc_transit(out0.data(), state0.data(), 0, g_encoder.data(), 7, 2);
+    nsc_transit(out1.data(), state1.data(), 1, g_encoder.data(), 7, 2);
+    std::vector<int32_t> bits(num_data_bits);
+    while (state.KeepRunning())
+        {
+            Viterbi(bits.data(), out0.data(), state0.data(), out1.data(), state1.data(), symbols.data(), 7, 2, num_data_bits);
+            benchmark::DoNotOptimize(bits.data());
+        }
+    state.SetItemsProcessed(state.iterations() * num_data_bits);
+}
+
+
+void bm_viterbi_k7_r2(benchmark::State& state)
+{
+    const auto num_data_bits = static_cast<int32_t>(state.range(0));
+    const std::vector<float> symbols = random_symbols(num_data_bits);
+    Viterbi_K7_R2_Decoder decoder({{121, 91}}, num_data_bits);
+    std::vector<int32_t> bits(num_data_bits);
+    while (state.KeepRunning())
+        {
+            decoder.decode(symbols.data(), bits.data(), num_data_bits);
+            benchmark::DoNotOptimize(bits.data());
+        }
+    state.SetItemsProcessed(state.iterations() * num_data_bits);
+}
+
+
+// 114, 238, 286 and 486 bits are the Galileo I/NAV page part, F/NAV page,
+// IRNSS subframe and Galileo C/NAV page lengths
+BENCHMARK(bm_viterbi_float)->Arg(114)->Arg(238)->Arg(286)->Arg(486);
+BENCHMARK(bm_viterbi_k7_r2)->Arg(114)->Arg(238)->Arg(286)->Arg(486);
+BENCHMARK_MAIN();
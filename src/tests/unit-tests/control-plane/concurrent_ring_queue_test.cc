@@ -0,0 +1,143 @@
+/*!
+ * \file concurrent_ring_queue_test.cc
+ * \brief This file implements unit tests for the Concurrent_Ring_Queue class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "concurrent_ring_queue.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+
+TEST(ConcurrentRingQueueTest, SingleThreadFifo)
+{
+    Concurrent_Ring_Queue<int> queue(5);
+    EXPECT_EQ(queue.capacity(), 8U);
+    EXPECT_TRUE(queue.empty());
+
+    for (int i = 0; i < 5; i++)
+        {
+            EXPECT_TRUE(queue.push(i));
+        }
+    EXPECT_FALSE(queue.empty());
+    EXPECT_EQ(queue.size(), 5U);
+
+    int value = -1;
+    for (int i = 0; i < 5; i++)
+        {
+            ASSERT_TRUE(queue.try_pop(value));
+            EXPECT_EQ(value, i);
+        }
+    EXPECT_FALSE(queue.try_pop(value));
+    EXPECT_TRUE(queue.empty());
+    EXPECT_EQ(queue.size(), 0U);
+    EXPECT_EQ(queue.high_watermark(), 5U);
+    EXPECT_EQ(queue.drops(), 0U);
+}
+
+
+TEST(ConcurrentRingQueueTest, DropsWhenFull)
+{
+    Concurrent_Ring_Queue<int> queue(8);
+    for (int i = 0; i < 10; i++)
+        {
+            queue.push(i);
+        }
+    EXPECT_EQ(queue.size(), 8U);
+    EXPECT_EQ(queue.high_watermark(), 8U);
+    EXPECT_EQ(queue.drops(), 2U);
+
+    // The oldest items are kept, and slots are reusable after a pop
+    int value = -1;
+    ASSERT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(queue.push(10));
+    EXPECT_FALSE(queue.push(11));
+    EXPECT_EQ(queue.drops(), 3U);
+    for (int i = 1; i < 9; i++)
+        {
+            ASSERT_TRUE(queue.try_pop(value));
+            EXPECT_EQ(value, i == 8 ? 10 : i);
+        }
+    EXPECT_TRUE(queue.empty());
+}
+
+
+TEST(ConcurrentRingQueueTest, MultipleProducers)
+{
+    const int num_producers = 4;
+    const int items_per_producer = 10000;
+    Concurrent_Ring_Queue<int64_t> queue(64);
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < num_producers; p++)
+        {
+            producers.emplace_back([&queue, p]() {
+                for (int i = 0; i < items_per_producer; i++)
+                    {
+                        while (!queue.push(static_cast<int64_t>(p) * items_per_producer + i))
+                            {
+                                std::this_thread::yield();
+                            }
+                    }
+            });
+        }
+
+    // Items from each producer must arrive in order
+    std::vector<int> next(num_producers, 0);
+    int64_t value;
+    for (int n = 0; n < num_producers * items_per_producer; n++)
+        {
+            queue.wait_and_pop(value);
+            const auto p = static_cast<int>(value / items_per_producer);
+            ASSERT_LT(p, num_producers);
+            EXPECT_EQ(value % items_per_producer, next[p]);
+            next[p]++;
+        }
+    for (auto& producer : producers)
+        {
+            producer.join();
+        }
+    EXPECT_TRUE(queue.empty());
+    EXPECT_LE(queue.high_watermark(), queue.capacity());
+}
+
+
+TEST(ConcurrentRingQueueTest, TimedWaitExpires)
+{
+    Concurrent_Ring_Queue<int> queue;
+    int value = 0;
+    const auto start = std::chrono::steady_clock::now();
+    EXPECT_FALSE(queue.timed_wait_and_pop(value, 20));
+    EXPECT_GE(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(20));
+}
+
+
+TEST(ConcurrentRingQueueTest, WaitWakesUpOnPush)
+{
+    Concurrent_Ring_Queue<int> queue;
+    std::thread producer([&queue]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.push(42);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        queue.push(43);
+    });
+    int value = 0;
+    queue.wait_and_pop(value);
+    EXPECT_EQ(value, 42);
+    EXPECT_TRUE(queue.timed_wait_and_pop(value, 5000));
+    EXPECT_EQ(value, 43);
+    producer.join();
+}
@@ -19,7 +19,7 @@
 
 #include "channel_event.h"
 #include "command_event.h"
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "control_thread.h"
 #include "gnss_sdr_make_unique.h"
 #include "in_memory_configuration.h"
@@ -109,7 +109,7 @@ TEST_F(ControlThreadTest /*unused*/, InstantiateRunControlMessages /*unused*/)
 
     std::shared_ptr<ControlThread> control_thread = std::make_shared<ControlThread>(config);
 
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> control_queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
     control_queue->push(pmt::make_any(channel_event_make(0, 0)));
     control_queue->push(pmt::make_any(channel_event_make(1, 0)));
     control_queue->push(pmt::make_any(command_event_make(200, 0)));
@@ -167,7 +167,7 @@ TEST_F(ControlThreadTest /*unused*/, InstantiateRunControlMessages2 /*unused*/)
     config->set_property("GNSS-SDR.internal_fs_sps", "4000000");
 
     auto control_thread2 = std::make_unique<ControlThread>(config);
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue2 = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> control_queue2 = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
 
     control_queue2->push(pmt::make_any(channel_event_make(0, 0)));
     control_queue2->push(pmt::make_any(channel_event_make(2, 0)));
@@ -229,7 +229,7 @@ TEST_F(ControlThreadTest /*unused*/, StopReceiverProgrammatically /*unused*/)
     config->set_property("GNSS-SDR.internal_fs_sps", "4000000");
 
     std::shared_ptr<ControlThread> control_thread = std::make_shared<ControlThread>(config);
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> control_queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> control_queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
     control_thread->set_control_queue(control_queue);
 
     std::thread stop_receiver_thread(stop_receiver);
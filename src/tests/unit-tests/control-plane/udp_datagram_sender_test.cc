@@ -0,0 +1,118 @@
+/*!
+ * \file udp_datagram_sender_test.cc
+ * \brief This file implements tests for Udp_Datagram_Sender and
+ * Gnss_Synchro_Udp_Sink
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_synchro_udp_sink.h"
+#include "serdes_gnss_synchro.h"
+#include "udp_datagram_sender.h"
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/asio.hpp>
+#include <boost/serialization/vector.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+class UdpDatagramSenderTest : public ::testing::Test
+{
+protected:
+    UdpDatagramSenderTest() : receiver(io_context, boost::asio::ip::udp::endpoint(boost::asio::ip::address_v4::loopback(), 0))
+    {
+        port = receiver.local_endpoint().port();
+    }
+
+    std::string receive()
+    {
+        std::array<char, 65536> buffer{};
+        const size_t size = receiver.receive(boost::asio::buffer(buffer));
+        return std::string(buffer.data(), size);
+    }
+
+    b_io_context io_context;
+    boost::asio::ip::udp::socket receiver;
+    uint16_t port;
+};
+
+
+TEST_F(UdpDatagramSenderTest, SendsQueuedDatagramsInOrder)
+{
+    Udp_Datagram_Sender sender({"127.0.0.1"}, port);
+    ASSERT_EQ(sender.connected_endpoints(), 1U);
+    for (int epoch = 0; epoch < 2; epoch++)
+        {
+            sender.new_datagram() = "first";
+            sender.new_datagram() = std::string(1000, 'x');
+            std::ostream stream(&sender.new_datagram_streambuf());
+            stream << "third " << epoch;
+            EXPECT_EQ(sender.queued_datagrams(), 3U);
+            EXPECT_TRUE(sender.send());
+            EXPECT_EQ(sender.queued_datagrams(), 0U);
+
+            EXPECT_EQ(receive(), "first");
+            EXPECT_EQ(receive(), std::string(1000, 'x'));
+            EXPECT_EQ(receive(), "third " + std::to_string(epoch));
+        }
+}
+
+
+TEST_F(UdpDatagramSenderTest, SkipsInvalidAddresses)
+{
+    Udp_Datagram_Sender sender({"not.an.address", "127.0.0.1"}, port);
+    EXPECT_EQ(sender.connected_endpoints(), 1U);
+    sender.new_datagram() = "hello";
+    EXPECT_TRUE(sender.send());
+    EXPECT_EQ(receive(), "hello");
+}
+
+
+TEST_F(UdpDatagramSenderTest, GnssSynchroSink)
+{
+    Gnss_Synchro gs = Gnss_Synchro();
+    gs.System = 'G';
+    gs.Signal[0] = '1';
+    gs.Signal[1] = 'C';
+    gs.PRN = 17;
+    gs.Pseudorange_m = 22000002.1;
+    std::vector<Gnss_Synchro> stocks(1, gs);
+
+    Gnss_Synchro_Udp_Sink protobuf_sink({"127.0.0.1"}, port, true);
+    protobuf_sink.queue_gnss_synchro(stocks);
+    stocks[0].PRN = 23;
+    EXPECT_TRUE(protobuf_sink.write_gnss_synchro(stocks));
+    Serdes_Gnss_Synchro serdes;
+    for (uint32_t prn : {17U, 23U})
+        {
+            gnss_sdr::Observables obs;
+            ASSERT_TRUE(obs.ParseFromString(receive()));
+            const std::vector<Gnss_Synchro> stocks_read = serdes.readProtobuffer(obs);
+            ASSERT_EQ(stocks_read.size(), 1U);
+            EXPECT_EQ(stocks_read[0].System, 'G');
+            EXPECT_EQ(std::string(stocks_read[0].Signal), "1C");
+            EXPECT_EQ(stocks_read[0].PRN, prn);
+            EXPECT_DOUBLE_EQ(stocks_read[0].Pseudorange_m, 22000002.1);
+        }
+
+    Gnss_Synchro_Udp_Sink archive_sink({"127.0.0.1"}, port, false);
+    EXPECT_TRUE(archive_sink.write_gnss_synchro(stocks));
+    std::istringstream archive_stream(receive());
+    boost::archive::binary_iarchive ia{archive_stream};
+    std::vector<Gnss_Synchro> stocks_read;
+    ia >> stocks_read;
+    ASSERT_EQ(stocks_read.size(), 1U);
+    EXPECT_EQ(stocks_read[0].PRN, 23U);
+    EXPECT_DOUBLE_EQ(stocks_read[0].Pseudorange_m, 22000002.1);
+}
@@ -0,0 +1,240 @@
+/*!
+ * \file acq_batch_engine_test.cc
+ * \brief Tests for the Acq_Batch_Engine class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "GPS_L1_CA.h"
+#include "MATH_CONSTANTS.h"
+#include "acq_batch_engine.h"
+#include "gnss_sdr_fft.h"
+#include "gps_sdr_signal_replica.h"
+#include <gtest/gtest.h>
+#include <volk/volk.h>
+#include <volk_gnsssdr/volk_gnsssdr.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+
+namespace
+{
+constexpr uint32_t BATCH_TEST_FS = 2000000;
+constexpr uint32_t BATCH_TEST_FFT_SIZE = 2000;
+constexpr uint32_t BATCH_TEST_DOPPLER_BINS = 21;
+constexpr int32_t BATCH_TEST_DOPPLER_MAX = 5000;
+constexpr int32_t BATCH_TEST_DOPPLER_STEP = 500;
+
+volk_gnsssdr::vector<std::complex<float>> code_spectrum(uint32_t prn)
+{
+    std::vector<std::complex<float>> code(BATCH_TEST_FFT_SIZE);
+    gps_l1_ca_code_gen_complex_sampled(code, prn, BATCH_TEST_FS, 0);
+    auto fft = gnss_fft_fwd_make_unique(BATCH_TEST_FFT_SIZE);
+    std::copy(code.begin(), code.end(), fft->get_inbuf());
+    fft->execute();
+    volk_gnsssdr::vector<std::complex<float>> spectrum(BATCH_TEST_FFT_SIZE);
+    volk_32fc_conjugate_32fc(spectrum.data(), fft->get_outbuf(), BATCH_TEST_FFT_SIZE);
+    return spectrum;
+}
+
+volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> doppler_wipeoffs()
+{
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> wipeoffs(BATCH_TEST_DOPPLER_BINS, volk_gnsssdr::vector<std::complex<float>>(BATCH_TEST_FFT_SIZE));
+    for (uint32_t i = 0; i < BATCH_TEST_DOPPLER_BINS; i++)
+        {
+            const float doppler = static_cast<float>(-BATCH_TEST_DOPPLER_MAX + BATCH_TEST_DOPPLER_STEP * static_cast<int32_t>(i));
+            const float phase_step_rad = static_cast<float>(TWO_PI) * doppler / static_cast<float>(BATCH_TEST_FS);
+            std::array<float, 1> phase{};
+            volk_gnsssdr_s32f_sincos_32fc(wipeoffs[i].data(), -phase_step_rad, phase.data(), BATCH_TEST_FFT_SIZE);
+        }
+    return wipeoffs;
+}
+}  // namespace
+
+
+TEST(AcqBatchEngineTest, FindsCodeDelayAndDoppler)
+{
+    // Input: PRN 3 delayed by 300 samples and shifted by +1500 Hz
+    const uint32_t delay = 300;
+    const float doppler = 1500.0;
+    std::vector<std::complex<float>> code(BATCH_TEST_FFT_SIZE);
+    gps_l1_ca_code_gen_complex_sampled(code, 3, BATCH_TEST_FS, 0);
+    volk_gnsssdr::vector<std::complex<float>> input(BATCH_TEST_FFT_SIZE);
+    std::array<float, 1> phase{};
+    volk_gnsssdr_s32f_sincos_32fc(input.data(), static_cast<float>(TWO_PI) * doppler / static_cast<float>(BATCH_TEST_FS), phase.data(), BATCH_TEST_FFT_SIZE);
+    for (uint32_t n = 0; n < BATCH_TEST_FFT_SIZE; n++)
+        {
+            input[n] *= code[(n + BATCH_TEST_FFT_SIZE - delay) % BATCH_TEST_FFT_SIZE];
+        }
+
+    const auto wipeoffs = doppler_wipeoffs();
+    const auto spectrum = code_spectrum(3);
+    volk_gnsssdr::vector<volk_gnsssdr::vector<float>> grid(BATCH_TEST_DOPPLER_BINS, volk_gnsssdr::vector<float>(BATCH_TEST_FFT_SIZE));
+    Acq_Batch_Engine engine(BATCH_TEST_FFT_SIZE, BATCH_TEST_FFT_SIZE, 0);
+    engine.search(input.data(), wipeoffs, BATCH_TEST_DOPPLER_BINS, {spectrum.data(), &grid}, false);
+
+    // One forward and one inverse FFT per Doppler bin
+    EXPECT_EQ(engine.forward_ffts(), static_cast<uint64_t>(BATCH_TEST_DOPPLER_BINS));
+    EXPECT_EQ(engine.inverse_ffts(), static_cast<uint64_t>(BATCH_TEST_DOPPLER_BINS));
+
+    // The peak must be at the right code delay and Doppler bin
+    const Acq_Grid_Peak peak = engine.find_peak(grid, BATCH_TEST_DOPPLER_BINS, BATCH_TEST_FFT_SIZE);
+    EXPECT_EQ(peak.time_index, delay);
+    EXPECT_EQ(-BATCH_TEST_DOPPLER_MAX + BATCH_TEST_DOPPLER_STEP * static_cast<int32_t>(peak.doppler_index), static_cast<int32_t>(doppler));
+}
+
+
+TEST(AcqBatchEngineTest, NonCoherentAccumulation)
+{
+    volk_gnsssdr::vector<std::complex<float>> input(BATCH_TEST_FFT_SIZE, std::complex<float>(1.0, 0.0));
+    const auto wipeoffs = doppler_wipeoffs();
+    const auto spectrum = code_spectrum(1);
+    volk_gnsssdr::vector<volk_gnsssdr::vector<float>> grid(BATCH_TEST_DOPPLER_BINS, volk_gnsssdr::vector<float>(BATCH_TEST_FFT_SIZE));
+    const Acq_Batch_Target target{spectrum.data(), &grid};
+    Acq_Batch_Engine engine(BATCH_TEST_FFT_SIZE, BATCH_TEST_FFT_SIZE, 0);
+
+    engine.search(input.data(), wipeoffs, BATCH_TEST_DOPPLER_BINS, target, false);
+    const auto first = grid;
+    engine.search(input.data(), wipeoffs, BATCH_TEST_DOPPLER_BINS, target, true);
+    for (uint32_t d = 0; d < BATCH_TEST_DOPPLER_BINS; d++)
+        {
+            for (uint32_t n = 0; n < BATCH_TEST_FFT_SIZE; n++)
+                {
+                    EXPECT_FLOAT_EQ(grid[d][n], 2.0F * first[d][n]);
+                }
+        }
+}
+
+
+TEST(AcqBatchEngineTest, DopplerByBinRotationMatchesWipeoffSearch)
+{
+    std::vector<std::complex<float>> code(BATCH_TEST_FFT_SIZE);
+    gps_l1_ca_code_gen_complex_sampled(code, 5, BATCH_TEST_FS, 0);
+    volk_gnsssdr::vector<std::complex<float>> input(BATCH_TEST_FFT_SIZE);
+    std::array<float, 1> phase{};
+    volk_gnsssdr_s32f_sincos_32fc(input.data(), static_cast<float>(TWO_PI) * -2500.0F / static_cast<float>(BATCH_TEST_FS), phase.data(), BATCH_TEST_FFT_SIZE);
+    for (uint32_t n = 0; n < BATCH_TEST_FFT_SIZE; n++)
+        {
+            input[n] *= code[(n + BATCH_TEST_FFT_SIZE - 1234) % BATCH_TEST_FFT_SIZE];
+        }
+    const auto spectrum = code_spectrum(5);
+
+    volk_gnsssdr::vector<volk_gnsssdr::vector<float>> direct_grid(BATCH_TEST_DOPPLER_BINS, volk_gnsssdr::vector<float>(BATCH_TEST_FFT_SIZE));
+    Acq_Batch_Engine direct_engine(BATCH_TEST_FFT_SIZE, BATCH_TEST_FFT_SIZE, 0);
+    direct_engine.search(input.data(), doppler_wipeoffs(), BATCH_TEST_DOPPLER_BINS, {spectrum.data(), &direct_grid}, false);
+
+    // The FFT bin spacing is 1 kHz, so the 500 Hz grid only needs two residual wipe-offs: 0 Hz and 500 Hz
+    volk_gnsssdr::vector<volk_gnsssdr::vector<std::complex<float>>> residual_wipeoffs(2, volk_gnsssdr::vector<std::complex<float>>(BATCH_TEST_FFT_SIZE));
+    volk_gnsssdr_s32f_sincos_32fc(residual_wipeoffs[0].data(), 0.0, phase.data(), BATCH_TEST_FFT_SIZE);
+    phase[0] = 0.0;
+    volk_gnsssdr_s32f_sincos_32fc(residual_wipeoffs[1].data(), -static_cast<float>(TWO_PI) * 500.0F / static_cast<float>(BATCH_TEST_FS), phase.data(), BATCH_TEST_FFT_SIZE);
+    std::vector<Acq_Doppler_Rotation> rotations(BATCH_TEST_DOPPLER_BINS);
+    for (uint32_t i = 0; i < BATCH_TEST_DOPPLER_BINS; i++)
+        {
+            const int32_t doppler = -BATCH_TEST_DOPPLER_MAX + BATCH_TEST_DOPPLER_STEP * static_cast<int32_t>(i);
+            const int32_t bin_shift = (doppler >= 0 ? doppler / 1000 : -((-doppler + 999) / 1000));
+            rotations[i] = {static_cast<uint32_t>((doppler - bin_shift * 1000) / 500), bin_shift};
+        }
+    volk_gnsssdr::vector<volk_gnsssdr::vector<float>> rotated_grid(BATCH_TEST_DOPPLER_BINS, volk_gnsssdr::vector<float>(BATCH_TEST_FFT_SIZE));
+    Acq_Batch_Engine rotation_engine(BATCH_TEST_FFT_SIZE, BATCH_TEST_FFT_SIZE, 0);
+    rotation_engine.search_by_rotation(input.data(), residual_wipeoffs, rotations, {spectrum.data(), &rotated_grid}, false);
+
+    EXPECT_EQ(rotation_engine.forward_ffts(), 2U);
+    EXPECT_EQ(rotation_engine.inverse_ffts(), static_cast<uint64_t>(BATCH_TEST_DOPPLER_BINS));
+
+    float peak = 0.0;
+    for (uint32_t d = 0; d < BATCH_TEST_DOPPLER_BINS; d++)
+        {
+            for (uint32_t n = 0; n < BATCH_TEST_FFT_SIZE; n++)
+                {
+                    peak = std::max(peak, direct_grid[d][n]);
+                }
+        }
+    for (uint32_t d = 0; d < BATCH_TEST_DOPPLER_BINS; d++)
+        {
+            for (uint32_t n = 0; n < BATCH_TEST_FFT_SIZE; n++)
+                {
+                    ASSERT_NEAR(direct_grid[d][n], rotated_grid[d][n], peak * 1e-4);
+                }
+        }
+    // -2500 Hz is Doppler bin 5
+    uint32_t index_time = 0;
+    volk_gnsssdr_32f_index_max_32u(&index_time, rotated_grid[5].data(), BATCH_TEST_FFT_SIZE);
+    EXPECT_EQ(index_time, 1234U);
+}
+
+
+TEST(AcqBatchEngineTest, ParallelSearchIsBitIdentical)
+{
+    // Input: PRN 7 delayed by 1234 samples and shifted by -2500 Hz
+    const uint32_t delay = 1234;
+    const float doppler = -2500.0;
+    std::vector<std::complex<float>> code(BATCH_TEST_FFT_SIZE);
+    gps_l1_ca_code_gen_complex_sampled(code, 7, BATCH_TEST_FS, 0);
+    volk_gnsssdr::vector<std::complex<float>> input(BATCH_TEST_FFT_SIZE);
+    std::array<float, 1> phase{};
+    volk_gnsssdr_s32f_sincos_32fc(input.data(), static_cast<float>(TWO_PI) * doppler / static_cast<float>(BATCH_TEST_FS), phase.data(), BATCH_TEST_FFT_SIZE);
+    for (uint32_t n = 0; n < BATCH_TEST_FFT_SIZE; n++)
+        {
+            input[n] *= code[(n + BATCH_TEST_FFT_SIZE - delay) % BATCH_TEST_FFT_SIZE];
+        }
+
+    const auto wipeoffs = doppler_wipeoffs();
+    const auto spectrum = code_spectrum(7);
+
+    volk_gnsssdr::vector<volk_gnsssdr::vector<float>> serial_grid(BATCH_TEST_DOPPLER_BINS, volk_gnsssdr::vector<float>(BATCH_TEST_FFT_SIZE));
+    Acq_Batch_Engine serial_engine(BATCH_TEST_FFT_SIZE, BATCH_TEST_FFT_SIZE, 0, 1);
+    serial_engine.search(input.data(), wipeoffs, BATCH_TEST_DOPPLER_BINS, {spectrum.data(), &serial_grid}, false);
+    serial_engine.search(input.data(), wipeoffs, BATCH_TEST_DOPPLER_BINS, {spectrum.data(), &serial_grid}, true);
+    const Acq_Grid_Peak serial_peak = serial_engine.find_peak(serial_grid, BATCH_TEST_DOPPLER_BINS, BATCH_TEST_FFT_SIZE);
+    EXPECT_EQ(serial_peak.time_index, delay);
+    EXPECT_EQ(-BATCH_TEST_DOPPLER_MAX + BATCH_TEST_DOPPLER_STEP * static_cast<int32_t>(serial_peak.doppler_index), static_cast<int32_t>(doppler));
+
+    // More workers than Doppler bins are also accepted
+    for (uint32_t workers : {2U, 3U, 4U, 8U, 32U})
+        {
+            volk_gnsssdr::vector<volk_gnsssdr::vector<float>> parallel_grid(BATCH_TEST_DOPPLER_BINS, volk_gnsssdr::vector<float>(BATCH_TEST_FFT_SIZE));
+            Acq_Batch_Engine parallel_engine(BATCH_TEST_FFT_SIZE, BATCH_TEST_FFT_SIZE, 0, workers);
+            EXPECT_EQ(parallel_engine.num_workers(), workers);
+            parallel_engine.search(input.data(), wipeoffs, BATCH_TEST_DOPPLER_BINS, {spectrum.data(), &parallel_grid}, false);
+            parallel_engine.search(input.data(), wipeoffs, BATCH_TEST_DOPPLER_BINS, {spectrum.data(), &parallel_grid}, true);
+            EXPECT_EQ(parallel_engine.forward_ffts(), static_cast<uint64_t>(2 * BATCH_TEST_DOPPLER_BINS));
+            for (uint32_t d = 0; d < BATCH_TEST_DOPPLER_BINS; d++)
+                {
+                    for (uint32_t n = 0; n < BATCH_TEST_FFT_SIZE; n++)
+                        {
+                            ASSERT_EQ(serial_grid[d][n], parallel_grid[d][n]);
+                        }
+                }
+            const Acq_Grid_Peak parallel_peak = parallel_engine.find_peak(parallel_grid, BATCH_TEST_DOPPLER_BINS, BATCH_TEST_FFT_SIZE);
+            EXPECT_EQ(parallel_peak.value, serial_peak.value);
+            EXPECT_EQ(parallel_peak.doppler_index, serial_peak.doppler_index);
+            EXPECT_EQ(parallel_peak.time_index, serial_peak.time_index);
+        }
+}
+
+
+TEST(AcqBatchEngineTest, FindPeakKeepsFirstMaximum)
+{
+    volk_gnsssdr::vector<volk_gnsssdr::vector<float>> grid(BATCH_TEST_DOPPLER_BINS, volk_gnsssdr::vector<float>(BATCH_TEST_FFT_SIZE, 1.0));
+    grid[5][100] = 10.0;
+    grid[17][50] = 10.0;
+    for (uint32_t workers : {1U, 4U})
+        {
+            Acq_Batch_Engine engine(BATCH_TEST_FFT_SIZE, BATCH_TEST_FFT_SIZE, 0, workers);
+            const Acq_Grid_Peak peak = engine.find_peak(grid, BATCH_TEST_DOPPLER_BINS, BATCH_TEST_FFT_SIZE);
+            EXPECT_EQ(peak.value, 10.0);
+            EXPECT_EQ(peak.doppler_index, 5U);
+            EXPECT_EQ(peak.time_index, 100U);
+        }
+}
@@ -17,6 +17,7 @@
 
 #include "GPS_L1_CA.h"
 #include "acquisition_dump_reader.h"
+#include "concurrent_queue.h"
 #include "display.h"
 #include "file_configuration.h"
 #include "galileo_e1_pcps_ambiguous_acquisition.h"
@@ -328,7 +329,7 @@ protected:
 
     Concurrent_Queue<int> channel_internal_queue;
 
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue;
     gr::top_block_sptr top_block;
     std::shared_ptr<AcquisitionInterface> acquisition;
     std::shared_ptr<InMemoryConfiguration> config;
@@ -576,7 +577,7 @@ int AcquisitionPerformanceTest::run_receiver()
     auto msg_rx = AcqPerfTest_msg_rx_make(channel_internal_queue);
     gr::blocks::skiphead::sptr skiphead = gr::blocks::skiphead::make(sizeof(gr_complex), FLAGS_acq_test_skiphead);
 
-    queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
     gnss_synchro = Gnss_Synchro();
     init();
 
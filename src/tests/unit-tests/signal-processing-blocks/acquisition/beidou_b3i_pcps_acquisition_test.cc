@@ -20,7 +20,7 @@
 #include "Beidou_B3I.h"
 #include "acquisition_dump_reader.h"
 #include "beidou_b3i_pcps_acquisition.h"
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "gnss_block_interface.h"
 #include "gnss_sdr_filesystem.h"
 #include "gnss_sdr_valve.h"
@@ -247,7 +247,7 @@ TEST_F(BeidouB3iPcpsAcquisitionTest, ConnectAndRun)
     int nsamples = 50000;
     std::chrono::time_point<std::chrono::system_clock> start, end;
     std::chrono::duration<double> elapsed_seconds(0);
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
 
     top_block = gr::make_top_block("Acquisition test");
     init();
@@ -0,0 +1,111 @@
+/*!
+ * \file code_spectrum_cache_test.cc
+ * \brief Tests for the Code_Spectrum_Cache class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "code_spectrum_cache.h"
+#include <gtest/gtest.h>
+
+
+TEST(CodeSpectrumCacheTest, SharesSpectraBetweenRequests)
+{
+    auto& cache = Code_Spectrum_Cache::instance();
+    cache.clear();
+    const uint64_t misses = cache.misses();
+    const uint64_t hits = cache.hits();
+
+    int computations = 0;
+    auto compute = [&computations](Code_Spectrum_Cache::Spectrum& spectrum) {
+        computations++;
+        for (size_t i = 0; i < spectrum.size(); i++)
+            {
+                spectrum[i] = std::complex<float>(static_cast<float>(i), 0.0);
+            }
+    };
+
+    const Code_Spectrum_Key key_prn1{'I', "5S", 1, 24000000, 24000, 0, 0};
+    const Code_Spectrum_Key key_prn2{'I', "5S", 2, 24000000, 24000, 0, 0};
+    const Code_Spectrum_Key key_prn1_padded{'I', "5S", 1, 24000000, 24000, 12000, 0};
+
+    auto a = cache.get(key_prn1, compute);
+    auto b = cache.get(key_prn1, compute);
+    auto c = cache.get(key_prn2, compute);
+    auto d = cache.get(key_prn1_padded, compute);
+
+    EXPECT_EQ(a, b);
+    EXPECT_NE(a, c);
+    EXPECT_NE(a, d);
+    EXPECT_EQ(a->size(), 24000U);
+    EXPECT_EQ(computations, 3);
+    EXPECT_EQ(cache.misses() - misses, 3U);
+    EXPECT_EQ(cache.hits() - hits, 1U);
+    EXPECT_EQ(cache.size(), 3U);
+
+    // Without memory budget, only the borrowed spectra survive a trim
+    const size_t max_released_bytes = cache.max_released_bytes();
+    c.reset();
+    cache.set_max_released_bytes(0);
+    EXPECT_EQ(cache.size(), 2U);
+    cache.set_max_released_bytes(max_released_bytes);
+    cache.clear();
+    EXPECT_EQ(cache.size(), 0U);
+    EXPECT_FLOAT_EQ((*a)[10].real(), 10.0);
+}
+
+
+TEST(CodeSpectrumCacheTest, KeepsReleasedSpectraWithinBudget)
+{
+    auto& cache = Code_Spectrum_Cache::instance();
+    cache.clear();
+    const size_t max_released_bytes = cache.max_released_bytes();
+    const uint64_t hits = cache.hits();
+
+    int computations = 0;
+    auto compute = [&computations](Code_Spectrum_Cache::Spectrum& spectrum) {
+        computations++;
+        spectrum[0] = std::complex<float>(static_cast<float>(computations), 0.0);
+    };
+
+    // Room for two released spectra
+    const uint32_t fft_size = 1024;
+    cache.set_max_released_bytes(2 * fft_size * sizeof(Code_Spectrum_Cache::Spectrum::value_type));
+    const Code_Spectrum_Key key_prn1{'I', "5S", 1, 24000000, fft_size, 0, 0};
+    const Code_Spectrum_Key key_prn2{'I', "5S", 2, 24000000, fft_size, 0, 0};
+    const Code_Spectrum_Key key_prn3{'I', "5S", 3, 24000000, fft_size, 0, 0};
+
+    // A channel releases PRN 1, and another channel acquires it later
+    auto spectrum = cache.get(key_prn1, compute);
+    spectrum.reset();
+    cache.trim();
+    spectrum = cache.get(key_prn1, compute);
+    EXPECT_EQ(computations, 1);
+    EXPECT_EQ(cache.hits() - hits, 1U);
+    EXPECT_FLOAT_EQ((*spectrum)[0].real(), 1.0);
+    spectrum.reset();
+
+    // Beyond the budget, the least recently requested spectrum is removed
+    cache.get(key_prn2, compute);
+    cache.get(key_prn1, compute);
+    cache.get(key_prn3, compute);
+    cache.trim();
+    EXPECT_EQ(cache.size(), 2U);
+    EXPECT_EQ(computations, 3);
+    cache.get(key_prn1, compute);
+    cache.get(key_prn3, compute);
+    EXPECT_EQ(computations, 3);
+    cache.get(key_prn2, compute);
+    EXPECT_EQ(computations, 4);
+
+    cache.set_max_released_bytes(max_released_bytes);
+    cache.clear();
+}
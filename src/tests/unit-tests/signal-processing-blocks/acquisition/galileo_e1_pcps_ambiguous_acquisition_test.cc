@@ -19,7 +19,7 @@
 
 #include "Galileo_E1.h"
 #include "acquisition_dump_reader.h"
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "galileo_e1_pcps_ambiguous_acquisition.h"
 #include "gnss_block_factory.h"
 #include "gnss_block_interface.h"
@@ -255,7 +255,7 @@ TEST_F(GalileoE1PcpsAmbiguousAcquisitionTest, ConnectAndRun)
     std::chrono::time_point<std::chrono::system_clock> start, end;
     std::chrono::duration<double> elapsed_seconds(0);
     top_block = gr::make_top_block("Acquisition test");
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
     init();
     std::shared_ptr<GNSSBlockInterface> acq_ = factory->GetBlock(config.get(), "Acquisition_1B", 1, 0);
     std::shared_ptr<AcquisitionInterface> acquisition = std::dynamic_pointer_cast<AcquisitionInterface>(acq_);
@@ -17,6 +17,7 @@
 
 
 #include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "configuration_interface.h"
 #include "fir_filter.h"
 #include "gen_signal_source.h"
@@ -142,7 +143,7 @@ protected:
 
     Concurrent_Queue<int> channel_internal_queue;
 
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t> > queue;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t> > queue;
     gr::top_block_sptr top_block;
     std::shared_ptr<GlonassL2CaPcpsAcquisition> acquisition;
     std::shared_ptr<InMemoryConfiguration> config;
@@ -439,7 +440,7 @@ TEST_F(GlonassL2CaPcpsAcquisitionTest, ConnectAndRun)
     int nsamples = floor(fs_in * integration_time_ms * 1e-3);
     std::chrono::time_point<std::chrono::system_clock> begin, end;
     std::chrono::duration<double> elapsed_seconds(0);
-    queue = std::make_shared<Concurrent_Queue<pmt::pmt_t> >();
+    queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t> >();
     top_block = gr::make_top_block("Acquisition test");
 
     config_1();
@@ -469,7 +470,7 @@ TEST_F(GlonassL2CaPcpsAcquisitionTest, ConnectAndRun)
 TEST_F(GlonassL2CaPcpsAcquisitionTest, ValidationOfResults)
 {
     config_1();
-    queue = std::make_shared<Concurrent_Queue<pmt::pmt_t> >();
+    queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t> >();
     top_block = gr::make_top_block("Acquisition test");
 
     acquisition = std::make_shared<GlonassL2CaPcpsAcquisition>(config.get(), "Acquisition_2G", 1, 0);
@@ -556,7 +557,7 @@ TEST_F(GlonassL2CaPcpsAcquisitionTest, ValidationOfResults)
 TEST_F(GlonassL2CaPcpsAcquisitionTest, ValidationOfResultsProbabilities)
 {
     config_2();
-    queue = std::make_shared<Concurrent_Queue<pmt::pmt_t> >();
+    queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t> >();
     top_block = gr::make_top_block("Acquisition test");
     acquisition = std::make_shared<GlonassL2CaPcpsAcquisition>(config.get(), "Acquisition_2G", 1, 0);
     auto msg_rx = GlonassL2CaPcpsAcquisitionTest_msg_rx_make(channel_internal_queue);
@@ -19,7 +19,7 @@
 
 #include "GPS_L1_CA.h"
 #include "acquisition_dump_reader.h"
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "gnss_block_interface.h"
 #include "gnss_sdr_filesystem.h"
 #include "gnss_sdr_valve.h"
@@ -247,7 +247,7 @@ TEST_F(GpsL1CaPcpsAcquisitionTest /*unused*/, ConnectAndRun /*unused*/)
     std::chrono::time_point<std::chrono::system_clock> start;
     std::chrono::time_point<std::chrono::system_clock> end;
     std::chrono::duration<double> elapsed_seconds(0);
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t> > queue = std::make_shared<Concurrent_Queue<pmt::pmt_t> >();
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t> > queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t> >();
 
     top_block = gr::make_top_block("Acquisition test");
     init();
@@ -0,0 +1,134 @@
+/*!
+ * \file fused_conditioner_test.cc
+ * \brief This file implements unit tests for the fused_conditioner custom block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "fused_conditioner.h"
+#include "pulse_blanking_detector.h"
+#include <gnuradio/filter/firdes.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <pmt/pmt.h>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_b.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+
+TEST(FusedConditionerTest, MatchesMixFilterDecimate)
+{
+    const double sampling_freq = 4000000.0;
+    const double intermediate_freq = 310000.0;
+    const int32_t decimation_factor = 5;
+    const std::vector<float> taps = gr::filter::firdes::low_pass(1.0, sampling_freq, 350000.0, 100000.0);
+
+    // Interleaved I/Q bytes
+    std::vector<int8_t> samples(2 * 100000);
+    std::mt19937 generator(1);
+    std::uniform_int_distribution<int> distribution(-128, 127);
+    for (auto &sample : samples)
+        {
+            sample = static_cast<int8_t>(distribution(generator));
+        }
+    const std::vector<unsigned char> input(samples.begin(), samples.end());
+
+    auto top_block = gr::make_top_block("FusedConditionerTest");
+    auto source = gr::blocks::vector_source_b::make(input);
+    auto conditioner = make_fused_conditioner("ibyte", taps, intermediate_freq, sampling_freq,
+        decimation_factor, false, false, 0.04, 32, 12500, 5000000);
+    auto sink = gr::blocks::vector_sink_c::make();
+    top_block->connect(source, 0, conditioner, 0);
+    top_block->connect(conditioner, 0, sink, 0);
+    top_block->run();
+
+    // Mix the IF down to zero Hz, filter and keep one out of decimation_factor samples
+    const std::vector<gr_complex> output = sink->data();
+    ASSERT_GT(output.size(), 0U);
+    const double w = TWO_PI * intermediate_freq / sampling_freq;
+    for (size_t m = 0; m < output.size(); m++)
+        {
+            std::complex<double> expected(0.0, 0.0);
+            for (size_t k = 0; k < taps.size() and k <= m * decimation_factor; k++)
+                {
+                    const size_t n = m * decimation_factor - k;
+                    const std::complex<double> sample(samples[2 * n], samples[2 * n + 1]);
+                    expected += static_cast<double>(taps[k]) * sample * std::polar(1.0, -w * static_cast<double>(n));
+                }
+            EXPECT_NEAR(output[m].real(), expected.real(), 5e-2);
+            EXPECT_NEAR(output[m].imag(), expected.imag(), 5e-2);
+        }
+}
+
+
+TEST(FusedConditionerTest, BlanksLikePulseBlankingDetector)
+{
+    const int32_t length = 32;
+
+    // Noise with a strong pulse
+    std::vector<gr_complex> input(100000);
+    std::mt19937 generator(1);
+    std::normal_distribution<float> distribution(0.0, 1.0);
+    for (auto &sample : input)
+        {
+            sample = gr_complex(distribution(generator), distribution(generator));
+        }
+    for (size_t n = 50000; n < 50200; n++)
+        {
+            input[n] *= 30.0F;
+        }
+
+    auto top_block = gr::make_top_block("FusedConditionerTest");
+    auto source = gr::blocks::vector_source_c::make(input);
+    auto conditioner = make_fused_conditioner("gr_complex", std::vector<float>(1, 1.0), 0.0, 4000000.0,
+        1, false, true, 0.04, length, 50, 1000);
+    auto sink = gr::blocks::vector_sink_c::make();
+    top_block->connect(source, 0, conditioner, 0);
+    top_block->connect(conditioner, 0, sink, 0);
+    top_block->run();
+    EXPECT_TRUE(conditioner->has_msg_port(pmt::mp("interference")));
+
+    // The output is delayed by half a window, as if the input started with zeros
+    const std::vector<gr_complex> output = sink->data();
+    ASSERT_GT(output.size(), 50200U);
+    std::vector<gr_complex> delayed(length / 2, gr_complex(0.0, 0.0));
+    delayed.insert(delayed.end(), input.begin(), input.end());
+    std::vector<gr_complex> expected(output.size());
+    Pulse_Blanking_Detector detector(0.04, length, 50, 1000);
+    detector.blank(delayed.data(), expected.data(), static_cast<int32_t>(output.size()));
+    for (size_t n = 0; n < output.size(); n++)
+        {
+            EXPECT_EQ(output[n], expected[n]) << "Sample " << n;
+        }
+    for (size_t n = 50000; n < 50200; n++)
+        {
+            EXPECT_EQ(output[n + length / 2], gr_complex(0.0, 0.0)) << "Sample " << n;
+        }
+}
+
+
+TEST(FusedConditionerTest, ThrowsIfItemTypeUnknown)
+{
+    const std::vector<float> taps(11, 0.1);
+    EXPECT_THROW({ make_fused_conditioner("cfloat", taps, 0.0, 4000000.0, 1, false, false, 0.04, 32, 12500, 5000000); }, std::invalid_argument);
+}
@@ -25,7 +25,7 @@
 #else
 #include <gnuradio/analog/sig_source_c.h>
 #endif
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "file_signal_source.h"
 #include "fir_filter.h"
 #include "gnss_block_factory.h"
@@ -46,7 +46,7 @@ class FirFilterTest : public ::testing::Test
 protected:
     FirFilterTest()
     {
-        queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+        queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
         item_size = sizeof(gr_complex);
         config = std::make_shared<InMemoryConfiguration>();
     }
@@ -57,7 +57,7 @@ protected:
     void configure_cbyte_gr_complex();
     void configure_gr_complex_gr_complex();
     void configure_cshort_cshort();
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue;
     gr::top_block_sptr top_block;
     std::shared_ptr<InMemoryConfiguration> config;
     size_t item_size;
@@ -0,0 +1,88 @@
+/*!
+ * \file pfb_channelizer_test.cc
+ * \brief This file implements unit tests for the pfb_channelizer_cc custom block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "pfb_channelizer_cc.h"
+#include <gnuradio/filter/firdes.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <complex>
+#include <cstdint>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+
+TEST(PfbChannelizerTest, MatchesMixFilterDecimate)
+{
+    const double sampling_freq = 4000000.0;
+    const int32_t n_channels = 4;
+    const std::vector<int32_t> channel_map{0, 3, 1};
+    const std::vector<float> taps = gr::filter::firdes::low_pass(1.0, sampling_freq, 500000.0, 100000.0);
+
+    std::vector<gr_complex> input(40000);
+    std::mt19937 generator(1);
+    std::uniform_real_distribution<float> distribution(-1.0, 1.0);
+    for (auto &sample : input)
+        {
+            sample = gr_complex(distribution(generator), distribution(generator));
+        }
+
+    auto top_block = gr::make_top_block("PfbChannelizerTest");
+    auto source = gr::blocks::vector_source_c::make(input);
+    auto channelizer = make_pfb_channelizer_cc(n_channels, taps, channel_map);
+    std::vector<gr::blocks::vector_sink_c::sptr> sinks;
+    top_block->connect(source, 0, channelizer, 0);
+    for (size_t j = 0; j < channel_map.size(); j++)
+        {
+            sinks.push_back(gr::blocks::vector_sink_c::make());
+            top_block->connect(channelizer, j, sinks.back(), 0);
+        }
+    top_block->run();
+
+    // Shift channel k to zero Hz, filter and keep the last sample of each block of n_channels
+    for (size_t j = 0; j < channel_map.size(); j++)
+        {
+            const std::vector<gr_complex> output = sinks[j]->data();
+            ASSERT_EQ(output.size(), input.size() / n_channels);
+            const double w = TWO_PI * channel_map[j] / n_channels;
+            for (size_t m = 0; m < output.size(); m++)
+                {
+                    const size_t n = m * n_channels + n_channels - 1;
+                    std::complex<double> expected(0.0, 0.0);
+                    for (size_t k = 0; k < taps.size() and k <= n; k++)
+                        {
+                            expected += static_cast<double>(taps[k]) * std::complex<double>(input[n - k]) * std::polar(1.0, -w * static_cast<double>(n - k));
+                        }
+                    EXPECT_NEAR(output[m].real(), expected.real(), 1e-4);
+                    EXPECT_NEAR(output[m].imag(), expected.imag(), 1e-4);
+                }
+        }
+}
+
+
+TEST(PfbChannelizerTest, ThrowsIfChannelOutOfRange)
+{
+    const std::vector<float> taps(16, 0.1);
+    EXPECT_THROW({ make_pfb_channelizer_cc(4, taps, {4}); }, std::invalid_argument);
+}
@@ -0,0 +1,93 @@
+/*!
+ * \file pulse_blanking_cc_test.cc
+ * \brief This file implements unit tests for the pulse_blanking_cc custom block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pulse_blanking_cc.h"
+#include <gnuradio/blocks/message_debug.h>
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <pmt/pmt.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#include <gnuradio/blocks/vector_source.h>
+#else
+#include <gnuradio/blocks/vector_sink_c.h>
+#include <gnuradio/blocks/vector_source_c.h>
+#endif
+
+
+TEST(PulseBlankingCcTest, BlanksPulses)
+{
+    const int32_t length = 32;
+    const int32_t n_segments_est = 100;
+    std::vector<gr_complex> input(200000);
+    std::mt19937 generator(1);
+    std::normal_distribution<float> distribution(0.0, 1.0);
+    for (auto &sample : input)
+        {
+            sample = gr_complex(distribution(generator), distribution(generator));
+        }
+
+    // Pulses of 14 samples after the noise estimation
+    std::vector<bool> pulse(input.size(), false);
+    for (size_t start = 10000; start + 14 < input.size(); start += 3000)
+        {
+            for (size_t i = start; i < start + 14; i++)
+                {
+                    input[i] += gr_complex(20.0, 0.0);
+                    pulse[i] = true;
+                }
+        }
+
+    auto top_block = gr::make_top_block("PulseBlankingCcTest");
+    auto source = gr::blocks::vector_source_c::make(input);
+    auto pulse_blanking = make_pulse_blanking_cc(0.04, length, n_segments_est, 5000000);
+    auto sink = gr::blocks::vector_sink_c::make();
+    auto statistics = gr::blocks::message_debug::make();
+    top_block->connect(source, 0, pulse_blanking, 0);
+    top_block->connect(pulse_blanking, 0, sink, 0);
+    top_block->msg_connect(pulse_blanking, pmt::mp("interference"), statistics, pmt::mp("store"));
+    top_block->run();
+
+    // The last length / 2 samples are not delivered, their window is not complete
+    const std::vector<gr_complex> output = sink->data();
+    ASSERT_EQ(output.size(), input.size() - length / 2);
+    size_t blanked_noise = 0;
+    for (size_t i = 0; i < output.size(); i++)
+        {
+            if (pulse[i])
+                {
+                    EXPECT_EQ(output[i], gr_complex(0.0, 0.0));
+                }
+            else if (output[i] == gr_complex(0.0, 0.0))
+                {
+                    blanked_noise++;
+                }
+            else
+                {
+                    EXPECT_EQ(output[i], input[i]);
+                }
+        }
+    EXPECT_LT(blanked_noise, output.size() / 10);
+
+    ASSERT_GT(statistics->num_messages(), 0);
+    const pmt::pmt_t percentage = pmt::dict_ref(statistics->get_message(statistics->num_messages() - 1), pmt::mp("blanked_percentage"), pmt::PMT_NIL);
+    ASSERT_TRUE(pmt::is_real(percentage));
+    EXPECT_GT(pmt::to_double(percentage), 0.0);
+    EXPECT_LT(pmt::to_double(percentage), 15.0);
+}
@@ -26,7 +26,7 @@
 #else
 #include <gnuradio/analog/sig_source_c.h>
 #endif
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "file_signal_source.h"
 #include "gnss_block_factory.h"
 #include "gnss_block_interface.h"
@@ -45,7 +45,7 @@ class PulseBlankingFilterTest : public ::testing::Test
 protected:
     PulseBlankingFilterTest()
     {
-        queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+        queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
         item_size = sizeof(gr_complex);
         config = std::make_shared<InMemoryConfiguration>();
         nsamples = FLAGS_pb_filter_test_nsamples;
@@ -59,7 +59,7 @@ protected:
     void stop_queue();
     void init();
     void configure_gr_complex_gr_complex();
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue;
     gr::top_block_sptr top_block;
     std::shared_ptr<InMemoryConfiguration> config;
     size_t item_size;
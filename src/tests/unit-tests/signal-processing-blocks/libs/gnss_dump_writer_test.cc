@@ -0,0 +1,127 @@
+/*!
+ * \file gnss_dump_writer_test.cc
+ * \brief This file implements unit tests for the Gnss_Dump_Writer class.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_dump_writer.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+#pragma pack(push, 1)
+struct Test_Dump_Record
+{
+    float a;
+    uint64_t b;
+    double c;
+    int32_t d;
+};
+#pragma pack(pop)
+static_assert(sizeof(Test_Dump_Record) == 24, "Unexpected padding");
+
+
+std::vector<char> read_file(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+}  // namespace
+
+
+TEST(GnssDumpWriterTest, SameContentsAsOfstream)
+{
+    const std::string filename = "gnss_dump_writer_test.dat";
+    const std::string reference_filename = "gnss_dump_writer_test_ref.dat";
+    {
+        Gnss_Dump_Writer writer;
+        ASSERT_TRUE(writer.open(filename, 1000, 2));  // batches do not hold whole records
+        std::ofstream reference(reference_filename, std::ios::out | std::ios::binary);
+        for (int32_t i = 0; i < 10000; i++)
+            {
+                const Test_Dump_Record record{static_cast<float>(i) * 0.5F, static_cast<uint64_t>(i) << 33U, i * 1e-3, -i};
+                writer.write(record);
+                reference.write(reinterpret_cast<const char*>(&record), sizeof(record));
+                const double extra = i;
+                writer.write(extra);
+                reference.write(reinterpret_cast<const char*>(&extra), sizeof(extra));
+            }
+        EXPECT_EQ(writer.bytes_written(), 10000U * (sizeof(Test_Dump_Record) + sizeof(double)));
+        EXPECT_FALSE(writer.failed());
+    }  // the destructor flushes and closes the file
+    const std::vector<char> contents = read_file(filename);
+    EXPECT_EQ(contents.size(), 10000U * (sizeof(Test_Dump_Record) + sizeof(double)));
+    EXPECT_TRUE(contents == read_file(reference_filename));
+    std::remove(filename.c_str());
+    std::remove(reference_filename.c_str());
+}
+
+
+TEST(GnssDumpWriterTest, ConcurrentWriters)
+{
+    const int num_writers = 8;
+    const int num_records = 20000;
+    std::vector<std::thread> threads;
+    for (int w = 0; w < num_writers; w++)
+        {
+            threads.emplace_back([w]() {
+                Gnss_Dump_Writer writer;
+                ASSERT_TRUE(writer.open("gnss_dump_writer_test_" + std::to_string(w) + ".dat", 4096));
+                for (int32_t i = 0; i < num_records; i++)
+                    {
+                        writer.write(w * num_records + i);
+                    }
+                writer.close();
+                EXPECT_FALSE(writer.is_open());
+            });
+        }
+    for (auto& thread : threads)
+        {
+            thread.join();
+        }
+    for (int w = 0; w < num_writers; w++)
+        {
+            const std::string filename = "gnss_dump_writer_test_" + std::to_string(w) + ".dat";
+            const std::vector<char> contents = read_file(filename);
+            ASSERT_EQ(contents.size(), num_records * sizeof(int32_t));
+            const auto* values = reinterpret_cast<const int32_t*>(contents.data());
+            for (int32_t i = 0; i < num_records; i++)
+                {
+                    ASSERT_EQ(values[i], w * num_records + i);
+                }
+            std::remove(filename.c_str());
+        }
+}
+
+
+TEST(GnssDumpWriterTest, FlushAndOpenErrors)
+{
+    Gnss_Dump_Writer writer;
+    EXPECT_FALSE(writer.open("/nonexistent_directory/dump.dat"));
+    EXPECT_FALSE(writer.is_open());
+    writer.write(1.0);  // ignored
+
+    const std::string filename = "gnss_dump_writer_test_flush.dat";
+    ASSERT_TRUE(writer.open(filename));
+    writer.write(1.0);
+    writer.flush();
+    EXPECT_EQ(read_file(filename).size(), sizeof(double));
+    writer.close();
+    std::remove(filename.c_str());
+}
@@ -67,6 +67,7 @@
 #include <cmath>
 #include <exception>
 #include <pthread.h>
+#include <thread>
 #include <unistd.h>
 #include <utility>
 #if HAS_GENERIC_LAMBDA
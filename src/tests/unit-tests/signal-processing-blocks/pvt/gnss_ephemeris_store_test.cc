@@ -0,0 +1,103 @@
+/*!
+ * \file gnss_ephemeris_store_test.cc
+ * \brief This file implements tests for Gnss_Ephemeris_Store
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_ephemeris_store.h"
+#include "gps_ephemeris.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <map>
+#include <memory>
+
+
+TEST(GnssEphemerisStoreTest, FindAndReplace)
+{
+    Gnss_Ephemeris_Store<Gps_Ephemeris, 32> store;
+    EXPECT_TRUE(store.empty());
+    EXPECT_EQ(store.find(5), nullptr);
+
+    Gps_Ephemeris eph;
+    eph.PRN = 5;
+    eph.toe = 1000;
+    EXPECT_TRUE(store.set(5, eph));
+    eph.PRN = 32;
+    EXPECT_TRUE(store.set(32, eph));
+    EXPECT_FALSE(store.set(0, eph));
+    EXPECT_FALSE(store.set(33, eph));
+    EXPECT_EQ(store.size(), 2U);
+    EXPECT_EQ(store.version(), 2U);
+
+    ASSERT_NE(store.find(5), nullptr);
+    EXPECT_EQ(store.find(5)->PRN, 5U);
+    EXPECT_EQ(store.find(5)->toe, 1000);
+    EXPECT_EQ(store.find(6), nullptr);
+    EXPECT_EQ(store.find(-1), nullptr);
+    EXPECT_EQ(store.find(33), nullptr);
+
+    const uint64_t version_5 = store.version(5);
+    const uint64_t version_32 = store.version(32);
+    EXPECT_NE(version_5, 0U);
+    EXPECT_NE(version_5, version_32);
+    EXPECT_EQ(store.version(6), 0U);
+
+    eph.PRN = 5;
+    eph.toe = 2000;
+    EXPECT_TRUE(store.set(5, eph));
+    EXPECT_EQ(store.size(), 2U);
+    EXPECT_EQ(store.find(5)->toe, 2000);
+    EXPECT_NE(store.version(5), version_5);
+    EXPECT_EQ(store.version(32), version_32);
+
+    EXPECT_TRUE(store.erase(32));
+    EXPECT_FALSE(store.erase(32));
+    EXPECT_EQ(store.find(32), nullptr);
+    EXPECT_EQ(store.size(), 1U);
+
+    EXPECT_NE(store.version(32), version_32);
+
+    const uint64_t version_before_clear = store.version(5);
+    store.clear();
+    EXPECT_TRUE(store.empty());
+    EXPECT_EQ(store.find(5), nullptr);
+    EXPECT_NE(store.version(5), version_before_clear);
+}
+
+
+TEST(GnssEphemerisStoreTest, SnapshotsAreNotModified)
+{
+    Gnss_Ephemeris_Store<Gps_Ephemeris, 32> store;
+    Gps_Ephemeris eph;
+    eph.PRN = 1;
+    eph.toe = 1000;
+    store.set(1, eph);
+
+    const std::shared_ptr<const std::map<int, Gps_Ephemeris>> snapshot = store.snapshot();
+    EXPECT_EQ(&store.map(), snapshot.get());
+
+    eph.toe = 2000;
+    store.set(1, eph);
+    eph.PRN = 2;
+    store.set(2, eph);
+    store.erase(1);
+
+    ASSERT_EQ(snapshot->size(), 1U);
+    EXPECT_EQ(snapshot->at(1).toe, 1000);
+    ASSERT_EQ(store.map().size(), 1U);
+    EXPECT_EQ(store.map().cbegin()->first, 2);
+    EXPECT_EQ(store.snapshot()->at(2).toe, 2000);
+
+    store.clear();
+    EXPECT_EQ(snapshot->size(), 1U);
+    EXPECT_TRUE(store.snapshot()->empty());
+}
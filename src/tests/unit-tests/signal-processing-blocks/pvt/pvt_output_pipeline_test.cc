@@ -0,0 +1,138 @@
+/*!
+ * \file pvt_output_pipeline_test.cc
+ * \brief This file implements tests for Pvt_Output_Pipeline
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "pvt_output_pipeline.h"
+#include "rtklib.h"
+#include "rtklib_solver.h"
+#include <gtest/gtest.h>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+
+TEST(PvtOutputPipelineTest, DropsWhenFullAndKeepsOrder)
+{
+    const rtk_t rtk{};
+    Rtklib_Solver solver(rtk, 12, std::string(), false, false);
+    const std::map<int, Gnss_Synchro> observables;
+    std::vector<double> written;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool released = false;
+    {
+        Pvt_Output_Pipeline pipeline(rtk, 12, 4);
+        pipeline.add_sink(1U, "test", [&](const Pvt_Output& output) {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] { return released; });
+            written.push_back(output.rx_time);
+        });
+
+        // The sink is blocked, so only the four snapshots of the pool can be queued
+        for (int i = 0; i < 4; i++)
+            {
+                EXPECT_TRUE(pipeline.push(solver, observables, static_cast<double>(i), false, 1U));
+            }
+        EXPECT_FALSE(pipeline.push(solver, observables, 4.0, false, 1U));
+        const Pvt_Output_Pipeline::Counters counters = pipeline.counters(1U);
+        EXPECT_EQ(counters.dropped, 1U);
+        EXPECT_EQ(counters.written, 0U);
+        EXPECT_GE(counters.max_lag, 3U);
+
+        // Epochs for sinks that do not exist are not queued
+        EXPECT_EQ(pipeline.counters(2U).dropped, 0U);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            released = true;
+        }
+        cv.notify_all();
+    }  // The destructor writes all the queued epochs
+
+    const std::vector<double> expected = {0.0, 1.0, 2.0, 3.0};
+    EXPECT_EQ(written, expected);
+}
+
+
+TEST(PvtOutputPipelineTest, TasksRunInOrderWithEpochs)
+{
+    const rtk_t rtk{};
+    Rtklib_Solver solver(rtk, 12, std::string(), false, false);
+    const std::map<int, Gnss_Synchro> observables;
+    std::vector<std::string> events;
+    {
+        Pvt_Output_Pipeline pipeline(rtk, 12, 8);
+        pipeline.add_sink(1U, "test", [&](const Pvt_Output& output) {
+            events.push_back(std::string("epoch ") + std::to_string(static_cast<int>(output.rx_time)));
+        });
+        pipeline.push(solver, observables, 1.0, false, 1U);
+        pipeline.post(1U, [&]() { events.emplace_back("task"); });
+        pipeline.push(solver, observables, 2.0, false, 1U);
+    }
+
+    const std::vector<std::string> expected = {"epoch 1", "task", "epoch 2"};
+    EXPECT_EQ(events, expected);
+}
+
+
+TEST(PvtOutputPipelineTest, StalledSinkDoesNotDropOtherSinks)
+{
+    const rtk_t rtk{};
+    Rtklib_Solver solver(rtk, 12, std::string(), false, false);
+    const std::map<int, Gnss_Synchro> observables;
+    std::vector<double> stalled_written;
+    std::vector<double> written;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool released = false;
+    {
+        Pvt_Output_Pipeline pipeline(rtk, 12, 4);
+        pipeline.add_sink(1U, "stalled", [&](const Pvt_Output& output) {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&] { return released; });
+            stalled_written.push_back(output.rx_time);
+        });
+        pipeline.add_sink(2U, "fast", [&](const Pvt_Output& output) {
+            std::lock_guard<std::mutex> lock(mutex);
+            written.push_back(output.rx_time);
+            cv.notify_all();
+        });
+
+        for (int i = 0; i < 20; i++)
+            {
+                // Only the stalled sink drops epochs
+                EXPECT_EQ(pipeline.push(solver, observables, static_cast<double>(i), false, 3U), i < 4);
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&] { return written.size() == static_cast<size_t>(i + 1); });
+            }
+        EXPECT_EQ(pipeline.counters(1U).dropped, 16U);
+        EXPECT_EQ(pipeline.counters(2U).dropped, 0U);
+        EXPECT_EQ(pipeline.counters(2U).written, 20U);
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            released = true;
+        }
+        cv.notify_all();
+    }
+
+    std::vector<double> expected;
+    for (int i = 0; i < 20; i++)
+        {
+            expected.push_back(static_cast<double>(i));
+        }
+    EXPECT_EQ(written, expected);
+    expected.resize(4);
+    EXPECT_EQ(stalled_written, expected);
+}
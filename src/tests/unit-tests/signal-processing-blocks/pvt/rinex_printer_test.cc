@@ -18,8 +18,13 @@
 #include "rinex_printer.h"
 #include "rtklib_rtkpos.h"
 #include "rtklib_solver.h"
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <fstream>
+#include <iterator>
 #include <string>
+#include <vector>
 
 
 class RinexPrinterTest : public ::testing::Test
@@ -139,12 +144,68 @@ void RinexPrinterTest::conf()
 }
 
 
+namespace
+{
+std::string rinex_printer_test_contents(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+
+// Splits the contents of a RINEX file into its header lines (up to END OF
+// HEADER) and the records that follow them
+std::vector<std::string> rinex_printer_test_header(const std::string& contents, std::string& records)
+{
+    std::vector<std::string> header;
+    size_t pos = 0;
+    while (pos < contents.size())
+        {
+            const size_t end = contents.find('\n', pos);
+            header.push_back(contents.substr(pos, end - pos));
+            pos = (end == std::string::npos) ? contents.size() : end + 1;
+            if (header.back().find("END OF HEADER", 59) != std::string::npos)
+                {
+                    break;
+                }
+        }
+    records = contents.substr(pos);
+    return header;
+}
+
+
+// Replaces the header line whose label is found in line, if any
+void rinex_printer_test_replace(std::vector<std::string>& header, const std::string& line)
+{
+    for (auto& header_line : header)
+        {
+            if (header_line.compare(0, 4, line, 0, 4) == 0 && header_line.compare(60, std::string::npos, line, 60, std::string::npos) == 0)
+                {
+                    header_line = line;
+                }
+        }
+}
+
+
+std::string rinex_printer_test_join(const std::vector<std::string>& header, const std::string& records)
+{
+    std::string contents;
+    for (const auto& line : header)
+        {
+            contents += line;
+            contents += '\n';
+        }
+    return contents + records;
+}
+}  // namespace
+
+
 TEST_F(RinexPrinterTest, GalileoObsHeader)
 {
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
     auto eph = Galileo_Ephemeris();
     eph.PRN = 1;
-    pvt_solution->galileo_ephemeris_map[1] = eph;
+    pvt_solution->galileo_ephemeris_map.set(1, eph);
 
     std::map<int, Gnss_Synchro> gnss_observables_map;
     Gnss_Synchro gs{};
@@ -230,7 +291,7 @@ TEST_F(RinexPrinterTest, GlonassObsHeader)
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
     auto eph = Glonass_Gnav_Ephemeris();
     eph.PRN = 1;
-    pvt_solution->glonass_gnav_ephemeris_map[1] = eph;
+    pvt_solution->glonass_gnav_ephemeris_map.set(1, eph);
 
     std::map<int, Gnss_Synchro> gnss_observables_map;
     Gnss_Synchro gs{};
@@ -288,9 +349,9 @@ TEST_F(RinexPrinterTest, MixedObsHeader)
     eph_gal.PRN = 1;
     eph_gps.PRN = 1;
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
-    pvt_solution->galileo_ephemeris_map[1] = eph_gal;
+    pvt_solution->galileo_ephemeris_map.set(1, eph_gal);
 
-    pvt_solution->gps_ephemeris_map[1] = eph_gps;
+    pvt_solution->gps_ephemeris_map.set(1, eph_gps);
 
     std::map<int, Gnss_Synchro> gnss_observables_map;
     Gnss_Synchro gs{};
@@ -358,9 +419,9 @@ TEST_F(RinexPrinterTest, MixedObsHeaderGpsGlo)
     eph_glo.PRN = 1;
     eph_gps.PRN = 1;
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
-    pvt_solution->glonass_gnav_ephemeris_map[1] = eph_glo;
+    pvt_solution->glonass_gnav_ephemeris_map.set(1, eph_glo);
 
-    pvt_solution->gps_ephemeris_map[1] = eph_gps;
+    pvt_solution->gps_ephemeris_map.set(1, eph_gps);
 
     std::map<int, Gnss_Synchro> gnss_observables_map;
     Gnss_Synchro gs{};
@@ -425,7 +486,7 @@ TEST_F(RinexPrinterTest, GalileoObsLog)
     auto eph = Galileo_Ephemeris();
     eph.PRN = 1;
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
-    pvt_solution->galileo_ephemeris_map[1] = eph;
+    pvt_solution->galileo_ephemeris_map.set(1, eph);
     std::map<int, Gnss_Synchro> gnss_observables_map;
 
     Gnss_Synchro gs1 = Gnss_Synchro();
@@ -505,7 +566,7 @@ TEST_F(RinexPrinterTest, GlonassObsLog)
     auto eph = Glonass_Gnav_Ephemeris();
     eph.PRN = 22;
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
-    pvt_solution->glonass_gnav_ephemeris_map[1] = eph;
+    pvt_solution->glonass_gnav_ephemeris_map.set(1, eph);
     std::map<int, Gnss_Synchro> gnss_observables_map;
 
     Gnss_Synchro gs1 = Gnss_Synchro();
@@ -587,8 +648,8 @@ TEST_F(RinexPrinterTest, GpsObsLogDualBand)
     eph.PRN = 1;
     eph_cnav.PRN = 1;
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
-    pvt_solution->gps_ephemeris_map[1] = eph;
-    pvt_solution->gps_cnav_ephemeris_map[1] = eph_cnav;
+    pvt_solution->gps_ephemeris_map.set(1, eph);
+    pvt_solution->gps_cnav_ephemeris_map.set(1, eph_cnav);
     std::map<int, Gnss_Synchro> gnss_observables_map;
 
     Gnss_Synchro gs1 = Gnss_Synchro();
@@ -677,7 +738,7 @@ TEST_F(RinexPrinterTest, GalileoObsLogDualBand)
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
     auto eph = Galileo_Ephemeris();
     eph.PRN = 1;
-    pvt_solution->galileo_ephemeris_map[1] = eph;
+    pvt_solution->galileo_ephemeris_map.set(1, eph);
 
     std::map<int, Gnss_Synchro> gnss_observables_map;
     Gnss_Synchro gs1 = Gnss_Synchro();
@@ -775,8 +836,8 @@ TEST_F(RinexPrinterTest, MixedObsLog)
     eph_gps.PRN = 1;
     eph_gal.PRN = 1;
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
-    pvt_solution->gps_ephemeris_map[1] = eph_gps;
-    pvt_solution->galileo_ephemeris_map[1] = eph_gal;
+    pvt_solution->gps_ephemeris_map.set(1, eph_gps);
+    pvt_solution->galileo_ephemeris_map.set(1, eph_gal);
     std::map<int, Gnss_Synchro> gnss_observables_map;
 
     Gnss_Synchro gs1 = Gnss_Synchro();
@@ -899,8 +960,8 @@ TEST_F(RinexPrinterTest, MixedObsLogGpsGlo)
     eph_gps.PRN = 1;
     eph_glo.PRN = 1;
     auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
-    pvt_solution->gps_ephemeris_map[1] = eph_gps;
-    pvt_solution->glonass_gnav_ephemeris_map[1] = eph_glo;
+    pvt_solution->gps_ephemeris_map.set(1, eph_gps);
+    pvt_solution->glonass_gnav_ephemeris_map.set(1, eph_glo);
     std::map<int, Gnss_Synchro> gnss_observables_map;
 
     Gnss_Synchro gs1 = Gnss_Synchro();
@@ -1010,3 +1071,114 @@ TEST_F(RinexPrinterTest, MixedObsLogGpsGlo)
     fs::remove(navfile);
     fs::remove(obsfile);
 }
+
+
+TEST_F(RinexPrinterTest, GpsHeaderUpdate)
+{
+    auto eph = Gps_Ephemeris();
+    eph.PRN = 1;
+
+    Gnss_Synchro gs{};
+    gs.System = 'G';
+    std::memcpy(static_cast<void*>(gs.Signal), "1C", 3);
+    gs.PRN = 1;
+    gs.Pseudorange_m = 22000000.0;
+    gs.Carrier_phase_rads = 23.4;
+    gs.Carrier_Doppler_hz = 1534.0;
+    gs.CN0_dB_hz = 42.0;
+    std::map<int, Gnss_Synchro> gnss_observables_map;
+    gnss_observables_map[1] = gs;
+
+    Gps_Utc_Model utc_model;
+    utc_model.A0 = 1.5e-9;
+    utc_model.A1 = 2.5e-15;
+    utc_model.tot = 61440;
+    utc_model.WN_T = 137;
+    utc_model.DeltaT_LS = 18;
+    utc_model.DeltaT_LSF = 18;
+    utc_model.WN_LSF = 1929;
+    utc_model.DN = 7;
+    Gps_Iono iono;
+    iono.alpha0 = 1.5e-8;
+    iono.beta0 = 2.5e5;
+
+    // The same three epochs are written twice: without UTC data, and with UTC
+    // data from the second epoch on, so that the headers are updated between
+    // the second and the third epochs
+    const std::array<std::string, 2> paths{"./rinex_header_update_test_reference", "./rinex_header_update_test_updated"};
+    std::array<std::string, 2> obsfiles;
+    std::array<std::string, 2> navfiles;
+    for (size_t i = 0; i < paths.size(); i++)
+        {
+            auto pvt_solution = std::make_shared<Rtklib_Solver>(rtk, 12, "filename", false, false);
+            pvt_solution->gps_ephemeris_map.set(1, eph);
+            auto rp = std::make_shared<Rinex_Printer>(3, paths[i]);
+            for (int epoch = 0; epoch < 3; epoch++)
+                {
+                    if (i == 1 && epoch == 1)
+                        {
+                            pvt_solution->gps_utc_model = utc_model;
+                            pvt_solution->gps_iono = iono;
+                        }
+                    rp->print_rinex_annotation(pvt_solution.get(), gnss_observables_map, static_cast<double>(epoch), 1, true);
+                }
+            obsfiles[i] = rp->get_obsfilename();
+            navfiles[i] = rp->get_navfilename()[0];
+            rp = nullptr;  // close the RINEX files so we can inspect them
+        }
+
+    const std::string leap_seconds("    18    18  1929     7                                    LEAP SECONDS        ");
+    const std::string reserved_comment(std::string(60, ' ') + "COMMENT             ");
+
+    // Observation file: the LEAP SECONDS line takes the place of the reserved
+    // COMMENT line, and the records are not changed
+    std::string records;
+    std::string updated_records;
+    std::vector<std::string> expected = rinex_printer_test_header(rinex_printer_test_contents(obsfiles[0]), records);
+    const std::vector<std::string> updated = rinex_printer_test_header(rinex_printer_test_contents(obsfiles[1]), updated_records);
+    ASSERT_EQ(std::count(expected.begin(), expected.end(), reserved_comment), 1);
+    expected.erase(std::find(expected.begin(), expected.end(), reserved_comment));
+    for (auto it = expected.begin(); it != expected.end(); ++it)
+        {
+            if (it->find("TIME OF FIRST OBS", 59) != std::string::npos)
+                {
+                    expected.insert(it + 1, leap_seconds);
+                    break;
+                }
+        }
+    ASSERT_EQ(expected.size(), updated.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        {
+            if (expected[i].find("PGM / RUN BY / DATE", 59) != std::string::npos)
+                {
+                    expected[i] = updated[i];  // the files were not created at the same time
+                }
+        }
+    EXPECT_EQ(std::count(records.begin(), records.end(), '>'), 3);
+    EXPECT_EQ(rinex_printer_test_join(expected, records), rinex_printer_test_contents(obsfiles[1]));
+
+    // Navigation file: the header lines are replaced in place, the reserved
+    // COMMENT line is kept, and the ephemeris record is not changed
+    expected = rinex_printer_test_header(rinex_printer_test_contents(navfiles[0]), records);
+    const std::vector<std::string> updated_nav = rinex_printer_test_header(rinex_printer_test_contents(navfiles[1]), updated_records);
+    ASSERT_EQ(expected.size(), updated_nav.size());
+    EXPECT_EQ(std::count(expected.begin(), expected.end(), reserved_comment), 1);
+    rinex_printer_test_replace(expected, "GPSA    .1500D-07   .0000D+00   .0000D+00   .0000D+00       IONOSPHERIC CORR    ");
+    rinex_printer_test_replace(expected, "GPSB    .2500D+06   .0000D+00   .0000D+00   .0000D+00       IONOSPHERIC CORR    ");
+    rinex_printer_test_replace(expected, "GPUT   .1500000000D-08  .250000000D-14  61440 2185          TIME SYSTEM CORR    ");
+    rinex_printer_test_replace(expected, leap_seconds);
+    for (size_t i = 0; i < expected.size(); i++)
+        {
+            if (expected[i].find("PGM / RUN BY / DATE", 59) != std::string::npos)
+                {
+                    expected[i] = updated_nav[i];
+                }
+        }
+    EXPECT_FALSE(records.empty());
+    EXPECT_EQ(rinex_printer_test_join(expected, records), rinex_printer_test_contents(navfiles[1]));
+
+    for (const auto& path : paths)
+        {
+            fs::remove_all(path);
+        }
+}
@@ -0,0 +1,320 @@
+/*!
+ * \file rtklib_batch_solver_test.cc
+ * \brief This file implements tests for Rtklib_Batch_Solver
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "MATH_CONSTANTS.h"
+#include "gnss_synchro.h"
+#include "gps_ephemeris.h"
+#include "rtklib.h"
+#include "rtklib_batch_solver.h"
+#include "rtklib_conversions.h"
+#include "rtklib_ephemeris.h"
+#include "rtklib_rtkcmn.h"
+#include "rtklib_rtkpos.h"
+#include "rtklib_solver.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+
+namespace
+{
+constexpr int32_t BATCH_TEST_WEEK = 2200;
+constexpr double BATCH_TEST_TOE = 345600.0;
+
+
+rtk_t batch_test_rtk(int tropopt = TROPOPT_OFF)
+{
+    prcopt_t opt{};
+    opt.mode = PMODE_SINGLE;
+    opt.soltype = 0;
+    opt.nf = 1;
+    opt.navsys = SYS_GPS;
+    opt.elmin = 10.0 * D2R;
+    opt.sateph = EPHOPT_BRDC;
+    opt.ionoopt = IONOOPT_OFF;
+    opt.tropopt = tropopt;
+    opt.eratio[0] = 100.0;
+    opt.err[0] = 100.0;
+    opt.err[1] = 0.003;
+    opt.err[2] = 0.003;
+    opt.err[4] = 1.0;
+    opt.maxgdop = 30.0;
+    rtk_t rtk{};
+    rtkinit(&rtk, &opt);
+    return rtk;
+}
+
+
+// Six orbital planes with four satellites each, as in the GPS constellation
+std::map<int, Gps_Ephemeris> batch_test_ephemerides()
+{
+    std::map<int, Gps_Ephemeris> ephemerides;
+    for (int prn = 1; prn <= 24; prn++)
+        {
+            Gps_Ephemeris eph;
+            eph.PRN = prn;
+            eph.WN = BATCH_TEST_WEEK;
+            eph.tow = static_cast<int32_t>(BATCH_TEST_TOE);
+            eph.toe = static_cast<int32_t>(BATCH_TEST_TOE);
+            eph.toc = static_cast<int32_t>(BATCH_TEST_TOE);
+            eph.sqrtA = 5153.6;
+            eph.ecc = 0.005;
+            eph.i_0 = 55.0 * D2R;
+            eph.OMEGA_0 = ((prn - 1) / 4) * GNSS_PI / 3.0;
+            eph.M_0 = ((prn - 1) % 4) * GNSS_PI / 2.0 + ((prn - 1) / 4) * GNSS_PI / 12.0;
+            eph.OMEGAdot = -8.0e-9;
+            eph.af0 = 1.0e-5 * (prn % 5);
+            ephemerides[prn] = eph;
+        }
+    return ephemerides;
+}
+
+
+// Observables of the satellites above 15 degrees of a receiver at rr, whose
+// clock is dtr seconds ahead, at GPS time of week rx_time
+std::map<int, Gnss_Synchro> batch_test_epoch(const std::map<int, Gps_Ephemeris>& ephemerides, const double* rr, double dtr, double rx_time)
+{
+    std::map<int, Gnss_Synchro> epoch;
+    std::array<double, 3> pos{};
+    ecef2pos(rr, pos.data());
+    const gtime_t t_rx = gpst2time(BATCH_TEST_WEEK, rx_time - dtr);
+    int channel = 0;
+    for (const auto& item : ephemerides)
+        {
+            const eph_t eph = eph_to_rtklib(item.second, false);
+            std::array<double, 6> rs{};
+            std::array<double, 3> e{};
+            std::array<double, 2> azel{};
+            double dts = 0.0;
+            double var = 0.0;
+            double range = 2.0e7;
+            for (int iter = 0; iter < 5; iter++)
+                {
+                    eph2pos(timeadd(t_rx, -range / SPEED_OF_LIGHT_M_S), &eph, rs.data(), &dts, &var);
+                    range = geodist(rs.data(), rr, e.data());
+                }
+            if (satazel(pos.data(), e.data(), azel.data()) < 15.0 * D2R)
+                {
+                    continue;
+                }
+            Gnss_Synchro obs{};
+            obs.System = 'G';
+            std::memcpy(static_cast<void*>(obs.Signal), "1C", 3);
+            obs.PRN = item.first;
+            obs.Channel_ID = channel;
+            obs.CN0_dB_hz = 45.0;
+            obs.Pseudorange_m = range + SPEED_OF_LIGHT_M_S * (dtr - dts);
+            obs.RX_time = rx_time;
+            obs.TOW_at_current_symbol_ms = static_cast<uint32_t>(std::round(rx_time * 1000.0));
+            obs.Flag_valid_pseudorange = true;
+            epoch[channel] = obs;
+            channel++;
+        }
+    return epoch;
+}
+
+
+// Size of a record of the PVT dump, as written by Rtklib_Solver::dump_solution()
+constexpr size_t BATCH_TEST_DUMP_RECORD_BYTES = 2 * 4 + 17 * 8 + 3 + 2 * 4 + 4 * 8;
+
+
+double batch_test_dump_double(const char* record, size_t offset)
+{
+    double value;
+    std::memcpy(&value, record + offset, sizeof(double));
+    return value;
+}
+
+
+std::string batch_test_file_contents(const std::string& filename)
+{
+    std::ifstream file(filename, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+}  // namespace
+
+
+TEST(RtklibBatchSolverTest, SameFixesAsSequentialSolver)
+{
+    const rtk_t rtk = batch_test_rtk();
+    const std::string sequential_dump = "./rtklib_batch_solver_test_sequential.dat";
+    const std::string batch_dump = "./rtklib_batch_solver_test_batch.dat";
+    const std::map<int, Gps_Ephemeris> ephemerides = batch_test_ephemerides();
+
+    // Receiver moving along the x axis, with a drifting clock
+    std::vector<std::map<int, Gnss_Synchro>> epochs;
+    const std::array<double, 3> rr0{4789000.0, 176000.0, 4195000.0};
+    for (int i = 0; i < 10; i++)
+        {
+            const std::array<double, 3> rr{rr0[0] + 10.0 * i, rr0[1], rr0[2]};
+            epochs.push_back(batch_test_epoch(ephemerides, rr.data(), 1.0e-4 + 1.0e-7 * i, BATCH_TEST_TOE + 600.0 + 0.1 * i));
+            ASSERT_GE(epochs.back().size(), 5U);
+        }
+
+    std::vector<bool> sequential_valid;
+    std::vector<std::array<double, 4>> sequential_fixes;
+    {
+        Rtklib_Solver sequential(rtk, 12, sequential_dump, true, false);
+        sequential.set_averaging_depth(1);
+        for (const auto& eph : ephemerides)
+            {
+                sequential.gps_ephemeris_map.set(eph.first, eph.second);
+            }
+        for (const auto& epoch : epochs)
+            {
+                sequential_valid.push_back(sequential.get_PVT(epoch, false));
+                sequential_fixes.push_back({sequential.get_latitude(), sequential.get_longitude(), sequential.get_height(), sequential.get_time_offset_s()});
+            }
+    }
+
+    // As the PVT block does: the main solver holds the ephemerides and the
+    // dump file, and the batch solvers write their fixes through it
+    std::array<double, 3> latest_fix{};
+    bool latest_valid = false;
+    {
+        Rtklib_Solver main_solver(rtk, 12, batch_dump, true, false);
+        main_solver.set_averaging_depth(1);
+        for (const auto& eph : ephemerides)
+            {
+                main_solver.gps_ephemeris_map.set(eph.first, eph.second);
+            }
+        Rtklib_Batch_Solver batch(rtk, 12, 4, false);
+        ASSERT_EQ(batch.max_epochs(), 4U);
+        size_t next = 0;
+        while (next < epochs.size())
+            {
+                const size_t end = std::min(next + batch.max_epochs(), epochs.size());
+                const std::vector<std::map<int, Gnss_Synchro>> batch_epochs(epochs.begin() + next, epochs.begin() + end);
+                batch.update_navigation_data(main_solver);
+                batch.solve(batch_epochs);
+                for (size_t i = 0; i < batch_epochs.size(); i++)
+                    {
+                        const Rtklib_Solver* solver = batch.solver(i);
+                        EXPECT_EQ(batch.is_valid(i), sequential_valid[next + i]) << "Epoch " << next + i;
+                        EXPECT_NEAR(solver->get_latitude(), sequential_fixes[next + i][0], 1e-9) << "Epoch " << next + i;
+                        EXPECT_NEAR(solver->get_longitude(), sequential_fixes[next + i][1], 1e-9) << "Epoch " << next + i;
+                        EXPECT_NEAR(solver->get_height(), sequential_fixes[next + i][2], 1e-4) << "Epoch " << next + i;
+                        EXPECT_NEAR(solver->get_time_offset_s(), sequential_fixes[next + i][3], 1e-12) << "Epoch " << next + i;
+                        if (batch.is_valid(i))
+                            {
+                                main_solver.dump_solution(*solver);
+                            }
+                    }
+                main_solver.copy_solution(*batch.solver(batch_epochs.size() - 1));
+                next = end;
+            }
+        latest_valid = main_solver.is_valid_position();
+        latest_fix = {main_solver.get_latitude(), main_solver.get_longitude(), main_solver.get_height()};
+    }
+
+    for (bool valid : sequential_valid)
+        {
+            EXPECT_TRUE(valid);
+        }
+
+    // The main solver reports the last fix, as get_latest_PVT() needs
+    EXPECT_TRUE(latest_valid);
+    EXPECT_NEAR(latest_fix[0], sequential_fixes.back()[0], 1e-9);
+    EXPECT_NEAR(latest_fix[1], sequential_fixes.back()[1], 1e-9);
+    EXPECT_NEAR(latest_fix[2], sequential_fixes.back()[2], 1e-4);
+
+    // Both modes write the same PVT dump records. The fixes of an epoch
+    // can differ in the last bits, since the iterations of each solver start
+    // from its own previous fix.
+    const std::string sequential_contents = batch_test_file_contents(sequential_dump);
+    const std::string batch_contents = batch_test_file_contents(batch_dump);
+    ASSERT_EQ(sequential_contents.size(), epochs.size() * BATCH_TEST_DUMP_RECORD_BYTES);
+    ASSERT_EQ(batch_contents.size(), sequential_contents.size());
+    for (size_t i = 0; i < epochs.size(); i++)
+        {
+            const char* expected = sequential_contents.data() + i * BATCH_TEST_DUMP_RECORD_BYTES;
+            const char* actual = batch_contents.data() + i * BATCH_TEST_DUMP_RECORD_BYTES;
+            // TOW, week and RX time
+            EXPECT_EQ(std::memcmp(actual, expected, 16), 0) << "Record " << i;
+            // Number of satellites, solution status and type
+            EXPECT_EQ(std::memcmp(actual + 144, expected + 144, 3), 0) << "Record " << i;
+            // Latitude, longitude and height
+            EXPECT_NEAR(batch_test_dump_double(actual, 120), batch_test_dump_double(expected, 120), 1e-9) << "Record " << i;
+            EXPECT_NEAR(batch_test_dump_double(actual, 128), batch_test_dump_double(expected, 128), 1e-9) << "Record " << i;
+            EXPECT_NEAR(batch_test_dump_double(actual, 136), batch_test_dump_double(expected, 136), 1e-4) << "Record " << i;
+        }
+    std::remove(sequential_dump.c_str());
+    std::remove(batch_dump.c_str());
+}
+
+
+TEST(RtklibBatchSolverTest, SameFixesWithSbasTroposphere)
+{
+    // The SBAS tropospheric model caches the zenith delays of the last
+    // position, so concurrent epochs must not share that cache
+    const rtk_t rtk = batch_test_rtk(TROPOPT_SBAS);
+    const std::map<int, Gps_Ephemeris> ephemerides = batch_test_ephemerides();
+
+    // Receivers far apart, so that each epoch needs its own zenith delays
+    std::vector<std::map<int, Gnss_Synchro>> epochs;
+    const std::array<std::array<double, 3>, 4> positions{{{4789000.0, 176000.0, 4195000.0},
+        {-2700000.0, -4300000.0, 3850000.0},
+        {1130000.0, -4830000.0, 3990000.0},
+        {-4050000.0, 4210000.0, -2540000.0}}};
+    for (int i = 0; i < 40; i++)
+        {
+            epochs.push_back(batch_test_epoch(ephemerides, positions[i % positions.size()].data(), 1.0e-4, BATCH_TEST_TOE + 600.0 + 0.1 * i));
+            ASSERT_GE(epochs.back().size(), 5U);
+        }
+
+    // Each epoch solved from scratch by a single solver
+    std::vector<std::array<double, 3>> expected_fixes;
+    for (const auto& epoch : epochs)
+        {
+            Rtklib_Solver solver(rtk, 12, std::string(), false, false);
+            solver.set_averaging_depth(1);
+            for (const auto& eph : ephemerides)
+                {
+                    solver.gps_ephemeris_map.set(eph.first, eph.second);
+                }
+            ASSERT_TRUE(solver.get_PVT(epoch, false));
+            expected_fixes.push_back({solver.get_latitude(), solver.get_longitude(), solver.get_height()});
+        }
+
+    Rtklib_Solver main_solver(rtk, 12, std::string(), false, false);
+    for (const auto& eph : ephemerides)
+        {
+            main_solver.gps_ephemeris_map.set(eph.first, eph.second);
+        }
+    Rtklib_Batch_Solver batch(rtk, 12, 4, false);
+    for (size_t next = 0; next < epochs.size(); next += batch.max_epochs())
+        {
+            const size_t end = std::min(next + batch.max_epochs(), epochs.size());
+            const std::vector<std::map<int, Gnss_Synchro>> batch_epochs(epochs.begin() + next, epochs.begin() + end);
+            batch.update_navigation_data(main_solver);
+            batch.solve(batch_epochs);
+            for (size_t i = 0; i < batch_epochs.size(); i++)
+                {
+                    const Rtklib_Solver* solver = batch.solver(i);
+                    ASSERT_TRUE(batch.is_valid(i)) << "Epoch " << next + i;
+                    EXPECT_NEAR(solver->get_latitude(), expected_fixes[next + i][0], 1e-9) << "Epoch " << next + i;
+                    EXPECT_NEAR(solver->get_longitude(), expected_fixes[next + i][1], 1e-9) << "Epoch " << next + i;
+                    EXPECT_NEAR(solver->get_height(), expected_fixes[next + i][2], 1e-4) << "Epoch " << next + i;
+                }
+        }
+}
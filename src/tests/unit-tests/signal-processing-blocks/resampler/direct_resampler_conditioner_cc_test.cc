@@ -25,7 +25,7 @@
 #else
 #include <gnuradio/analog/sig_source_c.h>
 #endif
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "direct_resampler_conditioner_cc.h"
 #include "gnss_sdr_valve.h"
 #include <gnuradio/blocks/null_sink.h>
@@ -38,7 +38,7 @@ TEST(DirectResamplerConditionerCcTest, InstantiationAndRunTest)
     std::chrono::time_point<std::chrono::system_clock> start, end;
     std::chrono::duration<double> elapsed_seconds(0);
     int nsamples = 1000000;  // Number of samples to be computed
-    auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    auto queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
     auto top_block = gr::make_top_block("direct_resampler_conditioner_cc_test");
     auto source = gr::analog::sig_source_c::make(fs_in, gr::analog::GR_SIN_WAVE, 1000.0, 1.0, gr_complex(0.0));
     auto valve = gnss_sdr_make_valve(sizeof(gr_complex), nsamples, queue.get());
@@ -24,14 +24,14 @@
 #else
 #include <gnuradio/analog/sig_source_f.h>
 #endif
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "gnss_sdr_valve.h"
 #include <gnuradio/blocks/null_sink.h>
 #include <pmt/pmt.h>
 
 TEST(ValveTest, CheckEventSentAfter100Samples)
 {
-    auto queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    auto queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
 
     auto top_block = gr::make_top_block("gnss_sdr_valve_test");
 
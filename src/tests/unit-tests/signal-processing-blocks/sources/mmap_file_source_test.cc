@@ -0,0 +1,69 @@
+/*!
+ * \file mmap_file_source_test.cc
+ * \brief This file implements unit tests for the mmap_file_source custom block.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_sdr_filesystem.h"
+#include "mmap_file_source.h"
+#include <gnuradio/top_block.h>
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifdef GR_GREATER_38
+#include <gnuradio/blocks/vector_sink.h>
+#else
+#include <gnuradio/blocks/vector_sink_s.h>
+#endif
+
+
+TEST(MmapFileSourceTest, ReadsFromSeekPosition)
+{
+    const std::string filename = "./mmap_file_source_test.dat";
+    std::vector<int16_t> samples(100000);
+    for (size_t i = 0; i < samples.size(); i++)
+        {
+            samples[i] = static_cast<int16_t>(i * 7);
+        }
+    {
+        std::ofstream file(filename, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(samples.data()), samples.size() * sizeof(int16_t));
+        file.put(1);  // incomplete item, not read
+    }
+
+    auto top_block = gr::make_top_block("MmapFileSourceTest");
+    auto source = make_mmap_file_source(sizeof(int16_t), filename, false);
+    EXPECT_EQ(source->items(), samples.size());
+    EXPECT_FALSE(source->seek(samples.size()));
+    EXPECT_TRUE(source->seek(1000));
+    auto sink = gr::blocks::vector_sink_s::make();
+
+    top_block->connect(source, 0, sink, 0);
+    top_block->run();
+    top_block->stop();
+
+    const std::vector<int16_t> expected(samples.begin() + 1000, samples.end());
+    EXPECT_EQ(sink->data(), expected);
+
+    errorlib::error_code ec;
+    fs::remove(fs::path(filename), ec);
+}
+
+
+TEST(MmapFileSourceTest, ThrowsIfFileNotExists)
+{
+    EXPECT_THROW({ make_mmap_file_source(sizeof(int16_t), "./signal_samples/i_dont_exist.dat", false); }, std::runtime_error);
+}
@@ -0,0 +1,110 @@
+/*!
+ * \file irnss_l5_subframe_decoder_test.cc
+ * \brief Tests for the de-interleaving and Viterbi decoding of the IRNSS L5
+ * SPS subframes.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "IRNSS_at_1.h"
+#include "convolutional.h"
+#include "irnss_l5_subframe_decoder.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+constexpr int32_t IRNSS_TEST_FRAME_SYMBOLS = IRNSS_L5_SUBFRAME_BITS - IRNSS_L5_PREAMBLE_LENGTH_BITS;
+constexpr int32_t IRNSS_TEST_DATA_BITS = IRNSS_TEST_FRAME_SYMBOLS / 2 - 6;
+
+// Encodes, applies the NOT gate in G2 and interleaves the data bits, as the
+// satellite does. Ones are mapped to +1 and zeros to -1.
+std::vector<float> encode_irnss_subframe(const std::vector<int32_t>& bits)
+{
+    const std::array<int32_t, 2> g_encoder{{121, 91}};
+    std::vector<float> encoded;
+    int32_t state = 0;
+    for (int32_t t = 0; t < IRNSS_TEST_DATA_BITS + 6; t++)
+        {
+            const int32_t input = t < IRNSS_TEST_DATA_BITS ? bits[t] : 0;
+            int32_t next_state = 0;
+            const int32_t out = nsc_enc_bit(&next_state, input, state, g_encoder.data(), 7, 2);
+            state = next_state;
+            encoded.push_back(((out >> 1) & 1) ? 1.0F : -1.0F);
+            encoded.push_back((out & 1) ? -1.0F : 1.0F);  // NOT gate
+        }
+    std::vector<float> symbols(IRNSS_TEST_FRAME_SYMBOLS);
+    for (int32_t r = 0; r < IRNSS_NAV_INTERLEAVER_ROWS; r++)
+        {
+            for (int32_t c = 0; c < IRNSS_NAV_INTERLEAVER_COLS; c++)
+                {
+                    symbols[r * IRNSS_NAV_INTERLEAVER_COLS + c] = encoded[c * IRNSS_NAV_INTERLEAVER_ROWS + r];
+                }
+        }
+    return symbols;
+}
+
+
+std::vector<int32_t> random_subframe_bits(uint32_t seed)
+{
+    std::mt19937 gen(seed);
+    std::uniform_int_distribution<int32_t> dist(0, 1);
+    std::vector<int32_t> bits(IRNSS_TEST_DATA_BITS);
+    for (auto& b : bits)
+        {
+            b = dist(gen);
+        }
+    return bits;
+}
+
+
+int32_t count_errors(const std::vector<int32_t>& bits, const std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS>& words)
+{
+    int32_t errors = 0;
+    for (int32_t i = 0; i < IRNSS_L5_DATAFRAME_WORDS * 64; i++)
+        {
+            const int32_t expected = i < IRNSS_TEST_DATA_BITS ? bits[i] : 0;
+            const auto decoded = static_cast<int32_t>((words[i / 64] >> (63 - (i % 64))) & 1ULL);
+            errors += (decoded != expected) ? 1 : 0;
+        }
+    return errors;
+}
+}  // namespace
+
+
+TEST(IrnssL5SubframeDecoderTest, CleanSymbols)
+{
+    Irnss_L5_Subframe_Decoder decoder;
+    for (uint32_t seed : {1U, 2U, 3U})
+        {
+            const std::vector<int32_t> bits = random_subframe_bits(seed);
+            const std::vector<float> symbols = encode_irnss_subframe(bits);
+            EXPECT_EQ(count_errors(bits, decoder.decode(symbols.data())), 0) << "seed " << seed;
+        }
+}
+
+
+TEST(IrnssL5SubframeDecoderTest, WrongSymbols)
+{
+    // A burst of wrong symbols is spread by the interleaver and corrected
+    const std::vector<int32_t> bits = random_subframe_bits(2022);
+    std::vector<float> symbols = encode_irnss_subframe(bits);
+    for (int32_t i = 100; i < 108; i++)
+        {
+            symbols[i] = -symbols[i];
+        }
+    Irnss_L5_Subframe_Decoder decoder;
+    EXPECT_EQ(count_errors(bits, decoder.decode(symbols.data())), 0);
+}
@@ -0,0 +1,154 @@
+/*!
+ * \file viterbi_k7_r2_decoder_test.cc
+ * \brief Tests for the K=7, rate 1/2 soft-decision Viterbi decoder.
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "convolutional.h"
+#include "viterbi_k7_r2_decoder.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+constexpr int32_t VITERBI_TEST_KK = 7;
+constexpr int32_t VITERBI_TEST_NN = 2;
+constexpr int32_t VITERBI_TEST_DATA_BITS = 486;  // Galileo CNAV page, the longest block decoded
+
+// Encodes bits followed by the zero tail, mapping ones to +1 and zeros to -1
+std::vector<float> encode_k7_r2(const std::vector<int32_t>& bits, std::array<int32_t, 2> g_encoder)
+{
+    std::vector<float> symbols;
+    int32_t state = 0;
+    const auto num_bits = static_cast<int32_t>(bits.size());
+    for (int32_t t = 0; t < num_bits + VITERBI_TEST_KK - 1; t++)
+        {
+            const int32_t input = t < num_bits ? bits[t] : 0;
+            int32_t next_state = 0;
+            const int32_t out = nsc_enc_bit(&next_state, input, state, g_encoder.data(), VITERBI_TEST_KK, VITERBI_TEST_NN);
+            state = next_state;
+            symbols.push_back(((out >> 1) & 1) ? 1.0F : -1.0F);
+            symbols.push_back((out & 1) ? 1.0F : -1.0F);
+        }
+    return symbols;
+}
+
+
+std::vector<int32_t> random_bits(std::mt19937& gen, int32_t num_bits)
+{
+    std::uniform_int_distribution<int32_t> dist(0, 1);
+    std::vector<int32_t> bits(num_bits);
+    for (auto& b : bits)
+        {
+            b = dist(gen);
+        }
+    return bits;
+}
+
+
+int32_t count_errors(const std::vector<int32_t>& a, const std::vector<int32_t>& b)
+{
+    int32_t errors = 0;
+    for (size_t i = 0; i < a.size(); i++)
+        {
+            errors += (a[i] != b[i]) ? 1 : 0;
+        }
+    return errors;
+}
+
+
+// Reference decoder: Viterbi() with the tables built as in the telemetry decoders
+std::vector<int32_t> reference_decode(const std::vector<float>& symbols, std::array<int32_t, 2> g_encoder, int32_t num_bits)
+{
+    const int32_t states = 1 << (VITERBI_TEST_KK - 1);
+    std::vector<int32_t> out0(states);
+    std::vector<int32_t> out1(states);
+    std::vector<int32_t> state0(states);
+    std::vector<int32_t> state1(states);
+    nsc_transit(out0.data(), state0.data(), 0, g_encoder.data(), VITERBI_TEST_KK, VITERBI_TEST_NN);
+    nsc_transit(out1.data(), state1.data(), 1, g_encoder.data(), VITERBI_TEST_KK, VITERBI_TEST_NN);
+    std::vector<int32_t> bits(num_bits);
+    Viterbi(bits.data(), out0.data(), state0.data(), out1.data(), state1.data(), symbols.data(), VITERBI_TEST_KK, VITERBI_TEST_NN, num_bits);
+    return bits;
+}
+}  // namespace
+
+
+TEST(ViterbiK7R2DecoderTest, CleanSymbols)
+{
+    const std::array<int32_t, 2> g_encoder{{121, 91}};
+    std::mt19937 gen(1234);
+    Viterbi_K7_R2_Decoder decoder(g_encoder, VITERBI_TEST_DATA_BITS);
+    for (int32_t num_bits : {114, 238, 486})
+        {
+            const std::vector<int32_t> bits = random_bits(gen, num_bits);
+            const std::vector<float> symbols = encode_k7_r2(bits, g_encoder);
+            std::vector<int32_t> decoded(num_bits, -1);
+            decoder.decode(symbols.data(), decoded.data(), num_bits);
+            EXPECT_EQ(count_errors(bits, decoded), 0) << num_bits << " bits";
+            EXPECT_EQ(count_errors(bits, reference_decode(symbols, g_encoder, num_bits)), 0) << num_bits << " bits";
+        }
+}
+
+
+TEST(ViterbiK7R2DecoderTest, SecondPolynomialIsUsed)
+{
+    // With the G1 symbols erased, the bits can only be recovered from G2
+    const std::array<int32_t, 2> g_encoder{{121, 91}};
+    std::mt19937 gen(42);
+    const std::vector<int32_t> bits = random_bits(gen, VITERBI_TEST_DATA_BITS);
+    std::vector<float> symbols = encode_k7_r2(bits, g_encoder);
+    for (size_t i = 0; i < symbols.size(); i += 2)
+        {
+            symbols[i] = 0.0F;
+        }
+    Viterbi_K7_R2_Decoder decoder(g_encoder, VITERBI_TEST_DATA_BITS);
+    std::vector<int32_t> decoded(VITERBI_TEST_DATA_BITS, -1);
+    decoder.decode(symbols.data(), decoded.data(), VITERBI_TEST_DATA_BITS);
+    EXPECT_EQ(count_errors(bits, decoded), 0);
+    EXPECT_EQ(count_errors(bits, reference_decode(symbols, g_encoder, VITERBI_TEST_DATA_BITS)), 0);
+}
+
+
+TEST(ViterbiK7R2DecoderTest, NoisySymbols)
+{
+    // The 8-bit quantization must not degrade the error rate noticeably
+    // with respect to the floating-point decoder
+    const std::array<int32_t, 2> g_encoder{{121, 91}};
+    std::mt19937 gen(2022);
+    std::normal_distribution<float> noise(0.0F, 0.9F);
+    Viterbi_K7_R2_Decoder decoder(g_encoder, VITERBI_TEST_DATA_BITS);
+    int32_t errors = 0;
+    int32_t reference_errors = 0;
+    std::vector<int32_t> decoded(VITERBI_TEST_DATA_BITS);
+    for (int32_t block = 0; block < 200; block++)
+        {
+            const std::vector<int32_t> bits = random_bits(gen, VITERBI_TEST_DATA_BITS);
+            std::vector<float> symbols = encode_k7_r2(bits, g_encoder);
+            for (auto& s : symbols)
+                {
+                    s += noise(gen);
+                }
+            decoder.decode(symbols.data(), decoded.data(), VITERBI_TEST_DATA_BITS);
+            errors += count_errors(bits, decoded);
+            reference_errors += count_errors(bits, reference_decode(symbols, g_encoder, VITERBI_TEST_DATA_BITS));
+        }
+    EXPECT_GT(reference_errors, 0);
+    EXPECT_LE(errors, reference_errors + reference_errors / 10 + 10);
+    std::cout << "Bit errors: " << errors << " (8-bit), " << reference_errors << " (float) out of "
+              << 200 * VITERBI_TEST_DATA_BITS << " bits\n";
+}
@@ -17,7 +17,7 @@
  */
 
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "galileo_e5a_dll_pll_tracking.h"
 #include "gnss_block_factory.h"
 #include "gnss_block_interface.h"
@@ -55,7 +55,7 @@ protected:
 
     void init();
 
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue;
     gr::top_block_sptr top_block;
     std::shared_ptr<GNSSBlockFactory> factory;
     std::shared_ptr<InMemoryConfiguration> config;
@@ -96,7 +96,7 @@ TEST_F(GalileoE5aTrackingTest, ValidationOfResults)
     int fs_in = 32000000;
     int nsamples = 32000000 * 5;
     init();
-    queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
     top_block = gr::make_top_block("Tracking test");
 
     // Example using smart pointers and the block factory
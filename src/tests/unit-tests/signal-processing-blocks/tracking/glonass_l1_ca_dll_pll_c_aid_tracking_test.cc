@@ -17,7 +17,7 @@
  */
 
 
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "glonass_l1_ca_dll_pll_c_aid_tracking.h"
 #include "gnss_block_interface.h"
 #include "gnss_sdr_valve.h"
@@ -110,7 +110,7 @@ protected:
 
     void init();
 
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue;
     gr::top_block_sptr top_block;
     std::shared_ptr<InMemoryConfiguration> config;
     Gnss_Synchro gnss_synchro;
@@ -146,7 +146,7 @@ TEST_F(GlonassL1CaDllPllCAidTrackingTest, ValidationOfResults)
     int nsamples = fs_in * 4e-3 * 2;
 
     init();
-    queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
     top_block = gr::make_top_block("Tracking test");
     std::shared_ptr<TrackingInterface> tracking = std::make_shared<GlonassL1CaDllPllCAidTracking>(config.get(), "Tracking_1G", 1, 1);
     auto msg_rx = GlonassL1CaDllPllCAidTrackingTest_msg_rx_make();
@@ -24,7 +24,7 @@
 #include "Galileo_E1.h"
 #include "Galileo_E5a.h"
 #include "acquisition_msg_rx.h"
-#include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "galileo_e1_pcps_ambiguous_acquisition_fpga.h"
 #include "galileo_e5a_pcps_acquisition_fpga.h"
 #include "gnss_block_factory.h"
@@ -53,6 +53,7 @@
 #include <chrono>
 #include <cstdint>
 #include <pthread.h>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -377,7 +378,7 @@ public:
     Gnss_Synchro gnss_synchro;
     size_t item_size;
 
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue;
 
     static const int32_t TEST_TRK_PULL_IN_TEST_SKIP_SAMPLES = 1024;  // 48
     static constexpr float DMA_SIGNAL_SCALING_FACTOR = 8.0;
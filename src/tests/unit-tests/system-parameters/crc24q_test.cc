@@ -0,0 +1,90 @@
+/*!
+ * \file crc24q_test.cc
+ * \brief Tests for the table-driven CRC-24Q
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "crc24q.h"
+#include <boost/crc.hpp>
+#include <gtest/gtest.h>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+
+namespace
+{
+template <size_t N>
+void check_packed_words()
+{
+    std::mt19937 gen(4321);
+    std::uniform_int_distribution<int> bit_dist(0, 1);
+    for (int32_t trial = 0; trial < 100; trial++)
+        {
+            std::bitset<N> bits;
+            std::array<uint64_t, (N + 63) / 64> words{};
+            for (size_t i = 0; i < N; i++)
+                {
+                    // bits[N - 1] is the first transmitted bit
+                    if (bit_dist(gen) == 1)
+                        {
+                            bits[N - 1 - i] = true;
+                            words[i / 64] |= 1ULL << (63U - (i % 64));
+                        }
+                }
+            EXPECT_EQ(crc24q(words, N), crc24q(bits));
+        }
+}
+}  // namespace
+
+
+TEST(Crc24qTest, CheckValue)
+{
+    const std::array<uint8_t, 9> check = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    EXPECT_EQ(crc24q(check.data(), check.size()), 0xCDE703U);
+    EXPECT_EQ(crc24q_bytewise(check.data(), check.size()), 0xCDE703U);
+}
+
+
+TEST(Crc24qTest, SlicingBy8MatchesReference)
+{
+    std::mt19937 gen(1234);
+    std::uniform_int_distribution<int> byte_dist(0, 255);
+    for (size_t length = 0; length < 200; length++)
+        {
+            std::vector<uint8_t> bytes(length);
+            for (auto& byte : bytes)
+                {
+                    byte = static_cast<uint8_t>(byte_dist(gen));
+                }
+            boost::crc_optimal<24, 0x1864CFBU, 0x0, 0x0, false, false> reference;
+            reference.process_bytes(bytes.data(), bytes.size());
+            EXPECT_EQ(crc24q(bytes.data(), bytes.size()), reference.checksum());
+            EXPECT_EQ(crc24q_bytewise(bytes.data(), bytes.size()), reference.checksum());
+
+            // Incremental computation
+            const size_t split = length / 3;
+            EXPECT_EQ(crc24q(bytes.data() + split, length - split, crc24q(bytes.data(), split)), reference.checksum());
+        }
+}
+
+
+TEST(Crc24qTest, PackedWordsMatchBitset)
+{
+    // 196, 214 and 262 bits: Galileo I/NAV, F/NAV and IRNSS frames, not a whole number of bytes
+    check_packed_words<196>();
+    check_packed_words<214>();
+    check_packed_words<256>();
+    check_packed_words<262>();
+}
@@ -0,0 +1,65 @@
+/*!
+ * \file gnss_signal_id_test.cc
+ * \brief Tests for the conversion of signal codes into Gnss_Signal_Id
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "gnss_signal_id.h"
+#include "gnss_synchro.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+
+TEST(GnssSignalIdTest, KnownSignals)
+{
+    const std::vector<std::pair<std::string, Gnss_Signal_Id>> signals = {
+        {"G1C", Gnss_Signal_Id::GPS_1C},
+        {"G2S", Gnss_Signal_Id::GPS_2S},
+        {"GL5", Gnss_Signal_Id::GPS_L5},
+        {"S1C", Gnss_Signal_Id::SBAS_1C},
+        {"E1B", Gnss_Signal_Id::GAL_1B},
+        {"E5X", Gnss_Signal_Id::GAL_5X},
+        {"E7X", Gnss_Signal_Id::GAL_7X},
+        {"EE6", Gnss_Signal_Id::GAL_E6},
+        {"R1G", Gnss_Signal_Id::GLO_1G},
+        {"R2G", Gnss_Signal_Id::GLO_2G},
+        {"CB1", Gnss_Signal_Id::BDS_B1},
+        {"CB2", Gnss_Signal_Id::BDS_B2},
+        {"CB3", Gnss_Signal_Id::BDS_B3},
+        {"I1I", Gnss_Signal_Id::IRN_1I}};
+
+    std::set<Gnss_Signal_Id> ids;
+    for (const auto& signal : signals)
+        {
+            Gnss_Synchro gs{};
+            gs.System = signal.first[0];
+            std::memcpy(gs.Signal, signal.first.c_str() + 1, 2);
+            EXPECT_EQ(gs.signal_id(), signal.second) << signal.first;
+            ids.insert(gs.signal_id());
+        }
+    EXPECT_EQ(ids.size(), signals.size());
+    EXPECT_EQ(ids.size() + 1, static_cast<size_t>(Gnss_Signal_Id::NUM_SIGNAL_IDS));
+}
+
+
+TEST(GnssSignalIdTest, UnknownSignals)
+{
+    EXPECT_EQ(gnss_signal_id('G', "1B"), Gnss_Signal_Id::UNKNOWN);  // right code, wrong system
+    EXPECT_EQ(gnss_signal_id('E', "1C"), Gnss_Signal_Id::UNKNOWN);
+    EXPECT_EQ(gnss_signal_id('G', "\0\0"), Gnss_Signal_Id::UNKNOWN);
+    EXPECT_EQ(gnss_signal_id('X', "1C"), Gnss_Signal_Id::UNKNOWN);
+    EXPECT_EQ(Gnss_Synchro().signal_id(), Gnss_Signal_Id::UNKNOWN);
+}
@@ -0,0 +1,116 @@
+/*!
+ * \file irnss_navigation_message_test.cc
+ * \brief Tests for the decoding of the IRNSS NAV message
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "crc24q.h"
+#include "irnss_navigation_message.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <cstdint>
+#include <string>
+
+
+namespace
+{
+// Writes value in the length bits starting at the ICD bit position first (1-based)
+void set_irnss_field(std::string& subframe, int32_t first, int32_t length, uint64_t value)
+{
+    for (int32_t j = 0; j < length; j++)
+        {
+            subframe[first - 1 + j] = ((value >> (length - 1 - j)) & 1ULL) ? '1' : '0';
+        }
+}
+
+
+std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS> pack_irnss_subframe(const std::string& subframe)
+{
+    std::array<uint64_t, IRNSS_L5_DATAFRAME_WORDS> words{};
+    for (size_t i = 0; i < subframe.size(); i++)
+        {
+            if (subframe[i] == '1')
+                {
+                    words[i / 64] |= 1ULL << (63 - (i % 64));
+                }
+        }
+    return words;
+}
+
+
+// Fills the CRC field with the checksum of bits 1 to 262
+void set_irnss_crc(std::string& subframe)
+{
+    set_irnss_field(subframe, 263, 24, crc24q(pack_irnss_subframe(subframe), IRNSS_L5_CRC_DATA_BITS));
+}
+}  // namespace
+
+
+TEST(IrnssNavigationMessageTest, PackedSubframeDecoding)
+{
+    std::string subframe(IRNSS_L5_DATAFRAME_BITS, '0');
+    set_irnss_field(subframe, 9, 17, 12345);                   // TOW
+    set_irnss_field(subframe, 28, 2, 1);                       // subframe ID
+    set_irnss_field(subframe, 31, 32, 0xC0000001ULL);          // M_0 (negative)
+    set_irnss_field(subframe, 63, 16, 1800);                   // t_oe
+    set_irnss_field(subframe, 111, 32, 0xCB00F1A5ULL);         // sqrt(A), crosses a 64-bit word boundary
+    set_irnss_field(subframe, 207, 22, (1ULL << 22) - 1ULL);   // OMEGA_DOT = -1 LSB
+    set_irnss_crc(subframe);
+
+    Irnss_Navigation_Message from_string;
+    Irnss_Navigation_Message from_words;
+    std::string subframe_copy = subframe;
+    const int32_t id_string = from_string.subframe_decoder(subframe_copy);
+    const int32_t id_words = from_words.subframe_decoder(pack_irnss_subframe(subframe));
+
+    EXPECT_EQ(id_string, 1);
+    EXPECT_EQ(id_words, 1);
+    EXPECT_TRUE(from_words.get_flag_CRC_test());
+    EXPECT_EQ(from_words.d_TOW_SF1, 12345 * 6);
+    EXPECT_EQ(from_words.d_TOW, from_string.d_TOW);
+
+    subframe_copy = subframe;
+    set_irnss_field(subframe_copy, 28, 2, 2);
+    set_irnss_crc(subframe_copy);
+    std::string subframe_2 = subframe_copy;
+    EXPECT_EQ(from_string.subframe_decoder(subframe_copy), 2);
+    EXPECT_EQ(from_words.subframe_decoder(pack_irnss_subframe(subframe_2)), 2);
+
+    EXPECT_DOUBLE_EQ(from_words.d_M_0, static_cast<double>(static_cast<int32_t>(0xC0000001U)) * IRNSS_M_0_LSB);
+    EXPECT_EQ(from_words.d_Toe, 1800 * IRNSS_T_OE_LSB);
+    EXPECT_DOUBLE_EQ(from_words.d_sqrt_A, static_cast<double>(0xCB00F1A5U) * IRNSS_SQRT_A_LSB);
+    EXPECT_DOUBLE_EQ(from_words.d_OMEGA_DOT, -IRNSS_OMEGA_DOT_LSB);
+
+    EXPECT_EQ(from_words.d_M_0, from_string.d_M_0);
+    EXPECT_EQ(from_words.d_sqrt_A, from_string.d_sqrt_A);
+    EXPECT_EQ(from_words.d_OMEGA_DOT, from_string.d_OMEGA_DOT);
+}
+
+
+TEST(IrnssNavigationMessageTest, CrcFailureIsRejected)
+{
+    std::string subframe(IRNSS_L5_DATAFRAME_BITS, '0');
+    set_irnss_field(subframe, 9, 17, 12345);  // TOW
+    set_irnss_field(subframe, 28, 2, 1);      // subframe ID
+    set_irnss_crc(subframe);
+
+    Irnss_Navigation_Message nav;
+    EXPECT_EQ(nav.subframe_decoder(pack_irnss_subframe(subframe)), 1);
+    EXPECT_TRUE(nav.get_flag_CRC_test());
+
+    // A single bit error must be detected and the subframe discarded
+    subframe[100] = (subframe[100] == '1') ? '0' : '1';
+    Irnss_Navigation_Message corrupted;
+    EXPECT_EQ(corrupted.subframe_decoder(pack_irnss_subframe(subframe)), 0);
+    EXPECT_FALSE(corrupted.get_flag_CRC_test());
+    EXPECT_EQ(corrupted.d_TOW, 0);
+}
@@ -0,0 +1,77 @@
+/*!
+ * \file nav_message_field_test.cc
+ * \brief Tests for the extraction of navigation message fields from packed words
+ *
+ * -----------------------------------------------------------------------------
+ *
+ * GNSS-SDR is a Global Navigation Satellite System software-defined receiver.
+ * This file is part of GNSS-SDR.
+ *
+ * Copyright (C) 2010-2022  (see AUTHORS file for a list of contributors)
+ * SPDX-License-Identifier: GPL-3.0-or-later
+ *
+ * -----------------------------------------------------------------------------
+ */
+
+#include "nav_message_field.h"
+#include <gtest/gtest.h>
+#include <array>
+#include <bitset>
+#include <cstdint>
+#include <random>
+#include <string>
+
+
+TEST(NavMessageFieldTest, MatchesBitByBitExtraction)
+{
+    constexpr int32_t num_bits = 300;
+    std::mt19937 generator(17);
+    std::bernoulli_distribution coin(0.5);
+    std::string message(num_bits, '0');
+    std::array<uint64_t, 5> words{};
+    for (int32_t i = 0; i < num_bits; i++)
+        {
+            if (coin(generator))
+                {
+                    message[i] = '1';
+                    words[i / 64] |= 1ULL << (63 - (i % 64));
+                }
+        }
+    const std::bitset<num_bits> bits(message);
+
+    for (int32_t offset = 1; offset <= num_bits; offset++)
+        {
+            for (int32_t length = 1; length <= 64 && offset + length - 1 <= num_bits; length++)
+                {
+                    uint64_t expected = 0ULL;
+                    for (int32_t j = 0; j < length; j++)
+                        {
+                            expected = (expected << 1) | (bits[num_bits - offset - j] ? 1ULL : 0ULL);
+                        }
+                    int64_t expected_signed = static_cast<int64_t>(expected);
+                    if (length < 64 && bits[num_bits - offset])
+                        {
+                            expected_signed = static_cast<int64_t>(expected | ~((1ULL << length) - 1ULL));
+                        }
+                    const Nav_Message_Field field(offset, length);
+                    ASSERT_EQ(read_nav_field_unsigned(words, field), expected);
+                    ASSERT_EQ(read_nav_field_signed(words, field), expected_signed);
+                    ASSERT_EQ(read_nav_field_bool(words, field), bits[num_bits - offset]);
+                }
+        }
+}
+
+
+TEST(NavMessageFieldTest, ScaledValues)
+{
+    constexpr Nav_Message_Field unsigned_field(61, 8, 0.5);
+    constexpr Nav_Message_Field signed_field = signed_nav_field(61, 8, 0.5);
+    static_assert(signed_field.is_signed, "signed_nav_field must declare a signed field");
+
+    // 0xFE in ICD bits 61 to 68, across the boundary between the first two words
+    std::array<uint64_t, 2> words{{0xFULL, 0xE000000000000000ULL}};
+    EXPECT_EQ(read_nav_field_unsigned(words, unsigned_field), 254ULL);
+    EXPECT_DOUBLE_EQ(read_nav_field(words, unsigned_field), 127.0);
+    EXPECT_EQ(read_nav_field_signed(words, signed_field), -2LL);
+    EXPECT_DOUBLE_EQ(read_nav_field(words, signed_field), -1.0);
+}
@@ -22,6 +22,7 @@
 #include "GPS_L1_CA.h"  // for GPS_L1_CA_COD...
 #include "concurrent_map.h"
 #include "concurrent_queue.h"
+#include "concurrent_ring_queue.h"
 #include "configuration_interface.h"  // for Configuration...
 #include "file_configuration.h"
 #include "front_end_cal.h"
@@ -188,9 +189,9 @@ bool front_end_capture(const std::shared_ptr<ConfigurationInterface>& configurat
 
     gr::top_block_sptr top_block;
     GNSSBlockFactory block_factory;
-    std::shared_ptr<Concurrent_Queue<pmt::pmt_t>> queue;
+    std::shared_ptr<Concurrent_Ring_Queue<pmt::pmt_t>> queue;
 
-    queue = std::make_shared<Concurrent_Queue<pmt::pmt_t>>();
+    queue = std::make_shared<Concurrent_Ring_Queue<pmt::pmt_t>>();
     top_block = gr::make_top_block("Acquisition test");
 
     try